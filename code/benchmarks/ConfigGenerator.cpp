@@ -0,0 +1,315 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a generator for synthetic configuration files used by the benchmarks
+ */
+
+// Own header
+#include "ConfigGenerator.hpp"
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+namespace Benchmarks
+{
+
+/*!
+ * Writes the JSON Object to a file
+ *
+ * \param   rootObject  Root JSON Object
+ * \param   filePath    Path to the file
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+static bool writeJsonFile(const QJsonObject &rootObject, const QString &filePath)
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "Failed to open the file for writing:" << filePath;
+        return false;
+    }
+
+    const QByteArray contents = QJsonDocument(rootObject).toJson(QJsonDocument::Indented);
+
+    if (file.write(contents) != contents.size())
+    {
+        qWarning() << "Failed to write the file:" << filePath;
+        return false;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigGeneratorParameters::toJson() const
+{
+    return QJsonObject {
+        { QStringLiteral("width"),                  width },
+        { QStringLiteral("depth"),                  depth },
+        { QStringLiteral("include_count"),          includeCount },
+        { QStringLiteral("reference_density"),      referenceDensity },
+        { QStringLiteral("derived_chain_count"),    derivedChainCount },
+        { QStringLiteral("derived_chain_length"),   derivedChainLength }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigGenerator::ConfigGenerator(const ConfigGeneratorParameters &parameters)
+    : m_parameters(parameters)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigGeneratorParameters &ConfigGenerator::parameters() const
+{
+    return m_parameters;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigGenerator::generate(const QDir &outputDir) const
+{
+    if (!outputDir.exists())
+    {
+        qWarning() << "Output directory does not exist:" << outputDir.absolutePath();
+        return {};
+    }
+
+    for (int i = 0; i < m_parameters.includeCount; i++)
+    {
+        if (!writeJsonFile(generateIncludeConfig(i),
+                           outputDir.absoluteFilePath(includeFileName(i))))
+        {
+            return {};
+        }
+    }
+
+    const QString rootFilePath = outputDir.absoluteFilePath(rootFileName());
+
+    if (!writeJsonFile(generateRootConfig(), rootFilePath))
+    {
+        return {};
+    }
+
+    return rootFilePath;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigGenerator::generateRootConfig() const
+{
+    QJsonObject config;
+
+    // Shared trees are either included or (if there are no includes) stored inline so that the
+    // references always have a target
+    if (m_parameters.includeCount <= 0)
+    {
+        config.insert(QStringLiteral("shared_0"), generateTree(0, 0));
+    }
+
+    int leafIndex = 0;
+    double referenceAccumulator = 0.0;
+    config.insert(QStringLiteral("main"),
+                  generateMainTree(0, QString(), &leafIndex, &referenceAccumulator));
+
+    for (int i = 0; i < m_parameters.derivedChainCount; i++)
+    {
+        config.insert(QString("derived_%1").arg(i), generateDerivedChain(i));
+    }
+
+    QJsonArray includes;
+
+    for (int i = 0; i < m_parameters.includeCount; i++)
+    {
+        includes.append(QJsonObject {
+                            { QStringLiteral("type"), QStringLiteral("CppConfigFramework") },
+                            { QStringLiteral("file_path"), includeFileName(i) }
+                        });
+    }
+
+    return QJsonObject {
+        {
+            QStringLiteral("environment_variables"),
+            QJsonObject { { QStringLiteral("BENCHMARK_ROOT"), QStringLiteral("root") } }
+        },
+        { QStringLiteral("includes"), includes },
+        { QStringLiteral("config"), config }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigGenerator::generateIncludeConfig(const int index) const
+{
+    return QJsonObject {
+        {
+            QStringLiteral("environment_variables"),
+            QJsonObject { { QString("BENCHMARK_INCLUDE_%1").arg(index), QString::number(index) } }
+        },
+        {
+            QStringLiteral("config"),
+            QJsonObject { { QString("shared_%1").arg(index), generateTree(0, index) } }
+        }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigGenerator::rootFileName()
+{
+    return QStringLiteral("root.json");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigGenerator::includeFileName(const int index)
+{
+    return QString("include_%1.json").arg(index);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigGenerator::generateTree(const int level, const int seed) const
+{
+    QJsonObject tree;
+
+    for (int i = 0; i < m_parameters.width; i++)
+    {
+        if (level >= m_parameters.depth)
+        {
+            tree.insert(QString("value_%1").arg(i), seed + i);
+        }
+        else
+        {
+            tree.insert(QString("node_%1").arg(i), generateTree(level + 1, seed + i));
+        }
+    }
+
+    return tree;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigGenerator::generateMainTree(const int level,
+                                              const QString &relativePath,
+                                              int *leafIndex,
+                                              double *referenceAccumulator) const
+{
+    QJsonObject tree;
+
+    for (int i = 0; i < m_parameters.width; i++)
+    {
+        if (level < m_parameters.depth)
+        {
+            const QString name = QString("node_%1").arg(i);
+            const QString path = relativePath.isEmpty() ? name : (relativePath + '/' + name);
+
+            tree.insert(name, generateMainTree(level + 1, path, leafIndex, referenceAccumulator));
+            continue;
+        }
+
+        // Leaf node: accumulate the reference density so that the references are evenly spread
+        // over the tree
+        const QString name = QString("value_%1").arg(i);
+        *referenceAccumulator += m_parameters.referenceDensity;
+
+        if (*referenceAccumulator >= 1.0)
+        {
+            *referenceAccumulator -= 1.0;
+
+            const QString target = QString("/shared_%1/%2%3")
+                                   .arg(*leafIndex % sharedTreeCount())
+                                   .arg(relativePath.isEmpty() ? QString()
+                                                               : (relativePath + '/'))
+                                   .arg(name);
+            tree.insert('&' + name, target);
+        }
+        else
+        {
+            tree.insert(name, *leafIndex);
+        }
+
+        (*leafIndex)++;
+    }
+
+    return tree;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigGenerator::generateDerivedChain(const int chainIndex) const
+{
+    QJsonObject baseObject;
+
+    for (int i = 0; i < m_parameters.width; i++)
+    {
+        baseObject.insert(QString("value_%1").arg(i), i);
+    }
+
+    QJsonObject chain { { QStringLiteral("level_0"), baseObject } };
+
+    for (int i = 1; i <= m_parameters.derivedChainLength; i++)
+    {
+        const QString overrideName = QString("value_%1").arg(i % std::max(m_parameters.width, 1));
+
+        chain.insert(QString("&level_%1").arg(i),
+                     QJsonObject {
+                         {
+                             QStringLiteral("base"),
+                             QString("/derived_%1/level_%2").arg(chainIndex).arg(i - 1)
+                         },
+                         {
+                             QStringLiteral("config"),
+                             QJsonObject { { overrideName, i } }
+                         }
+                     });
+    }
+
+    return chain;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigGenerator::sharedTreeCount() const
+{
+    return std::max(m_parameters.includeCount, 1);
+}
+
+} // namespace Benchmarks
+} // namespace CppConfigFramework
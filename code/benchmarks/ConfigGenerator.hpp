@@ -0,0 +1,182 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a generator for synthetic configuration files used by the benchmarks
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QDir>
+#include <QtCore/QJsonObject>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+namespace Benchmarks
+{
+
+//! Holds the parameters that define the shape of the generated configuration
+struct ConfigGeneratorParameters
+{
+    //! Number of members in each Object node of the generated trees
+    int width = 10;
+
+    //! Number of Object node levels in the generated trees (leaf Value nodes are not counted)
+    int depth = 2;
+
+    //! Number of included configuration files (each one contains its own shared tree)
+    int includeCount = 4;
+
+    /*!
+     * Ratio (from 0.0 to 1.0) of the leaf nodes in the main tree that are NodeReference nodes
+     * pointing to the matching leaf node in one of the shared trees
+     */
+    double referenceDensity = 0.1;
+
+    //! Number of independent DerivedObject node chains
+    int derivedChainCount = 1;
+
+    //! Number of DerivedObject nodes in each chain (each one derives from the previous one)
+    int derivedChainLength = 5;
+
+    /*!
+     * Converts the parameters to a JSON Object
+     *
+     * \return  JSON Object
+     */
+    QJsonObject toJson() const;
+};
+
+//! This class generates synthetic configuration files
+class ConfigGenerator
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   parameters  Parameters of the configuration
+     */
+    ConfigGenerator(const ConfigGeneratorParameters &parameters);
+
+    /*!
+     * Gets the parameters of the configuration
+     *
+     * \return  Parameters of the configuration
+     */
+    const ConfigGeneratorParameters &parameters() const;
+
+    /*!
+     * Generates the root configuration file and all of its includes
+     *
+     * \param   outputDir   Directory where the configuration files shall be written to
+     *
+     * \return  Absolute path to the root configuration file or an empty string in case of failure
+     */
+    QString generate(const QDir &outputDir) const;
+
+    /*!
+     * Generates the contents of the root configuration file
+     *
+     * \return  Root JSON Object
+     */
+    QJsonObject generateRootConfig() const;
+
+    /*!
+     * Generates the contents of the included configuration file
+     *
+     * \param   index   Index of the included configuration file
+     *
+     * \return  Root JSON Object
+     */
+    QJsonObject generateIncludeConfig(const int index) const;
+
+    /*!
+     * Gets the file name of the root configuration file
+     *
+     * \return  File name
+     */
+    static QString rootFileName();
+
+    /*!
+     * Gets the file name of the included configuration file
+     *
+     * \param   index   Index of the included configuration file
+     *
+     * \return  File name
+     */
+    static QString includeFileName(const int index);
+
+private:
+    /*!
+     * Generates a tree of Object nodes with Value nodes as leaves
+     *
+     * \param   level   Current level in the tree
+     * \param   seed    Seed used for the generated values
+     *
+     * \return  JSON Object
+     */
+    QJsonObject generateTree(const int level, const int seed) const;
+
+    /*!
+     * Generates a tree of Object nodes where some of the leaves reference the shared trees
+     *
+     * \param   level           Current level in the tree
+     * \param   relativePath    Node path of the current node relative to the root of the tree
+     *
+     * \param[in,out]   leafIndex               Index of the next leaf node
+     * \param[in,out]   referenceAccumulator    Accumulator for the reference density
+     *
+     * \return  JSON Object
+     */
+    QJsonObject generateMainTree(const int level,
+                                 const QString &relativePath,
+                                 int *leafIndex,
+                                 double *referenceAccumulator) const;
+
+    /*!
+     * Generates a chain of DerivedObject nodes
+     *
+     * \param   chainIndex  Index of the chain
+     *
+     * \return  JSON Object
+     */
+    QJsonObject generateDerivedChain(const int chainIndex) const;
+
+    /*!
+     * Gets the number of shared trees (there is always at least one)
+     *
+     * \return  Number of shared trees
+     */
+    int sharedTreeCount() const;
+
+private:
+    //! Parameters of the configuration
+    ConfigGeneratorParameters m_parameters;
+};
+
+} // namespace Benchmarks
+} // namespace CppConfigFramework
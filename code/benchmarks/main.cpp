@@ -0,0 +1,616 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the benchmark application which measures the individual phases of reading, loading and
+ * writing of synthetic configurations and outputs the results in JSON format
+ */
+
+// C++ Config Framework includes
+#include "ConfigGenerator.hpp"
+#include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigFileCache.hpp>
+#include <CppConfigFramework/ConfigLoader.hpp>
+#include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include <CppConfigFramework/ConfigWriter.hpp>
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDebug>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QTemporaryDir>
+
+// System includes
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <numeric>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFramework::Benchmarks;
+
+//! Exposes the individual phases of the configuration reader
+class BenchmarkConfigReader : public ConfigReader
+{
+public:
+    using ConfigReaderBase::isFullyResolved;
+    using ConfigReaderBase::resolveReferences;
+    using ConfigReaderBase::transformConfig;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Loads all of the Value nodes of a configuration node (recursively)
+class BenchmarkConfig : public ConfigLoader
+{
+public:
+    //! Number of loaded Value nodes
+    int loadedValueCount = 0;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        for (const auto &member : config)
+        {
+            const QString &name = member.name();
+
+            if (member.node().isObject())
+            {
+                BenchmarkConfig subConfig;
+
+                if (!subConfig.loadConfig(name, config))
+                {
+                    return false;
+                }
+
+                loadedValueCount += subConfig.loadedValueCount;
+            }
+            else
+            {
+                int value = 0;
+
+                if (!loadRequiredConfigParameter(&value, name, config))
+                {
+                    return false;
+                }
+
+                loadedValueCount++;
+            }
+        }
+
+        return true;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Creates a deep copy of the Object node
+ *
+ * \param   node    Object node
+ *
+ * \return  Copy of the Object node
+ */
+static std::unique_ptr<ConfigObjectNode> cloneObject(const ConfigObjectNode &node)
+{
+    return std::make_unique<ConfigObjectNode>(std::move(node.clone()->toObject()));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Reads the generated 'config' member without resolving its references
+ *
+ * \param   jsonObject  JSON Object
+ *
+ * \return  Object node
+ *
+ * \note    Only the subset of the configuration file format that is produced by the generator is
+ *          supported. This is needed to be able to measure the reference resolution on its own.
+ */
+static std::unique_ptr<ConfigObjectNode> readUnresolvedObject(const QJsonObject &jsonObject)
+{
+    auto objectNode = std::make_unique<ConfigObjectNode>();
+
+    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    {
+        const QString &key = it.key();
+        const QJsonValue value = it.value();
+
+        if (!key.startsWith('&'))
+        {
+            if (value.isObject())
+            {
+                objectNode->setMember(key, readUnresolvedObject(value.toObject()));
+            }
+            else
+            {
+                objectNode->setMember(key, std::make_unique<ConfigValueNode>(value));
+            }
+            continue;
+        }
+
+        const QString name = key.mid(1);
+
+        if (value.isString())
+        {
+            objectNode->setMember(
+                        name,
+                        std::make_unique<ConfigNodeReference>(ConfigNodePath(value.toString())));
+        }
+        else
+        {
+            const QJsonObject derivedObject = value.toObject();
+            const auto overrides =
+                    readUnresolvedObject(derivedObject.value(QStringLiteral("config")).toObject());
+            const QString basePath = derivedObject.value(QStringLiteral("base")).toString();
+
+            objectNode->setMember(
+                        name,
+                        std::make_unique<ConfigDerivedObjectNode>(
+                            QList<ConfigNodePath> { ConfigNodePath(basePath) },
+                            *overrides));
+        }
+    }
+
+    return objectNode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Measures the specified benchmark phase
+ *
+ * \param   name        Name of the phase
+ * \param   iterations  Number of iterations
+ * \param   prepare     Function that is executed before each iteration (it is not measured)
+ * \param   run         Function that is measured
+ *
+ * \param[out]  ok  Set to false in case the measured function failed
+ *
+ * \return  Results of the measurement
+ */
+static QJsonObject measure(const QString &name,
+                           const int iterations,
+                           const std::function<void()> &prepare,
+                           const std::function<bool()> &run,
+                           bool *ok)
+{
+    std::vector<qint64> durations;
+    durations.reserve(static_cast<size_t>(iterations));
+
+    for (int i = 0; i < iterations; i++)
+    {
+        if (prepare)
+        {
+            prepare();
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        const bool result = run();
+        const qint64 duration = timer.nsecsElapsed();
+
+        if (!result)
+        {
+            qWarning() << "Benchmark phase failed:" << name;
+            *ok = false;
+            return {};
+        }
+
+        durations.push_back(duration);
+    }
+
+    std::sort(durations.begin(), durations.end());
+
+    constexpr double nsecsPerMsec = 1000000.0;
+    const double total = static_cast<double>(std::accumulate(durations.begin(),
+                                                             durations.end(),
+                                                             qint64(0)));
+
+    return QJsonObject {
+        { QStringLiteral("name"),       name },
+        { QStringLiteral("iterations"), iterations },
+        { QStringLiteral("min_ms"),     static_cast<double>(durations.front()) / nsecsPerMsec },
+        { QStringLiteral("median_ms"),  static_cast<double>(durations.at(durations.size() / 2U)) /
+                                        nsecsPerMsec },
+        { QStringLiteral("mean_ms"),    total / static_cast<double>(durations.size()) /
+                                        nsecsPerMsec },
+        { QStringLiteral("max_ms"),     static_cast<double>(durations.back()) / nsecsPerMsec }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Runs all of the benchmark phases on the generated configuration
+ *
+ * \param   rootFilePath    Path to the generated root configuration file
+ * \param   parameters      Parameters of the generated configuration
+ * \param   iterations      Number of iterations of each phase
+ *
+ * \param[out]  ok  Set to false in case the benchmark failed
+ *
+ * \return  Results of the benchmark
+ */
+static QJsonObject runBenchmarks(const QString &rootFilePath,
+                                 const ConfigGeneratorParameters &parameters,
+                                 const int iterations,
+                                 bool *ok)
+{
+    const QDir workingDir = QFileInfo(rootFilePath).absoluteDir();
+    const ConfigNodePath sourceNodePath(QStringLiteral("/main"));
+    const ConfigNodePath destinationNodePath(QStringLiteral("/benchmark/main"));
+
+    BenchmarkConfigReader reader;
+
+    QFile file(rootFilePath);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qWarning() << "Failed to open the generated configuration:" << rootFilePath;
+        *ok = false;
+        return {};
+    }
+
+    const QByteArray fileContents = file.readAll();
+    const QJsonObject rootObject = QJsonDocument::fromJson(fileContents).object();
+
+    QJsonObject includesOnlyObject = rootObject;
+    includesOnlyObject.insert(QStringLiteral("config"), QJsonValue::Null);
+
+    const auto unresolvedConfig =
+            readUnresolvedObject(rootObject.value(QStringLiteral("config")).toObject());
+
+    // Intermediate results that are passed between the phases
+    std::unique_ptr<ConfigObjectNode> includesConfig;
+    std::unique_ptr<ConfigObjectNode> resolvedConfig;
+    std::unique_ptr<ConfigObjectNode> completeConfig;
+    std::unique_ptr<ConfigObjectNode> workConfig;
+
+    QJsonArray phases;
+
+    // Parse
+    phases.append(measure(QStringLiteral("parse"), iterations, {}, [&]()
+    {
+        QJsonParseError error {};
+        const auto doc = QJsonDocument::fromJson(fileContents, &error);
+        return (error.error == QJsonParseError::NoError) && doc.isObject();
+    }, ok));
+
+    // Includes (only the 'environment_variables' and 'includes' members)
+    phases.append(measure(QStringLiteral("read_includes"), iterations, {}, [&]()
+    {
+        EnvironmentVariables environmentVariables;
+        includesConfig = reader.read(includesOnlyObject,
+                                     workingDir,
+                                     ConfigNodePath::ROOT_PATH,
+                                     ConfigNodePath::ROOT_PATH,
+                                     {},
+                                     &environmentVariables);
+        return static_cast<bool>(includesConfig);
+    }, ok));
+
+    if (!*ok)
+    {
+        return {};
+    }
+
+    // Reference resolution
+    phases.append(measure(QStringLiteral("resolve_references"), iterations, [&]()
+    {
+        resolvedConfig = cloneObject(*unresolvedConfig);
+    }, [&]()
+    {
+        return reader.resolveReferences({ includesConfig.get() }, resolvedConfig.get()) &&
+                BenchmarkConfigReader::isFullyResolved(*resolvedConfig);
+    }, ok));
+
+    if (!*ok)
+    {
+        return {};
+    }
+
+    // Apply
+    phases.append(measure(QStringLiteral("apply"), iterations, [&]()
+    {
+        completeConfig = cloneObject(*includesConfig);
+    }, [&]()
+    {
+        completeConfig->apply(*resolvedConfig);
+        return true;
+    }, ok));
+
+    // Transformation
+    phases.append(measure(QStringLiteral("transform_config"), iterations, [&]()
+    {
+        workConfig = cloneObject(*completeConfig);
+    }, [&]()
+    {
+        workConfig = BenchmarkConfigReader::transformConfig(std::move(workConfig),
+                                                            sourceNodePath,
+                                                            destinationNodePath);
+        return static_cast<bool>(workConfig);
+    }, ok));
+
+    // Complete read
+    phases.append(measure(QStringLiteral("read_total"), iterations, {}, [&]()
+    {
+        EnvironmentVariables environmentVariables;
+        workConfig = reader.read(rootFilePath,
+                                 workingDir,
+                                 ConfigNodePath::ROOT_PATH,
+                                 ConfigNodePath::ROOT_PATH,
+                                 {},
+                                 &environmentVariables);
+        return static_cast<bool>(workConfig) && (*workConfig == *completeConfig);
+    }, ok));
+
+    // Complete read with includes read in parallel
+    BenchmarkConfigReader parallelReader;
+    parallelReader.setParallelIncludesEnabled(true);
+
+    phases.append(measure(QStringLiteral("read_total_parallel_includes"), iterations, {}, [&]()
+    {
+        EnvironmentVariables environmentVariables;
+        workConfig = parallelReader.read(rootFilePath,
+                                         workingDir,
+                                         ConfigNodePath::ROOT_PATH,
+                                         ConfigNodePath::ROOT_PATH,
+                                         {},
+                                         &environmentVariables);
+        return static_cast<bool>(workConfig) && (*workConfig == *completeConfig);
+    }, ok));
+
+    // Complete read with the files parsed straight into nodes
+    BenchmarkConfigReader streamingReader;
+    streamingReader.setStreamingParsingEnabled(true);
+
+    phases.append(measure(QStringLiteral("read_total_streaming_parsing"), iterations, {}, [&]()
+    {
+        EnvironmentVariables environmentVariables;
+        workConfig = streamingReader.read(rootFilePath,
+                                          workingDir,
+                                          ConfigNodePath::ROOT_PATH,
+                                          ConfigNodePath::ROOT_PATH,
+                                          {},
+                                          &environmentVariables);
+        return static_cast<bool>(workConfig) && (*workConfig == *completeConfig);
+    }, ok));
+
+    // Complete read with the file cache (the cache is filled before the measurements)
+    auto *fileCache = ConfigFileCache::instance();
+    fileCache->setEnabled(true);
+    {
+        EnvironmentVariables environmentVariables;
+        reader.read(rootFilePath,
+                    workingDir,
+                    ConfigNodePath::ROOT_PATH,
+                    ConfigNodePath::ROOT_PATH,
+                    {},
+                    &environmentVariables);
+    }
+
+    phases.append(measure(QStringLiteral("read_total_cached"), iterations, {}, [&]()
+    {
+        EnvironmentVariables environmentVariables;
+        workConfig = reader.read(rootFilePath,
+                                 workingDir,
+                                 ConfigNodePath::ROOT_PATH,
+                                 ConfigNodePath::ROOT_PATH,
+                                 {},
+                                 &environmentVariables);
+        return static_cast<bool>(workConfig) && (*workConfig == *completeConfig);
+    }, ok));
+
+    fileCache->setEnabled(false);
+
+    // Loading
+    phases.append(measure(QStringLiteral("load_config"), iterations, {}, [&]()
+    {
+        BenchmarkConfig config;
+        return config.loadConfig(*completeConfig) && (config.loadedValueCount > 0);
+    }, ok));
+
+    // Writing
+    phases.append(measure(QStringLiteral("write_json_config"), iterations, {}, [&]()
+    {
+        return !ConfigWriter::writeToJsonConfig(*completeConfig).isEmpty();
+    }, ok));
+
+    if (!*ok)
+    {
+        return {};
+    }
+
+    const ConfigTreeStatistics treeStatistics = completeConfig->treeStatistics();
+
+    return QJsonObject {
+        { QStringLiteral("qt_version"),         QString(qVersion()) },
+        { QStringLiteral("parameters"),         parameters.toJson() },
+        { QStringLiteral("node_count"),         static_cast<double>(treeStatistics.nodeCount()) },
+        { QStringLiteral("tree_statistics"),    treeStatistics.toJson() },
+        { QStringLiteral("memory_usage"),       completeConfig->memoryUsage().toJson() },
+        { QStringLiteral("file_size"),          fileContents.size() },
+        { QStringLiteral("phases"),             phases }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName(QStringLiteral("CppConfigFramework_Benchmarks"));
+
+    // Parse the command line
+    const ConfigGeneratorParameters defaults;
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("C++ Config Framework benchmarks"));
+    parser.addHelpOption();
+
+    const QCommandLineOption widthOption(
+                QStringLiteral("width"),
+                QStringLiteral("Number of members in each Object node."),
+                QStringLiteral("count"),
+                QString::number(defaults.width));
+    const QCommandLineOption depthOption(
+                QStringLiteral("depth"),
+                QStringLiteral("Number of Object node levels in each tree."),
+                QStringLiteral("count"),
+                QString::number(defaults.depth));
+    const QCommandLineOption includesOption(
+                QStringLiteral("includes"),
+                QStringLiteral("Number of included configuration files."),
+                QStringLiteral("count"),
+                QString::number(defaults.includeCount));
+    const QCommandLineOption referenceDensityOption(
+                QStringLiteral("reference-density"),
+                QStringLiteral("Ratio of leaf nodes in the main tree that are references."),
+                QStringLiteral("ratio"),
+                QString::number(defaults.referenceDensity));
+    const QCommandLineOption derivedChainsOption(
+                QStringLiteral("derived-chains"),
+                QStringLiteral("Number of DerivedObject node chains."),
+                QStringLiteral("count"),
+                QString::number(defaults.derivedChainCount));
+    const QCommandLineOption derivedChainLengthOption(
+                QStringLiteral("derived-chain-length"),
+                QStringLiteral("Number of DerivedObject nodes in each chain."),
+                QStringLiteral("count"),
+                QString::number(defaults.derivedChainLength));
+    const QCommandLineOption iterationsOption(
+                QStringLiteral("iterations"),
+                QStringLiteral("Number of iterations of each phase."),
+                QStringLiteral("count"),
+                QStringLiteral("5"));
+    const QCommandLineOption configDirOption(
+                QStringLiteral("config-dir"),
+                QStringLiteral("Directory for the generated configuration files (a temporary "
+                               "directory is used by default)."),
+                QStringLiteral("path"));
+    const QCommandLineOption outputOption(
+                QStringLiteral("output"),
+                QStringLiteral("File for the JSON results (standard output is used by default)."),
+                QStringLiteral("path"));
+
+    parser.addOption(widthOption);
+    parser.addOption(depthOption);
+    parser.addOption(includesOption);
+    parser.addOption(referenceDensityOption);
+    parser.addOption(derivedChainsOption);
+    parser.addOption(derivedChainLengthOption);
+    parser.addOption(iterationsOption);
+    parser.addOption(configDirOption);
+    parser.addOption(outputOption);
+    parser.process(app);
+
+    ConfigGeneratorParameters parameters;
+    parameters.width = parser.value(widthOption).toInt();
+    parameters.depth = parser.value(depthOption).toInt();
+    parameters.includeCount = parser.value(includesOption).toInt();
+    parameters.referenceDensity = parser.value(referenceDensityOption).toDouble();
+    parameters.derivedChainCount = parser.value(derivedChainsOption).toInt();
+    parameters.derivedChainLength = parser.value(derivedChainLengthOption).toInt();
+
+    const int iterations = parser.value(iterationsOption).toInt();
+
+    if ((parameters.width < 1) || (parameters.depth < 0) || (parameters.includeCount < 0) ||
+        (parameters.referenceDensity < 0.0) || (parameters.referenceDensity > 1.0) ||
+        (parameters.derivedChainCount < 0) || (parameters.derivedChainLength < 0) ||
+        (iterations < 1))
+    {
+        qWarning() << "Invalid benchmark parameters!";
+        return 1;
+    }
+
+    // Generate the configuration files
+    QTemporaryDir temporaryDir;
+    QDir configDir;
+
+    if (parser.isSet(configDirOption))
+    {
+        configDir = QDir(parser.value(configDirOption));
+
+        if (!configDir.mkpath(QStringLiteral(".")))
+        {
+            qWarning() << "Failed to create the configuration directory:" << configDir.path();
+            return 1;
+        }
+    }
+    else
+    {
+        if (!temporaryDir.isValid())
+        {
+            qWarning() << "Failed to create a temporary directory!";
+            return 1;
+        }
+
+        configDir = QDir(temporaryDir.path());
+    }
+
+    const QString rootFilePath = ConfigGenerator(parameters).generate(configDir);
+
+    if (rootFilePath.isEmpty())
+    {
+        qWarning() << "Failed to generate the configuration files!";
+        return 1;
+    }
+
+    // Run the benchmarks
+    bool ok = true;
+    const QJsonObject results = runBenchmarks(rootFilePath, parameters, iterations, &ok);
+
+    if (!ok)
+    {
+        return 1;
+    }
+
+    // Output the results
+    const QByteArray output = QJsonDocument(results).toJson(QJsonDocument::Indented);
+
+    if (!parser.isSet(outputOption))
+    {
+        std::fwrite(output.constData(), 1, static_cast<size_t>(output.size()), stdout);
+        return 0;
+    }
+
+    QFile outputFile(parser.value(outputOption));
+
+    if ((!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) ||
+        (outputFile.write(output) != output.size()))
+    {
+        qWarning() << "Failed to write the results to:" << outputFile.fileName();
+        return 1;
+    }
+
+    return 0;
+}
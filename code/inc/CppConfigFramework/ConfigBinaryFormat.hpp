@@ -0,0 +1,242 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the definitions of the C++ Config Framework binary configuration format
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigIncludeGraph.hpp>
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+#include <CppConfigFramework/EnvironmentVariables.hpp>
+
+// Qt includes
+#include <QtCore/QHash>
+#include <QtCore/QString>
+
+// System includes
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * Contains the definitions of the binary configuration format
+ *
+ * The binary format holds a fully resolved Object node (only Object and Value nodes) so that it
+ * can be loaded without any JSON parsing, reference resolution or expansion of environment
+ * variables. All integers are stored in little-endian byte order and all strings are stored as
+ * a 32-bit byte length followed by the UTF-8 encoded bytes.
+ *
+ * The file starts with a header:
+ *
+ * - magic number (32-bit)
+ * - format version (32-bit)
+ * - number of source files (32-bit) followed by the absolute path (string), the size (64-bit) and
+ *   the last modification time (64-bit, milliseconds since the epoch) of each source file
+ * - number of environment variables (32-bit) followed by the name (string), the "is set" flag
+ *   (8-bit) and the value (string) of each environment variable that the sources depend on
+ *
+ * The header is followed by the root Object node. Each node starts with a NodeTag:
+ *
+ * - Object node: number of members (32-bit) followed by the name and node of each member
+ * - Value node: JSON value
+ *
+ * Each JSON value starts with a ValueTag:
+ *
+ * - Null, False and True values have no additional data
+ * - Double value: 64-bit IEEE 754 representation
+ * - String value: string
+ * - Array value: number of items (32-bit) followed by the JSON value of each item
+ * - Object value: number of members (32-bit) followed by the name and JSON value of each member
+ */
+namespace ConfigBinaryFormat
+{
+
+//! Magic number at the start of the file ("CCFB" when stored in little-endian byte order)
+constexpr quint32 MAGIC = 0x42464343U;
+
+//! Current format version
+constexpr quint32 VERSION = 2U;
+
+//! Enumerates the node tags
+enum class NodeTag : quint8
+{
+    Object = 1U,    //!< Object node
+    Value = 2U      //!< Value node
+};
+
+//! Enumerates the JSON value tags
+enum class ValueTag : quint8
+{
+    Null = 0U,      //!< Null value
+    False = 1U,     //!< Boolean value "false"
+    True = 2U,      //!< Boolean value "true"
+    Double = 3U,    //!< Double value
+    String = 4U,    //!< String value
+    Array = 5U,     //!< Array value
+    Object = 6U     //!< Object value
+};
+
+//! Holds a source file of a binary configuration
+struct CPPCONFIGFRAMEWORK_EXPORT SourceFile
+{
+    //! Absolute path to the file
+    QString filePath;
+
+    //! Size of the file in bytes
+    qint64 size = 0;
+
+    //! Last modification time of the file (milliseconds since the epoch)
+    qint64 lastModified = 0;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Holds the sources from which a binary configuration was created
+struct CPPCONFIGFRAMEWORK_EXPORT Sources
+{
+    //! All of the configuration files that were read (including the nested includes)
+    std::vector<SourceFile> files;
+
+    /*!
+     * Values of the environment variables that were looked up while reading the configuration
+     * files (a null string if the environment variable was not set)
+     */
+    QHash<QString, QString> environmentVariables;
+
+    /*!
+     * Checks if the binary configuration created from these sources is stale
+     *
+     * \param   currentEnvironmentVariables Environment variables with which the binary
+     *                                      configuration is being read
+     *
+     * \param[out]  reason  Optional output for the reason why the binary configuration is stale
+     *
+     * \retval  true    One of the source files was changed (its size or its last modification
+     *                  time is different or it does not exist anymore) or one of the environment
+     *                  variables has a different value
+     * \retval  false   Sources are unchanged
+     *
+     * \note    Only the file metadata is checked, the contents of the files are not read
+     */
+    bool isStale(const EnvironmentVariables &currentEnvironmentVariables,
+                 QString *reason = nullptr) const;
+
+    /*!
+     * Checks if the file is one of the source files
+     *
+     * \param   filePath    Absolute path to the file
+     *
+     * \retval  true    File is one of the source files
+     * \retval  false   File is not one of the source files
+     */
+    bool containsFile(const QString &filePath) const;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Records the sources of the configurations that are read on this thread (until it is destroyed)
+ *
+ * The configuration files are recorded with a ConfigIncludeGraph::RecordScope and the environment
+ * variables with an EnvironmentVariables::LookupRecordScope, so every file that the readers
+ * actually read (including the nested includes) and every environment variable that they looked
+ * up is recorded.
+ *
+ * Example:
+ * \code
+ * auto environmentVariables = EnvironmentVariables::loadFromProcess();
+ * const auto initialEnvironmentVariables = environmentVariables;
+ *
+ * ConfigBinaryFormat::SourceRecordScope sourceRecordScope;
+ * auto config = ConfigReader().read(filePath, workingDir, ConfigNodePath::ROOT_PATH,
+ *                                   ConfigNodePath::ROOT_PATH, {}, &environmentVariables);
+ *
+ * ConfigBinaryFormat::Sources sources;
+ *
+ * if (config && sourceRecordScope.sources(initialEnvironmentVariables, &sources))
+ * {
+ *     ConfigWriter::writeToBinaryConfigFile(*config, binaryFilePath, sources);
+ * }
+ * \endcode
+ */
+class CPPCONFIGFRAMEWORK_EXPORT SourceRecordScope
+{
+public:
+    //! Constructor
+    SourceRecordScope();
+
+    //! Copy constructor is disabled
+    SourceRecordScope(const SourceRecordScope &) = delete;
+
+    //! Move constructor is disabled
+    SourceRecordScope(SourceRecordScope &&) = delete;
+
+    //! Destructor
+    ~SourceRecordScope() = default;
+
+    //! Copy assignment operator is disabled
+    SourceRecordScope &operator=(const SourceRecordScope &) = delete;
+
+    //! Move assignment operator is disabled
+    SourceRecordScope &operator=(SourceRecordScope &&) = delete;
+
+    /*!
+     * Gets the recorded sources
+     *
+     * \param   environmentVariables    Environment variables with which the configuration was
+     *                                  started to be read (the values of the looked up environment
+     *                                  variables are taken from them so that the environment
+     *                                  variables set by the configuration files are not a part of
+     *                                  the sources)
+     *
+     * \param[out]  sources Output for the sources
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (one of the source files does not exist anymore)
+     *
+     * \note    The sizes and the last modification times of the source files are taken when this
+     *          method is called, so the files must not be changed between reading them and calling
+     *          this method
+     */
+    bool sources(const EnvironmentVariables &environmentVariables, Sources *sources) const;
+
+private:
+    //! Graph in which the read configuration files are recorded
+    ConfigIncludeGraph m_includeGraph;
+
+    //! Environment variables that were looked up
+    QHash<QString, QString> m_environmentVariableLookups;
+
+    //! Scope that records the read configuration files
+    ConfigIncludeGraph::RecordScope m_includeGraphRecordScope;
+
+    //! Scope that records the looked up environment variables
+    EnvironmentVariables::LookupRecordScope m_lookupRecordScope;
+};
+
+} // namespace ConfigBinaryFormat
+
+} // namespace CppConfigFramework
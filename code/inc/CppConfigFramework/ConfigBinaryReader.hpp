@@ -0,0 +1,130 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class for reading the binary configuration files
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigBinaryFormat.hpp>
+#include <CppConfigFramework/ConfigReaderBase.hpp>
+
+// Qt includes
+#include <QtCore/QStringList>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class reads the binary configuration files
+ *
+ * A binary configuration file holds a fully resolved configuration node (see ConfigBinaryFormat)
+ * so it is read without any JSON parsing, reference resolution or expansion of environment
+ * variables.
+ *
+ * The reader is registered in the ConfigReaderRegistry with the type "CppConfigFrameworkBinary" so
+ * that it can also be used for the includes. The following parameters are supported:
+ *
+ * - "file_path": path to the binary configuration file (mandatory)
+ * - "source_node": node path to the node that needs to be extracted from the file (optional)
+ * - "source_files": paths to the source files of the binary configuration (optional), each of
+ *   them needs to be one of the sources stored in the file (so that a binary configuration
+ *   created from a different configuration is rejected)
+ *
+ * The sources stored in the file (see ConfigBinaryFormat::Sources) are always checked: a binary
+ * configuration is rejected as stale if any of the configuration files that were read to create
+ * it (including the nested includes) was changed or if any of the environment variables that were
+ * looked up has a different value.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigBinaryReader : public ConfigReaderBase
+{
+public:
+    //! Constructor
+    ConfigBinaryReader() = default;
+
+    //! Copy constructor
+    ConfigBinaryReader(const ConfigBinaryReader &) = default;
+
+    //! Move constructor
+    ConfigBinaryReader(ConfigBinaryReader &&) noexcept = default;
+
+    //! Destructor
+    ~ConfigBinaryReader() = default;
+
+    //! Copy assignment operator
+    ConfigBinaryReader &operator=(const ConfigBinaryReader &) = default;
+
+    //! Move assignment operator
+    ConfigBinaryReader &operator=(ConfigBinaryReader &&) noexcept = default;
+
+    /*!
+     * Read the specified binary config file
+     *
+     * \param   filePath                    Path to the binary configuration file
+     * \param   workingDir                  Path to the working directory
+     * \param   sourceNodePath              Node path to the node that needs to be extracted from
+     *                                      this configuration file (must be absolute node path)
+     * \param   destinationNodePath         Node path to the destination node where the result
+     *                                      needs to be stored (must be absolute node path)
+     * \param   environmentVariables        Environment variables for checking if the binary
+     *                                      configuration is stale (the environment variables of
+     *                                      the process are used if it is null)
+     * \param   requiredSourceFiles         Absolute paths to the files that need to be the sources
+     *                                      of the binary configuration
+     *
+     * \return  Configuration node instance or in case of failure (also if the binary
+     *          configuration is stale) a null pointer
+     */
+    std::unique_ptr<ConfigObjectNode> read(
+            const QString &filePath,
+            const QDir &workingDir,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            const EnvironmentVariables *environmentVariables = nullptr,
+            const QStringList &requiredSourceFiles = QStringList()) const;
+
+    //! \copydoc    ConfigReaderBase::read()
+    std::unique_ptr<ConfigObjectNode> read(
+            const QDir &workingDir,
+            const ConfigNodePath &destinationNodePath,
+            const QJsonObject &otherParameters,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables) const override;
+
+    /*!
+     * Reads the sources stored in the binary config file
+     *
+     * \param   filePath    Path to the binary configuration file
+     *
+     * \param[out]  sources Sources from which the binary configuration was created
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    static bool readSources(const QString &filePath, ConfigBinaryFormat::Sources *sources);
+};
+
+} // namespace CppConfigFramework
@@ -51,11 +51,22 @@ public:
                             const ConfigObjectNode &config = ConfigObjectNode(),
                             ConfigObjectNode *parent = nullptr);
 
+    /*!
+     * Constructor
+     *
+     * \param   bases   Bases for this configuration node
+     * \param   config  Overloads for this configuration node (its members are moved to this node)
+     * \param   parent  Parent for this configuration node
+     */
+    ConfigDerivedObjectNode(const QList<ConfigNodePath> &bases,
+                            ConfigObjectNode &&config,
+                            ConfigObjectNode *parent = nullptr);
+
     //! Copy constructor is disabled
     ConfigDerivedObjectNode(const ConfigDerivedObjectNode &) = delete;
 
     //! Move constructor
-    ConfigDerivedObjectNode(ConfigDerivedObjectNode &&) noexcept = default;
+    ConfigDerivedObjectNode(ConfigDerivedObjectNode &&other) noexcept;
 
     //! Destructor
     ~ConfigDerivedObjectNode() override = default;
@@ -64,7 +75,7 @@ public:
     ConfigDerivedObjectNode &operator=(const ConfigDerivedObjectNode &) = delete;
 
     //! Move assignment operator
-    ConfigDerivedObjectNode &operator=(ConfigDerivedObjectNode &&) noexcept = default;
+    ConfigDerivedObjectNode &operator=(ConfigDerivedObjectNode &&other) noexcept;
 
     //! \copydoc    ConfigNode::clone()
     std::unique_ptr<ConfigNode> clone() const override;
@@ -93,6 +104,9 @@ public:
      */
     const ConfigObjectNode &config() const;
 
+    //! \copydoc    ConfigDerivedObjectNode::config()
+    ConfigObjectNode &config();
+
     /*!
      * Sets the overloads for deriving the Object configuration node
      *
@@ -100,6 +114,17 @@ public:
      */
     void setConfig(const ConfigObjectNode &config);
 
+    /*!
+     * Sets the overloads for deriving the Object configuration node
+     *
+     * \param   config  New overloads (its members are moved to this node)
+     */
+    void setConfig(ConfigObjectNode &&config);
+
+private:
+    //! \copydoc    ConfigNode::calculateContentHash()
+    quint64 calculateContentHash() const override;
+
 private:
     //! Bases for deriving the Object configuration node
     QList<ConfigNodePath> m_bases;
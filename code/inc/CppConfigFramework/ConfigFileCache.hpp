@@ -0,0 +1,318 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a process-wide cache for the read configuration files
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/EnvironmentVariables.hpp>
+
+// Qt includes
+#include <QtCore/QDateTime>
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+
+// System includes
+#include <deque>
+#include <map>
+#include <memory>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This is a process-wide cache for the read configuration files
+ *
+ * For each cached file the parsed JSON contents are stored so that a file that is read multiple
+ * times (for example the same file included by different configuration files) is opened and parsed
+ * only once. Additionally the Object node that is read from the 'config' member of the file (before
+ * its references are resolved) is stored together with the values of the environment variables it
+ * references so that it can be reused as long as those environment variables have the same values.
+ *
+ * A cached file is valid only as long as its size and last modification time stay the same. The
+ * least recently used files are evicted from the cache once the maximum number of files is reached.
+ *
+ * \note    The cache is disabled by default
+ * \note    All methods are thread-safe
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigFileCache
+{
+public:
+    //! Identifies a specific version of a file
+    struct CPPCONFIGFRAMEWORK_EXPORT FileKey
+    {
+        //! Absolute path to the file
+        QString absoluteFilePath;
+
+        //! Size of the file
+        qint64 size = -1;
+
+        //! Last modification time of the file
+        QDateTime lastModified;
+
+        /*!
+         * Creates a file key from the current state of the file
+         *
+         * \param   absoluteFilePath    Absolute path to the file
+         *
+         * \return  File key
+         */
+        static FileKey fromFile(const QString &absoluteFilePath);
+
+        /*!
+         * Checks if this key identifies the same version of a file as the other key
+         *
+         * \param   other   Other file key
+         *
+         * \retval  true    Same version of the file
+         * \retval  false   Different file or a different version of the file
+         */
+        bool operator==(const FileKey &other) const;
+    };
+
+    //! Holds the statistics of the cache usage
+    struct CPPCONFIGFRAMEWORK_EXPORT Statistics
+    {
+        //! Number of times a file was found in the cache
+        int fileHits = 0;
+
+        //! Number of times a file was not found in the cache
+        int fileMisses = 0;
+
+        //! Number of times the 'config' member of a file was found in the cache
+        int configHits = 0;
+
+        //! Number of times the 'config' member of a file was not found in the cache
+        int configMisses = 0;
+
+        //! Number of evicted files
+        int evictions = 0;
+    };
+
+public:
+    //! Destructor
+    ~ConfigFileCache() = default;
+
+    /*!
+     * Gets the cache instance
+     *
+     * \return  Cache instance
+     */
+    static ConfigFileCache *instance();
+
+    /*!
+     * Checks if the cache is enabled
+     *
+     * \retval  true    Enabled
+     * \retval  false   Disabled
+     */
+    bool isEnabled() const;
+
+    /*!
+     * Enables or disables the cache
+     *
+     * \param   enabled New value
+     *
+     * \note    Disabling the cache also clears it
+     */
+    void setEnabled(const bool enabled);
+
+    /*!
+     * Gets the maximum number of cached files
+     *
+     * \return  Maximum number of cached files
+     */
+    int maxFileCount() const;
+
+    /*!
+     * Sets the maximum number of cached files
+     *
+     * \param   maxFileCount    New value (must be greater than zero)
+     *
+     * If needed the least recently used files are evicted from the cache.
+     */
+    void setMaxFileCount(const int maxFileCount);
+
+    /*!
+     * Gets the number of cached files
+     *
+     * \return  Number of cached files
+     */
+    int fileCount() const;
+
+    /*!
+     * Gets the statistics of the cache usage
+     *
+     * \return  Statistics
+     */
+    Statistics statistics() const;
+
+    //! Resets the statistics of the cache usage
+    void resetStatistics();
+
+    //! Removes all files from the cache
+    void clear();
+
+    /*!
+     * Removes the file from the cache (regardless of its version)
+     *
+     * \param   absoluteFilePath    Absolute path to the file
+     *
+     * This can be used to force the file to be read again, for example when it is known that the
+     * file was changed but the change could not be detected from its size and modification time.
+     */
+    void removeFile(const QString &absoluteFilePath);
+
+    /*!
+     * Checks if the file is in the cache (statistics are not updated)
+     *
+     * \param   fileKey Key of the file
+     *
+     * \retval  true    File is in the cache
+     * \retval  false   File is not in the cache
+     */
+    bool containsFile(const FileKey &fileKey) const;
+
+    /*!
+     * Finds the parsed contents of the file in the cache
+     *
+     * \param   fileKey Key of the file
+     *
+     * \param[out]  rootObject  Root JSON Object of the file
+     *
+     * \retval  true    File was found
+     * \retval  false   File was not found
+     */
+    bool findFile(const FileKey &fileKey, QJsonObject *rootObject);
+
+    /*!
+     * Stores the parsed contents of the file in the cache
+     *
+     * \param   fileKey     Key of the file
+     * \param   rootObject  Root JSON Object of the file
+     */
+    void storeFile(const FileKey &fileKey, const QJsonObject &rootObject);
+
+    /*!
+     * Finds the Object node read from the 'config' member of the file in the cache
+     *
+     * \param   fileKey                 Key of the file
+     * \param   environmentVariables    Environment variables used for reading the 'config' member
+     *
+     * \return  Copy of the cached Object node or null in case it was not found
+     */
+    std::unique_ptr<ConfigObjectNode> findConfig(const FileKey &fileKey,
+                                                 const EnvironmentVariables &environmentVariables);
+
+    /*!
+     * Stores the Object node read from the 'config' member of the file in the cache
+     *
+     * \param   fileKey         Key of the file
+     * \param   config          Object node read from the 'config' member
+     * \param   dependencies    Environment variables (with their values) that were looked up while
+     *                          reading the 'config' member
+     *
+     * \see     EnvironmentVariables::LookupRecordScope
+     *
+     * \note    The Object node is stored only if the file itself is already stored in the cache
+     */
+    void storeConfig(const FileKey &fileKey,
+                     const ConfigObjectNode &config,
+                     QHash<QString, QString> dependencies);
+
+private:
+    //! Holds an Object node read from the 'config' member of a file
+    struct CachedConfig
+    {
+        //! Values of the environment variables looked up while reading the 'config' member
+        QHash<QString, QString> dependencies;
+
+        //! Object node read from the 'config' member
+        std::unique_ptr<ConfigObjectNode> config;
+    };
+
+    //! Holds a cached file
+    struct CachedFile
+    {
+        //! Key of the file
+        FileKey fileKey;
+
+        //! Root JSON Object of the file
+        QJsonObject rootObject;
+
+        //! Object nodes read from the 'config' member (one for each set of dependencies)
+        std::deque<CachedConfig> configs;
+
+        //! Value of the usage counter when the file was last used
+        quint64 lastUsed = 0U;
+    };
+
+private:
+    //! Constructor
+    ConfigFileCache() = default;
+
+    /*!
+     * Finds the valid cached file
+     *
+     * \param   fileKey Key of the file
+     *
+     * \return  Cached file or null in case it was not found
+     *
+     * \note    The mutex must be locked before calling this method
+     */
+    CachedFile *findCachedFile(const FileKey &fileKey);
+
+    /*!
+     * Evicts the least recently used files until the number of cached files is below the limit
+     *
+     * \param   maxFileCount    Maximum number of cached files
+     *
+     * \note    The mutex must be locked before calling this method
+     */
+    void evictFiles(const int maxFileCount);
+
+private:
+    //! Mutex for protecting the state of the cache
+    mutable QMutex m_mutex;
+
+    //! Holds the "is enabled" flag
+    bool m_enabled = false;
+
+    //! Maximum number of cached files
+    int m_maxFileCount = 64;
+
+    //! Cached files
+    std::map<QString, CachedFile> m_files;
+
+    //! Usage counter
+    quint64 m_usageCounter = 0U;
+
+    //! Statistics of the cache usage
+    Statistics m_statistics;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,210 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the include dependency graph of a configuration
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodePath.hpp>
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QStringList>
+
+// System includes
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class holds the include dependency graph of a configuration
+ *
+ * While a RecordScope is active on a thread all of the configuration files read on that thread
+ * and all of the includes declared in their 'includes' members are recorded in the graph of the
+ * scope.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigIncludeGraph
+{
+public:
+    //! Holds an include declared in the 'includes' member of a configuration file
+    struct CPPCONFIGFRAMEWORK_EXPORT Include
+    {
+        /*!
+         * Absolute path to the configuration file that declares the include (empty if the include
+         * was declared in a configuration that was not read from a file)
+         */
+        QString parentFilePath;
+
+        //! Absolute path to the included file (empty if the include has no 'file_path' member)
+        QString filePath;
+
+        //! Type of the include
+        QString type;
+
+        //! Node path to the node that is extracted from the included configuration
+        ConfigNodePath sourceNodePath;
+
+        //! Node path to the destination node where the extracted node is stored
+        ConfigNodePath destinationNodePath;
+    };
+
+    //! Records the configuration files read on this thread in a graph (until it is destroyed)
+    class CPPCONFIGFRAMEWORK_EXPORT RecordScope
+    {
+    public:
+        /*!
+         * Constructor
+         *
+         * \param   graph   Graph in which the configuration files shall be recorded
+         */
+        explicit RecordScope(ConfigIncludeGraph *graph);
+
+        //! Copy constructor is disabled
+        RecordScope(const RecordScope &) = delete;
+
+        //! Move constructor is disabled
+        RecordScope(RecordScope &&) = delete;
+
+        //! Destructor
+        ~RecordScope();
+
+        //! Copy assignment operator is disabled
+        RecordScope &operator=(const RecordScope &) = delete;
+
+        //! Move assignment operator is disabled
+        RecordScope &operator=(RecordScope &&) = delete;
+
+    private:
+        //! Graph that was active on this thread
+        ConfigIncludeGraph *m_previousGraph;
+    };
+
+    //! Marks the configuration file that is currently being read on this thread
+    class CPPCONFIGFRAMEWORK_EXPORT FileScope
+    {
+    public:
+        /*!
+         * Constructor
+         *
+         * \param   absoluteFilePath    Absolute path to the configuration file
+         *
+         * \note    The scope has no effect if no graph is being recorded on this thread
+         */
+        explicit FileScope(const QString &absoluteFilePath);
+
+        //! Copy constructor is disabled
+        FileScope(const FileScope &) = delete;
+
+        //! Move constructor is disabled
+        FileScope(FileScope &&) = delete;
+
+        //! Destructor
+        ~FileScope();
+
+        //! Copy assignment operator is disabled
+        FileScope &operator=(const FileScope &) = delete;
+
+        //! Move assignment operator is disabled
+        FileScope &operator=(FileScope &&) = delete;
+
+    private:
+        //! Graph in which the file was recorded
+        ConfigIncludeGraph *m_graph;
+    };
+
+public:
+    /*!
+     * Checks if the graph is empty
+     *
+     * \retval  true    Graph is empty
+     * \retval  false   Graph is not empty
+     */
+    bool isEmpty() const;
+
+    //! Removes all files and includes from the graph
+    void clear();
+
+    /*!
+     * Gets the absolute paths to all of the read configuration files
+     *
+     * \return  File paths in the order in which they were first read
+     */
+    QStringList filePaths() const;
+
+    /*!
+     * Gets the recorded includes
+     *
+     * \return  Includes in the order in which they were processed
+     */
+    const std::vector<Include> &includes() const;
+
+    /*!
+     * Gets the configuration files affected by a change of the specified file
+     *
+     * \param   filePath    Absolute path to the file
+     *
+     * \return  The file itself followed by all of the files that include it (directly or through
+     *          other includes) or an empty list if the file is not a part of the graph
+     */
+    QStringList dependentFilePaths(const QString &filePath) const;
+
+    /*!
+     * Checks if a graph is being recorded on this thread
+     *
+     * \retval  true    Graph is being recorded
+     * \retval  false   Graph is not being recorded
+     */
+    static bool isRecording();
+
+    /*!
+     * Records an include in the graph that is being recorded on this thread
+     *
+     * \param   filePath            Absolute path to the included file
+     * \param   type                Type of the include
+     * \param   sourceNodePath      Node path to the node that is extracted from the included
+     *                              configuration
+     * \param   destinationNodePath Node path to the destination node where the extracted node is
+     *                              stored
+     *
+     * \note    The include is added to the configuration file of the innermost FileScope
+     */
+    static void recordInclude(const QString &filePath,
+                              const QString &type,
+                              const ConfigNodePath &sourceNodePath,
+                              const ConfigNodePath &destinationNodePath);
+
+private:
+    //! Absolute paths to the read configuration files
+    QStringList m_filePaths;
+
+    //! Recorded includes
+    std::vector<Include> m_includes;
+
+    //! Absolute paths to the configuration files that are currently being read
+    QStringList m_fileStack;
+};
+
+} // namespace CppConfigFramework
@@ -22,6 +22,8 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigContainerHelper.hpp>
+#include <CppConfigFramework/ConfigNodeHelper.hpp>
+#include <CppConfigFramework/ConfigParameterSchema.hpp>
 #include <CppConfigFramework/ConfigParameterValidator.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
@@ -33,6 +35,11 @@
 // Qt includes
 
 // System includes
+#include <array>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <vector>
 
 // Forward declarations
 
@@ -241,6 +248,45 @@ protected:
                                      ConfigParameterValidator<T> validator,
                                      bool *loaded = nullptr);
 
+    /*!
+     * Loads all of the configuration parameters described by the schema
+     *
+     * \tparam  Fields  Types of the field descriptors (ConfigParameterField)
+     *
+     * \param   schema  Schema created with makeConfigParameterSchema()
+     * \param   config  Configuration node from which this configuration structure should be loaded
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * The members of the configuration node are visited only once and each of them is loaded to the
+     * parameter with the matching name (so there is no lookup for the individual parameters) and
+     * then it is checked that all of the required parameters were loaded. The members and the
+     * fields are matched by walking both of them ordered by their names, so loading takes linear
+     * time in the number of members and fields (after sorting the field names). The validators are
+     * called directly, without wrapping them in a ConfigParameterValidator.
+     *
+     * The parameters are loaded in the order of the members in the configuration node and loading
+     * stops at the first parameter that fails to load.
+     *
+     * Example:
+     * \code
+     * bool loadConfigParameters(const ConfigObjectNode &config) override
+     * {
+     *     static constexpr auto schema = makeConfigParameterSchema(
+     *             requiredConfigParameter(&Config::m_host, "host"),
+     *             optionalConfigParameter(&Config::m_port,
+     *                                     "port",
+     *                                     ConfigParameterRangeValidator<int>(1, 65535)));
+     *
+     *     return loadConfigParameterSchema(schema, config);
+     * }
+     * \endcode
+     */
+    template<typename... Fields>
+    bool loadConfigParameterSchema(const std::tuple<Fields...> &schema,
+                                   const ConfigObjectNode &config);
+
     /*!
      * Loads the required configuration container from the configuration node
      *
@@ -333,11 +379,118 @@ protected:
             ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator,
             bool *loaded = nullptr);
 
+    /*!
+     * Loads the required configuration container from the configuration node with the items loaded
+     * in parallel
+     *
+     * \tparam  T   Data type of the container to load (its value type needs to be derived from
+     *              ConfigLoader class)
+     *
+     * \param[out]  container   Output for the configuration container
+     *
+     * \param   parameterName   Name of the parameter (member name in the configuration node)
+     * \param   config          Configuration node from which this configuration structure should be
+     *                          loaded
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \see     loadConfigContainerFromNodeInParallel()
+     */
+    template<typename T>
+    bool loadRequiredConfigContainerInParallel(T *container,
+                                               const QString &parameterName,
+                                               const ConfigObjectNode &config);
+
+    /*!
+     * Loads the required configuration container from the configuration node with the items loaded
+     * in parallel
+     *
+     * \tparam  T   Data type of the container to load (its value type needs to be derived from
+     *              ConfigLoader class)
+     *
+     * \param[out]  container   Output for the configuration container
+     *
+     * \param   parameterName   Name of the parameter (member name in the configuration node)
+     * \param   config          Configuration node from which this configuration structure should be
+     *                          loaded
+     * \param   itemCreator     Functor for creating the initial item instances for the container
+     *                          (it needs to be thread-safe)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \see     loadConfigContainerFromNodeInParallel()
+     */
+    template<typename T>
+    bool loadRequiredConfigContainerInParallel(
+            T *container,
+            const QString &parameterName,
+            const ConfigObjectNode &config,
+            ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator);
+
+    /*!
+     * Loads the optional configuration container from the configuration node with the items loaded
+     * in parallel
+     *
+     * \tparam  T   Data type of the container to load (its value type needs to be derived from
+     *              ConfigLoader class)
+     *
+     * \param[out]  container   Output for the configuration container
+     *
+     * \param   parameterName   Name of the parameter (member name in the configuration node)
+     * \param   config          Configuration node from which this configuration structure should be
+     *                          loaded
+     *
+     * \param[out]  loaded  Optional output for the loading result
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \see     loadConfigContainerFromNodeInParallel()
+     */
+    template<typename T>
+    bool loadOptionalConfigContainerInParallel(T *container,
+                                               const QString &parameterName,
+                                               const ConfigObjectNode &config,
+                                               bool *loaded = nullptr);
+
+    /*!
+     * Loads the optional configuration container from the configuration node with the items loaded
+     * in parallel
+     *
+     * \tparam  T   Data type of the container to load (its value type needs to be derived from
+     *              ConfigLoader class)
+     *
+     * \param[out]  container   Output for the configuration container
+     *
+     * \param   parameterName   Name of the parameter (member name in the configuration node)
+     * \param   config          Configuration node from which this configuration structure should be
+     *                          loaded
+     * \param   itemCreator     Functor for creating the initial item instances for the container
+     *                          (it needs to be thread-safe)
+     *
+     * \param[out]  loaded  Optional output for the loading result
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \see     loadConfigContainerFromNodeInParallel()
+     */
+    template<typename T>
+    bool loadOptionalConfigContainerInParallel(
+            T *container,
+            const QString &parameterName,
+            const ConfigObjectNode &config,
+            ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator,
+            bool *loaded = nullptr);
+
 private:
     /*!
      * Loads the configuration parameter from the configuration node with validation
      *
-     * \tparam  T   Data type of the parameter to load
+     * \tparam  T           Data type of the parameter to load
+     * \tparam  Validator   Type of the validator for the loaded parameter value
      *
      * \param[out]  parameterValue  Output for the configuration parameter value
      *
@@ -347,10 +500,10 @@ private:
      *
      * \return  Configuration parameter loading result
      */
-    template<typename T>
+    template<typename T, typename Validator>
     bool loadConfigParameterFromNode(T *parameterValue,
                                      const ConfigNode &node,
-                                     ConfigParameterValidator<T> validator);
+                                     const Validator &validator);
 
     /*!
      * Validates the configuration parameter
@@ -390,6 +543,66 @@ private:
             const ConfigNode &node,
             ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator);
 
+    /*!
+     * Loads the configuration container from the configuration node with the items loaded in
+     * parallel
+     *
+     * \tparam  T   Data type of the container to load (its value type needs to be derived from
+     *              ConfigLoader class)
+     *
+     * \param[out]  container   Output for the configuration container
+     *
+     * \param   node        Configuration node from which this configuration container should be
+     *                      loaded
+     * \param   itemCreator Functor for creating the initial item instances for the container
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * The item creator and the loadConfig() method of the items are executed on the global thread
+     * pool (so they need to be thread-safe) while the items are added to the container in the order
+     * of the members in the node after all of them are loaded. The outcome is the same as with
+     * loadConfigContainerFromNode(): on failure the container holds the items before the first item
+     * that failed to load and only the errors of that item are reported.
+     *
+     * The errors are not reported on the thread pool. Instead the first item that failed is loaded
+     * again on the calling thread, which reports its errors (logs them and calls handleError()) in
+     * the same order as loadConfigContainerFromNode(), no matter which of the items with higher
+     * indexes also failed in the meantime.
+     *
+     * 
+ote    Only the errors reported by ConfigLoader are deferred, the warnings logged by the
+     *          validators and the errors reported directly by the items are not
+     *
+     * Reading a node can change it (the lazy members are read and the node paths are cached on the
+     * first access), so before the items are loaded the whole container node is materialized and
+     * its node paths are cached on the calling thread (see ConfigObjectNode::materializeAll() and
+     * ConfigNode::cacheNodePaths()). After that the items only read the nodes.
+     *
+     * \note    The items must only access the nodes inside of the container node unless the
+     *          configuration tree is frozen (see ConfigSnapshotPublisher::freeze())
+     */
+    template<typename T>
+    bool loadConfigContainerFromNodeInParallel(
+            T *container,
+            const ConfigNode &node,
+            ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator);
+
+    /*!
+     * Executes the tasks in parallel on the global thread pool
+     *
+     * \param   taskCount   Number of tasks
+     * \param   task        Task to execute (its parameter is the index of the task)
+     *
+     * \return  Index of the first task that failed or -1 if all of them succeeded
+     *
+     * The tasks are started in the order of their indexes and the calling thread executes tasks too
+     * so this method never waits for a free thread in the thread pool (nested calls are allowed).
+     * After the first failure no further tasks are started, but all of the tasks with lower indexes
+     * are guaranteed to be executed.
+     */
+    static int executeInParallel(const int taskCount, const std::function<bool(int)> &task);
+
     /*!
      * Default container item creator
      *
@@ -438,6 +651,44 @@ private:
      * \note    Default implementation does not do anything!
      */
     virtual void handleError(const QString &error);
+
+    /*!
+     * Reports the error (logs it and calls handleError())
+     *
+     * \param   errorString Error string
+     *
+     * \note    The errors are not reported on a thread while it loads an item of a container in
+     *          parallel (see loadConfigContainerFromNodeInParallel())
+     */
+    void reportError(const QString &errorString);
+
+private:
+    //! Suppresses the reporting of the errors on the current thread while it exists
+    class CPPCONFIGFRAMEWORK_EXPORT ErrorReportSuppression
+    {
+    public:
+        //! Constructor
+        ErrorReportSuppression();
+
+        //! Copy constructor is disabled
+        ErrorReportSuppression(const ErrorReportSuppression &) = delete;
+
+        //! Move constructor is disabled
+        ErrorReportSuppression(ErrorReportSuppression &&) = delete;
+
+        //! Destructor
+        ~ErrorReportSuppression();
+
+        //! Copy assignment operator is disabled
+        ErrorReportSuppression &operator=(const ErrorReportSuppression &) = delete;
+
+        //! Move assignment operator is disabled
+        ErrorReportSuppression &operator=(ErrorReportSuppression &&) = delete;
+
+    private:
+        //! Suppression state that was active on this thread
+        bool m_previousState;
+    };
 };
 
 // -------------------------------------------------------------------------------------------------
@@ -469,8 +720,7 @@ bool ConfigLoader::loadRequiredConfigParameter(T *parameterValue,
         const QString errorString = QString("Configuration parameter name [%1] is not valid "
                                             "(configuration node [%2])!")
                                     .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -482,8 +732,7 @@ bool ConfigLoader::loadRequiredConfigParameter(T *parameterValue,
         const QString errorString = QString("Configuration parameter node with name [%1] was not "
                                             "found in configuration node [%2]!")
                                     .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -523,8 +772,7 @@ bool ConfigLoader::loadOptionalConfigParameter(T *parameterValue,
         const QString errorString = QString("Configuration parameter name [%1] is not valid "
                                             "(configuration node [%2])!")
                                     .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
 
         if (loaded != nullptr)
         {
@@ -558,6 +806,113 @@ bool ConfigLoader::loadOptionalConfigParameter(T *parameterValue,
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename... Fields>
+bool ConfigLoader::loadConfigParameterSchema(const std::tuple<Fields...> &schema,
+                                             const ConfigObjectNode &config)
+{
+    using Loader = typename std::tuple_element_t<0, std::tuple<Fields...>>::LoaderType;
+    static_assert(std::is_base_of<ConfigLoader, Loader>::value,
+                  "Schema needs to describe a class derived from ConfigLoader");
+
+    constexpr std::size_t fieldCount = sizeof...(Fields);
+    const auto fieldIndexes = std::index_sequence_for<Fields...>();
+    auto *loader = static_cast<Loader *>(this);
+
+    // Validate parameter names (in case the schema was not created in a constant expression)
+    bool result = true;
+
+    forEachConfigParameterField(schema, [this, &config, &result](const auto &field, std::size_t)
+    {
+        if (result && (!isValidConfigParameterName(field.name())))
+        {
+            const QString errorString = QString("Configuration parameter name [%1] is not valid "
+                                                "(configuration node [%2])!")
+                                        .arg(QString::fromLatin1(field.name()),
+                                             config.nodePath().path());
+            reportError(errorString);
+            result = false;
+        }
+    }, fieldIndexes);
+
+    if (!result)
+    {
+        return false;
+    }
+
+    // Load the parameters from the members of the configuration node in a single pass: both the
+    // members and the fields are ordered by their names so they are matched by walking them in step
+    const auto fieldNames = configParameterFieldNames(schema, fieldIndexes);
+    const auto fieldOrder = sortConfigParameterFields(fieldNames);
+    std::array<bool, fieldCount> loaded {};
+    std::size_t position = 0U;
+
+    for (const auto &member : config)
+    {
+        // Skip the fields that are ordered before the member
+        int comparison = 1;
+
+        while (position < fieldCount)
+        {
+            comparison = member.name().compare(QLatin1String(fieldNames[fieldOrder[position]]));
+
+            if (comparison <= 0)
+            {
+                break;
+            }
+
+            position++;
+        }
+
+        if (position == fieldCount)
+        {
+            break;
+        }
+
+        if (comparison != 0)
+        {
+            continue;
+        }
+
+        // Load the parameter (the other fields with the same name are skipped with the next member)
+        const std::size_t fieldIndex = fieldOrder[position];
+        position++;
+
+        auto loadField = [this, loader, &member, &result](const auto &field, std::size_t)
+        {
+            result = loadConfigParameterFromNode(&(loader->*field.member()),
+                                                 member.node(),
+                                                 field.validator());
+        };
+        visitConfigParameterField(schema, fieldIndex, loadField, fieldIndexes);
+        loaded[fieldIndex] = true;
+
+        if (!result)
+        {
+            return false;
+        }
+    }
+
+    // Check if all of the required parameters were loaded
+    forEachConfigParameterField(
+                schema,
+                [this, &config, &loaded, &result](const auto &field, const std::size_t index)
+    {
+        if (result && field.isRequired() && (!loaded[index]))
+        {
+            const QString errorString = QString("Configuration parameter node with name [%1] was "
+                                                "not found in configuration node [%2]!")
+                                        .arg(QString::fromLatin1(field.name()),
+                                             config.nodePath().path());
+            reportError(errorString);
+            result = false;
+        }
+    }, fieldIndexes);
+
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename T>
 bool ConfigLoader::loadRequiredConfigContainer(T *container,
                                                const QString &parameterName,
@@ -590,8 +945,7 @@ bool ConfigLoader::loadRequiredConfigContainer(
         const QString errorString = QString("Configuration parameter name [%1] is not valid "
                                             "(configuration node [%2])!")
                                     .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -603,8 +957,7 @@ bool ConfigLoader::loadRequiredConfigContainer(
         const QString errorString = QString("Configuration parameter node with name [%1] was not "
                                             "found in configuration node [%2]!")
                                     .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -649,8 +1002,7 @@ bool ConfigLoader::loadOptionalConfigContainer(
         const QString errorString = QString("Configuration parameter name [%1] is not valid "
                                             "(configuration node [%2])!")
                                     .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -679,33 +1031,27 @@ bool ConfigLoader::loadOptionalConfigContainer(
 
 // -------------------------------------------------------------------------------------------------
 
-template<typename T>
+template<typename T, typename Validator>
 bool ConfigLoader::loadConfigParameterFromNode(T *parameterValue,
                                                const ConfigNode &node,
-                                               ConfigParameterValidator<T> validator)
+                                               const Validator &validator)
 {
-    // Load the node value to the parameter
-    QJsonValue nodeJsonValue;
-
+    // Check the node type
     switch (node.type())
     {
         case ConfigNode::Type::Value:
         {
-            nodeJsonValue = node.toValue().value();
             break;
         }
 
         case ConfigNode::Type::Object:
         {
-            nodeJsonValue = ConfigWriter::convertToJsonValue(node.toObject());
-
-            if (nodeJsonValue.isUndefined())
+            if (node.toObject().unresolvedReferenceCount() > 0)
             {
                 const QString errorString = QString("Configuration parameter node [%1] has "
                                                     "unresolved references!")
                                             .arg(node.nodePath().path());
-                qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-                handleError(errorString);
+                reportError(errorString);
                 return false;
             }
             break;
@@ -716,18 +1062,17 @@ bool ConfigLoader::loadConfigParameterFromNode(T *parameterValue,
             const QString errorString = QString("Configuration parameter node [%1] is neither a "
                                                 "Value nor an Object node!")
                                         .arg(node.nodePath().path());
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-            handleError(errorString);
+            reportError(errorString);
             return false;
         }
     }
 
-    if (!CedarFramework::deserialize(nodeJsonValue, parameterValue))
+    // Load the node value to the parameter (directly from the node where possible)
+    if (!ConfigNodeHelper<T>::load(node, parameterValue))
     {
         const QString errorString = QString("Failed to load configuration parameter's value at "
                                             "node path [%1]").arg(node.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -736,8 +1081,7 @@ bool ConfigLoader::loadConfigParameterFromNode(T *parameterValue,
     {
         const QString errorString = QString("Configuration parameter's value [%1] is not valid")
                                     .arg(node.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -747,6 +1091,126 @@ bool ConfigLoader::loadConfigParameterFromNode(T *parameterValue,
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename T>
+bool ConfigLoader::loadRequiredConfigContainerInParallel(T *container,
+                                                         const QString &parameterName,
+                                                         const ConfigObjectNode &config)
+{
+    using ItemType = typename ConfigContainerHelper<T>::ItemType;
+
+    return loadRequiredConfigContainerInParallel(
+                container,
+                parameterName,
+                config,
+                ConfigLoader::defaultContainerItemCreator<ItemType>());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool ConfigLoader::loadRequiredConfigContainerInParallel(
+        T *container,
+        const QString &parameterName,
+        const ConfigObjectNode &config,
+        ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator)
+{
+    container->clear();
+
+    // Validate parameters
+    Q_ASSERT(container != nullptr);
+
+    if (!ConfigNodePath::validateNodeName(parameterName))
+    {
+        const QString errorString = QString("Configuration parameter name [%1] is not valid "
+                                            "(configuration node [%2])!")
+                                    .arg(parameterName, config.nodePath().path());
+        reportError(errorString);
+        return false;
+    }
+
+    // Get container's configuration node
+    const auto *node = config.member(parameterName);
+
+    if (node == nullptr)
+    {
+        const QString errorString = QString("Configuration parameter node with name [%1] was not "
+                                            "found in configuration node [%2]!")
+                                    .arg(parameterName, config.nodePath().path());
+        reportError(errorString);
+        return false;
+    }
+
+    // Load configuration container from the configuration node
+    return loadConfigContainerFromNodeInParallel(container, *node, itemCreator);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool ConfigLoader::loadOptionalConfigContainerInParallel(T *container,
+                                                         const QString &parameterName,
+                                                         const ConfigObjectNode &config,
+                                                         bool *loaded)
+{
+    using ItemType = typename ConfigContainerHelper<T>::ItemType;
+
+    return loadOptionalConfigContainerInParallel(
+                container,
+                parameterName,
+                config,
+                ConfigLoader::defaultContainerItemCreator<ItemType>(),
+                loaded);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool ConfigLoader::loadOptionalConfigContainerInParallel(
+        T *container,
+        const QString &parameterName,
+        const ConfigObjectNode &config,
+        ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator,
+        bool *loaded)
+{
+    container->clear();
+
+    // Validate parameters
+    Q_ASSERT(container != nullptr);
+
+    if (!ConfigNodePath::validateNodeName(parameterName))
+    {
+        const QString errorString = QString("Configuration parameter name [%1] is not valid "
+                                            "(configuration node [%2])!")
+                                    .arg(parameterName, config.nodePath().path());
+        reportError(errorString);
+        return false;
+    }
+
+    // Get container's configuration node
+    const auto *node = config.member(parameterName);
+
+    if (node == nullptr)
+    {
+        // Node was not found, skip it
+        if (loaded != nullptr)
+        {
+            *loaded = false;
+        }
+        return true;
+    }
+
+    // Load configuration container from the configuration node
+    const bool result = loadConfigContainerFromNodeInParallel(container, *node, itemCreator);
+
+    if (loaded != nullptr)
+    {
+        *loaded = result;
+    }
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename T>
 bool ConfigLoader::loadConfigContainerFromNode(
         T *container,
@@ -757,27 +1221,25 @@ bool ConfigLoader::loadConfigContainerFromNode(
     {
         const QString errorString = QString("Configuration container node [%1] is not an Object"
                                             "node!").arg(node.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
     // Load individual configuration items from the node object to the container
     const auto &nodeObject = node.toObject();
 
-    for (const QString &itemName : nodeObject.names())
+    for (const auto &nodeMember : nodeObject)
     {
         // Load item's node
+        const QString &itemName = nodeMember.name();
         auto item = itemCreator(itemName);
-        const auto *itemNode = nodeObject.member(itemName);
-        Q_ASSERT(itemNode != nullptr);
+        const auto *itemNode = &nodeMember.node();
 
         if (!itemNode->isObject())
         {
             const QString errorString = QString("Configuration node [%1] is not an Object node!")
                                         .arg(itemNode->nodePath().path());
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-            handleError(errorString);
+            reportError(errorString);
             return false;
         }
 
@@ -793,4 +1255,106 @@ bool ConfigLoader::loadConfigContainerFromNode(
     return true;
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool ConfigLoader::loadConfigContainerFromNodeInParallel(
+        T *container,
+        const ConfigNode &node,
+        ContainerItemCreator<typename ConfigContainerHelper<T>::ItemType> itemCreator)
+{
+    using ItemType = typename ConfigContainerHelper<T>::ItemType;
+
+    if (!node.isObject())
+    {
+        const QString errorString = QString("Configuration container node [%1] is not an Object"
+                                            "node!").arg(node.nodePath().path());
+        reportError(errorString);
+        return false;
+    }
+
+    // Read the lazy members and cache the node paths on this thread so that the nodes are not
+    // changed while the items are loaded on the thread pool
+    const auto &nodeObject = node.toObject();
+
+    if (!nodeObject.materializeAll())
+    {
+        const QString errorString = QString("Failed to read the members of the configuration "
+                                            "container node [%1]!").arg(node.nodePath().path());
+        reportError(errorString);
+        return false;
+    }
+
+    nodeObject.cacheNodePaths();
+
+    // Load individual configuration items from the node object on the thread pool
+    std::vector<ConfigObjectNode::ConstIterator> nodeMembers;
+    nodeMembers.reserve(static_cast<size_t>(nodeObject.count()));
+
+    for (auto it = nodeObject.begin(); it != nodeObject.end(); ++it)
+    {
+        nodeMembers.push_back(it);
+    }
+
+    const int itemCount = static_cast<int>(nodeMembers.size());
+    std::vector<std::unique_ptr<ItemType>> items(nodeMembers.size());
+
+    executeInParallel(itemCount, [&nodeMembers, &items, &itemCreator](const int index)
+    {
+        // The errors are reported on the calling thread only for the first item that failed
+        const ErrorReportSuppression errorReportSuppression;
+
+        const auto &nodeMember = nodeMembers[static_cast<size_t>(index)];
+        const auto *itemNode = &nodeMember->node();
+
+        if (!itemNode->isObject())
+        {
+            return false;
+        }
+
+        auto item = std::make_unique<ItemType>(itemCreator(nodeMember->name()));
+
+        if (!item->loadConfig(itemNode->toObject()))
+        {
+            return false;
+        }
+
+        items[static_cast<size_t>(index)] = std::move(item);
+        return true;
+    });
+
+    // Add the loaded items to the container in their original order. The items that were not
+    // loaded (the first item that failed and the items after it) are loaded on this thread so that
+    // the errors are reported in the same order as by loadConfigContainerFromNode().
+    for (int index = 0; index < itemCount; index++)
+    {
+        const auto &nodeMember = nodeMembers[static_cast<size_t>(index)];
+        auto &item = items[static_cast<size_t>(index)];
+
+        if (!item)
+        {
+            const auto *itemNode = &nodeMember->node();
+
+            if (!itemNode->isObject())
+            {
+                const QString errorString = QString("Configuration node [%1] is not an Object "
+                                                    "node!").arg(itemNode->nodePath().path());
+                reportError(errorString);
+                return false;
+            }
+
+            item = std::make_unique<ItemType>(itemCreator(nodeMember->name()));
+
+            if (!item->loadConfig(itemNode->toObject()))
+            {
+                return false;
+            }
+        }
+
+        ConfigContainerHelper<T>::addItem(container, nodeMember->name(), std::move(*item));
+    }
+
+    return true;
+}
+
 } // namespace CppConfigFramework
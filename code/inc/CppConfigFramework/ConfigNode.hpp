@@ -22,17 +22,20 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigNodePath.hpp>
+#include <CppConfigFramework/ConfigNodeStatistics.hpp>
 
 // Qt includes
 #include <QtCore/QJsonValue>
 
 // System includes
+#include <cstddef>
 
 // Forward declarations
 namespace CppConfigFramework
 {
 
 class ConfigDerivedObjectNode;
+class ConfigNodeArenaStorage;
 class ConfigNodeReference;
 class ConfigObjectNode;
 class ConfigValueNode;
@@ -78,16 +81,34 @@ public:
     ConfigNode(const ConfigNode &) = delete;
 
     //! Move constructor
-    ConfigNode(ConfigNode &&) noexcept = default;
+    ConfigNode(ConfigNode &&other) noexcept;
 
     //! Destructor
-    virtual ~ConfigNode() = default;
+    virtual ~ConfigNode();
 
     //! Copy assignment operator is disabled
     ConfigNode &operator=(const ConfigNode &) = delete;
 
     //! Move assignment operator
-    ConfigNode &operator=(ConfigNode &&) noexcept = default;
+    ConfigNode &operator=(ConfigNode &&other) noexcept;
+
+    /*!
+     * Allocates memory for a configuration node
+     *
+     * \param   size    Size of the configuration node
+     *
+     * \return  Allocated memory
+     *
+     * \note    The memory is allocated from the arena of the active ConfigNodeArena::Scope (if any)
+     */
+    static void *operator new(std::size_t size);
+
+    /*!
+     * Frees the memory of a configuration node
+     *
+     * \param   pointer Allocated memory
+     */
+    static void operator delete(void *pointer) noexcept;
 
     /*!
      * Clones just the configuration node contents and not the parent
@@ -222,9 +243,72 @@ public:
      * Gets the absolute node path of this configuration node
      *
      * \return  Node path
+     *
+     * \note    The node path is cached until this node or one of its parents is stored under a
+     *          different name or in a different parent
      */
     ConfigNodePath nodePath() const;
 
+    /*!
+     * Fills in the cached node paths of this configuration node, of its ancestors and of all of its
+     * descendants
+     *
+     * \note    Getting a node path that is not cached changes the node (see nodePath()), so the
+     *          node paths have to be cached before the nodes are read from several threads at the
+     *          same time
+     * \note    The Object nodes that were not materialized yet are materialized by this method
+     */
+    void cacheNodePaths() const;
+
+    /*!
+     * Gets the hash of the contents of this configuration node
+     *
+     * \return  Content hash
+     *
+     * The hash covers the value, the reference, the bases and the (indirect) members of the node
+     * but not its location in the configuration tree, so nodes with the same contents have the same
+     * hash regardless of where they are stored.
+     *
+     * \note    The hash is cached until this node or one of its (indirect) members is changed and
+     *          the hashes of the members are reused so only the changed branch is hashed again
+     */
+    quint64 contentHash() const;
+
+    /*!
+     * Checks if this configuration node has the same contents as the other node
+     *
+     * \param   other   Other configuration node
+     *
+     * \retval  true    Nodes have the same contents
+     * \retval  false   Nodes do not have the same contents
+     *
+     * The contents are compared the same way as they are hashed (see contentHash()), so the
+     * locations of the nodes in their configuration trees are not compared.
+     *
+     * \note    Different content hashes are used to detect different nodes without comparing them
+     *          and only the nodes with the same content hash are actually compared
+     */
+    bool hasSameContents(const ConfigNode &other) const;
+
+    /*!
+     * Estimates the memory usage of this configuration node and all of its (indirect) members
+     *
+     * \return  Memory usage
+     *
+     * \note    The Object nodes that were not materialized yet are not materialized by this method
+     */
+    ConfigMemoryUsage memoryUsage() const;
+
+    /*!
+     * Gets the statistics of the structure of this configuration node and all of its (indirect)
+     * members
+     *
+     * \return  Tree statistics
+     *
+     * \note    The Object nodes that were not materialized yet are not materialized by this method
+     */
+    ConfigTreeStatistics treeStatistics() const;
+
     /*!
      * Gets the node at the specified node path
      *
@@ -252,9 +336,103 @@ public:
      */
     static QString typeToString(const Type type);
 
+protected:
+    /*!
+     * Combines a content hash with another hash value
+     *
+     * \param   seed    Content hash
+     * \param   value   Hash value to add to the content hash
+     *
+     * \return  Combined content hash
+     */
+    static quint64 combineContentHash(const quint64 seed, const quint64 value);
+
+    /*!
+     * Calculates the content hash of a string
+     *
+     * \param   string  String
+     *
+     * \return  Content hash
+     */
+    static quint64 stringContentHash(const QString &string);
+
+    /*!
+     * Takes over the cached content hash of a node with the same contents (used when cloning)
+     *
+     * \param   other   Node with the same contents
+     */
+    void copyContentHashCache(const ConfigNode &other) const;
+
+    /*!
+     * Invalidates the cached content hash of this node and of all of the nodes that contain it
+     *
+     * \note    This needs to be called whenever the contents of this node are changed
+     */
+    void invalidateContentHashCache() const;
+
+private:
+    /*!
+     * Calculates the hash of the contents of this configuration node
+     *
+     * \return  Content hash
+     */
+    virtual quint64 calculateContentHash() const = 0;
+
+    /*!
+     * Gets the node whose contents include this node
+     *
+     * \return  Parent that holds this node as a member, DerivedObject node that holds this node as
+     *          its overloads or nullptr if this node is not a part of another node
+     */
+    const ConfigNode *contentOwner() const;
+
+    //! Invalidates the cached node path of this node and all of its member nodes
+    void invalidateNodePathCache() const;
+
+    /*!
+     * Adds the memory usage of this node and all of its (indirect) members
+     *
+     * \param[in,out]  usage           Memory usage
+     * \param          countInstance   Should the node instance be counted (the overrides of a
+     *                                  DerivedObject node are a part of its instance)
+     */
+    void addMemoryUsage(ConfigMemoryUsage *usage, const bool countInstance) const;
+
+    /*!
+     * Adds the statistics of this node and all of its (indirect) members
+     *
+     * \param[in,out]  statistics      Tree statistics
+     * \param          depth           Depth of this node in the tree
+     * \param[in,out]  widestObject    Node with the most members
+     */
+    void addTreeStatistics(ConfigTreeStatistics *statistics,
+                           const int depth,
+                           const ConfigNode **widestObject) const;
+
 private:
+    //! Object node needs access to the member name and the node path cache
+    friend class ConfigObjectNode;
+
     //! Holds a reference to the parent of this node or null if this is a root node
     ConfigObjectNode *m_parent;
+
+    //! Holds the arena that owns the memory of this node or null if it is not owned by an arena
+    ConfigNodeArenaStorage *m_arena;
+
+    //! Holds the name of this node in the parent node (set when the node is stored as a member)
+    QString m_memberName;
+
+    //! Holds the cached absolute node path of this node
+    mutable ConfigNodePath m_nodePathCache;
+
+    //! Holds the cached content hash of this node
+    mutable quint64 m_contentHashCache = 0U;
+
+    //! Flag that indicates if the cached node path is valid
+    mutable bool m_nodePathCacheValid = false;
+
+    //! Flag that indicates if the cached content hash is valid
+    mutable bool m_contentHashCacheValid = false;
 };
 
 } // namespace CppConfigFramework
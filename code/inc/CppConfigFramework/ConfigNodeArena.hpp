@@ -0,0 +1,187 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the arena allocator for the configuration nodes
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+
+// System includes
+#include <cstddef>
+
+// Forward declarations
+namespace CppConfigFramework
+{
+class ConfigNodeArenaStorage;
+}
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This is the arena allocator for the configuration nodes
+ *
+ * While a Scope is active on a thread all of the configuration nodes created on that thread (for
+ * example by the readers or by ConfigNode::clone()) are allocated from the same arena. Freeing an
+ * individual node only decrements the number of live allocations in its arena and the arena
+ * releases all of its memory in one shot once the scope has ended and the last of its nodes has
+ * been destroyed. Ownership of the nodes is not affected: nodes are still owned through
+ * std::unique_ptr and can be freely moved between trees.
+ *
+ * \note    Memory of the nodes that are destroyed before the rest of the tree (for example the
+ *          resolved NodeReference nodes) is not reused until the whole arena is released
+ *
+ * \note    Only the node objects themselves are allocated from the arena. The storage owned by the
+ *          nodes (for example the member containers of the Object nodes, the member names and the
+ *          JSON values) is still allocated from the heap (see ConfigStringPool for sharing the
+ *          member names and the string values).
+ *
+ * \note    A node carries a pointer to the arena that owns it, so freeing a node needs neither an
+ *          allocation header nor a lookup of its arena
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigNodeArena
+{
+public:
+    //! Allocates all of the configuration nodes created on this thread from an arena
+    class CPPCONFIGFRAMEWORK_EXPORT Scope
+    {
+    public:
+        /*!
+         * Constructor
+         *
+         * \param   enabled Holds the "is enabled" flag (a disabled scope has no effect)
+         *
+         * \note    A scope inside an already active scope has no effect so that all nodes are
+         *          allocated from the arena of the outermost scope
+         */
+        explicit Scope(const bool enabled = true);
+
+        //! Copy constructor is disabled
+        Scope(const Scope &) = delete;
+
+        //! Move constructor is disabled
+        Scope(Scope &&) = delete;
+
+        //! Destructor
+        ~Scope();
+
+        //! Copy assignment operator is disabled
+        Scope &operator=(const Scope &) = delete;
+
+        //! Move assignment operator is disabled
+        Scope &operator=(Scope &&) = delete;
+
+    private:
+        //! Holds the "owns the arena" flag
+        bool m_ownsArena = false;
+    };
+
+    //! Suspends the allocation from the arena on this thread (until it is destroyed)
+    class CPPCONFIGFRAMEWORK_EXPORT SuspendScope
+    {
+    public:
+        //! Constructor
+        SuspendScope();
+
+        //! Copy constructor is disabled
+        SuspendScope(const SuspendScope &) = delete;
+
+        //! Move constructor is disabled
+        SuspendScope(SuspendScope &&) = delete;
+
+        //! Destructor
+        ~SuspendScope();
+
+        //! Copy assignment operator is disabled
+        SuspendScope &operator=(const SuspendScope &) = delete;
+
+        //! Move assignment operator is disabled
+        SuspendScope &operator=(SuspendScope &&) = delete;
+
+    private:
+        //! Arena that was active on this thread
+        ConfigNodeArenaStorage *m_suspendedArena;
+    };
+
+public:
+    /*!
+     * Checks if nodes are allocated from an arena on this thread
+     *
+     * \retval  true    Nodes are allocated from an arena
+     * \retval  false   Nodes are allocated from the heap
+     */
+    static bool isActive();
+
+    /*!
+     * Gets the number of arenas that were not released yet
+     *
+     * \return  Number of arenas
+     */
+    static int arenaCount();
+
+    /*!
+     * Allocates memory for a configuration node
+     *
+     * \param   size    Size of the memory block
+     *
+     * \return  Memory block
+     *
+     * \note    The memory is allocated from the arena of the active scope or from the heap
+     */
+    static void *allocate(const std::size_t size);
+
+    /*!
+     * Takes the arena from which the memory block of a configuration node was just allocated
+     *
+     * \param   pointer Memory block of the configuration node that is being constructed
+     *
+     * \return  Arena that owns the memory block or null if it was not allocated from an arena on
+     *          this thread by the last call to allocate() (for example a node on the stack)
+     *
+     * \note    This method is meant to be called by the constructor of the configuration node
+     */
+    static ConfigNodeArenaStorage *takeAllocationArena(const void *pointer) noexcept;
+
+    /*!
+     * Sets the arena that owns the memory block of a configuration node that is being destroyed
+     *
+     * \param   pointer Memory block of the configuration node
+     * \param   arena   Arena that owns the memory block (null if it is allocated from the heap)
+     *
+     * \note    This method is meant to be called by the destructor of the configuration node so
+     *          that the following call to deallocate() knows where the memory block belongs
+     */
+    static void setDeallocationArena(const void *pointer, ConfigNodeArenaStorage *arena) noexcept;
+
+    /*!
+     * Frees the memory of a configuration node
+     *
+     * \param   pointer Memory block returned by allocate()
+     */
+    static void deallocate(void *pointer) noexcept;
+};
+
+} // namespace CppConfigFramework
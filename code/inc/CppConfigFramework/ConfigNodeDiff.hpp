@@ -0,0 +1,196 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the structural difference between two configuration nodes
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodePath.hpp>
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QStringList>
+
+// System includes
+#include <vector>
+
+// Forward declarations
+namespace CppConfigFramework
+{
+class ConfigNode;
+class ConfigObjectNode;
+}
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class holds the structural difference between two configuration nodes
+ *
+ * The difference is described with the node paths of the added, removed and changed nodes:
+ *
+ * - An added or removed node is reported only at the root of the added or removed subtree
+ * - A changed node is reported at the deepest level at which the difference occurs: members of two
+ *   Object nodes are compared one by one while a Value, NodeReference or DerivedObject node with a
+ *   different contents (or a node that changed its type) is reported as a whole
+ *
+ * This makes it possible to reload only the parts of an application whose configuration actually
+ * changed, for example:
+ *
+ * \code
+ * const auto diff = ConfigNodeDiff::compare(*previousConfig, *currentConfig);
+ *
+ * if (diff.isChanged(ConfigNodePath("/subsystem")))
+ * {
+ *     subsystemConfig.loadConfigAtPath(ConfigNodePath("/subsystem"), *currentConfig);
+ * }
+ * \endcode
+ *
+ * \note    The node paths are computed only for the reported nodes and not for every compared node
+ *
+ * \note    Subtrees with the same content hash (see ConfigNode::contentHash()) are skipped only
+ *          after checking that they have the same contents (see ConfigNode::hasSameContents()), so
+ *          a hash collision cannot hide a change
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigNodeDiff
+{
+public:
+    //! Constructor
+    ConfigNodeDiff() = default;
+
+    //! Copy constructor
+    ConfigNodeDiff(const ConfigNodeDiff &) = default;
+
+    //! Move constructor
+    ConfigNodeDiff(ConfigNodeDiff &&) noexcept = default;
+
+    //! Destructor
+    ~ConfigNodeDiff() = default;
+
+    //! Copy assignment operator
+    ConfigNodeDiff &operator=(const ConfigNodeDiff &) = default;
+
+    //! Move assignment operator
+    ConfigNodeDiff &operator=(ConfigNodeDiff &&) noexcept = default;
+
+    /*!
+     * Compares two configuration nodes
+     *
+     * \param   previous    Previous node
+     * \param   current     Current node
+     *
+     * \return  Difference between the nodes
+     *
+     * \note    The reported node paths start at the node path of the previous node
+     */
+    static ConfigNodeDiff compare(const ConfigNode &previous, const ConfigNode &current);
+
+    /*!
+     * Checks if the nodes are equal
+     *
+     * \retval  true    There are no differences
+     * \retval  false   There is at least one difference
+     */
+    bool isEmpty() const;
+
+    /*!
+     * Gets the node paths of the nodes that exist only in the current node
+     *
+     * \return  Absolute node paths (in depth-first order)
+     */
+    const std::vector<ConfigNodePath> &addedNodePaths() const;
+
+    /*!
+     * Gets the node paths of the nodes that exist only in the previous node
+     *
+     * \return  Absolute node paths (in depth-first order)
+     */
+    const std::vector<ConfigNodePath> &removedNodePaths() const;
+
+    /*!
+     * Gets the node paths of the nodes that exist in both nodes but with a different contents
+     *
+     * \return  Absolute node paths (in depth-first order)
+     */
+    const std::vector<ConfigNodePath> &changedNodePaths() const;
+
+    /*!
+     * Checks if the node at the specified path is affected by the difference
+     *
+     * \param   nodePath    Absolute node path
+     *
+     * \retval  true    The node itself, any of its (indirect) members or any of its parents was
+     *                  added, removed or changed
+     * \retval  false   The node is the same in both configuration nodes
+     */
+    bool isChanged(const ConfigNodePath &nodePath) const;
+
+private:
+    /*!
+     * Compares two configuration nodes and stores the differences
+     *
+     * \param   previous    Previous node
+     * \param   current     Current node
+     *
+     * \param[in,out]   nodeNames   Names of the nodes from the compared root node to the nodes
+     */
+    void compareNodes(const ConfigNode &previous,
+                      const ConfigNode &current,
+                      QStringList *nodeNames);
+
+    /*!
+     * Compares the members of two Object nodes and stores the differences
+     *
+     * \param   previous    Previous node
+     * \param   current     Current node
+     *
+     * \param[in,out]   nodeNames   Names of the nodes from the compared root node to the nodes
+     */
+    void compareMembers(const ConfigObjectNode &previous,
+                        const ConfigObjectNode &current,
+                        QStringList *nodeNames);
+
+    /*!
+     * Creates the node path for the node at the specified location
+     *
+     * \param   nodeNames   Names of the nodes from the compared root node to the node
+     *
+     * \return  Absolute node path
+     */
+    ConfigNodePath makeNodePath(const QStringList &nodeNames) const;
+
+private:
+    //! Node path of the compared root node
+    ConfigNodePath m_rootNodePath;
+
+    //! Node paths of the added nodes
+    std::vector<ConfigNodePath> m_addedNodePaths;
+
+    //! Node paths of the removed nodes
+    std::vector<ConfigNodePath> m_removedNodePaths;
+
+    //! Node paths of the changed nodes
+    std::vector<ConfigNodePath> m_changedNodePaths;
+};
+
+} // namespace CppConfigFramework
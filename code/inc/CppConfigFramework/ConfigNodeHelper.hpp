@@ -0,0 +1,180 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains types to make it easier to load parameters directly from config nodes
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueHelper.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include <CppConfigFramework/ConfigWriter.hpp>
+
+// Cedar Framework includes
+#include <CedarFramework/Deserialization.hpp>
+
+// Qt includes
+#include <QtCore/QHash>
+#include <QtCore/QMap>
+
+// System includes
+#include <map>
+#include <unordered_map>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * Loads a parameter value from a config node by deserializing the node's JSON representation
+ *
+ * The Value nodes are first loaded with ConfigValueHelper and the Object nodes are converted to a
+ * QJsonValue only if that is actually needed.
+ */
+template <typename T>
+struct ConfigNodeJsonHelper
+{
+    static bool load(const ConfigNode &node, T *value)
+    {
+        QJsonValue nodeJsonValue;
+
+        switch (node.type())
+        {
+            case ConfigNode::Type::Value:
+            {
+                if (ConfigValueHelper<T>::load(node.toValue(), value))
+                {
+                    return true;
+                }
+
+                nodeJsonValue = node.toValue().value();
+                break;
+            }
+
+            case ConfigNode::Type::Object:
+            {
+                nodeJsonValue = ConfigWriter::convertToJsonValue(node.toObject());
+                break;
+            }
+
+            default:
+            {
+                return false;
+            }
+        }
+
+        if (nodeJsonValue.isUndefined())
+        {
+            return false;
+        }
+
+        return CedarFramework::deserialize(nodeJsonValue, value);
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Loads a parameter value directly from a config node
+ *
+ * Each specialization has a static "load(node, value)" method which returns true if the value was
+ * loaded. The default implementation deserializes the node's JSON representation (see
+ * ConfigNodeJsonHelper) while the specializations for the associative containers with string keys
+ * load their items directly from the members of an Object node so that no intermediate JSON tree is
+ * created for them. Specializations for the user's own data types can be added in the same way.
+ *
+ * \note    The value is changed only if it was successfully loaded
+ */
+template <typename T, typename Enable = void>
+struct ConfigNodeHelper : ConfigNodeJsonHelper<T>
+{
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Loads an associative container with string keys from the members of an Object node
+ *
+ * \tparam  C   Container type
+ * \tparam  V   Data type of the container items
+ */
+template <typename C, typename V>
+struct ConfigNodeMapHelper
+{
+    static bool load(const ConfigNode &node, C *value)
+    {
+        if (!node.isObject())
+        {
+            return ConfigNodeJsonHelper<C>::load(node, value);
+        }
+
+        C container;
+
+        for (const auto &nodeMember : node.toObject())
+        {
+            V item;
+
+            if (!ConfigNodeHelper<V>::load(nodeMember.node(), &item))
+            {
+                return false;
+            }
+
+            container[nodeMember.name()] = std::move(item);
+        }
+
+        *value = std::move(container);
+        return true;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template <typename V>
+struct ConfigNodeHelper<QMap<QString, V>> : ConfigNodeMapHelper<QMap<QString, V>, V>
+{
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template <typename V>
+struct ConfigNodeHelper<QHash<QString, V>> : ConfigNodeMapHelper<QHash<QString, V>, V>
+{
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template <typename V>
+struct ConfigNodeHelper<std::map<QString, V>> : ConfigNodeMapHelper<std::map<QString, V>, V>
+{
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template <typename V>
+struct ConfigNodeHelper<std::unordered_map<QString, V>>
+        : ConfigNodeMapHelper<std::unordered_map<QString, V>, V>
+{
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,97 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the absolute node path lookup index of a configuration tree
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodePath.hpp>
+
+// Qt includes
+#include <QtCore/QHash>
+#include <QtCore/QString>
+
+// System includes
+
+// Forward declarations
+namespace CppConfigFramework
+{
+class ConfigNode;
+class ConfigObjectNode;
+}
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class maps the absolute node paths of a configuration tree to its nodes
+ *
+ * The index is built once with a single walk through the tree and then each lookup is a single
+ * hash lookup instead of a member lookup for every node name in the node path.
+ *
+ * \note    The index holds raw pointers to the nodes so it must not outlive the tree and it must be
+ *          rebuilt whenever the tree is changed (see ConfigObjectNode::buildNodeIndex())
+ * \note    The members of the DerivedObject nodes are not indexed since they are not reachable with
+ *          ConfigNode::nodeAtPath() either
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigNodeIndex
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   rootNode    Root node of the indexed configuration tree
+     */
+    explicit ConfigNodeIndex(const ConfigObjectNode &rootNode);
+
+    /*!
+     * Gets the number of indexed nodes
+     *
+     * \return  Number of indexed nodes (including the root node)
+     */
+    int count() const;
+
+    /*!
+     * Gets the node at the specified absolute node path
+     *
+     * \param   absoluteNodePath    Absolute node path without references to parent nodes ("..")
+     *
+     * \return  Node at the specified node path or null if node was not found
+     */
+    const ConfigNode *node(const ConfigNodePath &absoluteNodePath) const;
+
+private:
+    /*!
+     * Adds the members of an Object node (and their members) to the index
+     *
+     * \param   objectNode  Object node
+     * \param   nodePath    Absolute node path of the Object node
+     */
+    void addMembers(const ConfigObjectNode &objectNode, const QString &nodePath);
+
+private:
+    //! Indexed nodes
+    QHash<QString, const ConfigNode *> m_nodes;
+};
+
+} // namespace CppConfigFramework
@@ -140,11 +140,13 @@ public:
     void setPath(const QString &path);
 
     /*!
-     * Splits the node path to individual node names
+     * Gets the individual node names of the node path
      *
      * \return  Node names
+     *
+     * \note    The node path is split to node names only when its value is set
      */
-    QStringList nodeNames() const;
+    const QStringList &nodeNames() const;
 
     /*!
      * Creates a new path from this path and (if needed) the working path
@@ -203,6 +205,13 @@ public:
      */
     static bool validateNodeName(const QString &name);
 
+private:
+    //! Splits the node path's value to node names and updates the node path's properties
+    void parse();
+
+    //! Updates the node path's properties from the node path's value and node names
+    void updateProperties();
+
 public:
     //! Root node path value
     static const QString ROOT_PATH_VALUE;
@@ -219,6 +228,18 @@ public:
 private:
     //! Node path's value
     QString m_path;
+
+    //! Node names of the node path (node path's value split by the node path separator)
+    QStringList m_nodeNames;
+
+    //! Holds the "is absolute" property of the node path
+    bool m_absolute = false;
+
+    //! Holds the "is valid" property of the node path
+    bool m_valid = false;
+
+    //! Holds the "has unresolved references to parent nodes" property of the node path
+    bool m_hasUnresolvedReferences = false;
 };
 
 } // namespace CppConfigFramework
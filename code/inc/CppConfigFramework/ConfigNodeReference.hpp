@@ -84,6 +84,10 @@ public:
      */
     void setReference(const ConfigNodePath &reference);
 
+private:
+    //! \copydoc    ConfigNode::calculateContentHash()
+    quint64 calculateContentHash() const override;
+
 private:
     //! Reference to a configuration node
     ConfigNodePath m_reference;
@@ -0,0 +1,211 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the memory usage and the structure statistics of a configuration tree
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This structure holds the estimated memory usage of a configuration tree (see
+ * ConfigNode::memoryUsage())
+ *
+ * The sizes are estimated from the sizes of the node instances, the capacities of the containers
+ * and the strings, and the contents of the JSON values (the allocator overhead is not included).
+ *
+ * The storage that is implicitly shared with other configuration trees is reported separately:
+ * the member names and the string values interned in the ConfigStringPool, the JSON of the Object
+ * nodes that were not materialized yet (it is shared with the JSON it was read from, for example
+ * with the ConfigFileCache) and the subtrees that are shared copy-on-write (for example the bases
+ * of the DerivedObject nodes, see ConfigObjectNode::setSharedMembers()). The shared storage is
+ * reported in full by each node that uses it, so the shared sizes of several nodes or trees must
+ * not be summed up.
+ */
+struct CPPCONFIGFRAMEWORK_EXPORT ConfigMemoryUsage
+{
+    //! Holds the memory usage of the node instances of a node type
+    struct CPPCONFIGFRAMEWORK_EXPORT NodeUsage
+    {
+        //! Number of nodes
+        qint64 count = 0;
+
+        //! Size of the node instances in bytes
+        qint64 bytes = 0;
+    };
+
+    //! Value node instances
+    NodeUsage valueNodes;
+
+    //! Object node instances
+    NodeUsage objectNodes;
+
+    //! NodeReference node instances
+    NodeUsage nodeReferenceNodes;
+
+    //! DerivedObject node instances
+    NodeUsage derivedObjectNodes;
+
+    //! Size of the member containers of the Object nodes in bytes
+    qint64 memberContainerBytes = 0;
+
+    //! Size of the member names in bytes (only the names that are not shared)
+    qint64 memberNameBytes = 0;
+
+    //! Size of the member names that are shared through the ConfigStringPool in bytes
+    qint64 sharedMemberNameBytes = 0;
+
+    //! Size of the payloads of the JSON values in the Value nodes in bytes (only the payloads that
+    //! are not shared)
+    qint64 valuePayloadBytes = 0;
+
+    //! Size of the string values that are shared through the ConfigStringPool in bytes
+    qint64 sharedValuePayloadBytes = 0;
+
+    //! Size of the node paths in the NodeReference and DerivedObject nodes in bytes
+    qint64 referenceBytes = 0;
+
+    //! Size of the cached node paths in bytes
+    qint64 nodePathCacheBytes = 0;
+
+    //! Number of Object nodes that were not materialized yet
+    qint64 lazySubtreeCount = 0;
+
+    //! Size of the JSON of the Object nodes that were not materialized yet in bytes (shared)
+    qint64 lazySubtreeBytes = 0;
+
+    //! Number of Object nodes that still share their members with another Object node
+    qint64 sharedSubtreeCount = 0;
+
+    //! Size of the subtrees shared by the Object nodes that still share their members in bytes
+    qint64 sharedSubtreeBytes = 0;
+
+    /*!
+     * Gets the size of the storage that is owned by the configuration tree
+     *
+     * \return  Size in bytes
+     */
+    qint64 ownedBytes() const;
+
+    /*!
+     * Gets the size of the storage that is shared with other configuration trees
+     *
+     * \return  Size in bytes
+     */
+    qint64 sharedBytes() const;
+
+    /*!
+     * Gets the size of all of the storage used by the configuration tree
+     *
+     * \return  Size in bytes
+     */
+    qint64 totalBytes() const;
+
+    /*!
+     * Converts the memory usage to JSON (for example for the benchmark results)
+     *
+     * \return  JSON Object
+     */
+    QJsonObject toJson() const;
+
+    /*!
+     * Converts the memory usage to a human readable summary
+     *
+     * \return  Summary
+     */
+    QString toString() const;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This structure holds the statistics of the structure of a configuration tree (see
+ * ConfigNode::treeStatistics())
+ *
+ * \note    The members of the Object nodes that were not materialized yet are not counted while
+ *          the members of the overrides of the DerivedObject nodes are counted as the members of
+ *          the DerivedObject nodes
+ */
+struct CPPCONFIGFRAMEWORK_EXPORT ConfigTreeStatistics
+{
+    //! Number of Value nodes
+    qint64 valueNodeCount = 0;
+
+    //! Number of Object nodes (the overrides of the DerivedObject nodes are not counted)
+    qint64 objectNodeCount = 0;
+
+    //! Number of NodeReference nodes
+    qint64 nodeReferenceCount = 0;
+
+    //! Number of DerivedObject nodes
+    qint64 derivedObjectCount = 0;
+
+    //! Number of Object nodes that were not materialized yet
+    qint64 lazyObjectCount = 0;
+
+    //! Number of references in the NodeReference nodes and the bases of the DerivedObject nodes
+    qint64 referenceCount = 0;
+
+    //! Number of node levels below the root node of the tree (0 if it has no members)
+    int maxDepth = 0;
+
+    //! Number of members of the Object node with the most members
+    int widestObjectMemberCount = 0;
+
+    //! Absolute node path of the Object node with the most members
+    QString widestObjectNodePath;
+
+    /*!
+     * Gets the number of all nodes
+     *
+     * \return  Number of nodes
+     */
+    qint64 nodeCount() const;
+
+    /*!
+     * Converts the statistics to JSON (for example for the benchmark results)
+     *
+     * \return  JSON Object
+     */
+    QJsonObject toJson() const;
+
+    /*!
+     * Converts the statistics to a human readable summary
+     *
+     * \return  Summary
+     */
+    QString toString() const;
+};
+
+} // namespace CppConfigFramework
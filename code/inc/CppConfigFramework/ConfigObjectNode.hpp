@@ -24,11 +24,20 @@
 #include <CppConfigFramework/ConfigNode.hpp>
 
 // Qt includes
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
 
 // System includes
-#include <map>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
 
 // Forward declarations
+namespace CppConfigFramework
+{
+class ConfigNodeIndex;
+}
 
 // Macros
 
@@ -40,7 +49,139 @@ namespace CppConfigFramework
 //! This class holds the Object configuration node
 class CPPCONFIGFRAMEWORK_EXPORT ConfigObjectNode : public ConfigNode
 {
+private:
+    /*!
+     * Container for the configuration node members
+     *
+     * The members are stored in a vector sorted by their names. Compared to a tree based map this
+     * needs a single allocation for all of the members and a lookup is a binary search over
+     * contiguous memory, which is what matters for configuration trees since they are mostly only
+     * read after they are created.
+     */
+    using MemberContainer = std::vector<std::pair<QString, std::unique_ptr<ConfigNode>>>;
+
 public:
+    /*!
+     * Function that reads the members of a node from the JSON Object that was stored with
+     * setLazyMembers()
+     *
+     * \param   jsonObject  JSON Object
+     *
+     * \return  Object node that holds the members
+     */
+    using LazyMemberReader = std::unique_ptr<ConfigObjectNode> (*)(const QJsonObject &jsonObject);
+
+    /*!
+     * Forward iterator over the members of the node (ordered by their names)
+     *
+     * \tparam  NodeType            Type of the member node (const or non-const ConfigNode)
+     * \tparam  ContainerIterator   Iterator type of the member container
+     *
+     * Dereferencing the iterator gives access to the name and the node of the current member
+     * without copying them or looking them up again.
+     */
+    template<typename NodeType, typename ContainerIterator>
+    class MemberIterator
+    {
+    public:
+        //! Iterator category
+        using iterator_category = std::forward_iterator_tag;
+
+        //! Value type (the iterator itself gives access to the current member)
+        using value_type = MemberIterator;
+
+        //! Difference type
+        using difference_type = std::ptrdiff_t;
+
+        //! Pointer type
+        using pointer = const MemberIterator *;
+
+        //! Reference type
+        using reference = const MemberIterator &;
+
+        //! Constructor
+        MemberIterator() = default;
+
+        /*!
+         * Constructor
+         *
+         * \param   iterator    Iterator of the member container
+         */
+        explicit MemberIterator(ContainerIterator iterator)
+            : m_iterator(iterator)
+        {
+        }
+
+        /*!
+         * Gets the name of the current member
+         *
+         * \return  Member name
+         */
+        const QString &name() const
+        {
+            return m_iterator->first;
+        }
+
+        /*!
+         * Gets the current member node
+         *
+         * \return  Member node
+         */
+        NodeType &node() const
+        {
+            return *m_iterator->second;
+        }
+
+        //! Gives access to the current member
+        reference operator*() const
+        {
+            return *this;
+        }
+
+        //! Gives access to the current member
+        pointer operator->() const
+        {
+            return this;
+        }
+
+        //! Prefix increment operator
+        MemberIterator &operator++()
+        {
+            ++m_iterator;
+            return *this;
+        }
+
+        //! Postfix increment operator
+        MemberIterator operator++(int)
+        {
+            auto previous = *this;
+            ++m_iterator;
+            return previous;
+        }
+
+        //! "Equal to" operator
+        bool operator==(const MemberIterator &other) const
+        {
+            return (m_iterator == other.m_iterator);
+        }
+
+        //! "Not equal to" operator
+        bool operator!=(const MemberIterator &other) const
+        {
+            return (m_iterator != other.m_iterator);
+        }
+
+    private:
+        //! Iterator of the member container
+        ContainerIterator m_iterator;
+    };
+
+    //! Iterator over the members of the node
+    using Iterator = MemberIterator<ConfigNode, MemberContainer::iterator>;
+
+    //! Const iterator over the members of the node
+    using ConstIterator = MemberIterator<const ConfigNode, MemberContainer::const_iterator>;
+
     /*!
      * Constructor
      *
@@ -94,6 +235,14 @@ public:
      */
     bool contains(const QString &name) const;
 
+    //! \copydoc    ConfigObjectNode::contains()
+    bool contains(QLatin1String name) const;
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+    //! \copydoc    ConfigObjectNode::contains()
+    bool contains(QStringView name) const;
+#endif
+
     /*!
      * Gets the names of all member nodes in this node
      *
@@ -101,12 +250,41 @@ public:
      */
     QStringList names() const;
 
+    /*!
+     * Gets an iterator to the first member of this node
+     *
+     * \return  Iterator
+     */
+    Iterator begin();
+
+    //! \copydoc    ConfigObjectNode::begin()
+    ConstIterator begin() const;
+
+    //! \copydoc    ConfigObjectNode::begin()
+    ConstIterator cbegin() const;
+
+    /*!
+     * Gets an iterator past the last member of this node
+     *
+     * \return  Iterator
+     */
+    Iterator end();
+
+    //! \copydoc    ConfigObjectNode::end()
+    ConstIterator end() const;
+
+    //! \copydoc    ConfigObjectNode::end()
+    ConstIterator cend() const;
+
     /*!
      * Gets the name of the specified node
      *
      * \param   node    Configuration node to find
      *
      * \return  Name of the configuration node or an empty string if the member was not found
+     *
+     * \note    The node remembers the name under which it was stored so in the common case this is
+     *          just a lookup instead of a search through all of the members
      */
     QString name(const ConfigNode &node) const;
 
@@ -122,6 +300,20 @@ public:
     //! \copydoc    ConfigObjectNode::member()
     ConfigNode *member(const QString &name);
 
+    //! \copydoc    ConfigObjectNode::member()
+    const ConfigNode *member(QLatin1String name) const;
+
+    //! \copydoc    ConfigObjectNode::member()
+    ConfigNode *member(QLatin1String name);
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+    //! \copydoc    ConfigObjectNode::member()
+    const ConfigNode *member(QStringView name) const;
+
+    //! \copydoc    ConfigObjectNode::member()
+    ConfigNode *member(QStringView name);
+#endif
+
     /*!
      * Inserts a new member node or replaces an existing member node with the same name
      *
@@ -148,6 +340,17 @@ public:
      */
     bool remove(const QString &name);
 
+    /*!
+     * Removes a member with the specified name and takes the ownership of it
+     *
+     * \param   name    Name of the member node
+     *
+     * \return  Member node or null in case the member was not found
+     *
+     * \note    The parent of the returned node is reset so it becomes a root node
+     */
+    std::unique_ptr<ConfigNode> take(const QString &name);
+
     //! Removes all members
     void removeAll();
 
@@ -162,9 +365,168 @@ public:
      */
     void apply(const ConfigObjectNode &other);
 
+    /*!
+     * Applies values from the specified node to the matching nodes in this node
+     *
+     * \param   other   Configuration node to apply
+     *
+     * Same as the other apply() method except that the member nodes of the other node are moved to
+     * this node instead of being copied so the other node is left empty.
+     */
+    void apply(ConfigObjectNode &&other);
+
+    /*!
+     * Gets the number of unresolved nodes (NodeReference and DerivedObject nodes) in this node and
+     * all of its descendants
+     *
+     * \return  Number of unresolved nodes
+     *
+     * \note    The number is kept up to date when members are added, replaced or removed so this is
+     *          a constant-time operation
+     */
+    int unresolvedReferenceCount() const;
+
+    /*!
+     * Builds the absolute node path lookup index of this configuration tree
+     *
+     * Once the index is built ConfigNode::nodeAtPath() looks up the node paths without references
+     * to parent nodes ("..") of all of the nodes in this tree with a single hash lookup.
+     *
+     * \note    The index can only be built for the root node and it is dropped as soon as any of
+     *          the nodes in the tree is changed, so it is meant for trees that are only read after
+     *          they are created (for example the frozen snapshots)
+     * \note    Building the index is not thread-safe, so it has to be built before the tree is
+     *          shared with other threads
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (this is not the root node)
+     */
+    bool buildNodeIndex() const;
+
+    /*!
+     * Checks if this node has an absolute node path lookup index
+     *
+     * \retval  true    This node has an index
+     * \retval  false   This node does not have an index
+     */
+    bool hasNodeIndex() const;
+
+    /*!
+     * Replaces all members of this node with members that are read from the JSON Object only when
+     * they are first accessed
+     *
+     * \param   jsonObject  JSON Object with the members
+     * \param   reader      Function that reads the members from the JSON Object
+     *
+     * Any access to the members (lookup, iteration, modification, comparison, hashing) first reads
+     * them with the reader function. Until then the node holds only a (shared) reference to the
+     * JSON Object so the subtrees that are never accessed are never converted to nodes.
+     *
+     * \note    The members must not contain any unresolved nodes (NodeReference and DerivedObject
+     *          nodes) since they would not be counted by unresolvedReferenceCount()
+     * \note    Reading the members changes the node even through const methods (see materialize())
+     *          so a tree with lazy members must not be accessed from several threads at the same
+     *          time until it is materialized with materializeAll()
+     */
+    void setLazyMembers(const QJsonObject &jsonObject, LazyMemberReader reader);
+
+    /*!
+     * Replaces all members of this node with the members of an Object node that is shared with
+     * other nodes (copy-on-write)
+     *
+     * \param   sharedNode  Shared Object node
+     *
+     * Like with setLazyMembers() the members are copied from the shared node only when they are
+     * first accessed. A copied Object member again only refers to the corresponding member of the
+     * shared node, so changing a node copies just the nodes on the node path to it while the rest
+     * of the subtree stays shared.
+     *
+     * \note    The shared node must be fully resolved, its content hash must already be calculated
+     *          (see contentHash()) and it must not be changed anymore
+     * \note    Reading the members changes the node even through const methods (see materialize())
+     */
+    void setSharedMembers(const std::shared_ptr<const ConfigObjectNode> &sharedNode);
+
+    /*!
+     * Checks if the members of this node were already read (its members can still have lazy
+     * members)
+     *
+     * \retval  true    Members were read
+     * \retval  false   Members were not read yet
+     */
+    bool isMaterialized() const;
+
+    /*!
+     * Reads the lazy members of this node (but not the lazy members of its members)
+     *
+     * \retval  true    Success (or there were no lazy members)
+     * \retval  false   Failure (the reader function failed to read the members so the node still
+     *                  has its lazy members and it appears to have no members until they are read)
+     *
+     * \note    This method is called by all methods that access the members (even the const ones)
+     *          and it changes the node, so it is not thread-safe: the same tree must not be
+     *          accessed from several threads at the same time until it is materialized with
+     *          materializeAll() (for example by ConfigSnapshotPublisher::freeze())
+     */
+    bool materialize() const;
+
+    /*!
+     * Reads the lazy members of this node and of all of its (indirect) members
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (some of the lazy members could not be read)
+     *
+     * \note    This method is not thread-safe (see materialize())
+     */
+    bool materializeAll() const;
+
+private:
+    //! \copydoc    ConfigNode::calculateContentHash()
+    quint64 calculateContentHash() const override;
+
+    /*!
+     * Updates the number of unresolved nodes in this node and in all of the ancestors that hold it
+     * as a member
+     *
+     * \param   delta   Change in the number of unresolved nodes
+     */
+    void updateUnresolvedReferenceCount(const int delta);
+
+    //! Holds the lazy members of a node
+    struct LazyMembers
+    {
+        //! JSON Object with the members
+        QJsonObject jsonObject;
+
+        //! Function that reads the members from the JSON Object
+        LazyMemberReader reader;
+
+        //! Shared Object node from which the members are copied (instead of reading the JSON)
+        std::shared_ptr<const ConfigObjectNode> sharedNode;
+    };
+
 private:
-    //! Configuration node members
-    std::map<QString, std::unique_ptr<ConfigNode>> m_members;
+    //! Base node needs access to the members to invalidate their cached node paths and to walk
+    //! them without reading the lazy members
+    friend class ConfigNode;
+
+    //! DerivedObject node needs to register itself as the holder of its overloads
+    friend class ConfigDerivedObjectNode;
+
+    //! Configuration node members (mutable since the lazy members are read on the first access)
+    mutable MemberContainer m_members;
+
+    //! Lazy members that were not read yet
+    mutable std::unique_ptr<LazyMembers> m_lazyMembers;
+
+    //! Number of unresolved nodes (NodeReference and DerivedObject nodes) in the members
+    int m_unresolvedReferenceCount = 0;
+
+    //! DerivedObject node that holds this node as its overloads (its content hash depends on it)
+    ConfigDerivedObjectNode *m_derivedObject = nullptr;
+
+    //! Absolute node path lookup index of this configuration tree (only for a root node)
+    mutable std::shared_ptr<const ConfigNodeIndex> m_nodeIndex;
 };
 
 } // namespace CppConfigFramework
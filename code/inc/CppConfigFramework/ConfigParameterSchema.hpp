@@ -0,0 +1,402 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the field descriptors for describing the configuration parameters of a configuration
+ * structure
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigParameterValidator.hpp>
+
+// Qt includes
+
+// System includes
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * Checks if the configuration parameter name is valid
+ *
+ * \param   name    Configuration parameter name
+ *
+ * \retval  true    Valid
+ * \retval  false   Invalid
+ *
+ * \note    The rules are the same as in ConfigNodePath::validateNodeName()
+ */
+constexpr bool isValidConfigParameterName(const char *name)
+{
+    // Check if the name starts with a letter and continues with an optional string of alphanumeric
+    // and "_" characters
+    if (name == nullptr)
+    {
+        return false;
+    }
+
+    if (((name[0] < 'a') || (name[0] > 'z')) && ((name[0] < 'A') || (name[0] > 'Z')))
+    {
+        return false;
+    }
+
+    for (int i = 1; name[i] != '\0'; i++)
+    {
+        const char character = name[i];
+
+        if (((character < 'a') || (character > 'z')) &&
+            ((character < 'A') || (character > 'Z')) &&
+            ((character < '0') || (character > '9')) &&
+            (character != '_'))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This function is intentionally not constexpr: when a field descriptor with an invalid name is
+ * created in a constant expression the compiler reports that this function cannot be called
+ *
+ * \param   name    Configuration parameter name
+ *
+ * \note    When the field descriptor is created at runtime the invalid name is reported by
+ *          ConfigLoader::loadConfigParameterSchema()
+ */
+inline void configParameterNameIsNotValid(const char *name)
+{
+    Q_UNUSED(name)
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This class describes a configuration parameter of a configuration structure
+ *
+ * \tparam  Loader      Configuration structure (needs to be derived from ConfigLoader class)
+ * \tparam  T           Data type of the parameter
+ * \tparam  Validator   Type of the validator for the parameter value
+ *
+ * The validator is stored by value and called directly so that it does not need to be wrapped in
+ * a ConfigParameterValidator. If the validator is a literal type (for example
+ * ConfigParameterDefaultValidator and ConfigParameterRangeValidator of an arithmetic type) the
+ * field descriptor can be created in a constant expression and its name is then validated at
+ * compile time.
+ */
+template<typename Loader, typename T, typename Validator>
+class ConfigParameterField
+{
+public:
+    //! Configuration structure
+    using LoaderType = Loader;
+
+    //! Data type of the parameter
+    using ValueType = T;
+
+    //! Type of the validator for the parameter value
+    using ValidatorType = Validator;
+
+    /*!
+     * Constructor
+     *
+     * \param   member      Pointer to the member that holds the parameter value
+     * \param   name        Name of the parameter (member name in the configuration node)
+     * \param   required    Is the parameter required
+     * \param   validator   Validator for the parameter value
+     */
+    constexpr ConfigParameterField(T Loader::*member,
+                                   const char *name,
+                                   const bool required,
+                                   const Validator &validator)
+        : m_member(member),
+          m_name(isValidConfigParameterName(name) ? name
+                                                  : (configParameterNameIsNotValid(name), name)),
+          m_required(required),
+          m_validator(validator)
+    {
+    }
+
+    /*!
+     * Gets the pointer to the member that holds the parameter value
+     *
+     * \return  Member pointer
+     */
+    constexpr T Loader::*member() const
+    {
+        return m_member;
+    }
+
+    /*!
+     * Gets the name of the parameter
+     *
+     * \return  Parameter name
+     */
+    constexpr const char *name() const
+    {
+        return m_name;
+    }
+
+    /*!
+     * Checks if the parameter is required
+     *
+     * \retval  true    Required
+     * \retval  false   Optional
+     */
+    constexpr bool isRequired() const
+    {
+        return m_required;
+    }
+
+    /*!
+     * Gets the validator for the parameter value
+     *
+     * \return  Validator
+     */
+    constexpr const Validator &validator() const
+    {
+        return m_validator;
+    }
+
+private:
+    //! Holds the pointer to the member that holds the parameter value
+    T Loader::*m_member;
+
+    //! Holds the name of the parameter
+    const char *m_name;
+
+    //! Holds the "is required" flag
+    bool m_required;
+
+    //! Holds the validator for the parameter value
+    Validator m_validator;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Creates a descriptor for a required configuration parameter
+ *
+ * \tparam  Loader      Configuration structure (needs to be derived from ConfigLoader class)
+ * \tparam  T           Data type of the parameter
+ * \tparam  Validator   Type of the validator for the parameter value
+ *
+ * \param   member      Pointer to the member that holds the parameter value
+ * \param   name        Name of the parameter (member name in the configuration node)
+ * \param   validator   Validator for the parameter value
+ *
+ * \return  Field descriptor
+ */
+template<typename Loader, typename T, typename Validator = ConfigParameterDefaultValidator>
+constexpr ConfigParameterField<Loader, T, Validator> requiredConfigParameter(
+        T Loader::*member,
+        const char *name,
+        const Validator &validator = Validator())
+{
+    return ConfigParameterField<Loader, T, Validator>(member, name, true, validator);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Creates a descriptor for an optional configuration parameter
+ *
+ * \tparam  Loader      Configuration structure (needs to be derived from ConfigLoader class)
+ * \tparam  T           Data type of the parameter
+ * \tparam  Validator   Type of the validator for the parameter value
+ *
+ * \param   member      Pointer to the member that holds the parameter value
+ * \param   name        Name of the parameter (member name in the configuration node)
+ * \param   validator   Validator for the parameter value
+ *
+ * \return  Field descriptor
+ *
+ * \note    The member keeps its value if the parameter is not present in the configuration node
+ */
+template<typename Loader, typename T, typename Validator = ConfigParameterDefaultValidator>
+constexpr ConfigParameterField<Loader, T, Validator> optionalConfigParameter(
+        T Loader::*member,
+        const char *name,
+        const Validator &validator = Validator())
+{
+    return ConfigParameterField<Loader, T, Validator>(member, name, false, validator);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Creates a schema from the configuration parameter field descriptors
+ *
+ * \tparam  Fields  Types of the field descriptors
+ *
+ * \param   fields  Field descriptors
+ *
+ * \return  Schema
+ *
+ * A schema is meant to be declared as a static constexpr variable in the loadConfigParameters()
+ * method of the configuration structure and then loaded with
+ * ConfigLoader::loadConfigParameterSchema().
+ */
+template<typename... Fields>
+constexpr std::tuple<Fields...> makeConfigParameterSchema(const Fields &...fields)
+{
+    static_assert(sizeof...(Fields) > 0, "Schema needs to contain at least one field");
+
+    return std::tuple<Fields...>(fields...);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Calls the function for each of the field descriptors in the schema
+ *
+ * \tparam  Schema      Schema type
+ * \tparam  Function    Function type
+ * \tparam  Indexes     Indexes of the field descriptors
+ *
+ * \param   schema      Schema
+ * \param   function    Function (its parameters are the field descriptor and its index)
+ */
+template<typename Schema, typename Function, std::size_t... Indexes>
+void forEachConfigParameterField(const Schema &schema,
+                                 Function &&function,
+                                 std::index_sequence<Indexes...>)
+{
+    using Expander = int[];
+    (void)Expander { 0, (function(std::get<Indexes>(schema), Indexes), 0)... };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Calls the function for the field descriptor with the specified index in the schema
+ *
+ * \tparam  Index       Index of the field descriptor
+ * \tparam  Schema      Schema type
+ * \tparam  Function    Function type
+ *
+ * \param   schema      Schema
+ * \param   function    Function (its parameters are the field descriptor and its index)
+ */
+template<std::size_t Index, typename Schema, typename Function>
+void visitConfigParameterFieldAt(const Schema &schema, Function &function)
+{
+    function(std::get<Index>(schema), Index);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Calls the function for the field descriptor with the specified index in the schema
+ *
+ * \tparam  Schema      Schema type
+ * \tparam  Function    Function type
+ * \tparam  Indexes     Indexes of the field descriptors
+ *
+ * \param   schema      Schema
+ * \param   index       Index of the field descriptor (must be valid)
+ * \param   function    Function (its parameters are the field descriptor and its index)
+ *
+ * The function is called through a table of the instantiations for each index so there is no
+ * need to visit all of the field descriptors.
+ */
+template<typename Schema, typename Function, std::size_t... Indexes>
+void visitConfigParameterField(const Schema &schema,
+                               const std::size_t index,
+                               Function &function,
+                               std::index_sequence<Indexes...>)
+{
+    using Visitor = void (*)(const Schema &, Function &);
+    static constexpr Visitor visitors[] = {
+        &visitConfigParameterFieldAt<Indexes, Schema, Function>...
+    };
+
+    visitors[index](schema, function);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the names of the parameters in the schema
+ *
+ * \tparam  Schema      Schema type
+ * \tparam  Indexes     Indexes of the field descriptors
+ *
+ * \param   schema  Schema
+ *
+ * \return  Parameter names (in the order of the field descriptors)
+ */
+template<typename Schema, std::size_t... Indexes>
+std::array<const char *, sizeof...(Indexes)> configParameterFieldNames(
+        const Schema &schema,
+        std::index_sequence<Indexes...>)
+{
+    return { { std::get<Indexes>(schema).name()... } };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the indexes of the field descriptors ordered by their parameter names
+ *
+ * \tparam  FieldCount  Number of field descriptors
+ *
+ * \param   names   Parameter names (see configParameterFieldNames())
+ *
+ * \return  Indexes of the field descriptors
+ *
+ * The order is the same as the order of the members in a ConfigObjectNode (the parameter names
+ * contain only ASCII characters) and the field descriptors with the same name keep their order.
+ */
+template<std::size_t FieldCount>
+std::array<std::size_t, FieldCount> sortConfigParameterFields(
+        const std::array<const char *, FieldCount> &names)
+{
+    std::array<std::size_t, FieldCount> order;
+
+    for (std::size_t i = 0U; i < FieldCount; i++)
+    {
+        order[i] = i;
+    }
+
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&names](const std::size_t left, const std::size_t right)
+    {
+        return (std::strcmp(names[left], names[right]) < 0);
+    });
+
+    return order;
+}
+
+} // namespace CppConfigFramework
@@ -72,6 +72,33 @@ bool defaultConfigParameterValidator(const T &value)
 
 // -------------------------------------------------------------------------------------------------
 
+/*!
+ * This configuration parameter validator does not do any validation, but just returns "true"
+ *
+ * Unlike defaultConfigParameterValidator() it can be used for values of any data type without
+ * wrapping it in a ConfigParameterValidator (for example in a ConfigParameterField).
+ */
+struct ConfigParameterDefaultValidator
+{
+    /*!
+     * Validates the value
+     *
+     * \tparam  T   Data type of the value to validate
+     *
+     * \param   value   Value to validate
+     *
+     * \retval  true    Value is valid
+     */
+    template<typename T>
+    constexpr bool operator()(const T &value) const
+    {
+        Q_UNUSED(value)
+        return true;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
 /*!
  * This configuration parameter validator checks if the value is in the defined range using the
  * algorithm: minValue ≤ value ≤ maxValue
@@ -88,7 +115,7 @@ public:
      * \param   minValue    Min value
      * \param   maxValue    Max value
      */
-    ConfigParameterRangeValidator(const T &minValue, const T &maxValue)
+    constexpr ConfigParameterRangeValidator(const T &minValue, const T &maxValue)
         : m_minValue(minValue),
           m_maxValue(maxValue)
     {
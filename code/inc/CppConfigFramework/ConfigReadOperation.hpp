@@ -0,0 +1,167 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that tracks an asynchronous configuration read and allows canceling it
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QMutex>
+#include <QtCore/QWaitCondition>
+
+// System includes
+#include <atomic>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class tracks an asynchronous configuration read (see ConfigReader::readAsync())
+ *
+ * Canceling is cooperative: while a Scope of the operation is active on a thread the reader checks
+ * the "is canceled" flag before reading each configuration file, between the includes and before
+ * each reference resolution cycle and stops reading as soon as it sees that the operation was
+ * canceled. This way a read that was superseded (for example by a newer reload of the same
+ * configuration) can be dropped early instead of running to completion.
+ *
+ * \note    All methods are thread-safe
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigReadOperation
+{
+public:
+    //! Makes the operation active on this thread (until it is destroyed)
+    class CPPCONFIGFRAMEWORK_EXPORT Scope
+    {
+    public:
+        /*!
+         * Constructor
+         *
+         * \param   operation   Operation that shall be active on this thread (can be null)
+         */
+        explicit Scope(const ConfigReadOperation *operation);
+
+        //! Copy constructor is disabled
+        Scope(const Scope &) = delete;
+
+        //! Move constructor is disabled
+        Scope(Scope &&) = delete;
+
+        //! Destructor
+        ~Scope();
+
+        //! Copy assignment operator is disabled
+        Scope &operator=(const Scope &) = delete;
+
+        //! Move assignment operator is disabled
+        Scope &operator=(Scope &&) = delete;
+
+    private:
+        //! Operation that was active on this thread
+        const ConfigReadOperation *m_previousOperation;
+    };
+
+public:
+    //! Constructor
+    ConfigReadOperation() = default;
+
+    //! Copy constructor is disabled
+    ConfigReadOperation(const ConfigReadOperation &) = delete;
+
+    //! Move constructor is disabled
+    ConfigReadOperation(ConfigReadOperation &&) = delete;
+
+    //! Destructor
+    ~ConfigReadOperation() = default;
+
+    //! Copy assignment operator is disabled
+    ConfigReadOperation &operator=(const ConfigReadOperation &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigReadOperation &operator=(ConfigReadOperation &&) = delete;
+
+    //! Requests the operation to be canceled
+    void cancel();
+
+    /*!
+     * Checks if the operation was canceled
+     *
+     * \retval  true    Canceled
+     * \retval  false   Not canceled
+     */
+    bool isCanceled() const;
+
+    /*!
+     * Checks if the operation is finished
+     *
+     * \retval  true    Finished
+     * \retval  false   Still running
+     */
+    bool isFinished() const;
+
+    /*!
+     * Waits until the operation is finished
+     *
+     * \param   timeout Timeout in milliseconds (negative value means no timeout)
+     *
+     * \retval  true    Operation is finished
+     * \retval  false   Timeout
+     */
+    bool waitForFinished(const int timeout = -1) const;
+
+    //! Marks the operation as finished and wakes up the waiting threads
+    void finish();
+
+    /*!
+     * Gets the operation that is active on this thread
+     *
+     * \return  Active operation or null if no operation is active
+     */
+    static const ConfigReadOperation *current();
+
+    /*!
+     * Checks if the operation that is active on this thread was canceled
+     *
+     * \retval  true    Canceled
+     * \retval  false   Not canceled (or no operation is active)
+     */
+    static bool isCurrentCanceled();
+
+private:
+    //! Mutex for protecting the "is finished" flag
+    mutable QMutex m_mutex;
+
+    //! Wait condition for waiting until the operation is finished
+    mutable QWaitCondition m_finishedCondition;
+
+    //! Holds the "is canceled" flag (checked without locking the mutex)
+    std::atomic<bool> m_canceled { false };
+
+    //! Holds the "is finished" flag
+    bool m_finished = false;
+};
+
+} // namespace CppConfigFramework
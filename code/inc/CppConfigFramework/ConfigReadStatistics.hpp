@@ -0,0 +1,474 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the timings and counters of reading a configuration
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeStatistics.hpp>
+
+// Qt includes
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+
+// System includes
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace CppConfigFramework
+{
+class ConfigNode;
+}
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class holds the timings and counters of reading a configuration
+ *
+ * While a RecordScope is active on a thread the time spent in each phase of reading the
+ * configurations on that thread (and in the tasks that they start on the thread pool) is recorded
+ * together with the number of created and cloned configuration nodes.
+ *
+ * If no statistics are being recorded each instrumentation point just checks a thread-local
+ * pointer, so the statistics do not cost anything when they are not used.
+ *
+ * \note    All times are in nanoseconds and they are inclusive, for example the time of an include
+ *          also contains the time of the includes in the included configuration. The times of the
+ *          files that are read concurrently are summed up so they can exceed the total read time.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigReadStatistics
+{
+public:
+    //! Enumerates the phases of reading a configuration
+    enum class Phase
+    {
+        //! Reading the contents of the configuration files
+        FileIo,
+
+        //! Parsing the contents of the configuration files
+        JsonParsing,
+
+        //! Reading the configuration nodes from the 'config' member
+        ReadObjectNode,
+
+        //! Resolving the references in the configuration nodes
+        ResolveReferences,
+
+        //! Applying the read configuration nodes to the complete configuration
+        Apply,
+
+        //! Transforming the configuration based on the source and destination node paths
+        TransformConfig
+    };
+
+    //! Number of items in the Phase enum
+    static constexpr size_t PHASE_COUNT = 6U;
+
+    //! Holds the statistics of a phase
+    struct CPPCONFIGFRAMEWORK_EXPORT PhaseStatistics
+    {
+        //! Number of times the phase was executed
+        int count = 0;
+
+        //! Total time spent in the phase
+        qint64 elapsedNanoseconds = 0;
+    };
+
+    //! Holds the statistics of an include
+    struct CPPCONFIGFRAMEWORK_EXPORT Include
+    {
+        //! Type of the include
+        QString type;
+
+        //! Absolute path to the included file (empty if the include has no 'file_path' member)
+        QString filePath;
+
+        //! Time spent reading the include
+        qint64 elapsedNanoseconds = 0;
+    };
+
+    //! Holds the statistics of a single ConfigReaderBase::resolveReferences() call
+    struct CPPCONFIGFRAMEWORK_EXPORT ReferenceResolution
+    {
+        /*!
+         * Number of nodes resolved in each resolution cycle (the size of the container is the
+         * number of cycles)
+         *
+         * A cycle resolves the nodes whose dependencies were resolved in the previous cycle or, if
+         * there are no such nodes, the node that breaks a reference cycle with the external
+         * configuration nodes.
+         */
+        std::vector<int> resolvedNodeCounts;
+
+        //! Time spent resolving the references
+        qint64 elapsedNanoseconds = 0;
+    };
+
+    //! Records the statistics of the configurations read on this thread (until it is destroyed)
+    class CPPCONFIGFRAMEWORK_EXPORT RecordScope
+    {
+    public:
+        /*!
+         * Constructor
+         *
+         * \param   statistics  Statistics in which the configuration reading shall be recorded
+         */
+        explicit RecordScope(ConfigReadStatistics *statistics);
+
+        //! Copy constructor is disabled
+        RecordScope(const RecordScope &) = delete;
+
+        //! Move constructor is disabled
+        RecordScope(RecordScope &&) = delete;
+
+        //! Destructor
+        ~RecordScope();
+
+        //! Copy assignment operator is disabled
+        RecordScope &operator=(const RecordScope &) = delete;
+
+        //! Move assignment operator is disabled
+        RecordScope &operator=(RecordScope &&) = delete;
+
+    private:
+        //! Statistics that were active on this thread
+        ConfigReadStatistics *m_previousStatistics;
+    };
+
+    /*!
+     * Records and logs the statistics of a configuration read (until it is destroyed) if the
+     * debug output of the LoggingCategory::ConfigReadStatistics logging category is enabled
+     *
+     * \note    The scope has no effect if statistics are already being recorded on this thread
+     */
+    class CPPCONFIGFRAMEWORK_EXPORT LogScope
+    {
+    public:
+        /*!
+         * Constructor
+         *
+         * \param   description Description of the read configuration (for example its file path)
+         */
+        explicit LogScope(const QString &description);
+
+        //! Copy constructor is disabled
+        LogScope(const LogScope &) = delete;
+
+        //! Move constructor is disabled
+        LogScope(LogScope &&) = delete;
+
+        //! Destructor
+        ~LogScope();
+
+        //! Copy assignment operator is disabled
+        LogScope &operator=(const LogScope &) = delete;
+
+        //! Move assignment operator is disabled
+        LogScope &operator=(LogScope &&) = delete;
+
+    private:
+        //! Description of the read configuration
+        QString m_description;
+
+        //! Recorded statistics (null if the statistics are not logged)
+        std::unique_ptr<ConfigReadStatistics> m_statistics;
+
+        //! Record scope of the statistics
+        std::unique_ptr<RecordScope> m_recordScope;
+    };
+
+    //! Measures the time of a phase (until it is destroyed)
+    class CPPCONFIGFRAMEWORK_EXPORT PhaseTimer
+    {
+    public:
+        /*!
+         * Constructor
+         *
+         * \param   phase   Measured phase
+         *
+         * \note    The timer has no effect if no statistics are being recorded on this thread
+         */
+        explicit PhaseTimer(const Phase phase);
+
+        //! Copy constructor is disabled
+        PhaseTimer(const PhaseTimer &) = delete;
+
+        //! Move constructor is disabled
+        PhaseTimer(PhaseTimer &&) = delete;
+
+        //! Destructor
+        ~PhaseTimer();
+
+        //! Copy assignment operator is disabled
+        PhaseTimer &operator=(const PhaseTimer &) = delete;
+
+        //! Move assignment operator is disabled
+        PhaseTimer &operator=(PhaseTimer &&) = delete;
+
+    private:
+        //! Statistics in which the phase is recorded
+        ConfigReadStatistics *m_statistics;
+
+        //! Measured phase
+        Phase m_phase;
+
+        //! Timer
+        QElapsedTimer m_timer;
+    };
+
+    //! Measures the time of reading an include (until it is destroyed)
+    class CPPCONFIGFRAMEWORK_EXPORT IncludeTimer
+    {
+    public:
+        /*!
+         * Constructor
+         *
+         * \param   type        Type of the include
+         * \param   filePath    Absolute path to the included file
+         *
+         * \note    The timer has no effect if no statistics are being recorded on this thread
+         */
+        IncludeTimer(const QString &type, const QString &filePath);
+
+        //! Copy constructor is disabled
+        IncludeTimer(const IncludeTimer &) = delete;
+
+        //! Move constructor is disabled
+        IncludeTimer(IncludeTimer &&) = delete;
+
+        //! Destructor
+        ~IncludeTimer();
+
+        //! Copy assignment operator is disabled
+        IncludeTimer &operator=(const IncludeTimer &) = delete;
+
+        //! Move assignment operator is disabled
+        IncludeTimer &operator=(IncludeTimer &&) = delete;
+
+    private:
+        //! Statistics in which the include is recorded
+        ConfigReadStatistics *m_statistics;
+
+        //! Recorded include
+        Include m_include;
+
+        //! Timer
+        QElapsedTimer m_timer;
+    };
+
+    //! Records a single ConfigReaderBase::resolveReferences() call (until it is destroyed)
+    class CPPCONFIGFRAMEWORK_EXPORT ReferenceResolutionRecorder
+    {
+    public:
+        /*!
+         * Constructor
+         *
+         * \note    The recorder has no effect if no statistics are being recorded on this thread
+         */
+        ReferenceResolutionRecorder();
+
+        //! Copy constructor is disabled
+        ReferenceResolutionRecorder(const ReferenceResolutionRecorder &) = delete;
+
+        //! Move constructor is disabled
+        ReferenceResolutionRecorder(ReferenceResolutionRecorder &&) = delete;
+
+        //! Destructor
+        ~ReferenceResolutionRecorder();
+
+        //! Copy assignment operator is disabled
+        ReferenceResolutionRecorder &operator=(const ReferenceResolutionRecorder &) = delete;
+
+        //! Move assignment operator is disabled
+        ReferenceResolutionRecorder &operator=(ReferenceResolutionRecorder &&) = delete;
+
+        //! Starts a new resolution cycle
+        void startCycle();
+
+        //! Records a node resolved in the current resolution cycle
+        void recordResolvedNode();
+
+    private:
+        //! Statistics in which the reference resolution is recorded
+        ConfigReadStatistics *m_statistics;
+
+        //! Recorded reference resolution
+        ReferenceResolution m_resolution;
+
+        //! Timer
+        QElapsedTimer m_timer;
+    };
+
+public:
+    //! Constructor
+    ConfigReadStatistics() = default;
+
+    //! Copy constructor is disabled
+    ConfigReadStatistics(const ConfigReadStatistics &) = delete;
+
+    //! Move constructor is disabled
+    ConfigReadStatistics(ConfigReadStatistics &&) = delete;
+
+    //! Destructor
+    ~ConfigReadStatistics() = default;
+
+    //! Copy assignment operator is disabled
+    ConfigReadStatistics &operator=(const ConfigReadStatistics &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigReadStatistics &operator=(ConfigReadStatistics &&) = delete;
+
+    //! Removes all of the recorded statistics
+    void clear();
+
+    /*!
+     * Gets the statistics of a phase
+     *
+     * \param   phase   Phase
+     *
+     * \return  Phase statistics
+     */
+    PhaseStatistics phase(const Phase phase) const;
+
+    /*!
+     * Gets the recorded includes
+     *
+     * \return  Includes in the order in which they were finished
+     */
+    std::vector<Include> includes() const;
+
+    /*!
+     * Gets the recorded reference resolutions
+     *
+     * \return  Reference resolutions in the order in which they were finished
+     */
+    std::vector<ReferenceResolution> referenceResolutions() const;
+
+    /*!
+     * Gets the number of created configuration nodes (including the cloned nodes)
+     *
+     * \return  Number of created nodes
+     */
+    qint64 createdNodeCount() const;
+
+    /*!
+     * Gets the number of ConfigNode::clone() calls (including the calls for the member nodes)
+     *
+     * \return  Number of cloned nodes
+     */
+    qint64 clonedNodeCount() const;
+
+    /*!
+     * Gets the structure statistics of the read configuration
+     *
+     * \return  Tree statistics (empty if no configuration was read yet)
+     */
+    ConfigTreeStatistics treeStatistics() const;
+
+    /*!
+     * Gets the memory usage of the read configuration
+     *
+     * \return  Memory usage (empty if no configuration was read yet)
+     */
+    ConfigMemoryUsage memoryUsage() const;
+
+    /*!
+     * Converts the statistics to a human readable summary
+     *
+     * \return  Summary
+     */
+    QString toString() const;
+
+    /*!
+     * Converts the Phase value to string
+     *
+     * \param   phase   Phase
+     *
+     * \return  String representation of the phase
+     */
+    static QString phaseToString(const Phase phase);
+
+    /*!
+     * Gets the statistics that are being recorded on this thread
+     *
+     * \return  Statistics or null if no statistics are being recorded
+     */
+    static ConfigReadStatistics *current();
+
+    /*!
+     * Checks if statistics are being recorded on this thread
+     *
+     * \retval  true    Statistics are being recorded
+     * \retval  false   Statistics are not being recorded
+     */
+    static bool isRecording();
+
+    //! Records a created configuration node in the statistics that are being recorded (if any)
+    static void recordCreatedNode();
+
+    //! Records a cloned configuration node in the statistics that are being recorded (if any)
+    static void recordClonedNode();
+
+    /*!
+     * Records the structure statistics and the memory usage of a read configuration in the
+     * statistics that are being recorded (if any)
+     *
+     * \param   config  Read configuration
+     *
+     * \note    The configuration that is recorded last replaces the previously recorded one, so
+     *          for nested reads (for example of the includes) the outermost configuration is kept
+     */
+    static void recordTree(const ConfigNode &config);
+
+private:
+    //! Protects the phases, includes, reference resolutions and the read configuration statistics
+    mutable QMutex m_mutex;
+
+    //! Statistics of the phases
+    std::array<PhaseStatistics, PHASE_COUNT> m_phases;
+
+    //! Recorded includes
+    std::vector<Include> m_includes;
+
+    //! Recorded reference resolutions
+    std::vector<ReferenceResolution> m_referenceResolutions;
+
+    //! Structure statistics of the read configuration
+    ConfigTreeStatistics m_treeStatistics;
+
+    //! Memory usage of the read configuration
+    ConfigMemoryUsage m_memoryUsage;
+
+    //! Number of created configuration nodes
+    std::atomic<qint64> m_createdNodeCount { 0 };
+
+    //! Number of cloned configuration nodes
+    std::atomic<qint64> m_clonedNodeCount { 0 };
+};
+
+} // namespace CppConfigFramework
@@ -21,13 +21,23 @@
 #pragma once
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigFileCache.hpp>
+#include <CppConfigFramework/ConfigReadOperation.hpp>
 #include <CppConfigFramework/ConfigReaderBase.hpp>
 
 // Qt includes
+#include <QtCore/QVector>
 
 // System includes
+#include <functional>
+#include <memory>
 
 // Forward declarations
+namespace CppConfigFramework
+{
+class JsonStreamParser;
+struct PreReadIncludeFile;
+}
 
 // Macros
 
@@ -36,9 +46,34 @@
 namespace CppConfigFramework
 {
 
-//! This class reads the configuration
+/*!
+ * This class reads the configuration
+ *
+ * \note    Reading is reentrant: independent configurations can be read on different threads at the
+ *          same time (even with the same reader instance) as long as each thread uses its own
+ *          EnvironmentVariables instance. The shared state that is used while reading (the
+ *          ConfigReaderRegistry, the ConfigFileCache and the system environment variables) is
+ *          thread-safe while the include graph and the node arena are per-thread.
+ * \note    The external configs are not thread-safe to share: reference resolution calls
+ *          ConfigNode::nodePath(), ConfigNode::contentHash() and ConfigObjectNode::member() on
+ *          them, which fill in the cached node paths and content hashes and read the lazy members.
+ *          External configs that are used by several reads at the same time (or by any other
+ *          thread during a read) must therefore be frozen (see ConfigSnapshotPublisher::freeze()),
+ *          otherwise each thread needs its own external configs.
+ */
 class CPPCONFIGFRAMEWORK_EXPORT ConfigReader : public ConfigReaderBase
 {
+public:
+    /*!
+     * Type alias for the function that is called when an asynchronous read is finished
+     *
+     * \param   config                  Configuration node instance or in case of failure a null
+     *                                  pointer
+     * \param   environmentVariables    Environment variables after the configuration was read
+     */
+    using ReadCallback = std::function<void(std::unique_ptr<ConfigObjectNode> config,
+                                            const EnvironmentVariables &environmentVariables)>;
+
 public:
     //! Constructor
     ConfigReader() = default;
@@ -120,7 +155,257 @@ public:
             const std::vector<const ConfigObjectNode *> &externalConfigs,
             EnvironmentVariables *environmentVariables) const override;
 
+    /*!
+     * Reads the specified config file asynchronously on the global thread pool
+     *
+     * \param   filePath                Path to the configuration file
+     * \param   workingDir              Path to the working directory
+     * \param   sourceNodePath          Node path to the node that needs to be extracted from this
+     *                                  configuration file (must be absolute node path)
+     * \param   destinationNodePath     Node path to the destination node where the result needs
+     *                                  to be stored (must be absolute node path)
+     * \param   externalConfigs         Configuration nodes provided by an external source (they
+     *                                  need to stay valid until the operation is finished and they
+     *                                  need to be frozen if they are accessed by other threads in
+     *                                  the meantime, see the class notes)
+     * \param   environmentVariables    Environment variables (the read starts from a copy of them)
+     * \param   callback                Function that is called with the result on the thread that
+     *                                  executed the read (it is not called if the operation was
+     *                                  canceled)
+     *
+     * \return  Operation that can be used to cancel the read and to wait until it is finished
+     *
+     * File I/O, parsing, includes and reference resolution are all executed on the thread pool with
+     * a copy of this reader (so its options cannot be changed for a read that already started). The
+     * operation is finished after the callback returns.
+     *
+     * Canceling the operation is cooperative (see ConfigReadOperation). With the parallel reading
+     * of includes enabled the included files are also pre-read on the thread pool and the pre-read
+     * of the files that did not start yet is skipped once the operation is canceled.
+     *
+     * \note    The statistics that are being recorded on the calling thread (if any) also record
+     *          this read, so they must not be destroyed before the operation is finished
+     */
+    std::shared_ptr<ConfigReadOperation> readAsync(
+            const QString &filePath,
+            const QDir &workingDir,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            const EnvironmentVariables &environmentVariables,
+            ReadCallback callback) const;
+
+    /*!
+     * Checks if the included configuration files are read in parallel
+     *
+     * \retval  true    Included configuration files are read in parallel
+     * \retval  false   Included configuration files are read one after another
+     */
+    bool parallelIncludesEnabled() const;
+
+    /*!
+     * Enables or disables reading of the included configuration files in parallel
+     *
+     * \param   enabled New value
+     *
+     * When enabled, the files of all 'CppConfigFramework' includes of a configuration file are read
+     * and parsed concurrently on the global thread pool before the includes are processed. The
+     * includes are then still processed and applied in their declaration order (on the calling
+     * thread) so the result is the same as when the files are read one after another.
+     *
+     * \note    In this mode the 'CppConfigFramework' includes are read with this reader instance
+     *          (instead of the one from ConfigReaderRegistry) so that the mode is also used for
+     *          nested includes. Includes of other types are always read the regular way.
+     */
+    void setParallelIncludesEnabled(const bool enabled);
+
+    /*!
+     * Checks if the nodes of the read configuration are allocated from an arena
+     *
+     * \retval  true    Nodes are allocated from an arena
+     * \retval  false   Nodes are allocated from the heap
+     */
+    bool arenaAllocationEnabled() const;
+
+    /*!
+     * Enables or disables the allocation of the nodes of the read configuration from an arena
+     *
+     * \param   enabled New value
+     *
+     * When enabled, all nodes created while reading a configuration (including its includes) are
+     * allocated from a single ConfigNodeArena which is released in one shot once the last of the
+     * nodes is destroyed. The ownership of the read configuration node is not affected.
+     */
+    void setArenaAllocationEnabled(const bool enabled);
+
+    /*!
+     * Checks if the Object nodes of the read configuration are materialized lazily
+     *
+     * \retval  true    Object nodes are materialized when they are first accessed
+     * \retval  false   Object nodes are created while the configuration is read
+     */
+    bool lazyMaterializationEnabled() const;
+
+    /*!
+     * Enables or disables the lazy materialization of the Object nodes of the read configuration
+     *
+     * \param   enabled New value
+     *
+     * When enabled, the ordinary Object members of the 'config' member whose subtrees contain only
+     * ordinary members and explicit Value nodes ('#' decorator) are not converted to nodes while
+     * the configuration is read. Their members are kept as the parsed JSON Object and they are read
+     * one level at a time when they are first accessed (see ConfigObjectNode::setLazyMembers()).
+     * Subtrees with references or with references to environment variables are read as usual so
+     * that they can be resolved. The member names of the deferred subtrees are still validated
+     * while the configuration is read.
+     *
+     * \note    In this mode the read configuration must be materialized with
+     *          ConfigObjectNode::materializeAll() before it is accessed from several threads
+     * \note    Same as for the parallel reading of includes only the includes that are read with
+     *          this reader instance use this mode
+     */
+    void setLazyMaterializationEnabled(const bool enabled);
+
+    /*!
+     * Checks if only the nodes reachable from the source node are read
+     *
+     * \retval  true    Only the nodes reachable from the source node are read
+     * \retval  false   Whole configuration is read
+     */
+    bool sourceNodePruningEnabled() const;
+
+    /*!
+     * Enables or disables reading of only the nodes that are reachable from the source node
+     *
+     * \param   enabled New value
+     *
+     * When enabled and a source node other than the root node is read from a configuration file,
+     * the 'config' member is first analyzed to find all of the nodes that are reachable from the
+     * source node through references and the bases of derived objects. Only those nodes are read
+     * and resolved.
+     *
+     * An include is skipped only if skipping it cannot change the result: its destination node
+     * does not overlap any of the reachable nodes, it is not followed by an include that is read
+     * (since that include could reference its nodes) and its file neither sets environment
+     * variables nor has nested includes. The file of such an include is still loaded (parsed) to
+     * check the last condition, but its nodes are not read.
+     *
+     * \note    Same as for the parallel reading of includes, the 'CppConfigFramework' includes are
+     *          read with this reader instance so that the mode is also used for nested includes
+     */
+    void setSourceNodePruningEnabled(const bool enabled);
+
+    /*!
+     * Checks if the configuration files are parsed straight into configuration nodes
+     *
+     * \retval  true    Configuration files are parsed straight into configuration nodes
+     * \retval  false   Configuration files are parsed to a JSON document first
+     */
+    bool streamingParsingEnabled() const;
+
+    /*!
+     * Enables or disables parsing of the configuration files straight into configuration nodes
+     *
+     * \param   enabled New value
+     *
+     * When enabled, the contents of a configuration file are not converted to a QJsonDocument which
+     * is then walked again to create the nodes. Instead the nodes of the 'config' member (also the
+     * ones with the '#', '$' and '&' decorators) are created while the file contents are parsed, so
+     * the contents (read into a single buffer, see ConfigReaderBase::readFileData()) are the only
+     * other copy of the configuration in memory. Only the 'environment_variables' and 'includes'
+     * members and the values of the explicit Value nodes are parsed to JSON values.
+     *
+     * The 'config' member can only be read after the includes (they can set the environment
+     * variables that the '$' decorator needs), so the whole file is first checked for syntax errors
+     * without creating anything. The syntax errors are reported with the same offset and context as
+     * when the file is parsed to a QJsonDocument.
+     *
+     * A file is still parsed to a QJsonDocument when the file cache or the lazy materialization is
+     * enabled or when only the nodes reachable from a source node are read, since they all work on
+     * the parsed JSON Object.
+     *
+     * \note    Same as for the source node pruning, the 'CppConfigFramework' includes are read with
+     *          this reader instance so that the mode is also used for nested includes (except for
+     *          the files that were already parsed by the parallel reading of includes)
+     */
+    void setStreamingParsingEnabled(const bool enabled);
+
 private:
+    /*!
+     * Reads the config from the parsed contents of a configuration file
+     *
+     * \param   rootObject          Root JSON Object of the file
+     * \param   fileKey             Key of the file (if the size is not set the cache is not used)
+     * \param   sourceNodePath      Node path to the node that needs to be extracted from this
+     *                              configuration file (must be absolute node path)
+     * \param   destinationNodePath Node path to the destination node where the result needs to be
+     *                              stored (must be absolute node path)
+     * \param   externalConfigs     Configuration nodes provided by an external source
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or in case of failure a null pointer
+     */
+    std::unique_ptr<ConfigObjectNode> readFileContents(
+            const QJsonObject &rootObject,
+            const ConfigFileCache::FileKey &fileKey,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables) const;
+
+    /*!
+     * Reads the config by parsing the contents of a configuration file straight into nodes
+     *
+     * \param   fileContents        File contents
+     * \param   absoluteFilePath    Absolute path to the file
+     * \param   sourceNodePath      Node path to the node that needs to be extracted from this
+     *                              configuration file (must be absolute node path)
+     * \param   destinationNodePath Node path to the destination node where the result needs to be
+     *                              stored (must be absolute node path)
+     * \param   externalConfigs     Configuration nodes provided by an external source
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or in case of failure a null pointer
+     */
+    std::unique_ptr<ConfigObjectNode> readStreamedFileContents(
+            const QByteArray &fileContents,
+            const QString &absoluteFilePath,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables) const;
+
+    /*!
+     * Read the specified config from JSON
+     *
+     * \param   configObject        Configuration data in JSON format
+     * \param   workingDir          Path to the working directory
+     * \param   sourceNodePath      Node path to the node that needs to be extracted from this
+     *                              configuration file (must be absolute node path)
+     * \param   destinationNodePath Node path to the destination node where the result needs to be
+     *                              stored (must be absolute node path)
+     * \param   externalConfigs     Configuration nodes provided by an external source
+     * \param   fileKey             Key of the file that contains the configuration data (null if
+     *                              the data was not read from a cached file)
+     * \param   configParser        Parser positioned at the 'config' member which is read instead
+     *                              of the one in configObject (null if configObject contains it)
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or in case of failure a null pointer
+     */
+    std::unique_ptr<ConfigObjectNode> readConfigObject(
+            const QJsonObject &configObject,
+            const QDir &workingDir,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables,
+            const ConfigFileCache::FileKey *fileKey,
+            JsonStreamParser *configParser) const;
+
     /*!
      * Reads the 'environment_variables' member of the configuration file
      *
@@ -141,9 +426,11 @@ private:
     /*!
      * Reads the 'includes' member of the configuration file
      *
-     * \param   rootObject      Root JSON Object
-     * \param   workingDir      Path to the working directory
-     * \param   externalConfigs Configuration nodes provided by an external source
+     * \param   rootObject          Root JSON Object
+     * \param   workingDir          Path to the working directory
+     * \param   externalConfigs     Configuration nodes provided by an external source
+     * \param   requiredNodePaths   Names of the nodes in the absolute node paths of the nodes that
+     *                              are needed (null if all nodes are needed)
      *
      * \param[in,out]   environmentVariables    Environment variables
      *
@@ -153,6 +440,44 @@ private:
             const QJsonObject &rootObject,
             const QDir &workingDir,
             const std::vector<const ConfigObjectNode *> &externalConfigs,
+            const std::vector<QStringList> *requiredNodePaths,
+            EnvironmentVariables *environmentVariables) const;
+
+    /*!
+     * Reads and parses the files of the 'CppConfigFramework' includes concurrently
+     *
+     * \param   includes                Include JSON Objects
+     * \param   workingDir              Path to the working directory
+     * \param   environmentVariables    Environment variables (used to expand the file paths)
+     *
+     * \return  Pre-read files (one for each include) or an empty container if parallel reading of
+     *          the includes is disabled or not needed
+     */
+    std::vector<PreReadIncludeFile> preReadIncludes(
+            const QVector<QJsonObject> &includes,
+            const QDir &workingDir,
+            const EnvironmentVariables &environmentVariables) const;
+
+    /*!
+     * Reads the config from an already read and parsed included configuration file
+     *
+     * \param   absoluteFilePath    Absolute path to the file
+     * \param   fileObject          Root JSON Object of the file
+     * \param   includeObject       Include JSON Object
+     * \param   destinationNodePath Node path to the destination node where the result needs to be
+     *                              stored (must be absolute node path)
+     * \param   externalConfigs     Configuration nodes provided by an external source
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    std::unique_ptr<ConfigObjectNode> readPreReadInclude(
+            const QString &absoluteFilePath,
+            const QJsonObject &fileObject,
+            const QJsonObject &includeObject,
+            const ConfigNodePath &destinationNodePath,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
             EnvironmentVariables *environmentVariables) const;
 
     /*!
@@ -162,6 +487,11 @@ private:
      * \param   externalConfigs         Configuration nodes provided by an external source
      * \param   includesConfig          Configuration node loaded from includes
      * \param   environmentVariables    Environment variables
+     * \param   fileKey                 Key of the cached file that contains the 'config' member
+     *                                  (null if the cache shall not be used)
+     * \param   configParser            Parser positioned at the 'config' member which is read
+     *                                  instead of the one in rootObject (null if it is read from
+     *                                  rootObject)
      *
      * \return  Configuration node instance or null in case of failure
      */
@@ -169,7 +499,9 @@ private:
             const QJsonObject &rootObject,
             const std::vector<const ConfigObjectNode *> &externalConfigs,
             const ConfigObjectNode &includesConfig,
-            const EnvironmentVariables &environmentVariables) const;
+            const EnvironmentVariables &environmentVariables,
+            const ConfigFileCache::FileKey *fileKey,
+            JsonStreamParser *configParser) const;
 
     /*!
      * Reads a Value node from the JSON Value
@@ -188,14 +520,54 @@ private:
      * \param   jsonObject              JSON Object
      * \param   currentNodePath         Current node path
      * \param   environmentVariables    Environment variables
+     * \param   lazy                    Flag that indicates if the ordinary Object members that do
+     *                                  not need to be resolved are materialized lazily
      *
      * \return  Configuration node instance or null in case of failure
      */
     static std::unique_ptr<ConfigObjectNode> readObjectNode(
             const QJsonObject &jsonObject,
             const ConfigNodePath &currentNodePath,
+            const EnvironmentVariables &environmentVariables,
+            const bool lazy = false);
+
+    /*!
+     * Reads an Object node straight from the parsed file contents
+     *
+     * \param   parser                  Parser positioned at the JSON Object
+     * \param   currentNodePath         Current node path
+     * \param   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or null in case of failure (the parser has an error
+     *          if the failure was caused by the file contents)
+     */
+    static std::unique_ptr<ConfigObjectNode> readObjectNode(
+            JsonStreamParser *parser,
+            const ConfigNodePath &currentNodePath,
             const EnvironmentVariables &environmentVariables);
 
+    /*!
+     * Reads the lazy members of an Object node
+     *
+     * \param   jsonObject  JSON Object with the members
+     *
+     * \return  Object node that holds the members
+     *
+     * \note    The JSON Object must be checked with canReadLazily() first
+     */
+    static std::unique_ptr<ConfigObjectNode> readLazyMembers(const QJsonObject &jsonObject);
+
+    /*!
+     * Checks if the members of the JSON Object can be read lazily
+     *
+     * \param   jsonObject  JSON Object
+     *
+     * \retval  true    The JSON Object (and all of its ordinary Object members) contains only valid
+     *                  ordinary members and explicit Value nodes
+     * \retval  false   The JSON Object needs to be read right away
+     */
+    static bool canReadLazily(const QJsonObject &jsonObject);
+
     /*!
      * Reads a NodeReference node from the JSON String
      *
@@ -222,6 +594,21 @@ private:
             const ConfigNodePath &currentNodePath,
             const EnvironmentVariables &environmentVariables);
 
+    /*!
+     * Reads a DerivedObject node straight from the parsed file contents
+     *
+     * \param   parser                  Parser positioned at the JSON Object
+     * \param   currentNodePath         Current node path
+     * \param   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or null in case of failure (the parser has an error
+     *          if the failure was caused by the file contents)
+     */
+    static std::unique_ptr<ConfigDerivedObjectNode> readDerivedObjectNode(
+            JsonStreamParser *parser,
+            const ConfigNodePath &currentNodePath,
+            const EnvironmentVariables &environmentVariables);
+
     /*!
      * Resolves references to environment variables in a JSON Value
      *
@@ -278,6 +665,22 @@ private:
      */
     static void setCurrentDirectory(const QDir &currentDir,
                                     EnvironmentVariables *environmentVariables);
+
+private:
+    //! Holds the "is parallel reading of includes enabled" flag
+    bool m_parallelIncludesEnabled = false;
+
+    //! Holds the "is arena allocation enabled" flag
+    bool m_arenaAllocationEnabled = false;
+
+    //! Holds the "is lazy materialization enabled" flag
+    bool m_lazyMaterializationEnabled = false;
+
+    //! Holds the "is source node pruning enabled" flag
+    bool m_sourceNodePruningEnabled = false;
+
+    //! Holds the "is streaming parsing enabled" flag
+    bool m_streamingParsingEnabled = false;
 };
 
 } // namespace CppConfigFramework
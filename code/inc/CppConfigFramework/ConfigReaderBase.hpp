@@ -30,6 +30,12 @@
 // System includes
 
 // Forward declarations
+class QFile;
+
+namespace CppConfigFramework
+{
+struct DerivedObjectBaseCache;
+}
 
 // Macros
 
@@ -64,6 +70,9 @@ public:
      * Gets the max number of cycles for reference resolution procedure
      *
      * \return  Max number of cycles
+     *
+     * \deprecated  References are resolved in a single pass over a dependency graph so this value
+     *              is not used anymore
      */
     uint32_t referenceResolutionMaxCycles() const;
 
@@ -71,6 +80,9 @@ public:
      * Sets the max number of cycles for reference resolution procedure
      *
      * \param   referenceResolutionMaxCycles    New max number of cycles
+     *
+     * \deprecated  References are resolved in a single pass over a dependency graph so this value
+     *              is not used anymore (setting it logs a warning)
      */
     void setReferenceResolutionMaxCycles(const uint32_t referenceResolutionMaxCycles);
 
@@ -98,6 +110,21 @@ public:
             const std::vector<const ConfigObjectNode *> &externalConfigs,
             EnvironmentVariables *environmentVariables) const = 0;
 
+    /*!
+     * Reads the contents of the opened configuration file
+     *
+     * \param   file    Opened file
+     *
+     * \return  File contents
+     *
+     * This is the common way for the readers to read the configuration files (the time spent is
+     * recorded as the ConfigReadStatistics::Phase::FileIo phase).
+     *
+     * \note    The file is read into a buffer instead of being memory-mapped since accessing a
+     *          mapped file that is truncated by another process crashes the process (SIGBUS)
+     */
+    static QByteArray readFileData(QFile *file);
+
 protected:
     //! Enumerates the possible results of reference resolution procedure
     enum class ReferenceResolutionResult
@@ -135,7 +162,19 @@ protected:
      *
      * \param[in,out]   config  Configuration node
      *
-     * \return  Reference resolution result
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * All NodeReference and DerivedObject nodes are first collected into a dependency graph. A node
+     * depends on all unresolved nodes that are on the way to or inside of the nodes it references.
+     * The nodes are then resolved in topological order so that each of them is resolved exactly
+     * once. Nodes created during the resolution (for example references in the overrides of a
+     * DerivedObject node) are added to the graph as they appear. The merged bases of the
+     * DerivedObject nodes are cached for the duration of the resolution so that a chain of bases
+     * that is shared by multiple DerivedObject nodes is merged only once.
+     *
+     * The external configuration nodes are used either if a referenced node does not exist in the
+     * configuration node or (as a last resort) to break a cycle in the dependency graph.
      */
     bool resolveReferences(const std::vector<const ConfigObjectNode *> &externalConfigs,
                            ConfigObjectNode *config) const;
@@ -147,7 +186,11 @@ protected:
      *
      * \param[in,out]   node    Configuration node
      *
-     * \return  Reference resolution result
+     * \retval  ReferenceResolutionResult::Resolved    All references were resolved
+     * \retval  ReferenceResolutionResult::Error       Failed to resolve the references
+     *
+     * \deprecated  The references are resolved in a single pass (see resolveReferences()) so this
+     *              method no longer returns the partial results of a resolution cycle
      */
     static ReferenceResolutionResult resolveObjectReferences(
             const std::vector<const ConfigObjectNode *> &externalConfigs,
@@ -160,6 +203,9 @@ protected:
      * \param   newResult       New result
      *
      * \return  Updated result
+     *
+     * \deprecated  The references are resolved in a single pass (see resolveReferences()) so the
+     *              results of the resolution cycles no longer need to be combined
      */
     static ReferenceResolutionResult updateObjectResolutionResult(
             const ReferenceResolutionResult currentResult,
@@ -183,13 +229,20 @@ protected:
      *
      * \param   externalConfigs     Configuration nodes provided by an external source
      *
-     * \param[in,out]   node    Configuration node
+     * \param[in,out]   node        Configuration node
+     * \param[in,out]   baseCache   Optional cache of the flattened base objects
      *
      * \return  Reference resolution result
+     *
+     * If a cache is provided then the bases of all DerivedObject nodes that share the same base
+     * nodes are merged only once and the DerivedObject nodes share the merged bases copy-on-write
+     * (see ConfigObjectNode::setSharedMembers()): applying the overrides copies only the nodes on
+     * their node paths.
      */
     static ReferenceResolutionResult resolveDerivedObjectReferences(
             const std::vector<const ConfigObjectNode *> &externalConfigs,
-            ConfigDerivedObjectNode *node);
+            ConfigDerivedObjectNode *node,
+            DerivedObjectBaseCache *baseCache = nullptr);
 
     /*!
      * Try to find the referenced configuration node from the parent and as an alternative from the
@@ -200,6 +253,12 @@ protected:
      * \param   externalConfigs     Configuration nodes provided by an external source
      *
      * \return  Referenced configuration node or null in case the node was not found
+     *
+     * \note    If the node is found in multiple external configuration nodes then the node from the
+     *          last one is used
+     * \note    External configuration nodes that are only read (for example the frozen snapshots)
+     *          should have a node index (see ConfigObjectNode::buildNodeIndex()) so that each
+     *          lookup is a single hash lookup
      */
     static const ConfigNode *findReferencedConfigNode(
             const ConfigNodePath &referenceNodePath,
@@ -223,6 +282,22 @@ protected:
             const ConfigNodePath &sourceNodePath,
             const ConfigNodePath &destinationNodePath);
 
+private:
+    /*!
+     * Resolves all references in the specified configuration node through a dependency graph
+     *
+     * \param   externalConfigs     Configuration nodes provided by an external source
+     *
+     * \param[in,out]   config  Configuration node
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \see     resolveReferences()
+     */
+    static bool resolveReferenceGraph(const std::vector<const ConfigObjectNode *> &externalConfigs,
+                                      ConfigObjectNode *config);
+
 private:
     //! Holds the default value for max number of cycles for reference resolution procedure
     static constexpr uint32_t m_defaultReferenceResolutionMaxCycles = 100U;
@@ -24,9 +24,11 @@
 #include <CppConfigFramework/ConfigReaderBase.hpp>
 
 // Qt includes
+#include <QtCore/QReadWriteLock>
 
 // System includes
-#include <unordered_map>
+#include <map>
+#include <memory>
 
 // Forward declarations
 
@@ -37,7 +39,15 @@
 namespace CppConfigFramework
 {
 
-//! This is a class for registering configuration readers
+/*!
+ * This is a class for registering configuration readers
+ *
+ * \note    All methods are thread-safe. The registry is locked only while a configuration reader is
+ *          looked up (and not while the configuration is read) so configurations can be read on
+ *          multiple threads at the same time and a configuration reader can read its includes
+ *          through the registry. A configuration reader that is replaced while it is still reading
+ *          a configuration is destroyed only after it is done.
+ */
 class CPPCONFIGFRAMEWORK_EXPORT ConfigReaderRegistry
 {
 public:
@@ -93,9 +103,21 @@ private:
     //! Constructor
     ConfigReaderRegistry();
 
+    /*!
+     * Gets the configuration reader for the specified type
+     *
+     * \param   type    Configuration reader type
+     *
+     * \return  Configuration reader or null if the type is not registered
+     */
+    std::shared_ptr<const ConfigReaderBase> findConfigReader(const QString &type) const;
+
 private:
-    //! Holds the
-    std::map<QString, std::unique_ptr<ConfigReaderBase>> m_configReaders;
+    //! Lock for protecting the registered configuration readers
+    mutable QReadWriteLock m_lock;
+
+    //! Holds the registered configuration readers
+    std::map<QString, std::shared_ptr<const ConfigReaderBase>> m_configReaders;
 };
 
 } // namespace CppConfigFramework
@@ -0,0 +1,153 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a publisher of immutable configuration snapshots
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+
+// Qt includes
+
+// System includes
+#include <atomic>
+#include <memory>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * Immutable configuration snapshot
+ *
+ * A snapshot created with ConfigSnapshotPublisher::freeze() can be read from multiple threads at
+ * the same time and it is freed once the last of its holders drops it.
+ */
+using ConfigSnapshot = std::shared_ptr<const ConfigObjectNode>;
+
+/*!
+ * This class publishes immutable configuration snapshots to concurrent readers
+ *
+ * The publisher holds the current snapshot. Publishing a new snapshot atomically replaces it while
+ * the readers that still hold the previous snapshot can keep on reading it, so readers never block
+ * each other or the publisher:
+ *
+ * \code
+ * // Reload thread
+ * publisher.publish(reader.read(filePath));
+ *
+ * // Worker threads
+ * const ConfigSnapshot config = publisher.snapshot();
+ * myConfig.loadConfig(*config);
+ * \endcode
+ *
+ * \note    A configuration node caches its node path and its content hash on first use, which
+ *          would be a data race between concurrent readers, so a snapshot is frozen before it is
+ *          published by filling in all of the caches (after that the tree is only read)
+ *
+ * \note    All methods are thread-safe
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigSnapshotPublisher
+{
+public:
+    //! Constructor
+    ConfigSnapshotPublisher() = default;
+
+    //! Copy constructor is disabled
+    ConfigSnapshotPublisher(const ConfigSnapshotPublisher &) = delete;
+
+    //! Move constructor is disabled
+    ConfigSnapshotPublisher(ConfigSnapshotPublisher &&) = delete;
+
+    //! Destructor
+    ~ConfigSnapshotPublisher() = default;
+
+    //! Copy assignment operator is disabled
+    ConfigSnapshotPublisher &operator=(const ConfigSnapshotPublisher &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigSnapshotPublisher &operator=(ConfigSnapshotPublisher &&) = delete;
+
+    /*!
+     * Creates an immutable snapshot from the configuration node
+     *
+     * \param   config  Configuration node (it becomes the root node of the snapshot)
+     *
+     * \return  Snapshot or null if the configuration node is null or its lazy members could not be
+     *          read
+     *
+     * The lazy members, the node paths, the content hashes and the node index of the whole tree are
+     * prepared in advance (see ConfigObjectNode::materializeAll() and
+     * ConfigObjectNode::buildNodeIndex()) so that reading the snapshot never changes it.
+     *
+     * \note    The configuration node must not be changed after it is frozen
+     */
+    static ConfigSnapshot freeze(std::unique_ptr<ConfigObjectNode> config);
+
+    /*!
+     * Gets the current snapshot
+     *
+     * \return  Current snapshot or null if no snapshot was published yet
+     */
+    ConfigSnapshot snapshot() const;
+
+    /*!
+     * Freezes the configuration node and publishes it as the current snapshot
+     *
+     * \param   config  Configuration node
+     *
+     * \return  Published snapshot or null if the configuration node is null (the current snapshot
+     *          is kept then)
+     */
+    ConfigSnapshot publish(std::unique_ptr<ConfigObjectNode> config);
+
+    /*!
+     * Publishes the snapshot as the current one
+     *
+     * \param   snapshot    Snapshot created with freeze()
+     */
+    void publish(const ConfigSnapshot &snapshot);
+
+    //! Resets the current snapshot
+    void reset();
+
+    /*!
+     * Gets the version of the current snapshot
+     *
+     * \return  Number of times the current snapshot was replaced
+     *
+     * \note    The version is incremented after the current snapshot is replaced so a reader that
+     *          sees a new version also sees the new snapshot
+     */
+    quint64 version() const;
+
+private:
+    //! Current snapshot (accessed only through the atomic operations of std::shared_ptr)
+    ConfigSnapshot m_snapshot;
+
+    //! Version of the current snapshot
+    std::atomic<quint64> m_version { 0U };
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,143 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a process-wide pool of interned strings
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QMutex>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+// System includes
+#include <atomic>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This is a process-wide pool of interned strings
+ *
+ * Interning a string returns the copy of an equal string that is already stored in the pool (or
+ * stores the string in the pool if there is no such string yet). Since QString is implicitly shared
+ * all of the interned copies of a string share the same storage, so the member names that repeat
+ * throughout the configuration trees (and the repeated string values) are stored only once.
+ *
+ * When the pool is enabled the member names are interned by ConfigObjectNode::setMember() (which is
+ * also used by the readers) and the string values are interned by ConfigValueNode::setValue().
+ * Comparing two interned copies of a string only compares their storage pointers and the sizes.
+ *
+ * The strings stay in the pool until they are released with releaseUnused() or the pool is cleared.
+ *
+ * \note    The pool is disabled by default
+ * \note    All methods are thread-safe
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigStringPool
+{
+public:
+    //! Destructor
+    ~ConfigStringPool() = default;
+
+    /*!
+     * Gets the pool instance
+     *
+     * \return  Pool instance
+     */
+    static ConfigStringPool *instance();
+
+    /*!
+     * Checks if the pool is enabled
+     *
+     * \retval  true    Enabled
+     * \retval  false   Disabled
+     */
+    bool isEnabled() const;
+
+    /*!
+     * Enables or disables the pool
+     *
+     * \param   enabled New value
+     *
+     * \note    Disabling the pool also clears it (the strings that were already interned stay
+     *          shared)
+     */
+    void setEnabled(const bool enabled);
+
+    /*!
+     * Gets the number of strings in the pool
+     *
+     * \return  Number of strings
+     */
+    int count() const;
+
+    //! Removes all strings from the pool
+    void clear();
+
+    /*!
+     * Removes the strings that are not used outside of the pool anymore
+     *
+     * \return  Number of removed strings
+     */
+    int releaseUnused();
+
+    /*!
+     * Interns the string
+     *
+     * \param   string  String
+     *
+     * \return  Copy of the equal string from the pool (or the string itself if the pool is
+     *          disabled)
+     */
+    QString intern(const QString &string);
+
+    /*!
+     * Checks if the string is interned (if it shares the storage with a string in the pool)
+     *
+     * \param   string  String
+     *
+     * \retval  true    Interned
+     * \retval  false   Not interned (an equal string can still be in the pool)
+     */
+    bool isInterned(const QString &string) const;
+
+private:
+    //! Constructor
+    ConfigStringPool() = default;
+
+private:
+    //! Mutex for protecting the state of the pool
+    mutable QMutex m_mutex;
+
+    //! Holds the "is enabled" flag (checked without locking the mutex)
+    std::atomic<bool> m_enabled { false };
+
+    //! Interned strings
+    QSet<QString> m_strings;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,234 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains types to make it easier to load parameters directly from config value nodes
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QMetaEnum>
+
+// System includes
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+template<typename T>
+using IsIntegerParameter = std::enable_if_t<std::is_integral<T>::value &&
+                                            !std::is_same<T, bool>::value &&
+                                            !std::is_same<T, char>::value &&
+                                            !std::is_same<T, wchar_t>::value &&
+                                            !std::is_same<T, char16_t>::value &&
+                                            !std::is_same<T, char32_t>::value>;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Loads a parameter value directly from the value stored in a config value node
+ *
+ * Each specialization has a static "load(node, value)" method which returns true only if the value
+ * was loaded exactly like it would be by deserializing the node's QJsonValue. In all other cases
+ * (unsupported data types, mismatched values etc.) it returns false and the caller is expected to
+ * fall back to the deserialization of the QJsonValue.
+ */
+template <typename T, typename Enable = void>
+struct ConfigValueHelper
+{
+    static bool load(const ConfigValueNode &node, T *value)
+    {
+        Q_UNUSED(node)
+        Q_UNUSED(value)
+        return false;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template <>
+struct ConfigValueHelper<bool>
+{
+    static bool load(const ConfigValueNode &node, bool *value)
+    {
+        bool ok = false;
+        const bool boolean = node.toBool(&ok);
+
+        if (ok)
+        {
+            *value = boolean;
+        }
+        return ok;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template <typename T>
+struct ConfigValueHelper<T, IsIntegerParameter<T>>
+{
+    static bool load(const ConfigValueNode &node, T *value)
+    {
+        bool ok = false;
+        const qint64 integer = node.toInt64(&ok);
+
+        if (!ok)
+        {
+            return false;
+        }
+
+        // Make sure that the value is in the range of the data type
+        if (integer < 0)
+        {
+            if ((!std::is_signed<T>::value) ||
+                (integer < static_cast<qint64>(std::numeric_limits<T>::min())))
+            {
+                return false;
+            }
+        }
+        else if (static_cast<quint64>(integer) >
+                 static_cast<quint64>(std::numeric_limits<T>::max()))
+        {
+            return false;
+        }
+
+        *value = static_cast<T>(integer);
+        return true;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template <typename T>
+struct ConfigValueHelper<T, std::enable_if_t<std::is_floating_point<T>::value>>
+{
+    static bool load(const ConfigValueNode &node, T *value)
+    {
+        bool ok = false;
+        const double number = node.toDouble(&ok);
+
+        if (!ok)
+        {
+            return false;
+        }
+
+        // Make sure that a finite value is in the range of the data type (converting a value that
+        // is out of range is undefined behavior)
+        if (std::isfinite(number) &&
+            ((number < static_cast<double>(std::numeric_limits<T>::lowest())) ||
+             (number > static_cast<double>(std::numeric_limits<T>::max()))))
+        {
+            return false;
+        }
+
+        *value = static_cast<T>(number);
+        return true;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Loads an enum value directly from its numeric value
+ *
+ * The enum names always need the deserialization. For the enums that are registered with the Qt
+ * meta-object system (Q_ENUM) the numeric value needs to match one of the enumerators, otherwise
+ * the deserialization is left to decide. Other enums have no information about their enumerators,
+ * so any numeric value in the range of the underlying type is loaded without a validation (the
+ * same as the deserialization of their numeric value).
+ */
+template <typename T>
+struct ConfigValueHelper<T, std::enable_if_t<std::is_enum<T>::value>>
+{
+    static bool load(const ConfigValueNode &node, T *value)
+    {
+        std::underlying_type_t<T> underlyingValue;
+
+        if (!ConfigValueHelper<std::underlying_type_t<T>>::load(node, &underlyingValue))
+        {
+            return false;
+        }
+
+        if (!isEnumerator(underlyingValue, IsQEnum()))
+        {
+            return false;
+        }
+
+        *value = static_cast<T>(underlyingValue);
+        return true;
+    }
+
+private:
+    //! Holds true if the enum is registered with the Qt meta-object system
+    using IsQEnum = std::integral_constant<bool, QtPrivate::IsQEnumHelper<T>::Value>;
+
+    static bool isEnumerator(const std::underlying_type_t<T> underlyingValue, std::true_type)
+    {
+        const QMetaEnum metaEnum = QMetaEnum::fromType<T>();
+
+        if (metaEnum.isFlag())
+        {
+            return false;
+        }
+
+        for (int i = 0; i < metaEnum.keyCount(); i++)
+        {
+            if (static_cast<std::underlying_type_t<T>>(metaEnum.value(i)) == underlyingValue)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static bool isEnumerator(const std::underlying_type_t<T> underlyingValue, std::false_type)
+    {
+        Q_UNUSED(underlyingValue)
+        return true;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template <>
+struct ConfigValueHelper<QString>
+{
+    static bool load(const ConfigValueNode &node, QString *value)
+    {
+        if (node.storageType() != ConfigValueNode::StorageType::String)
+        {
+            return false;
+        }
+
+        *value = node.toString();
+        return true;
+    }
+};
+
+} // namespace CppConfigFramework
@@ -24,6 +24,7 @@
 #include <CppConfigFramework/ConfigNode.hpp>
 
 // Qt includes
+#include <QtCore/QString>
 
 // System includes
 
@@ -39,6 +40,34 @@ namespace CppConfigFramework
 //! This class holds the Value configuration node
 class CPPCONFIGFRAMEWORK_EXPORT ConfigValueNode : public ConfigNode
 {
+public:
+    /*!
+     * Storage types of the value
+     *
+     * The common scalar values are stored directly in the node so that they can be read without
+     * creating a QJsonValue. Arrays and objects (and the undefined value) are kept as a QJsonValue.
+     */
+    enum class StorageType
+    {
+        //! Null value
+        Null,
+
+        //! Boolean value
+        Bool,
+
+        //! Number with an integral value that can be exactly represented by a double
+        Integer,
+
+        //! Any other number
+        Double,
+
+        //! String value
+        String,
+
+        //! Any other value (stored as a QJsonValue)
+        Json
+    };
+
 public:
     /*!
      * Constructor
@@ -91,9 +120,101 @@ public:
      */
     void setValue(const QJsonValue &value);
 
+    /*!
+     * Gets the storage type of the value
+     *
+     * \return  Storage type
+     */
+    StorageType storageType() const;
+
+    /*!
+     * Gets the value as a Boolean
+     *
+     * \param[out]  ok  Optional output for the conversion result
+     *
+     * \return  Boolean value or false if the value is not a Boolean
+     */
+    bool toBool(bool *ok = nullptr) const;
+
+    /*!
+     * Gets the value as a 64-bit integer
+     *
+     * \param[out]  ok  Optional output for the conversion result
+     *
+     * \return  Integer value or 0 if the value is not a number with an integral value in the range
+     *          of a 64-bit integer
+     */
+    qint64 toInt64(bool *ok = nullptr) const;
+
+    /*!
+     * Gets the value as a double
+     *
+     * \param[out]  ok  Optional output for the conversion result
+     *
+     * \return  Numeric value or 0 if the value is not a number
+     */
+    double toDouble(bool *ok = nullptr) const;
+
+    /*!
+     * Gets the value as a string
+     *
+     * \param[out]  ok  Optional output for the conversion result
+     *
+     * \return  String value or a null string if the value is not a string
+     */
+    QString toString(bool *ok = nullptr) const;
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+    /*!
+     * Gets a view of the string value
+     *
+     * \param[out]  ok  Optional output for the conversion result
+     *
+     * \return  View of the string value or an empty view if the value is not a string
+     *
+     * \note    The view is valid until the value of the node is changed or the node is destroyed
+     */
+    QStringView toStringView(bool *ok = nullptr) const;
+#endif
+
+    /*!
+     * Checks if this node holds the same value as the other node
+     *
+     * \param   other   Other node
+     *
+     * \retval  true    Values are equal
+     * \retval  false   Values are not equal
+     *
+     * \note    Unlike the "equal to" operator this does not compare the node paths of the nodes
+     */
+    bool hasSameValue(const ConfigValueNode &other) const;
+
 private:
-    //! Configuration node's value
-    QJsonValue m_value;
+    //! \copydoc    ConfigNode::calculateContentHash()
+    quint64 calculateContentHash() const override;
+
+private:
+    //! Storage type of the value
+    StorageType m_storageType = StorageType::Null;
+
+    //! Holds the scalar value (for Bool, Integer and Double storage types)
+    union
+    {
+        //! Boolean value
+        bool boolean;
+
+        //! Integer value
+        qint64 integer;
+
+        //! Numeric value
+        double number;
+    } m_scalar;
+
+    //! Holds the string value (for String storage type)
+    QString m_string;
+
+    //! Holds the value (for Json storage type)
+    QJsonValue m_jsonValue;
 };
 
 } // namespace CppConfigFramework
@@ -0,0 +1,274 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that watches the configuration files and reloads the configuration
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigFileCache.hpp>
+#include <CppConfigFramework/ConfigIncludeGraph.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigSnapshotPublisher.hpp>
+#include <CppConfigFramework/EnvironmentVariables.hpp>
+
+// Qt includes
+#include <QtCore/QDir>
+#include <QtCore/QFileSystemWatcher>
+#include <QtCore/QHash>
+#include <QtCore/QMetaType>
+#include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtCore/QTimer>
+
+// System includes
+#include <memory>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class watches the configuration files and reloads the configuration when they are changed
+ *
+ * All of the configuration files read for the configuration (the file itself and all of its
+ * 'CppConfigFramework' includes) are recorded in an include graph and watched with a file system
+ * watcher. Changes of the files are debounced so that a burst of writes (for example during a
+ * deployment) results in a single reload once the files have not been changed for the debounce
+ * interval.
+ *
+ * On a reload only the changed files are read and parsed again. All of the other files and the
+ * 'config' members read from them are taken from the ConfigFileCache so only the merging of the
+ * includes and the resolution of the references is executed again for the whole configuration.
+ *
+ * \note    The ConfigFileCache is enabled while at least one watcher is active, once the last
+ *          watcher is stopped the cache is restored to the state it had before the first watcher
+ *          was started
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    /*!
+     * Constructor
+     *
+     * \param   parent  Parent object
+     */
+    explicit ConfigWatcher(QObject *parent = nullptr);
+
+    //! Destructor
+    ~ConfigWatcher() override;
+
+    /*!
+     * Gets the reader used for reading the configuration
+     *
+     * \return  Configuration reader
+     */
+    ConfigReader *reader();
+
+    /*!
+     * Gets the debounce interval
+     *
+     * \return  Debounce interval in milliseconds
+     */
+    int debounceInterval() const;
+
+    /*!
+     * Sets the debounce interval
+     *
+     * \param   debounceInterval    Time in milliseconds that needs to pass after the last change
+     *                              of a file before the configuration is reloaded
+     */
+    void setDebounceInterval(const int debounceInterval);
+
+    /*!
+     * Reads the configuration file and starts watching it and all of its includes
+     *
+     * \param   filePath                Path to the configuration file
+     * \param   workingDir              Path to the working directory
+     * \param   sourceNodePath          Node path to the node that needs to be extracted from this
+     *                                  configuration file (must be absolute node path)
+     * \param   destinationNodePath     Node path to the destination node where the result needs
+     *                                  to be stored (must be absolute node path)
+     * \param   environmentVariables    Environment variables
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    Each (re)load starts from a copy of the specified environment variables
+     */
+    bool start(const QString &filePath,
+               const QDir &workingDir,
+               const ConfigNodePath &sourceNodePath,
+               const ConfigNodePath &destinationNodePath,
+               const EnvironmentVariables &environmentVariables);
+
+    //! Stops watching the configuration files
+    void stop();
+
+    /*!
+     * Checks if the configuration files are watched
+     *
+     * \retval  true    Configuration files are watched
+     * \retval  false   Configuration files are not watched
+     */
+    bool isActive() const;
+
+    /*!
+     * Gets the last successfully read configuration
+     *
+     * \return  Configuration snapshot or null if no configuration was read yet
+     *
+     * \note    This method can be called from any thread (see ConfigSnapshotPublisher)
+     */
+    std::shared_ptr<const ConfigObjectNode> config() const;
+
+    /*!
+     * Gets the include graph of the last successfully read configuration
+     *
+     * \return  Include graph
+     */
+    const ConfigIncludeGraph &includeGraph() const;
+
+    /*!
+     * Gets the paths to the watched files and directories
+     *
+     * \return  Absolute paths to the watched files and directories
+     */
+    QStringList watchedPaths() const;
+
+    /*!
+     * Immediately reloads the configuration
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    The configChanged() signal is emitted only if the read configuration is different
+     *          than the previous one
+     */
+    bool reload();
+
+signals:
+    /*!
+     * Emitted when a reload results in a changed configuration
+     *
+     * \param   config  New configuration
+     */
+    void configChanged(std::shared_ptr<const CppConfigFramework::ConfigObjectNode> config);
+
+    /*!
+     * Emitted when a reload fails (the previous configuration is kept)
+     */
+    void reloadFailed();
+
+private:
+    /*!
+     * Handles a change of a watched file
+     *
+     * \param   filePath    Absolute path to the file
+     */
+    void onFileChanged(const QString &filePath);
+
+    /*!
+     * Handles a change of a watched directory (a file was created, removed or replaced)
+     *
+     * \param   directoryPath   Absolute path to the directory
+     */
+    void onDirectoryChanged(const QString &directoryPath);
+
+    //! Reloads the configuration if any of its files was changed
+    void onDebounceTimeout();
+
+    /*!
+     * Reads the configuration and updates the watched files
+     *
+     * \return  Configuration snapshot or null in case of a failure
+     */
+    ConfigSnapshot readConfig();
+
+    /*!
+     * Updates the watched files and directories
+     *
+     * \param   filePaths   Absolute paths to the configuration files
+     */
+    void updateWatchedPaths(const QStringList &filePaths);
+
+    /*!
+     * Enables the ConfigFileCache for this watcher (if it was not enabled for it yet)
+     */
+    void acquireFileCache();
+
+    /*!
+     * Releases the ConfigFileCache enabled for this watcher (if it was enabled for it)
+     */
+    void releaseFileCache();
+
+private:
+    //! Configuration reader
+    ConfigReader m_reader;
+
+    //! Path to the configuration file
+    QString m_filePath;
+
+    //! Path to the working directory
+    QDir m_workingDir;
+
+    //! Node path to the node that needs to be extracted from the configuration file
+    ConfigNodePath m_sourceNodePath;
+
+    //! Node path to the destination node where the result needs to be stored
+    ConfigNodePath m_destinationNodePath;
+
+    //! Environment variables
+    EnvironmentVariables m_environmentVariables;
+
+    //! Publisher of the last successfully read configuration
+    ConfigSnapshotPublisher m_config;
+
+    //! Include graph of the last successfully read configuration
+    ConfigIncludeGraph m_includeGraph;
+
+    //! Keys of the configuration files when they were last read
+    QHash<QString, ConfigFileCache::FileKey> m_fileKeys;
+
+    //! Files reported as changed since the last reload
+    QSet<QString> m_changedFilePaths;
+
+    //! File system watcher
+    QFileSystemWatcher m_fileSystemWatcher;
+
+    //! Timer used for debouncing of the changes
+    QTimer m_debounceTimer;
+
+    //! Holds the "is active" flag
+    bool m_active = false;
+
+    //! Holds the flag if the ConfigFileCache was enabled for this watcher
+    bool m_fileCacheAcquired = false;
+};
+
+} // namespace CppConfigFramework
+
+Q_DECLARE_METATYPE(std::shared_ptr<const CppConfigFramework::ConfigObjectNode>)
@@ -21,13 +21,16 @@
 #pragma once
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigBinaryFormat.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 
 // Qt includes
+#include <QtCore/QJsonDocument>
 
 // System includes
 
 // Forward declarations
+class QIODevice;
 
 // Macros
 
@@ -50,6 +53,28 @@ CPPCONFIGFRAMEWORK_EXPORT QJsonDocument writeToJsonConfig(const ConfigObjectNode
 
 // -------------------------------------------------------------------------------------------------
 
+/*!
+ * Writes the Object node to the C++ Config Framework JSON format directly to the device
+ *
+ * \param   node    Configuration node
+ * \param   device  Opened output device
+ * \param   format  Format of the written JSON
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * Unlike the overload that returns a JSON document this walks the configuration node and writes
+ * the JSON as it goes, so no intermediate QJsonObject tree or serialized copy is created.
+ *
+ * \note    The members are written in the order of their names (without the decorators)
+ */
+CPPCONFIGFRAMEWORK_EXPORT bool writeToJsonConfig(
+        const ConfigObjectNode &node,
+        QIODevice *device,
+        const QJsonDocument::JsonFormat format = QJsonDocument::Indented);
+
+// -------------------------------------------------------------------------------------------------
+
 /*!
  * Writes the Object node to the specified JSON config file
  *
@@ -64,6 +89,46 @@ CPPCONFIGFRAMEWORK_EXPORT bool writeToJsonConfigFile(const ConfigObjectNode &nod
 
 // -------------------------------------------------------------------------------------------------
 
+/*!
+ * Writes the Object node (with fully resolved references) to the C++ Config Framework binary format
+ *
+ * \param   node                Configuration node
+ * \param   sources             Sources from which the configuration node was read (see
+ *                              ConfigBinaryFormat::SourceRecordScope)
+ *
+ * \return  Binary data or an empty byte array in case of failure
+ *
+ * This function produces a valid output only when sub-nodes of this Object node contain only Object
+ * and Value nodes.
+ *
+ * \see ConfigBinaryFormat
+ */
+CPPCONFIGFRAMEWORK_EXPORT QByteArray writeToBinaryConfig(
+        const ConfigObjectNode &node,
+        const ConfigBinaryFormat::Sources &sources = ConfigBinaryFormat::Sources());
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Writes the Object node (with fully resolved references) to the specified binary config file
+ *
+ * \param   node                Configuration node
+ * \param   filePath            Path to the output binary config file
+ * \param   sources             Sources from which the configuration node was read (see
+ *                              ConfigBinaryFormat::SourceRecordScope)
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \see ConfigBinaryFormat
+ */
+CPPCONFIGFRAMEWORK_EXPORT bool writeToBinaryConfigFile(
+        const ConfigObjectNode &node,
+        const QString &filePath,
+        const ConfigBinaryFormat::Sources &sources = ConfigBinaryFormat::Sources());
+
+// -------------------------------------------------------------------------------------------------
+
 /*!
  * Converts the Object node (with fully resolved references) to a JSON value
  *
@@ -77,6 +142,27 @@ CPPCONFIGFRAMEWORK_EXPORT bool writeToJsonConfigFile(const ConfigObjectNode &nod
  */
 CPPCONFIGFRAMEWORK_EXPORT QJsonValue convertToJsonValue(const ConfigObjectNode &node);
 
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Converts the Object node (with fully resolved references) to JSON and writes it directly to the
+ * device
+ *
+ * \param   node    Configuration node
+ * \param   device  Opened output device
+ * \param   format  Format of the written JSON
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * This is the streaming equivalent of the overload that returns a JSON value. Nothing is written
+ * to the device if the Object node contains a NodeReference or a DerivedObject node.
+ */
+CPPCONFIGFRAMEWORK_EXPORT bool convertToJsonValue(
+        const ConfigObjectNode &node,
+        QIODevice *device,
+        const QJsonDocument::JsonFormat format = QJsonDocument::Indented);
+
 } // namespace ConfigWriter
 
 } // namespace CppConfigFramework
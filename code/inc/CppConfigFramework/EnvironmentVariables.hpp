@@ -27,8 +27,13 @@
 #include <QtCore/QHash>
 
 // System includes
+#include <memory>
 
 // Forward declarations
+namespace CppConfigFramework
+{
+class ProcessEnvironmentLayer;
+}
 
 // Macros
 
@@ -41,17 +46,115 @@ namespace CppConfigFramework
  * This class gives access to system and local environment variables. It can be used for accessing
  * the environment variable values and for expanding environment variable references in a string.
  *
- * System environment variables are read when an instance of this class is created and they are used
- * as the initial environment variables.
+ * The environment variables are stored in two layers. The bottom layer gives access to the system
+ * environment variables (if the instance was created with loadFromProcess()) and the top layer
+ * holds the local environment variables which override the system ones. The system environment
+ * variables are not copied, each of them is read from the process lazily when it is accessed for
+ * the first time and then remembered. The bottom layer is shared by all copies of the instance and
+ * the top layer is implicitly shared so copying an instance (for example to make a snapshot or to
+ * give an included configuration file its own environment) is a constant-time operation and a
+ * modification of a copy only copies the local environment variables.
  *
- * \note    If a system environment variable is updated after that then that change will not be
- *          applied to an already constructed instance of this class!
+ * \note    If a system environment variable is updated after it was accessed for the first time (or
+ *          after names() was called) then that change will not be applied to an already
+ *          constructed instance of this class!
  *
  * If an attempt is made to set an environment variable that does not exist then a new variable is
  * created.
  */
 class CPPCONFIGFRAMEWORK_EXPORT EnvironmentVariables
 {
+public:
+    //! Holds the information about the error that prevented the expansion of a text
+    struct ExpansionError
+    {
+        //! Error types
+        enum class Type
+        {
+            //! No error
+            None,
+
+            //! Referenced environment variable does not exist
+            UndefinedVariable,
+
+            //! Referenced environment variable (indirectly) references itself
+            CyclicReference
+        };
+
+        //! Error type
+        Type type = Type::None;
+
+        //! Name of the environment variable that caused the error
+        QString variableName;
+
+        /*!
+         * Gets a human readable description of the error
+         *
+         * \return  Error description
+         */
+        QString toString() const;
+    };
+
+    /*!
+     * Records the environment variables that are looked up while expanding texts on this thread
+     * (until it is destroyed)
+     *
+     * Each looked up environment variable is recorded with its (unexpanded) value or with a null
+     * string if it is not set. This includes the environment variables referenced from the values
+     * of other environment variables and the ones whose names are built from nested references
+     * (for example "${NAME_${SUFFIX}}"), so the recorded environment variables are exactly the
+     * ones that the expanded texts depend on.
+     *
+     * \note    The scopes can be nested, a lookup is recorded in all of the active scopes
+     */
+    class CPPCONFIGFRAMEWORK_EXPORT LookupRecordScope
+    {
+    public:
+        /*!
+         * Constructor
+         *
+         * \param   lookups Container in which the looked up environment variables shall be recorded
+         */
+        explicit LookupRecordScope(QHash<QString, QString> *lookups);
+
+        //! Copy constructor is disabled
+        LookupRecordScope(const LookupRecordScope &) = delete;
+
+        //! Move constructor is disabled
+        LookupRecordScope(LookupRecordScope &&) = delete;
+
+        //! Destructor
+        ~LookupRecordScope();
+
+        //! Copy assignment operator is disabled
+        LookupRecordScope &operator=(const LookupRecordScope &) = delete;
+
+        //! Move assignment operator is disabled
+        LookupRecordScope &operator=(LookupRecordScope &&) = delete;
+
+    private:
+        /*!
+         * Records the looked up environment variable in all of the active scopes on this thread
+         *
+         * \param   name    Environment variable name
+         * \param   value   Environment variable value (null string if it is not set)
+         */
+        static void record(const QString &name, const QString &value);
+
+    private:
+        //! Expander needs to record the looked up environment variables
+        friend class EnvironmentVariableExpander;
+
+        //! Cache needs to record the environment variables on which a cached config depends
+        friend class ConfigFileCache;
+
+        //! Container in which the looked up environment variables are recorded
+        QHash<QString, QString> *m_lookups;
+
+        //! Scope that was active on this thread
+        LookupRecordScope *m_previousScope;
+    };
+
 public:
     /*!
      * Loads environment variables from the current process
@@ -102,7 +205,27 @@ public:
      */
     QString expandText(const QString &text) const;
 
+    /*!
+     * Expands all references to environment variables in the text
+     *
+     * \param   text    Text to expand
+     *
+     * \param[out]  error   Optional output for the information about the expansion error
+     *
+     * \return  Expanded text or a null string if all references to environment variables were not
+     *          expanded
+     *
+     * The text is expanded in a single pass. The values of the referenced environment variables
+     * are expanded recursively (each variable is expanded only once per call) and a reference name
+     * can itself contain references (for example "${NAME_${SUFFIX}}"). Character sequences that are
+     * not valid references are kept as they are.
+     */
+    QString expandText(const QString &text, ExpansionError *error) const;
+
 private:
+    //! Holds the system environment variables (null if the process environment is not used)
+    std::shared_ptr<ProcessEnvironmentLayer> m_processEnvironment;
+
     //! Holds the local environment variables
     QHash<QString, QString> m_variables;
 };
@@ -49,9 +49,20 @@ CPPCONFIGFRAMEWORK_EXPORT extern const QLoggingCategory ConfigNodePath;
 //! Logging category for ConfigParameterValidator
 CPPCONFIGFRAMEWORK_EXPORT extern const QLoggingCategory ConfigParameterValidator;
 
+/*!
+ * Logging category for ConfigReadStatistics
+ *
+ * \note    The debug output of this category is disabled by default since enabling it records the
+ *          statistics of each configuration read
+ */
+CPPCONFIGFRAMEWORK_EXPORT extern const QLoggingCategory ConfigReadStatistics;
+
 //! Logging category for ConfigReader
 CPPCONFIGFRAMEWORK_EXPORT extern const QLoggingCategory ConfigReader;
 
+//! Logging category for ConfigWatcher
+CPPCONFIGFRAMEWORK_EXPORT extern const QLoggingCategory ConfigWatcher;
+
 //! Logging category for ConfigWriter
 CPPCONFIGFRAMEWORK_EXPORT extern const QLoggingCategory ConfigWriter;
 
@@ -0,0 +1,197 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the definitions of the C++ Config Framework binary configuration format
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigBinaryFormat.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/LoggingCategories.hpp>
+
+// Qt includes
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace ConfigBinaryFormat
+{
+
+/*!
+ * Gets the current metadata of the file
+ *
+ * \param   filePath    Absolute path to the file
+ *
+ * \param[out]  sourceFile  Output for the source file
+ *
+ * \retval  true    Success
+ * \retval  false   Failure (file does not exist)
+ */
+static bool readSourceFile(const QString &filePath, SourceFile *sourceFile)
+{
+    const QFileInfo fileInfo(filePath);
+
+    if (!fileInfo.isFile())
+    {
+        return false;
+    }
+
+    sourceFile->filePath = filePath;
+    sourceFile->size = fileInfo.size();
+    sourceFile->lastModified = fileInfo.lastModified().toMSecsSinceEpoch();
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool Sources::isStale(const EnvironmentVariables &currentEnvironmentVariables,
+                      QString *reason) const
+{
+    for (const auto &file : files)
+    {
+        SourceFile currentFile;
+
+        if (!readSourceFile(file.filePath, &currentFile))
+        {
+            if (reason != nullptr)
+            {
+                *reason = QString("Source file [%1] does not exist").arg(file.filePath);
+            }
+            return true;
+        }
+
+        if ((currentFile.size != file.size) || (currentFile.lastModified != file.lastModified))
+        {
+            if (reason != nullptr)
+            {
+                *reason = QString("Source file [%1] was changed").arg(file.filePath);
+            }
+            return true;
+        }
+    }
+
+    for (auto it = environmentVariables.begin(); it != environmentVariables.end(); it++)
+    {
+        const QString &name = it.key();
+        const bool wasSet = !it.value().isNull();
+
+        if ((currentEnvironmentVariables.contains(name) != wasSet) ||
+            (wasSet && (currentEnvironmentVariables.value(name) != it.value())))
+        {
+            if (reason != nullptr)
+            {
+                *reason = QString("Environment variable [%1] was changed").arg(name);
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool Sources::containsFile(const QString &filePath) const
+{
+    return std::any_of(files.begin(),
+                       files.end(),
+                       [&filePath](const SourceFile &file) { return file.filePath == filePath; });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SourceRecordScope::SourceRecordScope()
+    : m_includeGraphRecordScope(&m_includeGraph),
+      m_lookupRecordScope(&m_environmentVariableLookups)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool SourceRecordScope::sources(const EnvironmentVariables &environmentVariables,
+                                Sources *sources) const
+{
+    Q_ASSERT(sources != nullptr);
+
+    // The included files that were skipped (see ConfigReader::setSourceNodePruningEnabled()) are
+    // also sources since they could contribute to the configuration once they are changed
+    QStringList filePaths = m_includeGraph.filePaths();
+
+    for (const auto &include : m_includeGraph.includes())
+    {
+        if ((!include.filePath.isEmpty()) && (!filePaths.contains(include.filePath)))
+        {
+            filePaths.append(include.filePath);
+        }
+    }
+
+    Sources recordedSources;
+    recordedSources.files.reserve(static_cast<size_t>(filePaths.size()));
+
+    for (const QString &filePath : filePaths)
+    {
+        SourceFile sourceFile;
+
+        if (!readSourceFile(filePath, &sourceFile))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Source file does not exist:" << filePath;
+            return false;
+        }
+
+        recordedSources.files.push_back(sourceFile);
+    }
+
+    // An empty value is stored as an empty (not null) string
+    for (auto it = m_environmentVariableLookups.begin();
+         it != m_environmentVariableLookups.end();
+         it++)
+    {
+        QString value;
+
+        if (environmentVariables.contains(it.key()))
+        {
+            value = environmentVariables.value(it.key());
+
+            if (value.isNull())
+            {
+                value = QString(QLatin1String(""));
+            }
+        }
+
+        recordedSources.environmentVariables.insert(it.key(), value);
+    }
+
+    *sources = std::move(recordedSources);
+    return true;
+}
+
+} // namespace ConfigBinaryFormat
+
+} // namespace CppConfigFramework
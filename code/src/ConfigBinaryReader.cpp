@@ -0,0 +1,709 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class for reading the binary configuration files
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigBinaryReader.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigBinaryFormat.hpp>
+#include <CppConfigFramework/ConfigIncludeGraph.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include <CppConfigFramework/LoggingCategories.hpp>
+
+// Qt includes
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+
+// System includes
+#include <cstring>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+//! Maximum nesting depth of the nodes and JSON values (protects against corrupted files)
+static constexpr int s_maxDepth = 1024;
+
+// -------------------------------------------------------------------------------------------------
+
+//! Decodes the binary configuration format
+class BinaryConfigDecoder
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   data    Binary data (it must outlive the decoder)
+     */
+    explicit BinaryConfigDecoder(const QByteArray &data)
+        : m_data(data.constData()),
+          m_size(data.size())
+    {
+    }
+
+    /*!
+     * Checks if all of the data was decoded
+     *
+     * \retval  true    All of the data was decoded
+     * \retval  false   Not all of the data was decoded
+     */
+    bool atEnd() const
+    {
+        return m_position == m_size;
+    }
+
+    /*!
+     * Decodes the header
+     *
+     * \param[out]  sources Sources from which the binary configuration was created
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readHeader(ConfigBinaryFormat::Sources *sources)
+    {
+        quint32 magic = 0U;
+
+        if ((!readUInt32(&magic)) || (magic != ConfigBinaryFormat::MAGIC))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "The file is not a binary configuration file";
+            return false;
+        }
+
+        quint32 version = 0U;
+
+        if ((!readUInt32(&version)) || (version != ConfigBinaryFormat::VERSION))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("Unsupported binary configuration format version [%1], expected "
+                               "version [%2]")
+                       .arg(version)
+                       .arg(ConfigBinaryFormat::VERSION);
+            return false;
+        }
+
+        if (!readSources(sources))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Failed to read the sources";
+            return false;
+        }
+
+        return true;
+    }
+
+    /*!
+     * Decodes the root Object node
+     *
+     * \return  Object node or in case of failure a null pointer
+     */
+    std::unique_ptr<ConfigObjectNode> readRootNode()
+    {
+        quint8 tag = 0U;
+
+        if ((!readUInt8(&tag)) || (tag != static_cast<quint8>(ConfigBinaryFormat::NodeTag::Object)))
+        {
+            return {};
+        }
+
+        return readObjectNode(0);
+    }
+
+private:
+    /*!
+     * Decodes the sources
+     *
+     * \param[out]  sources Sources
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readSources(ConfigBinaryFormat::Sources *sources)
+    {
+        quint32 fileCount = 0U;
+
+        if (!readCount(&fileCount))
+        {
+            return false;
+        }
+
+        sources->files.clear();
+        sources->files.reserve(fileCount);
+
+        for (quint32 i = 0U; i < fileCount; i++)
+        {
+            ConfigBinaryFormat::SourceFile file;
+            quint64 size = 0U;
+            quint64 lastModified = 0U;
+
+            if ((!readString(&file.filePath)) ||
+                (!readUInt64(&size)) ||
+                (!readUInt64(&lastModified)))
+            {
+                return false;
+            }
+
+            file.size = static_cast<qint64>(size);
+            file.lastModified = static_cast<qint64>(lastModified);
+            sources->files.push_back(file);
+        }
+
+        quint32 environmentVariableCount = 0U;
+
+        if (!readCount(&environmentVariableCount))
+        {
+            return false;
+        }
+
+        sources->environmentVariables.clear();
+
+        for (quint32 i = 0U; i < environmentVariableCount; i++)
+        {
+            QString name;
+            quint8 isSet = 0U;
+            QString value;
+
+            if ((!readString(&name)) || (!readUInt8(&isSet)) || (!readString(&value)))
+            {
+                return false;
+            }
+
+            // An empty value is stored as an empty (not null) string
+            if (isSet != 0U)
+            {
+                sources->environmentVariables.insert(name,
+                                                     value.isNull() ? QString(QLatin1String(""))
+                                                                    : value);
+            }
+            else
+            {
+                sources->environmentVariables.insert(name, QString());
+            }
+        }
+
+        return true;
+    }
+
+    /*!
+     * Decodes an Object node (without its tag)
+     *
+     * \param   depth   Nesting depth of the node
+     *
+     * \return  Object node or in case of failure a null pointer
+     */
+    std::unique_ptr<ConfigObjectNode> readObjectNode(const int depth)
+    {
+        using ConfigBinaryFormat::NodeTag;
+
+        quint32 count = 0U;
+
+        if ((depth > s_maxDepth) || (!readCount(&count)))
+        {
+            return {};
+        }
+
+        auto objectNode = std::make_unique<ConfigObjectNode>();
+
+        for (quint32 i = 0U; i < count; i++)
+        {
+            QString name;
+            quint8 tag = 0U;
+
+            if ((!readString(&name)) || (!readUInt8(&tag)))
+            {
+                return {};
+            }
+
+            std::unique_ptr<ConfigNode> memberNode;
+
+            if (tag == static_cast<quint8>(NodeTag::Object))
+            {
+                memberNode = readObjectNode(depth + 1);
+            }
+            else if (tag == static_cast<quint8>(NodeTag::Value))
+            {
+                QJsonValue value;
+
+                if (readJsonValue(depth + 1, &value))
+                {
+                    memberNode = std::make_unique<ConfigValueNode>(value);
+                }
+            }
+
+            if ((!memberNode) || (!objectNode->setMember(name, std::move(memberNode))))
+            {
+                return {};
+            }
+        }
+
+        return objectNode;
+    }
+
+    /*!
+     * Decodes a JSON value
+     *
+     * \param   depth   Nesting depth of the value
+     *
+     * \param[out]  value   JSON value
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readJsonValue(const int depth, QJsonValue *value)
+    {
+        using ConfigBinaryFormat::ValueTag;
+
+        quint8 tag = 0U;
+
+        if ((depth > s_maxDepth) || (!readUInt8(&tag)))
+        {
+            return false;
+        }
+
+        switch (static_cast<ValueTag>(tag))
+        {
+            case ValueTag::Null:
+            {
+                *value = QJsonValue(QJsonValue::Null);
+                return true;
+            }
+
+            case ValueTag::False:
+            case ValueTag::True:
+            {
+                *value = QJsonValue(static_cast<ValueTag>(tag) == ValueTag::True);
+                return true;
+            }
+
+            case ValueTag::Double:
+            {
+                quint64 bits = 0U;
+
+                if (!readUInt64(&bits))
+                {
+                    return false;
+                }
+
+                double number = 0.0;
+                std::memcpy(&number, &bits, sizeof(number));
+                *value = QJsonValue(number);
+                return true;
+            }
+
+            case ValueTag::String:
+            {
+                QString text;
+
+                if (!readString(&text))
+                {
+                    return false;
+                }
+
+                *value = QJsonValue(text);
+                return true;
+            }
+
+            case ValueTag::Array:
+            {
+                quint32 count = 0U;
+
+                if (!readCount(&count))
+                {
+                    return false;
+                }
+
+                QJsonArray array;
+
+                for (quint32 i = 0U; i < count; i++)
+                {
+                    QJsonValue item;
+
+                    if (!readJsonValue(depth + 1, &item))
+                    {
+                        return false;
+                    }
+
+                    array.append(item);
+                }
+
+                *value = array;
+                return true;
+            }
+
+            case ValueTag::Object:
+            {
+                quint32 count = 0U;
+
+                if (!readCount(&count))
+                {
+                    return false;
+                }
+
+                QJsonObject object;
+
+                for (quint32 i = 0U; i < count; i++)
+                {
+                    QString key;
+                    QJsonValue item;
+
+                    if ((!readString(&key)) || (!readJsonValue(depth + 1, &item)))
+                    {
+                        return false;
+                    }
+
+                    object.insert(key, item);
+                }
+
+                *value = object;
+                return true;
+            }
+
+            default:
+            {
+                return false;
+            }
+        }
+    }
+
+    /*!
+     * Decodes a string
+     *
+     * \param[out]  value   String
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readString(QString *value)
+    {
+        quint32 size = 0U;
+
+        if ((!readUInt32(&size)) || (size > static_cast<quint64>(m_size - m_position)))
+        {
+            return false;
+        }
+
+        *value = QString::fromUtf8(m_data + m_position, static_cast<int>(size));
+        m_position += size;
+        return true;
+    }
+
+    /*!
+     * Decodes the number of items
+     *
+     * \param[out]  count   Number of items
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    Each item takes at least one byte so a larger number of items than the number of the
+     *          remaining bytes is rejected
+     */
+    bool readCount(quint32 *count)
+    {
+        return readUInt32(count) && (*count <= static_cast<quint64>(m_size - m_position));
+    }
+
+    /*!
+     * Decodes an unsigned integer
+     *
+     * \param[out]  value   Unsigned integer
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readUInt8(quint8 *value)
+    {
+        quint64 result = 0U;
+
+        if (!readLittleEndian(1, &result))
+        {
+            return false;
+        }
+
+        *value = static_cast<quint8>(result);
+        return true;
+    }
+
+    //! \copydoc    BinaryConfigDecoder::readUInt8()
+    bool readUInt32(quint32 *value)
+    {
+        quint64 result = 0U;
+
+        if (!readLittleEndian(4, &result))
+        {
+            return false;
+        }
+
+        *value = static_cast<quint32>(result);
+        return true;
+    }
+
+    //! \copydoc    BinaryConfigDecoder::readUInt8()
+    bool readUInt64(quint64 *value)
+    {
+        return readLittleEndian(8, value);
+    }
+
+    /*!
+     * Decodes an unsigned integer stored in little-endian byte order
+     *
+     * \param   size    Size of the integer in bytes
+     *
+     * \param[out]  value   Unsigned integer
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readLittleEndian(const int size, quint64 *value)
+    {
+        if ((m_size - m_position) < size)
+        {
+            return false;
+        }
+
+        quint64 result = 0U;
+
+        for (int i = 0; i < size; i++)
+        {
+            const auto byte = static_cast<quint8>(m_data[m_position + i]);
+            result |= (static_cast<quint64>(byte) << (8 * i));
+        }
+
+        *value = result;
+        m_position += size;
+        return true;
+    }
+
+private:
+    //! Binary data
+    const char *m_data;
+
+    //! Size of the binary data
+    qint64 m_size;
+
+    //! Position of the next byte to decode
+    qint64 m_position = 0;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigBinaryReader::read(
+        const QString &filePath,
+        const QDir &workingDir,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const EnvironmentVariables *environmentVariables,
+        const QStringList &requiredSourceFiles) const
+{
+    // Make sure that file path is not empty
+    if (filePath.isEmpty())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader) << "File path is empty!";
+        return {};
+    }
+
+    // Open file (it is recorded in the include graph, if one is being recorded, so that it is also
+    // a source of a binary configuration that includes it)
+    const QString absoluteFilePath = QDir::cleanPath(workingDir.absoluteFilePath(filePath));
+    const ConfigIncludeGraph::FileScope fileScope(absoluteFilePath);
+    QFile file(absoluteFilePath);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to open file at path:" << absoluteFilePath;
+        return {};
+    }
+
+    // Decode the contents
+    const QByteArray fileContents = readFileData(&file);
+    BinaryConfigDecoder decoder(fileContents);
+    ConfigBinaryFormat::Sources sources;
+
+    if (!decoder.readHeader(&sources))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to read the header of the binary configuration file:"
+                << absoluteFilePath;
+        return {};
+    }
+
+    // Check if the binary configuration is stale (this is always checked)
+    QString staleReason;
+    const bool stale = (environmentVariables != nullptr)
+                       ? sources.isStale(*environmentVariables, &staleReason)
+                       : sources.isStale(EnvironmentVariables::loadFromProcess(), &staleReason);
+
+    if (stale)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "The binary configuration file is stale:" << absoluteFilePath
+                << "Reason:" << staleReason;
+        return {};
+    }
+
+    for (const QString &requiredSourceFile : requiredSourceFiles)
+    {
+        if (!sources.containsFile(requiredSourceFile))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "The binary configuration file was not created from the source file:"
+                    << requiredSourceFile << "Binary configuration file:" << absoluteFilePath;
+            return {};
+        }
+    }
+
+    auto config = decoder.readRootNode();
+
+    if ((!config) || (!decoder.atEnd()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "The binary configuration file is corrupted:" << absoluteFilePath;
+        return {};
+    }
+
+    // Transform the configuration node based on source and destination node paths
+    auto transformedConfig = transformConfig(std::move(config),
+                                             sourceNodePath,
+                                             destinationNodePath);
+
+    if (!transformedConfig)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to transform the config";
+        return {};
+    }
+
+    return transformedConfig;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigBinaryReader::read(
+        const QDir &workingDir,
+        const ConfigNodePath &destinationNodePath,
+        const QJsonObject &otherParameters,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables) const
+{
+    Q_UNUSED(externalConfigs)
+    Q_ASSERT(environmentVariables);
+
+    // Extract file path
+    QString filePath;
+
+    if (!CedarFramework::deserializeNode(otherParameters, QStringLiteral("file_path"), &filePath))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "The 'file_path' parameter is missing or invalid";
+        return {};
+    }
+
+    EnvironmentVariables::ExpansionError expansionError;
+    const QString expandedFilePath = environmentVariables->expandText(filePath, &expansionError);
+
+    if (expandedFilePath.isEmpty())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to expand file path:" << filePath
+                << "Error:" << expansionError.toString();
+        return {};
+    }
+
+    // Extract source node
+    ConfigNodePath sourceNodePath = ConfigNodePath::ROOT_PATH;
+
+    if (!CedarFramework::deserializeOptionalNode(otherParameters,
+                                                 QStringLiteral("source_node"),
+                                                 &sourceNodePath))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "The 'source_node' parameter is invalid";
+        return {};
+    }
+
+    // Extract the source files from which the binary configuration needs to be created
+    QStringList sourceFiles;
+
+    if (!CedarFramework::deserializeOptionalNode(otherParameters,
+                                                 QStringLiteral("source_files"),
+                                                 &sourceFiles))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "The 'source_files' parameter is invalid";
+        return {};
+    }
+
+    for (auto &sourceFile : sourceFiles)
+    {
+        const QString expandedSourceFile = environmentVariables->expandText(sourceFile,
+                                                                            &expansionError);
+
+        if (expandedSourceFile.isEmpty())
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Failed to expand source file path:" << sourceFile
+                    << "Error:" << expansionError.toString();
+            return {};
+        }
+
+        sourceFile = QDir::cleanPath(workingDir.absoluteFilePath(expandedSourceFile));
+    }
+
+    // Read the binary configuration file
+    return read(expandedFilePath,
+                workingDir,
+                sourceNodePath,
+                destinationNodePath,
+                environmentVariables,
+                sourceFiles);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigBinaryReader::readSources(const QString &filePath,
+                                     ConfigBinaryFormat::Sources *sources)
+{
+    Q_ASSERT(sources != nullptr);
+
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to open file at path:" << filePath;
+        return false;
+    }
+
+    const QByteArray fileContents = readFileData(&file);
+    BinaryConfigDecoder decoder(fileContents);
+
+    return decoder.readHeader(sources);
+}
+
+} // namespace CppConfigFramework
@@ -22,6 +22,7 @@
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigReadStatistics.hpp>
 
 // Qt includes
 #include <QtCore/QJsonArray>
@@ -45,13 +46,59 @@ ConfigDerivedObjectNode::ConfigDerivedObjectNode(const QList<ConfigNodePath> &ba
       m_bases(bases),
       m_config(std::move(config.clone()->toObject()))
 {
+    m_config.m_derivedObject = this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigDerivedObjectNode::ConfigDerivedObjectNode(const QList<ConfigNodePath> &bases,
+                                                 ConfigObjectNode &&config,
+                                                 ConfigObjectNode *parent)
+    : ConfigNode(parent),
+      m_bases(bases),
+      m_config(std::move(config))
+{
+    m_config.setParent(nullptr);
+    m_config.m_derivedObject = this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigDerivedObjectNode::ConfigDerivedObjectNode(ConfigDerivedObjectNode &&other) noexcept
+    : ConfigNode(std::move(other)),
+      m_bases(std::move(other.m_bases)),
+      m_config(std::move(other.m_config))
+{
+    m_config.m_derivedObject = this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigDerivedObjectNode &ConfigDerivedObjectNode::operator=(
+        ConfigDerivedObjectNode &&other) noexcept
+{
+    if (&other == this)
+    {
+        return *this;
+    }
+
+    ConfigNode::operator=(std::move(other));
+    m_bases = std::move(other.m_bases);
+    m_config = std::move(other.m_config);
+
+    return *this;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 std::unique_ptr<ConfigNode> ConfigDerivedObjectNode::clone() const
 {
-    return std::make_unique<ConfigDerivedObjectNode>(m_bases, m_config, nullptr);
+    ConfigReadStatistics::recordClonedNode();
+
+    auto node = std::make_unique<ConfigDerivedObjectNode>(m_bases, m_config, nullptr);
+    node->copyContentHashCache(*this);
+
+    return node;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -73,6 +120,7 @@ QList<ConfigNodePath> ConfigDerivedObjectNode::bases() const
 void ConfigDerivedObjectNode::setBases(const QList<ConfigNodePath> &bases)
 {
     m_bases = bases;
+    invalidateContentHashCache();
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -84,11 +132,41 @@ const ConfigObjectNode &ConfigDerivedObjectNode::config() const
 
 // -------------------------------------------------------------------------------------------------
 
+ConfigObjectNode &ConfigDerivedObjectNode::config()
+{
+    return m_config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 void ConfigDerivedObjectNode::setConfig(const ConfigObjectNode &config)
 {
     m_config = std::move(config.clone()->toObject());
 }
 
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDerivedObjectNode::setConfig(ConfigObjectNode &&config)
+{
+    m_config = std::move(config);
+    m_config.setParent(nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 ConfigDerivedObjectNode::calculateContentHash() const
+{
+    quint64 hash = combineContentHash(static_cast<quint64>(type()),
+                                      static_cast<quint64>(m_bases.size()));
+
+    for (const auto &base : m_bases)
+    {
+        hash = combineContentHash(hash, stringContentHash(base.path()));
+    }
+
+    return combineContentHash(hash, m_config.contentHash());
+}
+
 } // namespace CppConfigFramework
 
 // -------------------------------------------------------------------------------------------------
@@ -0,0 +1,382 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a process-wide cache for the read configuration files
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigFileCache.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+
+// Qt includes
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+//! Maximum number of cached Object nodes for the same file
+static constexpr size_t s_maxConfigsPerFile = 4U;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if the environment variables match the values of the dependencies
+ *
+ * \param   dependencies            Values of the environment variables (an environment variable
+ *                                  that was not set is stored as a null string)
+ * \param   environmentVariables    Environment variables
+ *
+ * \retval  true    Match
+ * \retval  false   Mismatch
+ */
+static bool dependenciesMatch(const QHash<QString, QString> &dependencies,
+                              const EnvironmentVariables &environmentVariables)
+{
+    for (auto it = dependencies.begin(); it != dependencies.end(); it++)
+    {
+        if (it.value().isNull())
+        {
+            if (environmentVariables.contains(it.key()))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            if ((!environmentVariables.contains(it.key())) ||
+                (environmentVariables.value(it.key()) != it.value()))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigFileCache::FileKey ConfigFileCache::FileKey::fromFile(const QString &absoluteFilePath)
+{
+    const QFileInfo fileInfo(absoluteFilePath);
+
+    FileKey fileKey;
+    fileKey.absoluteFilePath = absoluteFilePath;
+
+    if (fileInfo.exists())
+    {
+        fileKey.size = fileInfo.size();
+        fileKey.lastModified = fileInfo.lastModified();
+    }
+
+    return fileKey;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigFileCache::FileKey::operator==(const ConfigFileCache::FileKey &other) const
+{
+    return (absoluteFilePath == other.absoluteFilePath) &&
+            (size == other.size) &&
+            (lastModified == other.lastModified);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigFileCache *ConfigFileCache::instance()
+{
+    static ConfigFileCache cache;
+
+    return &cache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigFileCache::isEnabled() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigFileCache::setEnabled(const bool enabled)
+{
+    QMutexLocker locker(&m_mutex);
+    m_enabled = enabled;
+
+    if (!enabled)
+    {
+        m_files.clear();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigFileCache::maxFileCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_maxFileCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigFileCache::setMaxFileCount(const int maxFileCount)
+{
+    if (maxFileCount <= 0)
+    {
+        return;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    m_maxFileCount = maxFileCount;
+    evictFiles(m_maxFileCount);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigFileCache::fileCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return static_cast<int>(m_files.size());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigFileCache::Statistics ConfigFileCache::statistics() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_statistics;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigFileCache::resetStatistics()
+{
+    QMutexLocker locker(&m_mutex);
+    m_statistics = Statistics();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigFileCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_files.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigFileCache::removeFile(const QString &absoluteFilePath)
+{
+    QMutexLocker locker(&m_mutex);
+    m_files.erase(absoluteFilePath);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigFileCache::containsFile(const ConfigFileCache::FileKey &fileKey) const
+{
+    QMutexLocker locker(&m_mutex);
+    const auto it = m_files.find(fileKey.absoluteFilePath);
+
+    return (it != m_files.end()) && (it->second.fileKey == fileKey);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigFileCache::findFile(const ConfigFileCache::FileKey &fileKey, QJsonObject *rootObject)
+{
+    Q_ASSERT(rootObject != nullptr);
+
+    QMutexLocker locker(&m_mutex);
+
+    if (!m_enabled)
+    {
+        return false;
+    }
+
+    auto *cachedFile = findCachedFile(fileKey);
+
+    if (cachedFile == nullptr)
+    {
+        m_statistics.fileMisses++;
+        return false;
+    }
+
+    m_statistics.fileHits++;
+    *rootObject = cachedFile->rootObject;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigFileCache::storeFile(const ConfigFileCache::FileKey &fileKey,
+                                const QJsonObject &rootObject)
+{
+    QMutexLocker locker(&m_mutex);
+
+    if ((!m_enabled) || (fileKey.size < 0))
+    {
+        return;
+    }
+
+    // Replace any older version of the file
+    auto &cachedFile = m_files[fileKey.absoluteFilePath];
+    cachedFile.fileKey = fileKey;
+    cachedFile.rootObject = rootObject;
+    cachedFile.configs.clear();
+    cachedFile.lastUsed = ++m_usageCounter;
+
+    evictFiles(m_maxFileCount);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigFileCache::findConfig(
+        const ConfigFileCache::FileKey &fileKey,
+        const EnvironmentVariables &environmentVariables)
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (!m_enabled)
+    {
+        return {};
+    }
+
+    auto *cachedFile = findCachedFile(fileKey);
+
+    if (cachedFile != nullptr)
+    {
+        for (const auto &cachedConfig : cachedFile->configs)
+        {
+            if (dependenciesMatch(cachedConfig.dependencies, environmentVariables))
+            {
+                // The cached config depends on the same environment variables as if it was read
+                // from the file, so they are recorded as if they were looked up
+                for (auto it = cachedConfig.dependencies.begin();
+                     it != cachedConfig.dependencies.end();
+                     it++)
+                {
+                    EnvironmentVariables::LookupRecordScope::record(it.key(), it.value());
+                }
+
+                m_statistics.configHits++;
+                return std::make_unique<ConfigObjectNode>(
+                            std::move(cachedConfig.config->clone()->toObject()));
+            }
+        }
+    }
+
+    m_statistics.configMisses++;
+    return {};
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigFileCache::storeConfig(const ConfigFileCache::FileKey &fileKey,
+                                  const ConfigObjectNode &config,
+                                  QHash<QString, QString> dependencies)
+{
+    // The copy is allocated from the heap since a copy allocated from the arena of the reader would
+    // keep the whole arena alive for as long as it is cached
+    std::unique_ptr<ConfigObjectNode> configCopy;
+
+    {
+        const ConfigNodeArena::SuspendScope suspendArena;
+        configCopy = std::make_unique<ConfigObjectNode>(std::move(config.clone()->toObject()));
+    }
+
+    // Store the config
+    QMutexLocker locker(&m_mutex);
+
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    auto *cachedFile = findCachedFile(fileKey);
+
+    if (cachedFile == nullptr)
+    {
+        return;
+    }
+
+    if (cachedFile->configs.size() >= s_maxConfigsPerFile)
+    {
+        cachedFile->configs.pop_front();
+    }
+
+    cachedFile->configs.push_back(CachedConfig { std::move(dependencies), std::move(configCopy) });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigFileCache::CachedFile *ConfigFileCache::findCachedFile(
+        const ConfigFileCache::FileKey &fileKey)
+{
+    auto it = m_files.find(fileKey.absoluteFilePath);
+
+    if (it == m_files.end())
+    {
+        return nullptr;
+    }
+
+    if (!(it->second.fileKey == fileKey))
+    {
+        // The file was changed, remove the stale entry
+        m_files.erase(it);
+        return nullptr;
+    }
+
+    it->second.lastUsed = ++m_usageCounter;
+    return &it->second;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigFileCache::evictFiles(const int maxFileCount)
+{
+    while (static_cast<int>(m_files.size()) > maxFileCount)
+    {
+        auto leastRecentlyUsed = m_files.begin();
+
+        for (auto it = m_files.begin(); it != m_files.end(); it++)
+        {
+            if (it->second.lastUsed < leastRecentlyUsed->second.lastUsed)
+            {
+                leastRecentlyUsed = it;
+            }
+        }
+
+        m_files.erase(leastRecentlyUsed);
+        m_statistics.evictions++;
+    }
+}
+
+} // namespace CppConfigFramework
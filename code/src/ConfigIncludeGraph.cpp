@@ -0,0 +1,177 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the include dependency graph of a configuration
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigIncludeGraph.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+//! Graph of the active record scope on this thread (null if no graph is being recorded)
+static thread_local ConfigIncludeGraph *t_currentGraph = nullptr;
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigIncludeGraph::RecordScope::RecordScope(ConfigIncludeGraph *graph)
+    : m_previousGraph(t_currentGraph)
+{
+    t_currentGraph = graph;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigIncludeGraph::RecordScope::~RecordScope()
+{
+    t_currentGraph = m_previousGraph;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigIncludeGraph::FileScope::FileScope(const QString &absoluteFilePath)
+    : m_graph(t_currentGraph)
+{
+    if (m_graph == nullptr)
+    {
+        return;
+    }
+
+    if (!m_graph->m_filePaths.contains(absoluteFilePath))
+    {
+        m_graph->m_filePaths.append(absoluteFilePath);
+    }
+
+    m_graph->m_fileStack.append(absoluteFilePath);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigIncludeGraph::FileScope::~FileScope()
+{
+    if (m_graph != nullptr)
+    {
+        m_graph->m_fileStack.removeLast();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigIncludeGraph::isEmpty() const
+{
+    return m_filePaths.isEmpty() && m_includes.empty();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigIncludeGraph::clear()
+{
+    m_filePaths.clear();
+    m_includes.clear();
+    m_fileStack.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QStringList ConfigIncludeGraph::filePaths() const
+{
+    return m_filePaths;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const std::vector<ConfigIncludeGraph::Include> &ConfigIncludeGraph::includes() const
+{
+    return m_includes;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QStringList ConfigIncludeGraph::dependentFilePaths(const QString &filePath) const
+{
+    if (!m_filePaths.contains(filePath))
+    {
+        return {};
+    }
+
+    // Walk the includes backwards from the file to all of its (indirect) parents
+    QStringList dependentFilePaths { filePath };
+
+    for (int i = 0; i < dependentFilePaths.size(); i++)
+    {
+        const QString currentFilePath = dependentFilePaths.at(i);
+
+        for (const auto &include : m_includes)
+        {
+            if ((include.filePath == currentFilePath) &&
+                (!include.parentFilePath.isEmpty()) &&
+                (!dependentFilePaths.contains(include.parentFilePath)))
+            {
+                dependentFilePaths.append(include.parentFilePath);
+            }
+        }
+    }
+
+    return dependentFilePaths;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigIncludeGraph::isRecording()
+{
+    return (t_currentGraph != nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigIncludeGraph::recordInclude(const QString &filePath,
+                                       const QString &type,
+                                       const ConfigNodePath &sourceNodePath,
+                                       const ConfigNodePath &destinationNodePath)
+{
+    ConfigIncludeGraph *graph = t_currentGraph;
+
+    if (graph == nullptr)
+    {
+        return;
+    }
+
+    Include include;
+    include.parentFilePath = graph->m_fileStack.isEmpty() ? QString()
+                                                          : graph->m_fileStack.last();
+    include.filePath = filePath;
+    include.type = type;
+    include.sourceNodePath = sourceNodePath;
+    include.destinationNodePath = destinationNodePath;
+
+    graph->m_includes.push_back(std::move(include));
+}
+
+} // namespace CppConfigFramework
@@ -24,8 +24,13 @@
 // C++ Config Framework includes
 
 // Qt includes
+#include <QtCore/QRunnable>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThreadPool>
 
 // System includes
+#include <algorithm>
+#include <atomic>
 
 // Forward declarations
 
@@ -36,14 +41,119 @@
 namespace CppConfigFramework
 {
 
+//! Flag that suppresses the reporting of the errors on this thread
+static thread_local bool t_errorReportSuppressed = false;
+
+// -------------------------------------------------------------------------------------------------
+
+//! Shared state of the tasks executed by ConfigLoader::executeInParallel()
+class ParallelTasks
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   taskCount   Number of tasks
+     * \param   task        Task to execute
+     */
+    ParallelTasks(const int taskCount, const std::function<bool(int)> &task)
+        : m_taskCount(taskCount),
+          m_task(task),
+          m_nextIndex(0),
+          m_failedIndex(taskCount)
+    {
+    }
+
+    //! Executes the tasks until there are no more tasks to start
+    void execute()
+    {
+        while (true)
+        {
+            const int index = m_nextIndex++;
+
+            if ((index >= m_taskCount) || (index > m_failedIndex.load()))
+            {
+                return;
+            }
+
+            if (!m_task(index))
+            {
+                // Keep the lowest index of the failed tasks
+                int failedIndex = m_failedIndex.load();
+
+                while ((index < failedIndex) &&
+                       (!m_failedIndex.compare_exchange_weak(failedIndex, index)))
+                {
+                }
+            }
+        }
+    }
+
+    /*!
+     * Gets the index of the first task that failed
+     *
+     * \return  Task index or -1 if all of the tasks succeeded
+     */
+    int failedIndex() const
+    {
+        const int failedIndex = m_failedIndex.load();
+        return (failedIndex < m_taskCount) ? failedIndex : -1;
+    }
+
+    //! Semaphore that is released once by each of the helper tasks when it is finished
+    QSemaphore finished;
+
+private:
+    //! Number of tasks
+    const int m_taskCount;
+
+    //! Task to execute
+    const std::function<bool(int)> &m_task;
+
+    //! Index of the next task to start
+    std::atomic<int> m_nextIndex;
+
+    //! Lowest index of the failed tasks (task count if none of them failed)
+    std::atomic<int> m_failedIndex;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Helper task that executes the parallel tasks on a thread pool
+class ParallelTasksRunnable : public QRunnable
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   tasks   Shared state of the tasks
+     */
+    explicit ParallelTasksRunnable(ParallelTasks *tasks)
+        : m_tasks(tasks)
+    {
+    }
+
+    //! \copydoc    QRunnable::run()
+    void run() override
+    {
+        m_tasks->execute();
+        m_tasks->finished.release();
+    }
+
+private:
+    //! Shared state of the tasks
+    ParallelTasks *m_tasks;
+};
+
+// -------------------------------------------------------------------------------------------------
+
 bool ConfigLoader::loadConfig(const ConfigObjectNode &config)
 {
     if (!loadConfigParameters(config))
     {
         const QString errorString = QString("Failed to load the configuration parameters [%1]!")
                                     .arg(config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -54,8 +164,7 @@ bool ConfigLoader::loadConfig(const ConfigObjectNode &config)
     {
         const QString errorString = QString("Configuration [%1] is not valid! Error: [%2]")
                                     .arg(config.nodePath().path(), validationError);
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -69,8 +178,7 @@ bool ConfigLoader::loadConfig(const QString &parameterName, const ConfigObjectNo
     if (!ConfigNodePath::validateNodeName(parameterName))
     {
         const QString errorString = QString("Parameter name [%1] is not valid!").arg(parameterName);
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -86,8 +194,7 @@ bool ConfigLoader::loadOptionalConfig(const QString &parameterName,
     if (!ConfigNodePath::validateNodeName(parameterName))
     {
         const QString errorString = QString("Parameter name [%1] is not valid!").arg(parameterName);
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -104,8 +211,7 @@ bool ConfigLoader::loadConfigAtPath(const ConfigNodePath &path,
     {
         const QString errorString = QString("Configuration node path [%1] is not valid!")
                                     .arg(path.path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -116,8 +222,7 @@ bool ConfigLoader::loadConfigAtPath(const ConfigNodePath &path,
     {
         const QString errorString = QString("Configuration node [%1] was not found!")
                                     .arg(path.toAbsolute(config.nodePath()).path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -125,8 +230,7 @@ bool ConfigLoader::loadConfigAtPath(const ConfigNodePath &path,
     {
         const QString errorString = QString("Configuration node [%1] is not an Object node!")
                                     .arg(node->nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -152,8 +256,7 @@ bool ConfigLoader::loadOptionalConfigAtPath(const ConfigNodePath &path,
     {
         const QString errorString = QString("Configuration node path [%1] is not valid!")
                                     .arg(path.path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
 
         if (loaded != nullptr)
         {
@@ -179,8 +282,7 @@ bool ConfigLoader::loadOptionalConfigAtPath(const ConfigNodePath &path,
     {
         const QString errorString = QString("Configuration node [%1] is not an Object node!")
                                     .arg(node->nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
-        handleError(errorString);
+        reportError(errorString);
         return false;
     }
 
@@ -217,4 +319,63 @@ void ConfigLoader::handleError(const QString &error)
     Q_UNUSED(error);
 }
 
+// -------------------------------------------------------------------------------------------------
+
+void ConfigLoader::reportError(const QString &errorString)
+{
+    if (t_errorReportSuppressed)
+    {
+        return;
+    }
+
+    qCWarning(CppConfigFramework::LoggingCategory::ConfigLoader) << errorString;
+    handleError(errorString);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigLoader::ErrorReportSuppression::ErrorReportSuppression()
+    : m_previousState(t_errorReportSuppressed)
+{
+    t_errorReportSuppressed = true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigLoader::ErrorReportSuppression::~ErrorReportSuppression()
+{
+    t_errorReportSuppressed = m_previousState;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigLoader::executeInParallel(const int taskCount, const std::function<bool(int)> &task)
+{
+    ParallelTasks tasks(taskCount, task);
+
+    // Helper tasks are only started if a thread is available so the calling thread never has to
+    // wait for a thread pool that is busy with the callers of this method
+    auto *threadPool = QThreadPool::globalInstance();
+    const int maxHelperCount = std::min(taskCount, threadPool->maxThreadCount()) - 1;
+    int helperCount = 0;
+
+    while (helperCount < maxHelperCount)
+    {
+        auto *runnable = new ParallelTasksRunnable(&tasks);
+
+        if (!threadPool->tryStart(runnable))
+        {
+            delete runnable;
+            break;
+        }
+
+        helperCount++;
+    }
+
+    tasks.execute();
+    tasks.finished.acquire(helperCount);
+
+    return tasks.failedIndex();
+}
+
 } // namespace CppConfigFramework
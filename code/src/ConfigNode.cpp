@@ -23,13 +23,19 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+#include <CppConfigFramework/ConfigNodeIndex.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReadStatistics.hpp>
+#include <CppConfigFramework/ConfigStringPool.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 
 // Qt includes
+#include <QtCore/QJsonArray>
 
 // System includes
+#include <algorithm>
 
 // Forward declarations
 
@@ -40,9 +46,187 @@
 namespace CppConfigFramework
 {
 
+/*!
+ * Estimates the size of the storage of a string
+ *
+ * \param   string  String
+ *
+ * \return  Size in bytes (0 if the string does not allocate any storage)
+ */
+static qint64 stringStorageSize(const QString &string)
+{
+    // Empty strings and string literals do not allocate any storage
+    if (string.capacity() == 0)
+    {
+        return 0;
+    }
+
+    return static_cast<qint64>(sizeof(QArrayData)) +
+            (static_cast<qint64>(string.capacity()) + 1) * static_cast<qint64>(sizeof(QChar));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Estimates the size of the storage of a list
+ *
+ * \param   count       Number of items
+ * \param   itemSize    Size of an item in the list storage
+ *
+ * \return  Size in bytes (0 if the list is empty)
+ */
+static qint64 listStorageSize(const int count, const std::size_t itemSize)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    return static_cast<qint64>(sizeof(QArrayData)) +
+            static_cast<qint64>(count) * static_cast<qint64>(itemSize);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Estimates the size of the storage of a node path (without the size of the node path instance)
+ *
+ * \param   nodePath    Node path
+ *
+ * \return  Size in bytes
+ */
+static qint64 nodePathStorageSize(const ConfigNodePath &nodePath)
+{
+    const QStringList &nodeNames = nodePath.nodeNames();
+    qint64 size = stringStorageSize(nodePath.path()) +
+                  listStorageSize(nodeNames.size(), sizeof(QString));
+
+    for (const QString &nodeName : nodeNames)
+    {
+        size += stringStorageSize(nodeName);
+    }
+
+    return size;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Estimates the size of the payload of a JSON value (without the size of the value instance)
+ *
+ * \param   value   JSON value
+ *
+ * \return  Size in bytes
+ */
+static qint64 jsonPayloadSize(const QJsonValue &value)
+{
+    switch (value.type())
+    {
+        case QJsonValue::String:
+        {
+            return stringStorageSize(value.toString());
+        }
+
+        case QJsonValue::Array:
+        {
+            const QJsonArray array = value.toArray();
+            qint64 size = listStorageSize(array.size(), sizeof(QJsonValue));
+
+            for (const QJsonValue &item : array)
+            {
+                size += jsonPayloadSize(item);
+            }
+
+            return size;
+        }
+
+        case QJsonValue::Object:
+        {
+            const QJsonObject object = value.toObject();
+            qint64 size = listStorageSize(object.size(), sizeof(QString) + sizeof(QJsonValue));
+
+            for (auto it = object.constBegin(); it != object.constEnd(); ++it)
+            {
+                size += stringStorageSize(it.key()) + jsonPayloadSize(it.value());
+            }
+
+            return size;
+        }
+
+        default:
+        {
+            // Null, Boolean and numeric values are stored in the value instance
+            return 0;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
 ConfigNode::ConfigNode(ConfigObjectNode *parent)
-    : m_parent(parent)
+    : m_parent(parent),
+      m_arena(ConfigNodeArena::takeAllocationArena(this))
+{
+    ConfigReadStatistics::recordCreatedNode();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNode::ConfigNode(ConfigNode &&other) noexcept
+    : m_parent(other.m_parent),
+      m_arena(ConfigNodeArena::takeAllocationArena(this)),
+      m_memberName(other.m_memberName),
+      m_contentHashCache(other.m_contentHashCache),
+      m_contentHashCacheValid(other.m_contentHashCacheValid)
+{
+    // The cached node path is not taken over since this node is not necessarily stored at the same
+    // location as the other node, but the cached content hash is since this node takes over the
+    // contents of the other node
+    other.invalidateContentHashCache();
+
+    ConfigReadStatistics::recordCreatedNode();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNode::~ConfigNode()
+{
+    // The memory of this node is freed right after its destructor (if it was created with new)
+    ConfigNodeArena::setDeallocationArena(this, m_arena);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNode &ConfigNode::operator=(ConfigNode &&other) noexcept
+{
+    if (&other == this)
+    {
+        return *this;
+    }
+
+    // The contents of this node are replaced so the nodes that contain it need to be hashed again
+    invalidateContentHashCache();
+    other.invalidateContentHashCache();
+
+    m_parent = other.m_parent;
+    m_memberName = other.m_memberName;
+    invalidateNodePathCache();
+
+    return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void *ConfigNode::operator new(std::size_t size)
+{
+    return ConfigNodeArena::allocate(size);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNode::operator delete(void *pointer) noexcept
 {
+    ConfigNodeArena::deallocate(pointer);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -99,6 +283,7 @@ ConfigObjectNode *ConfigNode::parent()
 void ConfigNode::setParent(ConfigObjectNode *parent)
 {
     m_parent = parent;
+    invalidateNodePathCache();
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -213,18 +398,177 @@ ConfigDerivedObjectNode &ConfigNode::toDerivedObject()
 
 ConfigNodePath ConfigNode::nodePath() const
 {
-    // Check for root node
+    // Check for cached node path
+    if (m_nodePathCacheValid)
+    {
+        return m_nodePathCache;
+    }
+
+    // Check for root node (its node path is also cached so that the cache of the whole tree gets
+    // invalidated when the root node gets a parent)
     if (isRoot())
     {
-        return ConfigNodePath::ROOT_PATH;
+        m_nodePathCache = ConfigNodePath::ROOT_PATH;
+        m_nodePathCacheValid = true;
+        return m_nodePathCache;
     }
 
-    // Get the base path
-    auto basePath = parent()->isRoot() ? ConfigNodePath::ROOT_PATH
-                                       : parent()->nodePath();
+    // Get the base path (this also caches the node path of the parent)
+    auto basePath = parent()->nodePath();
 
     // Append the name of this node to the path
-    return basePath.append(parent()->name(*this));
+    m_nodePathCache = basePath.append(parent()->name(*this));
+    m_nodePathCacheValid = true;
+
+    return m_nodePathCache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNode::cacheNodePaths() const
+{
+    nodePath();
+
+    switch (type())
+    {
+        case Type::Object:
+        {
+            for (const auto &member : toObject())
+            {
+                member.node().cacheNodePaths();
+            }
+            break;
+        }
+
+        case Type::DerivedObject:
+        {
+            toDerivedObject().config().cacheNodePaths();
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 ConfigNode::contentHash() const
+{
+    if (!m_contentHashCacheValid)
+    {
+        m_contentHashCache = calculateContentHash();
+        m_contentHashCacheValid = true;
+    }
+
+    return m_contentHashCache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNode::hasSameContents(const ConfigNode &other) const
+{
+    if (this == &other)
+    {
+        return true;
+    }
+
+    if ((type() != other.type()) || (contentHash() != other.contentHash()))
+    {
+        return false;
+    }
+
+    switch (type())
+    {
+        case Type::Value:
+        {
+            return toValue().hasSameValue(other.toValue());
+        }
+
+        case Type::Object:
+        {
+            const auto &object = toObject();
+            const auto &otherObject = other.toObject();
+
+            // Nodes that still share their members with the same node have the same contents
+            const auto contentSource = [](const ConfigObjectNode &node)
+            {
+                return (node.m_lazyMembers && node.m_lazyMembers->sharedNode)
+                        ? node.m_lazyMembers->sharedNode.get()
+                        : &node;
+            };
+
+            if (contentSource(object) == contentSource(otherObject))
+            {
+                return true;
+            }
+
+            if (object.count() != otherObject.count())
+            {
+                return false;
+            }
+
+            // The members of both nodes are sorted by their names so they can be compared in pairs
+            auto otherIt = otherObject.begin();
+
+            for (const auto &member : object)
+            {
+                if ((member.name() != otherIt->name()) ||
+                    (!member.node().hasSameContents(otherIt->node())))
+                {
+                    return false;
+                }
+
+                ++otherIt;
+            }
+
+            return true;
+        }
+
+        case Type::NodeReference:
+        {
+            return (toNodeReference().reference() == other.toNodeReference().reference());
+        }
+
+        case Type::DerivedObject:
+        {
+            const auto &derivedObject = toDerivedObject();
+            const auto &otherDerivedObject = other.toDerivedObject();
+
+            return ((derivedObject.bases() == otherDerivedObject.bases()) &&
+                    derivedObject.config().hasSameContents(otherDerivedObject.config()));
+        }
+    }
+
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigMemoryUsage ConfigNode::memoryUsage() const
+{
+    ConfigMemoryUsage usage;
+    addMemoryUsage(&usage, true);
+
+    return usage;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigTreeStatistics ConfigNode::treeStatistics() const
+{
+    ConfigTreeStatistics statistics;
+    const ConfigNode *widestObject = nullptr;
+    addTreeStatistics(&statistics, 0, &widestObject);
+
+    if (widestObject != nullptr)
+    {
+        statistics.widestObjectNodePath = widestObject->nodePath().path();
+    }
+
+    return statistics;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -243,6 +587,29 @@ const ConfigNode *ConfigNode::nodeAtPath(const ConfigNodePath &nodePath) const
         return rootNode();
     }
 
+    // Look up the node paths without references to parent nodes in the index of the tree (if any)
+    if (!nodePath.hasUnresolvedReferences())
+    {
+        const auto *root = rootNode();
+
+        if ((root != nullptr) && root->m_nodeIndex)
+        {
+            if (nodePath.isAbsolute())
+            {
+                return root->m_nodeIndex->node(nodePath);
+            }
+
+            // A relative node path can only be looked up from a node that is a part of the indexed
+            // tree (and not for example a part of the overloads of a DerivedObject node)
+            const ConfigNodePath workingPath = this->nodePath();
+
+            if (root->m_nodeIndex->node(workingPath) == this)
+            {
+                return root->m_nodeIndex->node(nodePath.toAbsolute(workingPath));
+            }
+        }
+    }
+
     const ConfigNode *currentNode = nullptr;
 
     if (nodePath.isAbsolute())
@@ -346,4 +713,292 @@ QString ConfigNode::typeToString(const ConfigNode::Type type)
     return {};
 }
 
+// -------------------------------------------------------------------------------------------------
+
+quint64 ConfigNode::combineContentHash(const quint64 seed, const quint64 value)
+{
+    // Mix the bits of the value (SplitMix64 finalizer) before combining it with the seed so that
+    // similar values (for example small integers) do not produce similar hashes
+    quint64 mixedValue = value + Q_UINT64_C(0x9E3779B97F4A7C15);
+    mixedValue = (mixedValue ^ (mixedValue >> 30U)) * Q_UINT64_C(0xBF58476D1CE4E5B9);
+    mixedValue = (mixedValue ^ (mixedValue >> 27U)) * Q_UINT64_C(0x94D049BB133111EB);
+    mixedValue = mixedValue ^ (mixedValue >> 31U);
+
+    return seed ^ (mixedValue + Q_UINT64_C(0x9E3779B97F4A7C15) + (seed << 6U) + (seed >> 2U));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 ConfigNode::stringContentHash(const QString &string)
+{
+    // 64-bit FNV-1a hash of the UTF-16 code units
+    quint64 hash = Q_UINT64_C(0xCBF29CE484222325);
+
+    for (const QChar character : string)
+    {
+        hash = (hash ^ character.unicode()) * Q_UINT64_C(0x100000001B3);
+    }
+
+    return combineContentHash(hash, static_cast<quint64>(string.size()));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNode::copyContentHashCache(const ConfigNode &other) const
+{
+    m_contentHashCache = other.m_contentHashCache;
+    m_contentHashCacheValid = other.m_contentHashCacheValid;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNode::invalidateContentHashCache() const
+{
+    // A content hash can only be cached if the content hashes of all of the nodes in its contents
+    // are also cached so if a node doesn't have a cached content hash then the nodes that contain
+    // it also don't have it
+    const ConfigNode *node = this;
+
+    while ((node != nullptr) && node->m_contentHashCacheValid)
+    {
+        node->m_contentHashCacheValid = false;
+        const ConfigNode *owner = node->contentOwner();
+
+        // A node index can only exist while the content hash of its root node is cached
+        if ((owner == nullptr) && node->isObject())
+        {
+            node->toObject().m_nodeIndex.reset();
+        }
+
+        node = owner;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigNode *ConfigNode::contentOwner() const
+{
+    // A temporary node can also point to a parent without being stored in it
+    if ((m_parent != nullptr) && (m_parent->member(m_memberName) == this))
+    {
+        return m_parent;
+    }
+
+    if (isObject())
+    {
+        return toObject().m_derivedObject;
+    }
+
+    return nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNode::invalidateNodePathCache() const
+{
+    // A node path can only be cached if the node path of the parent is also cached so if this node
+    // doesn't have a cached node path then its members also don't have it
+    if (!m_nodePathCacheValid)
+    {
+        return;
+    }
+
+    m_nodePathCacheValid = false;
+    m_nodePathCache = ConfigNodePath();
+
+    if (isObject())
+    {
+        for (const auto &member : toObject().m_members)
+        {
+            member.second->invalidateNodePathCache();
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNode::addMemoryUsage(ConfigMemoryUsage *usage, const bool countInstance) const
+{
+    ConfigStringPool *stringPool = ConfigStringPool::instance();
+
+    if (m_nodePathCacheValid)
+    {
+        usage->nodePathCacheBytes += nodePathStorageSize(m_nodePathCache);
+    }
+
+    switch (type())
+    {
+        case Type::Value:
+        {
+            const auto &node = toValue();
+            usage->valueNodes.count++;
+            usage->valueNodes.bytes += static_cast<qint64>(sizeof(ConfigValueNode));
+
+            if (node.storageType() == ConfigValueNode::StorageType::String)
+            {
+                const QString string = node.toString();
+
+                if (stringPool->isInterned(string))
+                {
+                    usage->sharedValuePayloadBytes += stringStorageSize(string);
+                }
+                else
+                {
+                    usage->valuePayloadBytes += stringStorageSize(string);
+                }
+            }
+            else if (node.storageType() == ConfigValueNode::StorageType::Json)
+            {
+                usage->valuePayloadBytes += jsonPayloadSize(node.value());
+            }
+            break;
+        }
+
+        case Type::Object:
+        {
+            const auto &node = toObject();
+
+            if (countInstance)
+            {
+                usage->objectNodes.count++;
+                usage->objectNodes.bytes += static_cast<qint64>(sizeof(ConfigObjectNode));
+            }
+
+            usage->memberContainerBytes += static_cast<qint64>(
+                node.m_members.capacity() * sizeof(ConfigObjectNode::MemberContainer::value_type));
+
+            // The lazy members are shared with the JSON Object they were read from or with the
+            // Object node from which they are copied
+            if (node.m_lazyMembers)
+            {
+                usage->memberContainerBytes +=
+                        static_cast<qint64>(sizeof(ConfigObjectNode::LazyMembers));
+
+                if (node.m_lazyMembers->sharedNode)
+                {
+                    ConfigMemoryUsage sharedUsage;
+                    node.m_lazyMembers->sharedNode->addMemoryUsage(&sharedUsage, true);
+
+                    usage->sharedSubtreeCount++;
+                    usage->sharedSubtreeBytes += sharedUsage.totalBytes();
+                }
+                else
+                {
+                    usage->lazySubtreeCount++;
+                    usage->lazySubtreeBytes += jsonPayloadSize(node.m_lazyMembers->jsonObject);
+                }
+            }
+
+            for (const auto &member : node.m_members)
+            {
+                if (stringPool->isInterned(member.first))
+                {
+                    usage->sharedMemberNameBytes += stringStorageSize(member.first);
+                }
+                else
+                {
+                    usage->memberNameBytes += stringStorageSize(member.first);
+                }
+
+                member.second->addMemoryUsage(usage, true);
+            }
+            break;
+        }
+
+        case Type::NodeReference:
+        {
+            usage->nodeReferenceNodes.count++;
+            usage->nodeReferenceNodes.bytes += static_cast<qint64>(sizeof(ConfigNodeReference));
+            usage->referenceBytes += nodePathStorageSize(toNodeReference().reference());
+            break;
+        }
+
+        case Type::DerivedObject:
+        {
+            const auto &node = toDerivedObject();
+            const auto bases = node.bases();
+            usage->derivedObjectNodes.count++;
+            usage->derivedObjectNodes.bytes += static_cast<qint64>(sizeof(ConfigDerivedObjectNode));
+
+            // The list stores the node paths in separately allocated items
+            usage->referenceBytes += listStorageSize(bases.size(), sizeof(void *));
+
+            for (const auto &base : bases)
+            {
+                usage->referenceBytes += static_cast<qint64>(sizeof(ConfigNodePath)) +
+                                         nodePathStorageSize(base);
+            }
+
+            node.config().addMemoryUsage(usage, false);
+            break;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNode::addTreeStatistics(ConfigTreeStatistics *statistics,
+                                   const int depth,
+                                   const ConfigNode **widestObject) const
+{
+    statistics->maxDepth = std::max(statistics->maxDepth, depth);
+
+    const ConfigObjectNode *object = nullptr;
+
+    switch (type())
+    {
+        case Type::Value:
+        {
+            statistics->valueNodeCount++;
+            break;
+        }
+
+        case Type::Object:
+        {
+            object = &toObject();
+            statistics->objectNodeCount++;
+
+            if (object->m_lazyMembers)
+            {
+                statistics->lazyObjectCount++;
+            }
+            break;
+        }
+
+        case Type::NodeReference:
+        {
+            statistics->nodeReferenceCount++;
+            statistics->referenceCount++;
+            break;
+        }
+
+        case Type::DerivedObject:
+        {
+            const auto &node = toDerivedObject();
+            object = &node.config();
+            statistics->derivedObjectCount++;
+            statistics->referenceCount += node.bases().size();
+            break;
+        }
+    }
+
+    if (object == nullptr)
+    {
+        return;
+    }
+
+    const int memberCount = static_cast<int>(object->m_members.size());
+
+    if ((*widestObject == nullptr) || (memberCount > statistics->widestObjectMemberCount))
+    {
+        statistics->widestObjectMemberCount = memberCount;
+        *widestObject = this;
+    }
+
+    for (const auto &member : object->m_members)
+    {
+        member.second->addTreeStatistics(statistics, depth + 1, widestObject);
+    }
+}
+
 } // namespace CppConfigFramework
@@ -0,0 +1,309 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the arena allocator for the configuration nodes
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+
+// System includes
+#include <atomic>
+#include <new>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+//! Alignment of the memory blocks allocated from an arena
+static constexpr std::size_t s_alignment = alignof(std::max_align_t);
+
+//! Size of the memory chunks allocated by an arena
+static constexpr std::size_t s_chunkSize = 64U * 1024U;
+
+//! Number of arenas that were not released yet
+static std::atomic<int> s_arenaCount(0);
+
+// -------------------------------------------------------------------------------------------------
+
+//! Holds a memory block and the arena that owns it
+struct ConfigNodeArenaBlock
+{
+    //! Memory block
+    const void *pointer;
+
+    //! Arena that owns the memory block
+    ConfigNodeArenaStorage *arena;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Holds the memory of the nodes allocated from an arena
+class ConfigNodeArenaStorage
+{
+public:
+    //! Constructor
+    ConfigNodeArenaStorage()
+    {
+        s_arenaCount++;
+    }
+
+    //! Copy constructor is disabled
+    ConfigNodeArenaStorage(const ConfigNodeArenaStorage &) = delete;
+
+    //! Move constructor is disabled
+    ConfigNodeArenaStorage(ConfigNodeArenaStorage &&) = delete;
+
+    //! Destructor
+    ~ConfigNodeArenaStorage()
+    {
+        for (void *chunk : m_chunks)
+        {
+            ::operator delete(chunk);
+        }
+
+        s_arenaCount--;
+    }
+
+    //! Copy assignment operator is disabled
+    ConfigNodeArenaStorage &operator=(const ConfigNodeArenaStorage &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigNodeArenaStorage &operator=(ConfigNodeArenaStorage &&) = delete;
+
+    /*!
+     * Allocates a memory block from the arena
+     *
+     * \param   size    Size of the memory block (must be a multiple of the alignment)
+     *
+     * \return  Memory block
+     *
+     * \note    This method must only be called from the thread that owns the arena
+     */
+    void *allocate(const std::size_t size)
+    {
+        // Large memory blocks get their own chunk so that the current chunk is not wasted
+        if (size > (s_chunkSize / 4U))
+        {
+            void *chunk = allocateChunk(size);
+            m_referenceCount++;
+            return chunk;
+        }
+
+        if (size > m_remainingSize)
+        {
+            m_nextBlock = static_cast<char *>(allocateChunk(s_chunkSize));
+            m_remainingSize = s_chunkSize;
+        }
+
+        void *block = m_nextBlock;
+        m_nextBlock += size;
+        m_remainingSize -= size;
+        m_referenceCount++;
+        return block;
+    }
+
+    //! Releases one reference (a memory block or the owning scope) and deletes the unused arena
+    void release() noexcept
+    {
+        if (m_referenceCount.fetch_sub(1) == 1)
+        {
+            delete this;
+        }
+    }
+
+private:
+    /*!
+     * Allocates a memory chunk owned by this arena
+     *
+     * \param   size    Size of the memory chunk
+     *
+     * \return  Memory chunk
+     */
+    void *allocateChunk(const std::size_t size)
+    {
+        m_chunks.reserve(m_chunks.size() + 1U);
+        void *chunk = ::operator new(size);
+        m_chunks.push_back(chunk);
+        return chunk;
+    }
+
+private:
+    //! Allocated memory chunks
+    std::vector<void *> m_chunks;
+
+    //! Next free memory block in the current chunk
+    char *m_nextBlock = nullptr;
+
+    //! Remaining size of the current chunk
+    std::size_t m_remainingSize = 0U;
+
+    //! Number of live memory blocks plus one for the owning scope
+    std::atomic<int> m_referenceCount { 1 };
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Arena of the active scope on this thread (null if the nodes are allocated from the heap)
+static thread_local ConfigNodeArenaStorage *t_currentArena = nullptr;
+
+//! Memory block that was allocated from an arena on this thread and not taken by its node yet
+static thread_local ConfigNodeArenaBlock t_allocatedBlock = { nullptr, nullptr };
+
+//! Memory block of the node that is being destroyed on this thread
+static thread_local ConfigNodeArenaBlock t_deallocatedBlock = { nullptr, nullptr };
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArena::Scope::Scope(const bool enabled)
+{
+    if (enabled && (t_currentArena == nullptr))
+    {
+        t_currentArena = new ConfigNodeArenaStorage();
+        m_ownsArena = true;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArena::Scope::~Scope()
+{
+    if (m_ownsArena)
+    {
+        ConfigNodeArenaStorage *arena = t_currentArena;
+        t_currentArena = nullptr;
+        arena->release();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArena::SuspendScope::SuspendScope()
+    : m_suspendedArena(t_currentArena)
+{
+    t_currentArena = nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArena::SuspendScope::~SuspendScope()
+{
+    t_currentArena = m_suspendedArena;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodeArena::isActive()
+{
+    return (t_currentArena != nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigNodeArena::arenaCount()
+{
+    return s_arenaCount.load();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void *ConfigNodeArena::allocate(const std::size_t size)
+{
+    ConfigNodeArenaStorage *arena = t_currentArena;
+
+    if (arena == nullptr)
+    {
+        return ::operator new(size);
+    }
+
+    void *block = arena->allocate(((size + s_alignment - 1U) / s_alignment) * s_alignment);
+    t_allocatedBlock = ConfigNodeArenaBlock { block, arena };
+    return block;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArenaStorage *ConfigNodeArena::takeAllocationArena(const void *pointer) noexcept
+{
+    if ((pointer == nullptr) || (pointer != t_allocatedBlock.pointer))
+    {
+        return nullptr;
+    }
+
+    ConfigNodeArenaStorage *arena = t_allocatedBlock.arena;
+    t_allocatedBlock = ConfigNodeArenaBlock { nullptr, nullptr };
+    return arena;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodeArena::setDeallocationArena(const void *pointer,
+                                           ConfigNodeArenaStorage *arena) noexcept
+{
+    t_deallocatedBlock = ConfigNodeArenaBlock { pointer, arena };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodeArena::deallocate(void *pointer) noexcept
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+    // The destructor of the node has just set the arena that owns its memory block. If the node
+    // was never constructed (for example its constructor arguments threw an exception) then its
+    // memory block is still the one that was allocated last on this thread.
+    ConfigNodeArenaStorage *arena = nullptr;
+
+    if (pointer == t_deallocatedBlock.pointer)
+    {
+        arena = t_deallocatedBlock.arena;
+        t_deallocatedBlock = ConfigNodeArenaBlock { nullptr, nullptr };
+    }
+    else if (pointer == t_allocatedBlock.pointer)
+    {
+        arena = t_allocatedBlock.arena;
+        t_allocatedBlock = ConfigNodeArenaBlock { nullptr, nullptr };
+    }
+    else
+    {
+        // Memory block was allocated from the heap
+    }
+
+    if (arena == nullptr)
+    {
+        ::operator delete(pointer);
+    }
+    else
+    {
+        arena->release();
+    }
+}
+
+} // namespace CppConfigFramework
@@ -0,0 +1,296 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the structural difference between two configuration nodes
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigNodeDiff.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * Gets the names of the nodes in an absolute node path
+ *
+ * \param   nodePath    Absolute node path
+ *
+ * \return  Node names (empty for the root node path)
+ */
+static QStringList absoluteNodeNames(const ConfigNodePath &nodePath)
+{
+    return nodePath.isRoot() ? QStringList() : nodePath.nodeNames();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if the node path is the same as the other one or if one of them is a parent of the other
+ *
+ * \param   nodeNames       Node names of the node path
+ * \param   otherNodeNames  Node names of the other node path
+ *
+ * \retval  true    Node paths overlap
+ * \retval  false   Node paths do not overlap
+ */
+static bool isOverlappingNodePath(const QStringList &nodeNames, const QStringList &otherNodeNames)
+{
+    const int count = std::min(nodeNames.size(), otherNodeNames.size());
+
+    for (int i = 0; i < count; i++)
+    {
+        if (nodeNames.at(i) != otherNodeNames.at(i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if any of the node paths overlaps with the specified node path
+ *
+ * \param   nodePaths   Node paths
+ * \param   nodeNames   Node names of the specified node path
+ *
+ * \retval  true    At least one of the node paths overlaps
+ * \retval  false   None of the node paths overlap
+ */
+static bool containsOverlappingNodePath(const std::vector<ConfigNodePath> &nodePaths,
+                                        const QStringList &nodeNames)
+{
+    for (const auto &nodePath : nodePaths)
+    {
+        if (isOverlappingNodePath(absoluteNodeNames(nodePath), nodeNames))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeDiff ConfigNodeDiff::compare(const ConfigNode &previous, const ConfigNode &current)
+{
+    ConfigNodeDiff diff;
+    diff.m_rootNodePath = previous.nodePath();
+
+    QStringList nodeNames;
+    diff.compareNodes(previous, current, &nodeNames);
+
+    return diff;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodeDiff::isEmpty() const
+{
+    return m_addedNodePaths.empty() && m_removedNodePaths.empty() && m_changedNodePaths.empty();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const std::vector<ConfigNodePath> &ConfigNodeDiff::addedNodePaths() const
+{
+    return m_addedNodePaths;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const std::vector<ConfigNodePath> &ConfigNodeDiff::removedNodePaths() const
+{
+    return m_removedNodePaths;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const std::vector<ConfigNodePath> &ConfigNodeDiff::changedNodePaths() const
+{
+    return m_changedNodePaths;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodeDiff::isChanged(const ConfigNodePath &nodePath) const
+{
+    const QStringList nodeNames = absoluteNodeNames(nodePath);
+
+    return containsOverlappingNodePath(m_addedNodePaths, nodeNames) ||
+            containsOverlappingNodePath(m_removedNodePaths, nodeNames) ||
+            containsOverlappingNodePath(m_changedNodePaths, nodeNames);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodeDiff::compareNodes(const ConfigNode &previous,
+                                  const ConfigNode &current,
+                                  QStringList *nodeNames)
+{
+    if (&previous == &current)
+    {
+        return;
+    }
+
+    if (previous.type() != current.type())
+    {
+        m_changedNodePaths.push_back(makeNodePath(*nodeNames));
+        return;
+    }
+
+    // Skip the subtrees with the same contents (a different content hash is just a lookup since the
+    // hashes of the members are cached while hashing the compared root nodes, only the subtrees with
+    // the same hash are actually compared in case the hashes collide)
+    if (previous.hasSameContents(current))
+    {
+        return;
+    }
+
+    switch (previous.type())
+    {
+        case ConfigNode::Type::Value:
+        {
+            if (!previous.toValue().hasSameValue(current.toValue()))
+            {
+                m_changedNodePaths.push_back(makeNodePath(*nodeNames));
+            }
+            break;
+        }
+
+        case ConfigNode::Type::Object:
+        {
+            compareMembers(previous.toObject(), current.toObject(), nodeNames);
+            break;
+        }
+
+        case ConfigNode::Type::NodeReference:
+        {
+            if (previous.toNodeReference().reference() != current.toNodeReference().reference())
+            {
+                m_changedNodePaths.push_back(makeNodePath(*nodeNames));
+            }
+            break;
+        }
+
+        case ConfigNode::Type::DerivedObject:
+        {
+            const auto &previousDerivedObject = previous.toDerivedObject();
+            const auto &currentDerivedObject = current.toDerivedObject();
+
+            if (previousDerivedObject.bases() != currentDerivedObject.bases())
+            {
+                m_changedNodePaths.push_back(makeNodePath(*nodeNames));
+            }
+            else
+            {
+                compareMembers(previousDerivedObject.config(),
+                               currentDerivedObject.config(),
+                               nodeNames);
+            }
+            break;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodeDiff::compareMembers(const ConfigObjectNode &previous,
+                                    const ConfigObjectNode &current,
+                                    QStringList *nodeNames)
+{
+    // The members of both nodes are sorted by their names so they can be compared in a single pass
+    auto previousIt = previous.begin();
+    auto currentIt = current.begin();
+
+    while ((previousIt != previous.end()) || (currentIt != current.end()))
+    {
+        int order = 0;
+
+        if (previousIt == previous.end())
+        {
+            order = 1;
+        }
+        else if (currentIt == current.end())
+        {
+            order = -1;
+        }
+        else
+        {
+            order = previousIt->name().compare(currentIt->name());
+        }
+
+        if (order < 0)
+        {
+            nodeNames->append(previousIt->name());
+            m_removedNodePaths.push_back(makeNodePath(*nodeNames));
+            nodeNames->removeLast();
+            ++previousIt;
+        }
+        else if (order > 0)
+        {
+            nodeNames->append(currentIt->name());
+            m_addedNodePaths.push_back(makeNodePath(*nodeNames));
+            nodeNames->removeLast();
+            ++currentIt;
+        }
+        else
+        {
+            nodeNames->append(previousIt->name());
+            compareNodes(previousIt->node(), currentIt->node(), nodeNames);
+            nodeNames->removeLast();
+            ++previousIt;
+            ++currentIt;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodePath ConfigNodeDiff::makeNodePath(const QStringList &nodeNames) const
+{
+    ConfigNodePath nodePath = m_rootNodePath;
+
+    for (const QString &nodeName : nodeNames)
+    {
+        nodePath.append(nodeName);
+    }
+
+    return nodePath;
+}
+
+} // namespace CppConfigFramework
@@ -0,0 +1,89 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the absolute node path lookup index of a configuration tree
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigNodeIndex.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+
+// Qt includes
+#include <QtCore/QStringBuilder>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+//! Node path separator
+static const QChar NODE_PATH_SEPARATOR = QChar('/');
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeIndex::ConfigNodeIndex(const ConfigObjectNode &rootNode)
+{
+    m_nodes.insert(ConfigNodePath::ROOT_PATH_VALUE, &rootNode);
+    addMembers(rootNode, QString());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigNodeIndex::count() const
+{
+    return m_nodes.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigNode *ConfigNodeIndex::node(const ConfigNodePath &absoluteNodePath) const
+{
+    if ((!absoluteNodePath.isAbsolute()) || absoluteNodePath.hasUnresolvedReferences())
+    {
+        return nullptr;
+    }
+
+    return m_nodes.value(absoluteNodePath.path(), nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodeIndex::addMembers(const ConfigObjectNode &objectNode, const QString &nodePath)
+{
+    for (const auto &objectMember : objectNode)
+    {
+        const QString memberPath = nodePath % NODE_PATH_SEPARATOR % objectMember.name();
+        const ConfigNode &member = objectMember.node();
+
+        m_nodes.insert(memberPath, &member);
+
+        if (member.isObject())
+        {
+            addMembers(member.toObject(), memberPath);
+        }
+    }
+}
+
+} // namespace CppConfigFramework
@@ -25,7 +25,6 @@
 #include <CppConfigFramework/LoggingCategories.hpp>
 
 // Qt includes
-#include <QtCore/QRegularExpression>
 #include <QtCore/QStringBuilder>
 
 // System includes
@@ -39,6 +38,8 @@
 namespace CppConfigFramework
 {
 
+static const QChar NODE_PATH_SEPARATOR = QChar('/');
+
 // Constants
 const QString ConfigNodePath::ROOT_PATH_VALUE = QStringLiteral("/");
 const ConfigNodePath ConfigNodePath::ROOT_PATH = ConfigNodePath(ConfigNodePath::ROOT_PATH_VALUE);
@@ -46,27 +47,46 @@ const ConfigNodePath ConfigNodePath::ROOT_PATH = ConfigNodePath(ConfigNodePath::
 const QString ConfigNodePath::PARENT_PATH_VALUE = QStringLiteral("..");
 const ConfigNodePath ConfigNodePath::PARENT_PATH = ConfigNodePath(ConfigNodePath::PARENT_PATH_VALUE);
 
-static QChar NODE_PATH_SEPARATOR = QChar('/');
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if the node name is a reference to the parent node ("..")
+ *
+ * \param   nodeName    Node name
+ *
+ * \retval  true    Node name is a reference to the parent node
+ * \retval  false   Node name is not a reference to the parent node
+ *
+ * \note    PARENT_PATH_VALUE is intentionally not used here since this function is also needed
+ *          while the static node paths are being initialized
+ */
+static bool isParentNodeName(const QString &nodeName)
+{
+    return ((nodeName.size() == 2) &&
+            (nodeName.at(0) == QChar('.')) &&
+            (nodeName.at(1) == QChar('.')));
+}
 
 // -------------------------------------------------------------------------------------------------
 
 ConfigNodePath::ConfigNodePath(const QString &path)
     : m_path(path)
 {
+    parse();
 }
 
 // -------------------------------------------------------------------------------------------------
 
 bool ConfigNodePath::isRoot() const
 {
-    return (m_path == ROOT_PATH_VALUE);
+    return (m_absolute && (m_path.size() == 1));
 }
 
 // -------------------------------------------------------------------------------------------------
 
 bool ConfigNodePath::isAbsolute() const
 {
-    return m_path.startsWith(NODE_PATH_SEPARATOR);
+    return m_absolute;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -87,86 +107,14 @@ bool ConfigNodePath::isRelative() const
 
 bool ConfigNodePath::isValid() const
 {
-    // Check for an empty
-    if (m_path.isEmpty())
-    {
-        // Error, an empty path is not valid
-        return false;
-    }
-
-    // Check for "root" path
-    if (isRoot())
-    {
-        return true;
-    }
-
-    // Use different algorithms for absolute and relative path validation
-    if (isAbsolute())
-    {
-        // Make sure that the individual node names are valid and that there is no attempt to access
-        // the parent node of the root node
-        QStringList workingNodeNames;
-
-        for (const QString &nodeName : nodeNames())
-        {
-            if (nodeName == PARENT_PATH_VALUE)
-            {
-                if (workingNodeNames.isEmpty())
-                {
-                    // Error, the root node does not have a parent node
-                    return false;
-                }
-
-                workingNodeNames.removeLast();
-                continue;
-            }
-
-            if (!validateNodeName(nodeName))
-            {
-                // Error, invalid node name
-                return false;
-            }
-
-            workingNodeNames.append(nodeName);
-        }
-    }
-    else
-    {
-        // Make sure that just the individual node names are valid
-        for (const QString &nodeName : nodeNames())
-        {
-            if ((nodeName != PARENT_PATH_VALUE) && (!validateNodeName(nodeName)))
-            {
-                return false;
-            }
-        }
-    }
-
-    return true;
+    return m_valid;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 bool ConfigNodePath::hasUnresolvedReferences() const
 {
-    // Check for an empty
-    if (m_path.isEmpty())
-    {
-        // Error, an empty path is not valid
-        return false;
-    }
-
-    // Check for "root" path
-    if (isRoot())
-    {
-        return false;
-    }
-
-    // Check if ".." is the only node, the first node, middle node or the last node
-    static const QRegularExpression s_regex(QStringLiteral("(?>^|\\/)\\.\\.(?>\\/|$)"));
-
-    auto match = s_regex.match(m_path);
-    return match.hasMatch();
+    return m_hasUnresolvedReferences;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -181,13 +129,13 @@ bool ConfigNodePath::resolveReferences()
     }
 
     // Use different algorithms for absolute and relative path validation
+    QStringList workingNodeNames;
+
     if (isAbsolute())
     {
         // Make sure that the individual node names are valid and that there is no attempt to access
         // the parent node of the root node
-        QStringList workingNodeNames;
-
-        for (const QString &nodeName : nodeNames())
+        for (const QString &nodeName : m_nodeNames)
         {
             if (nodeName.isEmpty())
             {
@@ -195,7 +143,7 @@ bool ConfigNodePath::resolveReferences()
                 return false;
             }
 
-            if (nodeName == PARENT_PATH_VALUE)
+            if (isParentNodeName(nodeName))
             {
                 if (workingNodeNames.isEmpty())
                 {
@@ -213,6 +161,7 @@ bool ConfigNodePath::resolveReferences()
         if (workingNodeNames.isEmpty())
         {
             m_path = ROOT_PATH_VALUE;
+            workingNodeNames.append(QString());
         }
         else
         {
@@ -222,9 +171,7 @@ bool ConfigNodePath::resolveReferences()
     else
     {
         // Make sure that just the individual node names are valid
-        QStringList workingNodeNames;
-
-        for (const QString &nodeName : nodeNames())
+        for (const QString &nodeName : m_nodeNames)
         {
             if (nodeName.isEmpty())
             {
@@ -232,10 +179,10 @@ bool ConfigNodePath::resolveReferences()
                 return false;
             }
 
-            if (nodeName == PARENT_PATH_VALUE)
+            if (isParentNodeName(nodeName))
             {
                 // Only remove the node name if the last node in it is a non-parent node reference
-                if ((!workingNodeNames.isEmpty()) && (workingNodeNames.last() != PARENT_PATH_VALUE))
+                if ((!workingNodeNames.isEmpty()) && (!isParentNodeName(workingNodeNames.last())))
                 {
                     workingNodeNames.removeLast();
                     continue;
@@ -254,6 +201,8 @@ bool ConfigNodePath::resolveReferences()
         m_path = workingNodeNames.join(NODE_PATH_SEPARATOR);
     }
 
+    m_nodeNames = workingNodeNames;
+    updateProperties();
     return true;
 }
 
@@ -269,14 +218,14 @@ QString ConfigNodePath::path() const
 void ConfigNodePath::setPath(const QString &path)
 {
     m_path = path;
+    parse();
 }
 
 // -------------------------------------------------------------------------------------------------
 
-QStringList ConfigNodePath::nodeNames() const
+const QStringList &ConfigNodePath::nodeNames() const
 {
-    return (isAbsolute() ? m_path.mid(1).split(NODE_PATH_SEPARATOR)
-                         : m_path.split(NODE_PATH_SEPARATOR));
+    return m_nodeNames;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -323,18 +272,21 @@ ConfigNodePath &ConfigNodePath::append(const QString &nodeName)
     if ((!isValid()) || (!validateNodeName(nodeName)))
     {
         // Error, invalidate this path and return it
-        m_path.clear();
+        setPath(QString());
         return *this;
     }
 
-    // Append the specified node path to this path
+    // Append the specified node path to this path (appending a valid node name to a valid node
+    // path does not change any of the node path's properties)
     if (isRoot())
     {
         m_path.append(nodeName);
+        m_nodeNames = QStringList { nodeName };
     }
     else
     {
         m_path.append(NODE_PATH_SEPARATOR % nodeName);
+        m_nodeNames.append(nodeName);
     }
 
     return *this;
@@ -355,20 +307,24 @@ ConfigNodePath &ConfigNodePath::append(const ConfigNodePath &nodePath)
     if ((!isValid()) || nodePath.isAbsolute() || (!nodePath.isValid()))
     {
         // Error, invalidate this path and return it
-        m_path.clear();
+        setPath(QString());
         return *this;
     }
 
     // Append the specified node path to this path
     if (isRoot())
     {
-        m_path.append(nodePath.path());
+        m_path.append(nodePath.m_path);
+        m_nodeNames = nodePath.m_nodeNames;
     }
     else
     {
-        m_path.append(NODE_PATH_SEPARATOR % nodePath.path());
+        m_path.append(NODE_PATH_SEPARATOR % nodePath.m_path);
+        m_nodeNames.append(nodePath.m_nodeNames);
     }
 
+    // References to parent nodes in the appended node path can make an absolute path invalid
+    updateProperties();
     return *this;
 }
 
@@ -378,10 +334,116 @@ bool ConfigNodePath::validateNodeName(const QString &name)
 {
     // Check if the name starts with a letter and continues with an optional string of alphanumeric
     // and "_" characters
-    static const QRegularExpression s_regex(QStringLiteral("^[a-zA-Z][a-zA-Z0-9_]*$"));
+    if (name.isEmpty())
+    {
+        return false;
+    }
+
+    const auto isLetter = [](const ushort character)
+    {
+        return (((character >= 'a') && (character <= 'z')) ||
+                ((character >= 'A') && (character <= 'Z')));
+    };
+
+    if (!isLetter(name.at(0).unicode()))
+    {
+        return false;
+    }
+
+    for (int i = 1; i < name.size(); i++)
+    {
+        const ushort character = name.at(i).unicode();
+
+        if ((!isLetter(character)) &&
+            ((character < '0') || (character > '9')) &&
+            (character != '_'))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodePath::parse()
+{
+    if (m_path.isEmpty())
+    {
+        m_nodeNames.clear();
+    }
+    else if (m_path.startsWith(NODE_PATH_SEPARATOR))
+    {
+        m_nodeNames = m_path.mid(1).split(NODE_PATH_SEPARATOR);
+    }
+    else
+    {
+        m_nodeNames = m_path.split(NODE_PATH_SEPARATOR);
+    }
+
+    updateProperties();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodePath::updateProperties()
+{
+    m_absolute = m_path.startsWith(NODE_PATH_SEPARATOR);
+    m_valid = false;
+    m_hasUnresolvedReferences = false;
+
+    // Check for an empty
+    if (m_path.isEmpty())
+    {
+        // Error, an empty path is not valid
+        return;
+    }
+
+    // Check for "root" path
+    if (isRoot())
+    {
+        m_valid = true;
+        return;
+    }
+
+    // Make sure that the individual node names are valid and, for an absolute path, that there is
+    // no attempt to access the parent node of the root node
+    bool valid = true;
+    int depth = 0;
+
+    for (const QString &nodeName : m_nodeNames)
+    {
+        if (isParentNodeName(nodeName))
+        {
+            m_hasUnresolvedReferences = true;
+
+            if (m_absolute)
+            {
+                if (depth == 0)
+                {
+                    // Error, the root node does not have a parent node
+                    valid = false;
+                }
+                else
+                {
+                    depth--;
+                }
+            }
+
+            continue;
+        }
+
+        if (!validateNodeName(nodeName))
+        {
+            // Error, invalid node name
+            valid = false;
+        }
+
+        depth++;
+    }
 
-    auto match = s_regex.match(name);
-    return match.hasMatch();
+    m_valid = valid;
 }
 
 } // namespace CppConfigFramework
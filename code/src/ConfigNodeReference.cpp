@@ -22,6 +22,7 @@
 #include <CppConfigFramework/ConfigNodeReference.hpp>
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigReadStatistics.hpp>
 
 // Qt includes
 
@@ -46,7 +47,12 @@ ConfigNodeReference::ConfigNodeReference(const ConfigNodePath &reference, Config
 
 std::unique_ptr<ConfigNode> ConfigNodeReference::clone() const
 {
-    return std::make_unique<ConfigNodeReference>(m_reference, nullptr);
+    ConfigReadStatistics::recordClonedNode();
+
+    auto node = std::make_unique<ConfigNodeReference>(m_reference, nullptr);
+    node->copyContentHashCache(*this);
+
+    return node;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -68,6 +74,14 @@ ConfigNodePath ConfigNodeReference::reference() const
 void ConfigNodeReference::setReference(const ConfigNodePath &reference)
 {
     m_reference = reference;
+    invalidateContentHashCache();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 ConfigNodeReference::calculateContentHash() const
+{
+    return combineContentHash(static_cast<quint64>(type()), stringContentHash(m_reference.path()));
 }
 
 } // namespace CppConfigFramework
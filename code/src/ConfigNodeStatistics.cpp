@@ -0,0 +1,196 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the memory usage and the structure statistics of a configuration tree
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigNodeStatistics.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QStringList>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * Converts the memory usage of node instances to JSON
+ *
+ * \param   usage   Memory usage of node instances
+ *
+ * \return  JSON Object
+ */
+static QJsonObject nodeUsageToJson(const ConfigMemoryUsage::NodeUsage &usage)
+{
+    return QJsonObject {
+        { QStringLiteral("count"),  static_cast<double>(usage.count) },
+        { QStringLiteral("bytes"),  static_cast<double>(usage.bytes) }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+qint64 ConfigMemoryUsage::ownedBytes() const
+{
+    return valueNodes.bytes +
+            objectNodes.bytes +
+            nodeReferenceNodes.bytes +
+            derivedObjectNodes.bytes +
+            memberContainerBytes +
+            memberNameBytes +
+            valuePayloadBytes +
+            referenceBytes +
+            nodePathCacheBytes;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+qint64 ConfigMemoryUsage::sharedBytes() const
+{
+    return sharedMemberNameBytes + sharedValuePayloadBytes + lazySubtreeBytes + sharedSubtreeBytes;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+qint64 ConfigMemoryUsage::totalBytes() const
+{
+    return ownedBytes() + sharedBytes();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigMemoryUsage::toJson() const
+{
+    return QJsonObject {
+        { QStringLiteral("value_nodes"),            nodeUsageToJson(valueNodes) },
+        { QStringLiteral("object_nodes"),           nodeUsageToJson(objectNodes) },
+        { QStringLiteral("node_reference_nodes"),   nodeUsageToJson(nodeReferenceNodes) },
+        { QStringLiteral("derived_object_nodes"),   nodeUsageToJson(derivedObjectNodes) },
+        { QStringLiteral("member_container_bytes"), static_cast<double>(memberContainerBytes) },
+        { QStringLiteral("member_name_bytes"),      static_cast<double>(memberNameBytes) },
+        { QStringLiteral("shared_member_name_bytes"),
+          static_cast<double>(sharedMemberNameBytes) },
+        { QStringLiteral("value_payload_bytes"),    static_cast<double>(valuePayloadBytes) },
+        { QStringLiteral("shared_value_payload_bytes"),
+          static_cast<double>(sharedValuePayloadBytes) },
+        { QStringLiteral("reference_bytes"),        static_cast<double>(referenceBytes) },
+        { QStringLiteral("node_path_cache_bytes"),  static_cast<double>(nodePathCacheBytes) },
+        { QStringLiteral("lazy_subtree_count"),     static_cast<double>(lazySubtreeCount) },
+        { QStringLiteral("lazy_subtree_bytes"),     static_cast<double>(lazySubtreeBytes) },
+        { QStringLiteral("shared_subtree_count"),   static_cast<double>(sharedSubtreeCount) },
+        { QStringLiteral("shared_subtree_bytes"),   static_cast<double>(sharedSubtreeBytes) },
+        { QStringLiteral("owned_bytes"),            static_cast<double>(ownedBytes()) },
+        { QStringLiteral("shared_bytes"),           static_cast<double>(sharedBytes()) },
+        { QStringLiteral("total_bytes"),            static_cast<double>(totalBytes()) }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigMemoryUsage::toString() const
+{
+    const auto nodeUsageToString = [](const QString &name, const NodeUsage &usage)
+    {
+        return QString("  %1: %2 nodes, %3 bytes").arg(name).arg(usage.count).arg(usage.bytes);
+    };
+
+    QStringList lines;
+    lines.append(QString("Memory usage: %1 bytes (owned: %2 bytes, shared: %3 bytes)")
+                 .arg(totalBytes())
+                 .arg(ownedBytes())
+                 .arg(sharedBytes()));
+    lines.append(nodeUsageToString(QStringLiteral("Value"), valueNodes));
+    lines.append(nodeUsageToString(QStringLiteral("Object"), objectNodes));
+    lines.append(nodeUsageToString(QStringLiteral("NodeReference"), nodeReferenceNodes));
+    lines.append(nodeUsageToString(QStringLiteral("DerivedObject"), derivedObjectNodes));
+    lines.append(QString("  Member containers: %1 bytes").arg(memberContainerBytes));
+    lines.append(QString("  Member names: %1 bytes (shared: %2 bytes)")
+                 .arg(memberNameBytes)
+                 .arg(sharedMemberNameBytes));
+    lines.append(QString("  Value payloads: %1 bytes (shared: %2 bytes)")
+                 .arg(valuePayloadBytes)
+                 .arg(sharedValuePayloadBytes));
+    lines.append(QString("  References: %1 bytes").arg(referenceBytes));
+    lines.append(QString("  Node path caches: %1 bytes").arg(nodePathCacheBytes));
+    lines.append(QString("  Lazy subtrees: %1 (shared: %2 bytes)")
+                 .arg(lazySubtreeCount)
+                 .arg(lazySubtreeBytes));
+    lines.append(QString("  Shared subtrees: %1 (shared: %2 bytes)")
+                 .arg(sharedSubtreeCount)
+                 .arg(sharedSubtreeBytes));
+
+    return lines.join(QLatin1Char('\n'));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+qint64 ConfigTreeStatistics::nodeCount() const
+{
+    return valueNodeCount + objectNodeCount + nodeReferenceCount + derivedObjectCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QJsonObject ConfigTreeStatistics::toJson() const
+{
+    return QJsonObject {
+        { QStringLiteral("node_count"),                 static_cast<double>(nodeCount()) },
+        { QStringLiteral("value_node_count"),           static_cast<double>(valueNodeCount) },
+        { QStringLiteral("object_node_count"),          static_cast<double>(objectNodeCount) },
+        { QStringLiteral("node_reference_count"),       static_cast<double>(nodeReferenceCount) },
+        { QStringLiteral("derived_object_count"),       static_cast<double>(derivedObjectCount) },
+        { QStringLiteral("lazy_object_count"),          static_cast<double>(lazyObjectCount) },
+        { QStringLiteral("reference_count"),            static_cast<double>(referenceCount) },
+        { QStringLiteral("max_depth"),                  maxDepth },
+        { QStringLiteral("widest_object_member_count"), widestObjectMemberCount },
+        { QStringLiteral("widest_object_node_path"),    widestObjectNodePath }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigTreeStatistics::toString() const
+{
+    QStringList lines;
+    lines.append(QString("Tree statistics: %1 nodes").arg(nodeCount()));
+    lines.append(QString("  Value: %1, Object: %2 (not materialized: %3), NodeReference: %4, "
+                         "DerivedObject: %5")
+                 .arg(valueNodeCount)
+                 .arg(objectNodeCount)
+                 .arg(lazyObjectCount)
+                 .arg(nodeReferenceCount)
+                 .arg(derivedObjectCount));
+    lines.append(QString("  References: %1").arg(referenceCount));
+    lines.append(QString("  Max depth: %1").arg(maxDepth));
+    lines.append(QString("  Widest object: %1 members [%2]")
+                 .arg(widestObjectMemberCount)
+                 .arg(widestObjectNodePath));
+
+    return lines.join(QLatin1Char('\n'));
+}
+
+} // namespace CppConfigFramework
@@ -23,7 +23,10 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigNodeIndex.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigReadStatistics.hpp>
+#include <CppConfigFramework/ConfigStringPool.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 
 // Qt includes
@@ -31,6 +34,7 @@
 #include <QtCore/QStringBuilder>
 
 // System includes
+#include <algorithm>
 
 // Forward declarations
 
@@ -41,6 +45,110 @@
 namespace CppConfigFramework
 {
 
+/*!
+ * Finds the position of the member with the specified name in the (sorted) member container
+ *
+ * \param   members     Member container
+ * \param   name        Name of the member node
+ *
+ * \return  Iterator to the member with the specified name or if the member was not found to the
+ *          position where it should be inserted
+ */
+template<typename Container, typename Name>
+static auto lowerBound(Container &members, const Name &name) -> decltype(members.begin())
+{
+    return std::lower_bound(members.begin(),
+                            members.end(),
+                            name,
+                            [](const typename Container::value_type &member, const Name &value)
+                            {
+                                return (member.first.compare(value) < 0);
+                            });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Finds the member with the specified name in the (sorted) member container
+ *
+ * \param   members     Member container
+ * \param   name        Name of the member node
+ *
+ * \return  Iterator to the member with the specified name or the end iterator if the member was
+ *          not found
+ */
+template<typename Container, typename Name>
+static auto findMember(Container &members, const Name &name) -> decltype(members.begin())
+{
+    auto it = lowerBound(members, name);
+
+    if ((it == members.end()) || (it->first.compare(name) != 0))
+    {
+        return members.end();
+    }
+
+    return it;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the member with the specified name
+ *
+ * \param   members     Member container
+ * \param   name        Name of the member node
+ *
+ * \return  Configuration node or nullptr if the member was not found
+ */
+template<typename Container, typename Name>
+static ConfigNode *findMemberNode(Container &members, const Name &name)
+{
+    auto it = findMember(members, name);
+
+    if (it == members.end())
+    {
+        return nullptr;
+    }
+
+    return it->second.get();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the number of unresolved nodes (NodeReference and DerivedObject nodes) in the node and all
+ * of its descendants
+ *
+ * \param   node    Configuration node
+ *
+ * \return  Number of unresolved nodes
+ */
+static int unresolvedReferenceCountOf(const ConfigNode &node)
+{
+    switch (node.type())
+    {
+        case ConfigNode::Type::Value:
+        {
+            return 0;
+        }
+
+        case ConfigNode::Type::Object:
+        {
+            return node.toObject().unresolvedReferenceCount();
+        }
+
+        case ConfigNode::Type::NodeReference:
+        case ConfigNode::Type::DerivedObject:
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 ConfigObjectNode::ConfigObjectNode(ConfigObjectNode *parent)
     : ConfigNode(parent)
 {
@@ -60,13 +168,17 @@ ConfigObjectNode::ConfigObjectNode(std::initializer_list<std::pair<QString, Conf
 // -------------------------------------------------------------------------------------------------
 
 ConfigObjectNode::ConfigObjectNode(ConfigObjectNode &&other) noexcept
-    : ConfigNode(other.parent()),
-      m_members(std::move(other.m_members))
+    : ConfigNode(std::move(other)),
+      m_members(std::move(other.m_members)),
+      m_lazyMembers(std::move(other.m_lazyMembers)),
+      m_unresolvedReferenceCount(other.m_unresolvedReferenceCount)
 {
     for (const auto &member : m_members)
     {
         member.second->setParent(this);
     }
+
+    other.updateUnresolvedReferenceCount(-other.m_unresolvedReferenceCount);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -78,8 +190,17 @@ ConfigObjectNode &ConfigObjectNode::operator=(ConfigObjectNode &&other) noexcept
         return *this;
     }
 
+    // Update the number of unresolved nodes while the nodes are still stored in their parents
+    const int unresolvedReferenceCount = other.m_unresolvedReferenceCount;
+    other.updateUnresolvedReferenceCount(-unresolvedReferenceCount);
+    updateUnresolvedReferenceCount(unresolvedReferenceCount - m_unresolvedReferenceCount);
+
+    invalidateContentHashCache();
+    other.invalidateContentHashCache();
+
     setParent(other.parent());
     m_members = std::move(other.m_members);
+    m_lazyMembers = std::move(other.m_lazyMembers);
 
     for (const auto &member : m_members)
     {
@@ -93,13 +214,34 @@ ConfigObjectNode &ConfigObjectNode::operator=(ConfigObjectNode &&other) noexcept
 
 std::unique_ptr<ConfigNode> ConfigObjectNode::clone() const
 {
+    ConfigReadStatistics::recordClonedNode();
+
+    // The members are already sorted and have valid names so the cloned members can just be
+    // appended (without the lookups and the propagation of the number of unresolved nodes that
+    // would be done by setMember())
     auto clonedNode = std::make_unique<ConfigObjectNode>(nullptr);
 
+    if (m_lazyMembers)
+    {
+        // Lazy members are cloned without reading them (the JSON Object is implicitly shared)
+        clonedNode->m_lazyMembers = std::make_unique<LazyMembers>(*m_lazyMembers);
+        clonedNode->copyContentHashCache(*this);
+        return clonedNode;
+    }
+
+    clonedNode->m_members.reserve(m_members.size());
+
     for (const auto &member : m_members)
     {
-        clonedNode->setMember(member.first, member.second->clone());
+        auto clonedMember = member.second->clone();
+        clonedMember->m_parent = clonedNode.get();
+        clonedMember->m_memberName = member.first;
+
+        clonedNode->m_members.emplace_back(member.first, std::move(clonedMember));
     }
 
+    clonedNode->m_unresolvedReferenceCount = m_unresolvedReferenceCount;
+    clonedNode->copyContentHashCache(*this);
     return clonedNode;
 }
 
@@ -114,6 +256,7 @@ ConfigNode::Type ConfigObjectNode::type() const
 
 int ConfigObjectNode::count() const
 {
+    materialize();
     return static_cast<int>(m_members.size());
 }
 
@@ -121,14 +264,36 @@ int ConfigObjectNode::count() const
 
 bool ConfigObjectNode::contains(const QString &name) const
 {
-    return (m_members.find(name) != m_members.end());
+    materialize();
+    return (findMember(m_members, name) != m_members.end());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::contains(QLatin1String name) const
+{
+    materialize();
+    return (findMember(m_members, name) != m_members.end());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+bool ConfigObjectNode::contains(QStringView name) const
+{
+    materialize();
+    return (findMember(m_members, name) != m_members.end());
 }
+#endif
 
 // -------------------------------------------------------------------------------------------------
 
 QStringList ConfigObjectNode::names() const
 {
+    materialize();
+
     QStringList nameList;
+    nameList.reserve(count());
 
     for (auto &it : m_members)
     {
@@ -140,8 +305,70 @@ QStringList ConfigObjectNode::names() const
 
 // -------------------------------------------------------------------------------------------------
 
+ConfigObjectNode::Iterator ConfigObjectNode::begin()
+{
+    materialize();
+    return Iterator(m_members.begin());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigObjectNode::ConstIterator ConfigObjectNode::begin() const
+{
+    materialize();
+    return ConstIterator(m_members.cbegin());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigObjectNode::ConstIterator ConfigObjectNode::cbegin() const
+{
+    materialize();
+    return ConstIterator(m_members.cbegin());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigObjectNode::Iterator ConfigObjectNode::end()
+{
+    materialize();
+    return Iterator(m_members.end());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigObjectNode::ConstIterator ConfigObjectNode::end() const
+{
+    materialize();
+    return ConstIterator(m_members.cend());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigObjectNode::ConstIterator ConfigObjectNode::cend() const
+{
+    materialize();
+    return ConstIterator(m_members.cend());
+}
+
+// -------------------------------------------------------------------------------------------------
+
 QString ConfigObjectNode::name(const ConfigNode &node) const
 {
+    materialize();
+
+    // Try the name under which the node was stored
+    if (node.parent() == this)
+    {
+        auto it = findMember(m_members, node.m_memberName);
+
+        if ((it != m_members.end()) && (it->second.get() == &node))
+        {
+            return it->first;
+        }
+    }
+
+    // Fall back to searching through all of the members
     for (auto &it : m_members)
     {
         if (it.second.get() == &node)
@@ -157,32 +384,54 @@ QString ConfigObjectNode::name(const ConfigNode &node) const
 
 const ConfigNode *ConfigObjectNode::member(const QString &name) const
 {
-    auto it = m_members.find(name);
+    materialize();
+    return findMemberNode(m_members, name);
+}
 
-    if (it == m_members.end())
-    {
-        return nullptr;
-    }
+// -------------------------------------------------------------------------------------------------
 
-    return it->second.get();
+ConfigNode *ConfigObjectNode::member(const QString &name)
+{
+    materialize();
+    return findMemberNode(m_members, name);
 }
 
 // -------------------------------------------------------------------------------------------------
 
-ConfigNode *ConfigObjectNode::member(const QString &name)
+const ConfigNode *ConfigObjectNode::member(QLatin1String name) const
 {
-    auto it = m_members.find(name);
+    materialize();
+    return findMemberNode(m_members, name);
+}
 
-    if (it == m_members.end())
-    {
-        return nullptr;
-    }
+// -------------------------------------------------------------------------------------------------
 
-    return it->second.get();
+ConfigNode *ConfigObjectNode::member(QLatin1String name)
+{
+    materialize();
+    return findMemberNode(m_members, name);
 }
 
 // -------------------------------------------------------------------------------------------------
 
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+const ConfigNode *ConfigObjectNode::member(QStringView name) const
+{
+    materialize();
+    return findMemberNode(m_members, name);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNode *ConfigObjectNode::member(QStringView name)
+{
+    materialize();
+    return findMemberNode(m_members, name);
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
 bool ConfigObjectNode::setMember(const QString &name, std::unique_ptr<ConfigNode> node)
 {
     // Make sure that name and node are both valid
@@ -191,23 +440,38 @@ bool ConfigObjectNode::setMember(const QString &name, std::unique_ptr<ConfigNode
         return false;
     }
 
-    // Set the parent to this node
+    materialize();
+
+    // Insert or replace the member (keep the members sorted by their names)
+    auto it = lowerBound(m_members, name);
+    const bool insert = ((it == m_members.end()) || (it->first != name));
+
+    // Set the parent to this node (a new member name is interned so that it shares the storage with
+    // the equal names in the other nodes)
+    const QString memberName = insert ? ConfigStringPool::instance()->intern(name) : it->first;
+    node->m_memberName = memberName;
     node->setParent(this);
 
-    // Insert or replace the member
-    auto it = m_members.find(name);
+    int unresolvedReferenceCountDelta = unresolvedReferenceCountOf(*node);
 
-    if (it == m_members.end())
+    if (insert)
     {
         // Insert a new item
-        m_members.emplace(name, std::move(node));
+        m_members.emplace(it, memberName, std::move(node));
     }
     else
     {
         // Replace the existing item
+        unresolvedReferenceCountDelta -= unresolvedReferenceCountOf(*it->second);
         it->second = std::move(node);
     }
 
+    if (unresolvedReferenceCountDelta != 0)
+    {
+        updateUnresolvedReferenceCount(unresolvedReferenceCountDelta);
+    }
+
+    invalidateContentHashCache();
     return true;
 }
 
@@ -222,22 +486,72 @@ bool ConfigObjectNode::setMember(const QString &name, const ConfigNode &node)
 
 bool ConfigObjectNode::remove(const QString &name)
 {
-    auto it = m_members.find(name);
+    materialize();
+
+    auto it = findMember(m_members, name);
 
     if (it == m_members.end())
     {
         return false;
     }
 
+    const int unresolvedReferenceCount = unresolvedReferenceCountOf(*it->second);
     m_members.erase(it);
+
+    if (unresolvedReferenceCount != 0)
+    {
+        updateUnresolvedReferenceCount(-unresolvedReferenceCount);
+    }
+
+    invalidateContentHashCache();
     return true;
 }
 
 // -------------------------------------------------------------------------------------------------
 
+std::unique_ptr<ConfigNode> ConfigObjectNode::take(const QString &name)
+{
+    materialize();
+
+    auto it = findMember(m_members, name);
+
+    if (it == m_members.end())
+    {
+        return {};
+    }
+
+    std::unique_ptr<ConfigNode> node = std::move(it->second);
+    m_members.erase(it);
+
+    const int unresolvedReferenceCount = unresolvedReferenceCountOf(*node);
+
+    if (unresolvedReferenceCount != 0)
+    {
+        updateUnresolvedReferenceCount(-unresolvedReferenceCount);
+    }
+
+    invalidateContentHashCache();
+
+    // Detach the node from this node
+    node->m_memberName.clear();
+    node->setParent(nullptr);
+
+    return node;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 void ConfigObjectNode::removeAll()
 {
     m_members.clear();
+    m_lazyMembers.reset();
+
+    if (m_unresolvedReferenceCount != 0)
+    {
+        updateUnresolvedReferenceCount(-m_unresolvedReferenceCount);
+    }
+
+    invalidateContentHashCache();
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -245,10 +559,10 @@ void ConfigObjectNode::removeAll()
 void ConfigObjectNode::apply(const ConfigObjectNode &other)
 {
     // Merge nodes
-    for (const QString &name : other.names())
+    for (const auto &otherMember : other)
     {
-        const ConfigNode *memberOther = other.member(name);
-        Q_ASSERT(memberOther != nullptr);
+        const QString &name = otherMember.name();
+        const ConfigNode *memberOther = &otherMember.node();
 
         // Check if a member with the same name already exists
         ConfigNode *memberThis = member(name);
@@ -281,77 +595,211 @@ void ConfigObjectNode::apply(const ConfigObjectNode &other)
     }
 }
 
-} // namespace CppConfigFramework
-
 // -------------------------------------------------------------------------------------------------
 
-bool operator==(const CppConfigFramework::ConfigObjectNode &left,
-                const CppConfigFramework::ConfigObjectNode &right)
+void ConfigObjectNode::apply(ConfigObjectNode &&other)
 {
-    if ((left.nodePath() != right.nodePath()) ||
-        (left.count() != right.count()))
+    if (&other == this)
     {
-        return false;
+        return;
     }
 
-    for (const QString &name : left.names())
+    other.materialize();
+
+    // Merge nodes
+    for (auto &otherMember : other.m_members)
     {
-        const auto *leftMemberNode = left.member(name);
-        const auto *rightMemberNode = right.member(name);
+        const QString &name = otherMember.first;
+        std::unique_ptr<ConfigNode> &memberOther = otherMember.second;
+
+        // Check if a member with the same name already exists
+        ConfigNode *memberThis = member(name);
 
-        if (rightMemberNode == nullptr)
+        if (memberThis == nullptr)
         {
-            // Member with the specified name was not found
-            return false;
+            // A member with the same name doesn't exist, move the item to this node as a new
+            // member
+            setMember(name, std::move(memberOther));
+            continue;
         }
 
-        if (leftMemberNode->type() != rightMemberNode->type())
+        // Apply other node's item to this node
+        if (memberThis->isValue() && memberOther->isValue())
         {
-            return false;
+            // Overwrite this node's value with the other node's value
+            memberThis->toValue().setValue(memberOther->toValue().value());
         }
+        else if (memberThis->isObject() && memberOther->isObject())
+        {
+            // Merge object items
+            memberThis->toObject().apply(std::move(memberOther->toObject()));
+        }
+        else
+        {
+            // For all other type combinations just overwrite this node's member with the other
+            // node's member
+            setMember(name, std::move(memberOther));
+        }
+    }
 
-        switch (leftMemberNode->type())
+    // Remove the (now empty) member slots from the other node
+    other.removeAll();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigObjectNode::unresolvedReferenceCount() const
+{
+    return m_unresolvedReferenceCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::buildNodeIndex() const
+{
+    if (!isRoot())
+    {
+        return false;
+    }
+
+    // The index is dropped together with the cached content hash of the root node, which is
+    // invalidated whenever any of the nodes in the tree is changed
+    contentHash();
+    m_nodeIndex = std::make_shared<const ConfigNodeIndex>(*this);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::hasNodeIndex() const
+{
+    return static_cast<bool>(m_nodeIndex);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::setLazyMembers(const QJsonObject &jsonObject, LazyMemberReader reader)
+{
+    Q_ASSERT(reader != nullptr);
+
+    removeAll();
+    m_lazyMembers = std::make_unique<LazyMembers>(LazyMembers { jsonObject, reader, nullptr });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::setSharedMembers(const std::shared_ptr<const ConfigObjectNode> &sharedNode)
+{
+    Q_ASSERT(sharedNode);
+    Q_ASSERT(sharedNode->m_unresolvedReferenceCount == 0);
+    Q_ASSERT(sharedNode->m_contentHashCacheValid);
+
+    removeAll();
+
+    if (sharedNode->m_lazyMembers)
+    {
+        // The shared node must not be changed so its lazy members are taken over instead of
+        // materializing them
+        m_lazyMembers = std::make_unique<LazyMembers>(*sharedNode->m_lazyMembers);
+    }
+    else
+    {
+        m_lazyMembers = std::make_unique<LazyMembers>(LazyMembers { {}, nullptr, sharedNode });
+    }
+
+    // The contents of this node are the same as the contents of the shared node
+    copyContentHashCache(*sharedNode);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::isMaterialized() const
+{
+    return !m_lazyMembers;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::materialize() const
+{
+    if (!m_lazyMembers)
+    {
+        return true;
+    }
+
+    // Lazy members are reset before they are read so that the reader can access this node
+    std::unique_ptr<LazyMembers> lazyMembers = std::move(m_lazyMembers);
+    auto *self = const_cast<ConfigObjectNode *>(this);
+
+    if (lazyMembers->sharedNode)
+    {
+        // The members are copied in the same (sorted) order, except for the Object members which
+        // only refer to the members of the shared node until they are accessed too
+        const auto &sharedNode = lazyMembers->sharedNode;
+        m_members.reserve(sharedNode->m_members.size());
+
+        for (const auto &sharedMember : sharedNode->m_members)
         {
-            case CppConfigFramework::ConfigNode::Type::Value:
-            {
-                if (leftMemberNode->toValue() != rightMemberNode->toValue())
-                {
-                    return false;
-                }
-                break;
-            }
+            std::unique_ptr<ConfigNode> member;
 
-            case CppConfigFramework::ConfigNode::Type::Object:
+            if (sharedMember.second->isObject())
             {
-                if (leftMemberNode->toObject() != rightMemberNode->toObject())
-                {
-                    return false;
-                }
-                break;
+                auto objectMember = std::make_unique<ConfigObjectNode>(nullptr);
+                objectMember->setSharedMembers(std::shared_ptr<const ConfigObjectNode>(
+                                                   sharedNode, &sharedMember.second->toObject()));
+                member = std::move(objectMember);
             }
-
-            case CppConfigFramework::ConfigNode::Type::NodeReference:
+            else
             {
-                if (leftMemberNode->toNodeReference() != rightMemberNode->toNodeReference())
-                {
-                    return false;
-                }
-                break;
+                member = sharedMember.second->clone();
             }
 
-            case CppConfigFramework::ConfigNode::Type::DerivedObject:
-            {
-                if (leftMemberNode->toDerivedObject() != rightMemberNode->toDerivedObject())
-                {
-                    return false;
-                }
-                break;
-            }
+            member->m_parent = self;
+            member->m_memberName = sharedMember.first;
+            m_members.emplace_back(sharedMember.first, std::move(member));
+        }
 
-            default:
-            {
-                return false;
-            }
+        return true;
+    }
+
+    auto node = lazyMembers->reader(lazyMembers->jsonObject);
+
+    if (!node)
+    {
+        // Keep the lazy members so that the failure is not hidden by an empty node
+        m_lazyMembers = std::move(lazyMembers);
+        return false;
+    }
+
+    Q_ASSERT(node->m_unresolvedReferenceCount == 0);
+
+    // The members are already sorted and the content of this node does not change so the members
+    // can just be taken over (the content hash and the number of unresolved nodes stay the same)
+    m_members = std::move(node->m_members);
+    node->m_members.clear();
+
+    for (const auto &member : m_members)
+    {
+        member.second->setParent(self);
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::materializeAll() const
+{
+    if (!materialize())
+    {
+        return false;
+    }
+
+    for (const auto &member : m_members)
+    {
+        if (member.second->isObject() && !member.second->toObject().materializeAll())
+        {
+            return false;
         }
     }
 
@@ -360,6 +808,66 @@ bool operator==(const CppConfigFramework::ConfigObjectNode &left,
 
 // -------------------------------------------------------------------------------------------------
 
+quint64 ConfigObjectNode::calculateContentHash() const
+{
+    // Shared members have the same content hash as the shared node (it is already calculated)
+    if (m_lazyMembers && m_lazyMembers->sharedNode)
+    {
+        return m_lazyMembers->sharedNode->contentHash();
+    }
+
+    materialize();
+
+    quint64 hash = combineContentHash(static_cast<quint64>(type()),
+                                      static_cast<quint64>(m_members.size()));
+
+    for (const auto &member : m_members)
+    {
+        hash = combineContentHash(hash, stringContentHash(member.first));
+        hash = combineContentHash(hash, member.second->contentHash());
+    }
+
+    return hash;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::updateUnresolvedReferenceCount(const int delta)
+{
+    ConfigObjectNode *node = this;
+
+    while (true)
+    {
+        node->m_unresolvedReferenceCount += delta;
+
+        // Propagate the change only to a parent that actually holds the node as a member (a
+        // temporary node can also point to a parent without being stored in it)
+        ConfigObjectNode *parentNode = node->parent();
+
+        if ((parentNode == nullptr) || (parentNode->member(node->m_memberName) != node))
+        {
+            break;
+        }
+
+        node = parentNode;
+    }
+}
+
+} // namespace CppConfigFramework
+
+// -------------------------------------------------------------------------------------------------
+
+bool operator==(const CppConfigFramework::ConfigObjectNode &left,
+                const CppConfigFramework::ConfigObjectNode &right)
+{
+    // Node paths of the members are not compared since they are equal if the node paths of these
+    // nodes are equal
+    return (left.hasSameContents(right) &&
+            (left.nodePath() == right.nodePath()));
+}
+
+// -------------------------------------------------------------------------------------------------
+
 bool operator!=(const CppConfigFramework::ConfigObjectNode &left,
                 const CppConfigFramework::ConfigObjectNode &right)
 {
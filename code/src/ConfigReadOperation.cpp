@@ -0,0 +1,124 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that tracks an asynchronous configuration read and allows canceling it
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigReadOperation.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QMutexLocker>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+//! Operation of the active scope on this thread (null if no operation is active)
+static thread_local const ConfigReadOperation *t_currentOperation = nullptr;
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadOperation::Scope::Scope(const ConfigReadOperation *operation)
+    : m_previousOperation(t_currentOperation)
+{
+    t_currentOperation = operation;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadOperation::Scope::~Scope()
+{
+    t_currentOperation = m_previousOperation;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReadOperation::cancel()
+{
+    m_canceled.store(true);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReadOperation::isCanceled() const
+{
+    return m_canceled.load();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReadOperation::isFinished() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_finished;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReadOperation::waitForFinished(const int timeout) const
+{
+    QMutexLocker locker(&m_mutex);
+
+    while (!m_finished)
+    {
+        if (timeout < 0)
+        {
+            m_finishedCondition.wait(&m_mutex);
+        }
+        else if (!m_finishedCondition.wait(&m_mutex, static_cast<unsigned long>(timeout)))
+        {
+            return m_finished;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReadOperation::finish()
+{
+    QMutexLocker locker(&m_mutex);
+    m_finished = true;
+    m_finishedCondition.wakeAll();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigReadOperation *ConfigReadOperation::current()
+{
+    return t_currentOperation;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReadOperation::isCurrentCanceled()
+{
+    return (t_currentOperation != nullptr) && t_currentOperation->isCanceled();
+}
+
+} // namespace CppConfigFramework
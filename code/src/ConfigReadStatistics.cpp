@@ -0,0 +1,438 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the timings and counters of reading a configuration
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigReadStatistics.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNode.hpp>
+#include <CppConfigFramework/LoggingCategories.hpp>
+
+// Qt includes
+#include <QtCore/QMutexLocker>
+#include <QtCore/QStringList>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+//! Statistics of the active record scope on this thread (null if no statistics are being recorded)
+static thread_local ConfigReadStatistics *t_currentStatistics = nullptr;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Converts a time to a human readable string
+ *
+ * \param   nanoseconds Time in nanoseconds
+ *
+ * \return  Time in milliseconds
+ */
+static QString timeToString(const qint64 nanoseconds)
+{
+    constexpr double nanosecondsPerMillisecond = 1000000.0;
+    return QString::number(static_cast<double>(nanoseconds) / nanosecondsPerMillisecond, 'f', 3) +
+            QStringLiteral(" ms");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics::RecordScope::RecordScope(ConfigReadStatistics *statistics)
+    : m_previousStatistics(t_currentStatistics)
+{
+    t_currentStatistics = statistics;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics::RecordScope::~RecordScope()
+{
+    t_currentStatistics = m_previousStatistics;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics::LogScope::LogScope(const QString &description)
+{
+    if ((t_currentStatistics != nullptr) ||
+        (!CppConfigFramework::LoggingCategory::ConfigReadStatistics.isDebugEnabled()))
+    {
+        return;
+    }
+
+    m_description = description;
+    m_statistics = std::make_unique<ConfigReadStatistics>();
+    m_recordScope = std::make_unique<RecordScope>(m_statistics.get());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics::LogScope::~LogScope()
+{
+    if (!m_statistics)
+    {
+        return;
+    }
+
+    m_recordScope.reset();
+
+    qCDebug(CppConfigFramework::LoggingCategory::ConfigReadStatistics).noquote()
+            << QString("Read statistics of the configuration [%1]:\n%2")
+               .arg(m_description, m_statistics->toString());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics::PhaseTimer::PhaseTimer(const Phase phase)
+    : m_statistics(t_currentStatistics),
+      m_phase(phase)
+{
+    if (m_statistics != nullptr)
+    {
+        m_timer.start();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics::PhaseTimer::~PhaseTimer()
+{
+    if (m_statistics == nullptr)
+    {
+        return;
+    }
+
+    const qint64 elapsedNanoseconds = m_timer.nsecsElapsed();
+
+    QMutexLocker locker(&m_statistics->m_mutex);
+    auto &phaseStatistics = m_statistics->m_phases[static_cast<size_t>(m_phase)];
+    phaseStatistics.count++;
+    phaseStatistics.elapsedNanoseconds += elapsedNanoseconds;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics::IncludeTimer::IncludeTimer(const QString &type, const QString &filePath)
+    : m_statistics(t_currentStatistics)
+{
+    if (m_statistics != nullptr)
+    {
+        m_include.type = type;
+        m_include.filePath = filePath;
+        m_timer.start();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics::IncludeTimer::~IncludeTimer()
+{
+    if (m_statistics == nullptr)
+    {
+        return;
+    }
+
+    m_include.elapsedNanoseconds = m_timer.nsecsElapsed();
+
+    QMutexLocker locker(&m_statistics->m_mutex);
+    m_statistics->m_includes.push_back(std::move(m_include));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics::ReferenceResolutionRecorder::ReferenceResolutionRecorder()
+    : m_statistics(t_currentStatistics)
+{
+    if (m_statistics != nullptr)
+    {
+        m_timer.start();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics::ReferenceResolutionRecorder::~ReferenceResolutionRecorder()
+{
+    if (m_statistics == nullptr)
+    {
+        return;
+    }
+
+    m_resolution.elapsedNanoseconds = m_timer.nsecsElapsed();
+
+    QMutexLocker locker(&m_statistics->m_mutex);
+    auto &phaseStatistics =
+            m_statistics->m_phases[static_cast<size_t>(Phase::ResolveReferences)];
+    phaseStatistics.count++;
+    phaseStatistics.elapsedNanoseconds += m_resolution.elapsedNanoseconds;
+
+    m_statistics->m_referenceResolutions.push_back(std::move(m_resolution));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReadStatistics::ReferenceResolutionRecorder::startCycle()
+{
+    if (m_statistics != nullptr)
+    {
+        m_resolution.resolvedNodeCounts.push_back(0);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReadStatistics::ReferenceResolutionRecorder::recordResolvedNode()
+{
+    if ((m_statistics != nullptr) && (!m_resolution.resolvedNodeCounts.empty()))
+    {
+        m_resolution.resolvedNodeCounts.back()++;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReadStatistics::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_phases.fill(PhaseStatistics());
+    m_includes.clear();
+    m_referenceResolutions.clear();
+    m_treeStatistics = ConfigTreeStatistics();
+    m_memoryUsage = ConfigMemoryUsage();
+    m_createdNodeCount = 0;
+    m_clonedNodeCount = 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics::PhaseStatistics ConfigReadStatistics::phase(const Phase phase) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_phases[static_cast<size_t>(phase)];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::vector<ConfigReadStatistics::Include> ConfigReadStatistics::includes() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_includes;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::vector<ConfigReadStatistics::ReferenceResolution>
+ConfigReadStatistics::referenceResolutions() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_referenceResolutions;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+qint64 ConfigReadStatistics::createdNodeCount() const
+{
+    return m_createdNodeCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+qint64 ConfigReadStatistics::clonedNodeCount() const
+{
+    return m_clonedNodeCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigTreeStatistics ConfigReadStatistics::treeStatistics() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_treeStatistics;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigMemoryUsage ConfigReadStatistics::memoryUsage() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_memoryUsage;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigReadStatistics::toString() const
+{
+    QStringList lines;
+
+    for (size_t i = 0; i < PHASE_COUNT; i++)
+    {
+        const auto phaseValue = static_cast<Phase>(i);
+        const auto phaseStatistics = phase(phaseValue);
+
+        lines.append(QString("    %1: %2 (count: %3)")
+                     .arg(phaseToString(phaseValue),
+                          timeToString(phaseStatistics.elapsedNanoseconds))
+                     .arg(phaseStatistics.count));
+    }
+
+    const auto includeList = includes();
+    lines.append(QString("    includes: %1").arg(includeList.size()));
+
+    for (const auto &include : includeList)
+    {
+        lines.append(QString("        %1: [%2] %3")
+                     .arg(timeToString(include.elapsedNanoseconds),
+                          include.type,
+                          include.filePath));
+    }
+
+    const auto resolutions = referenceResolutions();
+    lines.append(QString("    reference resolutions: %1").arg(resolutions.size()));
+
+    for (const auto &resolution : resolutions)
+    {
+        QStringList resolvedNodeCounts;
+
+        for (const int resolvedNodeCount : resolution.resolvedNodeCounts)
+        {
+            resolvedNodeCounts.append(QString::number(resolvedNodeCount));
+        }
+
+        lines.append(QString("        %1: cycles: %2, resolved nodes per cycle: [%3]")
+                     .arg(timeToString(resolution.elapsedNanoseconds))
+                     .arg(resolution.resolvedNodeCounts.size())
+                     .arg(resolvedNodeCounts.join(", ")));
+    }
+
+    lines.append(QString("    created nodes: %1").arg(createdNodeCount()));
+    lines.append(QString("    cloned nodes: %1").arg(clonedNodeCount()));
+
+    const auto tree = treeStatistics();
+
+    if (tree.nodeCount() > 0)
+    {
+        const auto memory = memoryUsage();
+
+        lines.append(QString("    tree: %1 nodes, max depth: %2, references: %3, "
+                             "widest object: %4 members [%5]")
+                     .arg(tree.nodeCount())
+                     .arg(tree.maxDepth)
+                     .arg(tree.referenceCount)
+                     .arg(tree.widestObjectMemberCount)
+                     .arg(tree.widestObjectNodePath));
+        lines.append(QString("    memory: %1 bytes (owned: %2 bytes, shared: %3 bytes)")
+                     .arg(memory.totalBytes())
+                     .arg(memory.ownedBytes())
+                     .arg(memory.sharedBytes()));
+    }
+
+    return lines.join("\n");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigReadStatistics::phaseToString(const Phase phase)
+{
+    switch (phase)
+    {
+        case Phase::FileIo:
+            return QStringLiteral("FileIo");
+
+        case Phase::JsonParsing:
+            return QStringLiteral("JsonParsing");
+
+        case Phase::ReadObjectNode:
+            return QStringLiteral("ReadObjectNode");
+
+        case Phase::ResolveReferences:
+            return QStringLiteral("ResolveReferences");
+
+        case Phase::Apply:
+            return QStringLiteral("Apply");
+
+        case Phase::TransformConfig:
+            return QStringLiteral("TransformConfig");
+    }
+
+    return {};
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReadStatistics *ConfigReadStatistics::current()
+{
+    return t_currentStatistics;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReadStatistics::isRecording()
+{
+    return (t_currentStatistics != nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReadStatistics::recordCreatedNode()
+{
+    if (t_currentStatistics != nullptr)
+    {
+        t_currentStatistics->m_createdNodeCount++;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReadStatistics::recordClonedNode()
+{
+    if (t_currentStatistics != nullptr)
+    {
+        t_currentStatistics->m_clonedNodeCount++;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReadStatistics::recordTree(const ConfigNode &config)
+{
+    ConfigReadStatistics *statistics = t_currentStatistics;
+
+    if (statistics == nullptr)
+    {
+        return;
+    }
+
+    // Walk the tree without holding the lock
+    const auto treeStatistics = config.treeStatistics();
+    const auto memoryUsage = config.memoryUsage();
+
+    QMutexLocker locker(&statistics->m_mutex);
+    statistics->m_treeStatistics = treeStatistics;
+    statistics->m_memoryUsage = memoryUsage;
+}
+
+} // namespace CppConfigFramework
@@ -23,8 +23,12 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigFileCache.hpp>
+#include <CppConfigFramework/ConfigIncludeGraph.hpp>
+#include <CppConfigFramework/ConfigNodeArena.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReadStatistics.hpp>
 #include <CppConfigFramework/ConfigReaderRegistry.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 #include <CppConfigFramework/LoggingCategories.hpp>
@@ -36,8 +40,16 @@
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonValue>
 #include <QtCore/QRegularExpression>
+#include <QtCore/QRunnable>
+#include <QtCore/QSemaphore>
+#include <QtCore/QSet>
+#include <QtCore/QThreadPool>
 
 // System includes
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <vector>
 
 // Forward declarations
 
@@ -48,6 +60,1891 @@
 namespace CppConfigFramework
 {
 
+/*!
+ * Makes an absolute path to the file using the working directory if needed
+ *
+ * \param   filePath    Path to the file (with already expanded environment variables)
+ * \param   workingDir  Path to the working directory
+ *
+ * \return  Absolute file path
+ */
+static QString makeAbsoluteFilePath(const QString &filePath, const QDir &workingDir)
+{
+    if (QDir::isAbsolutePath(filePath))
+    {
+        return QDir::cleanPath(filePath);
+    }
+
+    return QDir::cleanPath(workingDir.absoluteFilePath(filePath));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Parses the contents of a configuration file
+ *
+ * \param   fileContents    File contents
+ * \param   jsonParseError  Output for the parse error
+ *
+ * \return  Parsed JSON document
+ */
+static QJsonDocument parseFileContents(const QByteArray &fileContents,
+                                       QJsonParseError *jsonParseError)
+{
+    const ConfigReadStatistics::PhaseTimer phaseTimer(ConfigReadStatistics::Phase::JsonParsing);
+    return QJsonDocument::fromJson(fileContents, jsonParseError);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Logs an error that occurred while parsing the contents of a configuration file
+ *
+ * \param   filePath        Path to the file
+ * \param   fileContents    File contents
+ * \param   jsonParseError  Parse error
+ */
+static void logParseError(const QString &filePath,
+                          const QByteArray &fileContents,
+                          const QJsonParseError &jsonParseError)
+{
+    constexpr int contextMaxLength = 20;
+    const int contextBeforeIndex = std::max(0, jsonParseError.offset - contextMaxLength);
+    const int contextBeforeLength = std::min(jsonParseError.offset, contextMaxLength);
+
+    qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+            << QString("Failed to parse the file contents:"
+                       "\n    file path: %1"
+                       "\n    offset: %2"
+                       "\n    error: [%3]"
+                       "\n    context before error: [%4]"
+                       "\n    context at error: [%5]")
+               .arg(filePath,
+                    QString::number(jsonParseError.offset),
+                    jsonParseError.errorString(),
+                    QString::fromUtf8(fileContents.mid(contextBeforeIndex, contextBeforeLength)),
+                    QString::fromUtf8(fileContents.mid(jsonParseError.offset, contextMaxLength)));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Finds the first byte of an invalid UTF-8 sequence
+ *
+ * \param   data    Data
+ * \param   size    Size of the data
+ *
+ * \return  Index of the first byte of the invalid sequence or -1 if the data is valid UTF-8
+ *
+ * Overlong encodings, surrogates and code points past U+10FFFF are invalid.
+ */
+static int findInvalidUtf8(const char *data, const int size)
+{
+    const auto *bytes = reinterpret_cast<const uchar *>(data);
+    int index = 0;
+
+    while (index < size)
+    {
+        const uchar leadByte = bytes[index];
+
+        if (leadByte < 0x80U)
+        {
+            index++;
+            continue;
+        }
+
+        int length = 0;
+        uint codePoint = 0U;
+        uint minCodePoint = 0U;
+
+        if ((leadByte & 0xE0U) == 0xC0U)
+        {
+            length = 2;
+            codePoint = leadByte & 0x1FU;
+            minCodePoint = 0x80U;
+        }
+        else if ((leadByte & 0xF0U) == 0xE0U)
+        {
+            length = 3;
+            codePoint = leadByte & 0x0FU;
+            minCodePoint = 0x800U;
+        }
+        else if ((leadByte & 0xF8U) == 0xF0U)
+        {
+            length = 4;
+            codePoint = leadByte & 0x07U;
+            minCodePoint = 0x10000U;
+        }
+        else
+        {
+            return index;
+        }
+
+        if ((size - index) < length)
+        {
+            return index;
+        }
+
+        for (int i = 1; i < length; i++)
+        {
+            const uchar byte = bytes[index + i];
+
+            if ((byte & 0xC0U) != 0x80U)
+            {
+                return index;
+            }
+
+            codePoint = (codePoint << 6U) | (byte & 0x3FU);
+        }
+
+        if ((codePoint < minCodePoint) ||
+            ((codePoint >= 0xD800U) && (codePoint <= 0xDFFFU)) ||
+            (codePoint > 0x10FFFFU))
+        {
+            return index;
+        }
+
+        index += length;
+    }
+
+    return -1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Pull parser that reads the JSON values straight from the contents of a configuration file
+ *
+ * This is used to create the configuration nodes while the file contents are parsed instead of
+ * parsing them to a QJsonDocument first (see ConfigReader::setStreamingParsingEnabled()). The
+ * syntax is the same as for QJsonDocument::fromJson() and the errors are reported the same way, as
+ * a QJsonParseError with the offset in the file contents. Once an error occurs all of the methods
+ * fail.
+ *
+ * The members of a JSON Object are read with beginObject() and nextMember(). Each member value
+ * then needs to be read (or skipped) before the next member is read.
+ */
+class JsonStreamParser
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   fileContents    File contents (they need to stay valid while the parser is used)
+     * \param   filePath        Path to the file (used for reporting the errors)
+     * \param   offset          Offset of the first value that needs to be read
+     *
+     * \note    A UTF-8 byte order mark at the start of the file contents is skipped
+     */
+    JsonStreamParser(const QByteArray &fileContents, const QString &filePath, const int offset = 0)
+        : m_fileContents(fileContents),
+          m_filePath(filePath),
+          m_begin(fileContents.constData()),
+          m_end(fileContents.constData() + fileContents.size()),
+          m_position(fileContents.constData() + offset)
+    {
+        m_error.offset = 0;
+        m_error.error = QJsonParseError::NoError;
+
+        if ((offset == 0) && fileContents.startsWith("\xEF\xBB\xBF"))
+        {
+            m_position += 3;
+        }
+    }
+
+    /*!
+     * Gets the offset of the current position in the file contents
+     *
+     * \return  Offset
+     */
+    int offset() const
+    {
+        return static_cast<int>(m_position - m_begin);
+    }
+
+    /*!
+     * Checks if an error occurred
+     *
+     * \retval  true    Error occurred
+     * \retval  false   No error occurred
+     */
+    bool hasError() const
+    {
+        return (m_error.error != QJsonParseError::NoError);
+    }
+
+    //! Logs the error (if any) with the context from the file contents
+    void logError() const
+    {
+        if (hasError())
+        {
+            logParseError(m_filePath, m_fileContents, m_error);
+        }
+    }
+
+    /*!
+     * Gets the type of the next value without reading it
+     *
+     * \return  Type of the next value or QJsonValue::Undefined if it is not a valid value
+     */
+    QJsonValue::Type nextValueType()
+    {
+        if (hasError() || (!skipWhitespace()))
+        {
+            return QJsonValue::Undefined;
+        }
+
+        switch (*m_position)
+        {
+            case '{':
+            {
+                return QJsonValue::Object;
+            }
+
+            case '[':
+            {
+                return QJsonValue::Array;
+            }
+
+            case '"':
+            {
+                return QJsonValue::String;
+            }
+
+            case 't':
+            case 'f':
+            {
+                return QJsonValue::Bool;
+            }
+
+            case 'n':
+            {
+                return QJsonValue::Null;
+            }
+
+            case '-':
+            case '0':
+            case '1':
+            case '2':
+            case '3':
+            case '4':
+            case '5':
+            case '6':
+            case '7':
+            case '8':
+            case '9':
+            {
+                return QJsonValue::Double;
+            }
+
+            default:
+            {
+                return QJsonValue::Undefined;
+            }
+        }
+    }
+
+    /*!
+     * Starts reading a JSON Object
+     *
+     * \retval  true    Success, the members can be read with nextMember()
+     * \retval  false   Failure (the next value is not a JSON Object)
+     */
+    bool beginObject()
+    {
+        if (nextValueType() != QJsonValue::Object)
+        {
+            return setError(QJsonParseError::IllegalValue);
+        }
+
+        if (m_depth >= MAX_NESTING_DEPTH)
+        {
+            return setError(QJsonParseError::DeepNesting);
+        }
+
+        m_position++;
+        m_depth++;
+        m_memberCounts.push_back(0);
+        return true;
+    }
+
+    /*!
+     * Reads the name of the next member of the JSON Object that is being read
+     *
+     * \param[out]  name    Output for the member name (null if it is not needed)
+     *
+     * \retval  true    Member name was read, its value needs to be read next
+     * \retval  false   End of the JSON Object was reached or an error occurred (see hasError())
+     */
+    bool nextMember(QString *name)
+    {
+        Q_ASSERT(!m_memberCounts.empty());
+
+        if (hasError())
+        {
+            return false;
+        }
+
+        if (!skipWhitespace())
+        {
+            return setError(QJsonParseError::UnterminatedObject);
+        }
+
+        int &memberCount = m_memberCounts.back();
+
+        if (*m_position == '}')
+        {
+            m_position++;
+            m_depth--;
+            m_memberCounts.pop_back();
+            return false;
+        }
+
+        if (memberCount > 0)
+        {
+            if (*m_position != ',')
+            {
+                return setError(QJsonParseError::UnterminatedObject);
+            }
+
+            m_position++;
+
+            if (!skipWhitespace())
+            {
+                return setError(QJsonParseError::UnterminatedObject);
+            }
+
+            if (*m_position == '}')
+            {
+                return setError(QJsonParseError::MissingObject);
+            }
+        }
+
+        if (*m_position != '"')
+        {
+            return setError(QJsonParseError::UnterminatedObject);
+        }
+
+        if (!readStringContents(name))
+        {
+            return false;
+        }
+
+        if ((!skipWhitespace()) || (*m_position != ':'))
+        {
+            return setError(QJsonParseError::MissingNameSeparator);
+        }
+
+        m_position++;
+        memberCount++;
+        return true;
+    }
+
+    /*!
+     * Reads a JSON String
+     *
+     * \param[out]  string  Output for the string
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (also if the next value is not a JSON String)
+     */
+    bool readString(QString *string)
+    {
+        if (nextValueType() != QJsonValue::String)
+        {
+            return setError(QJsonParseError::IllegalValue);
+        }
+
+        return readStringContents(string);
+    }
+
+    /*!
+     * Reads the next value
+     *
+     * \param[out]  value   Output for the value (null if the value only needs to be skipped)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readValue(QJsonValue *value)
+    {
+        switch (nextValueType())
+        {
+            case QJsonValue::Object:
+            {
+                return readObject(value);
+            }
+
+            case QJsonValue::Array:
+            {
+                return readArray(value);
+            }
+
+            case QJsonValue::String:
+            {
+                QString string;
+
+                if (!readStringContents((value != nullptr) ? &string : nullptr))
+                {
+                    return false;
+                }
+
+                if (value != nullptr)
+                {
+                    *value = QJsonValue(string);
+                }
+                return true;
+            }
+
+            case QJsonValue::Bool:
+            {
+                return (*m_position == 't') ? readLiteral("true", QJsonValue(true), value)
+                                            : readLiteral("false", QJsonValue(false), value);
+            }
+
+            case QJsonValue::Null:
+            {
+                return readLiteral("null", QJsonValue(QJsonValue::Null), value);
+            }
+
+            case QJsonValue::Double:
+            {
+                return readNumber(value);
+            }
+
+            default:
+            {
+                return setError(QJsonParseError::IllegalValue);
+            }
+        }
+    }
+
+    /*!
+     * Skips the next value (it is still checked for syntax errors)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool skipValue()
+    {
+        return readValue(nullptr);
+    }
+
+    /*!
+     * Checks that nothing but whitespace follows the current position
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readEnd()
+    {
+        if (hasError())
+        {
+            return false;
+        }
+
+        if (skipWhitespace())
+        {
+            return setError(QJsonParseError::GarbageAtEnd);
+        }
+
+        return true;
+    }
+
+private:
+    /*!
+     * Sets the error at the current position (only the first error is kept)
+     *
+     * \param   error   Error
+     *
+     * \return  Always false
+     */
+    bool setError(const QJsonParseError::ParseError error)
+    {
+        if (!hasError())
+        {
+            m_error.error = error;
+            m_error.offset = offset();
+        }
+
+        return false;
+    }
+
+    /*!
+     * Skips the whitespace
+     *
+     * \retval  true    Current position is at a character other than whitespace
+     * \retval  false   End of the file contents was reached
+     */
+    bool skipWhitespace()
+    {
+        while ((m_position < m_end) &&
+               ((*m_position == ' ') ||
+                (*m_position == '\t') ||
+                (*m_position == '\n') ||
+                (*m_position == '\r')))
+        {
+            m_position++;
+        }
+
+        return (m_position < m_end);
+    }
+
+    /*!
+     * Reads a JSON Object
+     *
+     * \param[out]  value   Output for the value (null if the value only needs to be skipped)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readObject(QJsonValue *value)
+    {
+        if (!beginObject())
+        {
+            return false;
+        }
+
+        QJsonObject object;
+        QString name;
+
+        while (nextMember((value != nullptr) ? &name : nullptr))
+        {
+            QJsonValue memberValue;
+
+            if (!readValue((value != nullptr) ? &memberValue : nullptr))
+            {
+                return false;
+            }
+
+            if (value != nullptr)
+            {
+                object.insert(name, memberValue);
+            }
+        }
+
+        if (hasError())
+        {
+            return false;
+        }
+
+        if (value != nullptr)
+        {
+            *value = QJsonValue(object);
+        }
+        return true;
+    }
+
+    /*!
+     * Reads a JSON Array
+     *
+     * \param[out]  value   Output for the value (null if the value only needs to be skipped)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readArray(QJsonValue *value)
+    {
+        if (m_depth >= MAX_NESTING_DEPTH)
+        {
+            return setError(QJsonParseError::DeepNesting);
+        }
+
+        m_position++;
+        m_depth++;
+
+        if (!skipWhitespace())
+        {
+            return setError(QJsonParseError::UnterminatedArray);
+        }
+
+        QJsonArray array;
+
+        if (*m_position != ']')
+        {
+            while (true)
+            {
+                QJsonValue item;
+
+                if (!readValue((value != nullptr) ? &item : nullptr))
+                {
+                    return false;
+                }
+
+                if (value != nullptr)
+                {
+                    array.append(item);
+                }
+
+                if (!skipWhitespace())
+                {
+                    return setError(QJsonParseError::UnterminatedArray);
+                }
+
+                if (*m_position != ',')
+                {
+                    break;
+                }
+
+                m_position++;
+            }
+
+            if (*m_position != ']')
+            {
+                return setError(QJsonParseError::UnterminatedArray);
+            }
+        }
+
+        m_position++;
+        m_depth--;
+
+        if (value != nullptr)
+        {
+            *value = QJsonValue(array);
+        }
+        return true;
+    }
+
+    /*!
+     * Reads the contents of a JSON String (the current position needs to be at its opening quote)
+     *
+     * \param[out]  string  Output for the string (null if the string only needs to be skipped)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readStringContents(QString *string)
+    {
+        Q_ASSERT(*m_position == '"');
+        m_position++;
+
+        if (string != nullptr)
+        {
+            string->clear();
+        }
+
+        // The string is converted one segment between the escape sequences at a time so that a
+        // string without them (the usual case) is converted in one go
+        const char *segmentBegin = m_position;
+        bool segmentIsAscii = true;
+
+        while (m_position < m_end)
+        {
+            const char character = *m_position;
+
+            if ((character != '"') && (character != '\\'))
+            {
+                segmentIsAscii = segmentIsAscii && (static_cast<uchar>(character) < 0x80U);
+                m_position++;
+                continue;
+            }
+
+            if (!appendStringSegment(segmentBegin, segmentIsAscii, string))
+            {
+                return false;
+            }
+
+            if (character == '"')
+            {
+                m_position++;
+                return true;
+            }
+
+            if (!readEscapeSequence(string))
+            {
+                return false;
+            }
+
+            segmentBegin = m_position;
+            segmentIsAscii = true;
+        }
+
+        return setError(QJsonParseError::UnterminatedString);
+    }
+
+    /*!
+     * Appends a segment of a JSON String that ends at the current position
+     *
+     * \param   segmentBegin    Start of the segment
+     * \param   segmentIsAscii  Flag that indicates if the segment contains only ASCII characters
+     *
+     * \param[out]  string  Output for the string (null if the string only needs to be skipped)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (the segment is not valid UTF-8)
+     */
+    bool appendStringSegment(const char *segmentBegin, const bool segmentIsAscii, QString *string)
+    {
+        const int size = static_cast<int>(m_position - segmentBegin);
+
+        if (!segmentIsAscii)
+        {
+            const int invalidIndex = findInvalidUtf8(segmentBegin, size);
+
+            if (invalidIndex >= 0)
+            {
+                m_position = segmentBegin + invalidIndex;
+                return setError(QJsonParseError::IllegalUTF8String);
+            }
+        }
+
+        if ((string != nullptr) && (size > 0))
+        {
+            if (string->isEmpty())
+            {
+                *string = QString::fromUtf8(segmentBegin, size);
+            }
+            else
+            {
+                string->append(QString::fromUtf8(segmentBegin, size));
+            }
+        }
+
+        return true;
+    }
+
+    /*!
+     * Reads an escape sequence in a JSON String (the current position needs to be at its backslash)
+     *
+     * \param[out]  string  Output for the string (null if the string only needs to be skipped)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    Same as for QJsonDocument::fromJson() an unknown escape sequence stands for the
+     *          escaped character itself
+     */
+    bool readEscapeSequence(QString *string)
+    {
+        m_position++;
+
+        if (m_position == m_end)
+        {
+            return setError(QJsonParseError::IllegalEscapeSequence);
+        }
+
+        const uchar escaped = static_cast<uchar>(*m_position);
+        m_position++;
+        ushort character = escaped;
+
+        switch (escaped)
+        {
+            case 'b':
+            {
+                character = 0x08U;
+                break;
+            }
+
+            case 'f':
+            {
+                character = 0x0CU;
+                break;
+            }
+
+            case 'n':
+            {
+                character = 0x0AU;
+                break;
+            }
+
+            case 'r':
+            {
+                character = 0x0DU;
+                break;
+            }
+
+            case 't':
+            {
+                character = 0x09U;
+                break;
+            }
+
+            case 'u':
+            {
+                if ((m_end - m_position) < 4)
+                {
+                    return setError(QJsonParseError::IllegalEscapeSequence);
+                }
+
+                character = 0U;
+
+                for (int i = 0; i < 4; i++)
+                {
+                    const char hexDigit = *m_position;
+                    uint digit = 0U;
+
+                    if ((hexDigit >= '0') && (hexDigit <= '9'))
+                    {
+                        digit = static_cast<uint>(hexDigit - '0');
+                    }
+                    else if ((hexDigit >= 'a') && (hexDigit <= 'f'))
+                    {
+                        digit = static_cast<uint>(hexDigit - 'a') + 10U;
+                    }
+                    else if ((hexDigit >= 'A') && (hexDigit <= 'F'))
+                    {
+                        digit = static_cast<uint>(hexDigit - 'A') + 10U;
+                    }
+                    else
+                    {
+                        return setError(QJsonParseError::IllegalEscapeSequence);
+                    }
+
+                    character = static_cast<ushort>((static_cast<uint>(character) << 4U) | digit);
+                    m_position++;
+                }
+                break;
+            }
+
+            default:
+            {
+                // The escaped character itself (also for '"', '\\' and '/')
+                break;
+            }
+        }
+
+        if (string != nullptr)
+        {
+            string->append(QChar(character));
+        }
+
+        return true;
+    }
+
+    /*!
+     * Reads a JSON literal (true, false or null)
+     *
+     * \param   literal         Literal
+     * \param   literalValue    Value of the literal
+     *
+     * \param[out]  value   Output for the value (null if the value only needs to be skipped)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readLiteral(const char *literal, const QJsonValue &literalValue, QJsonValue *value)
+    {
+        const size_t length = std::strlen(literal);
+
+        if ((static_cast<size_t>(m_end - m_position) < length) ||
+            (std::memcmp(m_position, literal, length) != 0))
+        {
+            return setError(QJsonParseError::IllegalValue);
+        }
+
+        m_position += length;
+
+        if (value != nullptr)
+        {
+            *value = literalValue;
+        }
+        return true;
+    }
+
+    /*!
+     * Reads a JSON Number
+     *
+     * \param[out]  value   Output for the value (null if the value only needs to be skipped)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    The number is converted also when it is skipped so that the same numbers are
+     *          rejected in both cases
+     */
+    bool readNumber(QJsonValue *value)
+    {
+        const char *numberBegin = m_position;
+        const auto skipDigits = [this]()
+        {
+            while ((m_position < m_end) && (*m_position >= '0') && (*m_position <= '9'))
+            {
+                m_position++;
+            }
+        };
+
+        if (*m_position == '-')
+        {
+            m_position++;
+        }
+
+        if ((m_position < m_end) && (*m_position == '0'))
+        {
+            m_position++;
+        }
+        else
+        {
+            skipDigits();
+        }
+
+        if ((m_position < m_end) && (*m_position == '.'))
+        {
+            m_position++;
+            skipDigits();
+        }
+
+        if ((m_position < m_end) && ((*m_position == 'e') || (*m_position == 'E')))
+        {
+            m_position++;
+
+            if ((m_position < m_end) && ((*m_position == '-') || (*m_position == '+')))
+            {
+                m_position++;
+            }
+
+            skipDigits();
+        }
+
+        if (m_position == m_end)
+        {
+            return setError(QJsonParseError::TerminationByNumber);
+        }
+
+        bool ok = false;
+        const double number = QByteArray::fromRawData(
+                numberBegin, static_cast<int>(m_position - numberBegin)).toDouble(&ok);
+
+        if (!ok)
+        {
+            m_position = numberBegin;
+            return setError(QJsonParseError::IllegalNumber);
+        }
+
+        if (value != nullptr)
+        {
+            *value = QJsonValue(number);
+        }
+        return true;
+    }
+
+private:
+    //! Max nesting depth of the JSON Arrays and Objects (same as for QJsonDocument::fromJson())
+    static constexpr int MAX_NESTING_DEPTH = 1024;
+
+    //! File contents
+    const QByteArray &m_fileContents;
+
+    //! Path to the file
+    QString m_filePath;
+
+    //! Start of the file contents
+    const char *m_begin;
+
+    //! End of the file contents
+    const char *m_end;
+
+    //! Current position in the file contents
+    const char *m_position;
+
+    //! Current nesting depth of the JSON Arrays and Objects
+    int m_depth = 0;
+
+    //! Number of the members that were read for each of the JSON Objects that are being read
+    std::vector<int> m_memberCounts;
+
+    //! Holds the error
+    QJsonParseError m_error;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Holds an included configuration file that was read ahead of its processing
+struct PreReadIncludeFile
+{
+    //! Absolute path to the file
+    QString absoluteFilePath;
+
+    //! Root JSON Object of the file
+    QJsonObject rootObject;
+
+    //! Holds the "is valid" flag (file was successfully read and contains a JSON Object)
+    bool valid = false;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Task that reads and parses a configuration file on a thread pool
+ *
+ * \note    Errors are not logged since a file that fails to be pre-read is read again the regular
+ *          way which logs the error in the declaration order of the includes
+ */
+class PreReadIncludeFileTask : public QRunnable
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   includeFile Included configuration file (absolute path needs to be set)
+     * \param   finished    Semaphore that will be released once the task is finished
+     */
+    PreReadIncludeFileTask(PreReadIncludeFile *includeFile, QSemaphore *finished)
+        : m_includeFile(includeFile),
+          m_finished(finished),
+          m_statistics(ConfigReadStatistics::current()),
+          m_operation(ConfigReadOperation::current())
+    {
+    }
+
+    //! \copydoc    QRunnable::run()
+    void run() override
+    {
+        // Skip the file if the operation of the thread that started the task was canceled
+        if ((m_operation != nullptr) && m_operation->isCanceled())
+        {
+            m_finished->release();
+            return;
+        }
+
+        // Record the statistics in the statistics of the thread that started the task (if any)
+        const ConfigReadStatistics::RecordScope statisticsScope(m_statistics);
+
+        // With the cache enabled the file is only stored in the cache (if needed) and then read
+        // from the cache the regular way
+        auto *cache = ConfigFileCache::instance();
+        const bool cacheEnabled = cache->isEnabled();
+        ConfigFileCache::FileKey fileKey;
+
+        if (cacheEnabled)
+        {
+            fileKey = ConfigFileCache::FileKey::fromFile(m_includeFile->absoluteFilePath);
+
+            if (cache->containsFile(fileKey))
+            {
+                m_finished->release();
+                return;
+            }
+        }
+
+        QFile file(m_includeFile->absoluteFilePath);
+
+        if (file.open(QIODevice::ReadOnly))
+        {
+            QJsonParseError jsonParseError {};
+            const auto doc = parseFileContents(ConfigReaderBase::readFileData(&file),
+                                               &jsonParseError);
+
+            if ((jsonParseError.error == QJsonParseError::NoError) && doc.isObject())
+            {
+                if (cacheEnabled)
+                {
+                    cache->storeFile(fileKey, doc.object());
+                }
+                else
+                {
+                    m_includeFile->rootObject = doc.object();
+                    m_includeFile->valid = true;
+                }
+            }
+        }
+
+        m_finished->release();
+    }
+
+private:
+    //! Included configuration file
+    PreReadIncludeFile *m_includeFile;
+
+    //! Semaphore that will be released once the task is finished
+    QSemaphore *m_finished;
+
+    //! Statistics that are being recorded on the thread that started the task (can be null)
+    ConfigReadStatistics *m_statistics;
+
+    //! Operation that is active on the thread that started the task (can be null)
+    const ConfigReadOperation *m_operation;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Task that reads a configuration file on a thread pool (see ConfigReader::readAsync())
+class ReadConfigTask : public QRunnable
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   reader                  Configuration reader
+     * \param   filePath                Path to the configuration file
+     * \param   workingDir              Path to the working directory
+     * \param   sourceNodePath          Node path to the node that needs to be extracted
+     * \param   destinationNodePath     Node path to the destination node
+     * \param   externalConfigs         Configuration nodes provided by an external source
+     * \param   environmentVariables    Environment variables
+     * \param   callback                Function that is called with the result
+     * \param   operation               Operation of the read
+     */
+    ReadConfigTask(const ConfigReader &reader,
+                   const QString &filePath,
+                   const QDir &workingDir,
+                   const ConfigNodePath &sourceNodePath,
+                   const ConfigNodePath &destinationNodePath,
+                   const std::vector<const ConfigObjectNode *> &externalConfigs,
+                   const EnvironmentVariables &environmentVariables,
+                   ConfigReader::ReadCallback callback,
+                   std::shared_ptr<ConfigReadOperation> operation)
+        : m_reader(reader),
+          m_filePath(filePath),
+          m_workingDir(workingDir),
+          m_sourceNodePath(sourceNodePath),
+          m_destinationNodePath(destinationNodePath),
+          m_externalConfigs(externalConfigs),
+          m_environmentVariables(environmentVariables),
+          m_callback(std::move(callback)),
+          m_operation(std::move(operation)),
+          m_statistics(ConfigReadStatistics::current())
+    {
+    }
+
+    //! \copydoc    QRunnable::run()
+    void run() override
+    {
+        {
+            const ConfigReadStatistics::RecordScope statisticsScope(m_statistics);
+            const ConfigReadOperation::Scope operationScope(m_operation.get());
+
+            auto config = m_operation->isCanceled()
+                          ? std::unique_ptr<ConfigObjectNode>()
+                          : m_reader.read(m_filePath,
+                                          m_workingDir,
+                                          m_sourceNodePath,
+                                          m_destinationNodePath,
+                                          m_externalConfigs,
+                                          &m_environmentVariables);
+
+            if (!m_operation->isCanceled())
+            {
+                m_callback(std::move(config), m_environmentVariables);
+            }
+        }
+
+        m_operation->finish();
+    }
+
+private:
+    //! Configuration reader
+    const ConfigReader m_reader;
+
+    //! Path to the configuration file
+    const QString m_filePath;
+
+    //! Path to the working directory
+    const QDir m_workingDir;
+
+    //! Node path to the node that needs to be extracted
+    const ConfigNodePath m_sourceNodePath;
+
+    //! Node path to the destination node
+    const ConfigNodePath m_destinationNodePath;
+
+    //! Configuration nodes provided by an external source
+    const std::vector<const ConfigObjectNode *> m_externalConfigs;
+
+    //! Environment variables
+    EnvironmentVariables m_environmentVariables;
+
+    //! Function that is called with the result
+    ConfigReader::ReadCallback m_callback;
+
+    //! Operation of the read
+    std::shared_ptr<ConfigReadOperation> m_operation;
+
+    //! Statistics that are being recorded on the thread that started the task (can be null)
+    ConfigReadStatistics *m_statistics;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Extracts the absolute path to the file of an include from its 'file_path' member
+ *
+ * \param   includeObject           Include JSON Object
+ * \param   workingDir              Path to the working directory
+ * \param   environmentVariables    Environment variables
+ *
+ * \return  Absolute file path or an empty string if the include has no file path or in case of
+ *          failure
+ */
+static QString includeFilePath(const QJsonObject &includeObject,
+                               const QDir &workingDir,
+                               const EnvironmentVariables &environmentVariables)
+{
+    QString filePath;
+
+    if ((!CedarFramework::deserializeNode(includeObject, QStringLiteral("file_path"), &filePath)) ||
+        filePath.isEmpty())
+    {
+        return {};
+    }
+
+    const QString expandedFilePath = environmentVariables.expandText(filePath);
+
+    if (expandedFilePath.isEmpty())
+    {
+        return {};
+    }
+
+    return makeAbsoluteFilePath(expandedFilePath, workingDir);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Extracts the absolute path to the file of an include of 'CppConfigFramework' type
+ *
+ * \param   includeObject           Include JSON Object
+ * \param   workingDir              Path to the working directory
+ * \param   environmentVariables    Environment variables
+ *
+ * \return  Absolute file path or an empty string if the include is of a different type or in case
+ *          of failure
+ */
+static QString includeAbsoluteFilePath(const QJsonObject &includeObject,
+                                       const QDir &workingDir,
+                                       const EnvironmentVariables &environmentVariables)
+{
+    QString type = QStringLiteral("CppConfigFramework");
+
+    if ((!CedarFramework::deserializeOptionalNode(includeObject, QStringLiteral("type"), &type)) ||
+        (type != QStringLiteral("CppConfigFramework")))
+    {
+        return {};
+    }
+
+    return includeFilePath(includeObject, workingDir, environmentVariables);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Loads the root JSON Object of an included configuration file without reading its nodes
+ *
+ * \param   absoluteFilePath    Absolute path to the file
+ * \param   preReadIncludeFile  Included file that was read ahead of its processing (can be null)
+ * \param   rootObject          Output for the root JSON Object
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    Errors are not logged since a file that fails to be loaded is read again the regular way
+ *          which logs the error
+ */
+static bool loadIncludeRootObject(const QString &absoluteFilePath,
+                                  const PreReadIncludeFile *preReadIncludeFile,
+                                  QJsonObject *rootObject)
+{
+    if ((preReadIncludeFile != nullptr) &&
+        preReadIncludeFile->valid &&
+        (preReadIncludeFile->absoluteFilePath == absoluteFilePath))
+    {
+        *rootObject = preReadIncludeFile->rootObject;
+        return true;
+    }
+
+    auto *cache = ConfigFileCache::instance();
+    const bool cacheEnabled = cache->isEnabled();
+    ConfigFileCache::FileKey fileKey;
+
+    if (cacheEnabled)
+    {
+        fileKey = ConfigFileCache::FileKey::fromFile(absoluteFilePath);
+
+        if (cache->findFile(fileKey, rootObject))
+        {
+            return true;
+        }
+    }
+
+    QFile file(absoluteFilePath);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    QJsonParseError jsonParseError {};
+    const auto doc = parseFileContents(ConfigReaderBase::readFileData(&file), &jsonParseError);
+
+    if ((jsonParseError.error != QJsonParseError::NoError) || (!doc.isObject()))
+    {
+        return false;
+    }
+
+    *rootObject = doc.object();
+
+    if (cacheEnabled)
+    {
+        cache->storeFile(fileKey, *rootObject);
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if reading an included configuration file affects anything besides its own nodes
+ *
+ * \param   rootObject  Root JSON Object of the included file
+ *
+ * \retval  true    File sets environment variables or has nested includes (which could set them)
+ * \retval  false   File only provides its own nodes
+ */
+static bool includeHasSideEffects(const QJsonObject &rootObject)
+{
+    const QJsonValue environmentVariables =
+            rootObject.value(QStringLiteral("environment_variables"));
+    const QJsonValue includes = rootObject.value(QStringLiteral("includes"));
+
+    const bool hasEnvironmentVariables =
+            (!environmentVariables.isUndefined()) &&
+            (!environmentVariables.isNull()) &&
+            ((!environmentVariables.isObject()) || (!environmentVariables.toObject().isEmpty()));
+
+    const bool hasIncludes = (!includes.isUndefined()) &&
+                             (!includes.isNull()) &&
+                             ((!includes.isArray()) || (!includes.toArray().isEmpty()));
+
+    return hasEnvironmentVariables || hasIncludes;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Records the include in the include graph that is being recorded on this thread
+ *
+ * \param   includeObject           Include JSON Object
+ * \param   type                    Type of the include
+ * \param   destinationNodePath     Node path to the destination node of the include
+ * \param   workingDir              Path to the working directory
+ * \param   environmentVariables    Environment variables
+ */
+static void recordInclude(const QJsonObject &includeObject,
+                          const QString &type,
+                          const ConfigNodePath &destinationNodePath,
+                          const QDir &workingDir,
+                          const EnvironmentVariables &environmentVariables)
+{
+    ConfigNodePath sourceNodePath = ConfigNodePath::ROOT_PATH;
+    CedarFramework::deserializeOptionalNode(includeObject,
+                                            QStringLiteral("source_node"),
+                                            &sourceNodePath);
+
+    ConfigIncludeGraph::recordInclude(includeFilePath(includeObject,
+                                                      workingDir,
+                                                      environmentVariables),
+                                      type,
+                                      sourceNodePath,
+                                      destinationNodePath);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Converts the reference to the names of the nodes in the absolute node path
+ *
+ * \param   reference       Node path of the reference (absolute or relative to the parent node)
+ * \param   parentNodeNames Names of the nodes in the absolute node path of the parent node
+ *
+ * \param[out]  nodeNames   Names of the nodes in the absolute node path of the referenced node
+ *
+ * \retval  true    Success
+ * \retval  false   Failure (invalid reference)
+ */
+static bool referencedNodeNames(const ConfigNodePath &reference,
+                                const QStringList &parentNodeNames,
+                                QStringList *nodeNames)
+{
+    const ConfigNodePath parentNodePath =
+            parentNodeNames.isEmpty() ? ConfigNodePath::ROOT_PATH
+                                      : ConfigNodePath(QStringLiteral("/") +
+                                                       parentNodeNames.join(QLatin1Char('/')));
+    ConfigNodePath absoluteNodePath = reference.toAbsolute(parentNodePath);
+
+    if ((!absoluteNodePath.isValid()) || (!absoluteNodePath.resolveReferences()))
+    {
+        return false;
+    }
+
+    *nodeNames = absoluteNodePath.isRoot() ? QStringList() : absoluteNodePath.nodeNames();
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if one of the node paths is the same as or contained in the other node path
+ *
+ * \param   left    Names of the nodes in an absolute node path
+ * \param   right   Names of the nodes in an absolute node path
+ *
+ * \retval  true    Node paths overlap
+ * \retval  false   Node paths do not overlap
+ */
+static bool nodePathsOverlap(const QStringList &left, const QStringList &right)
+{
+    const int count = std::min(left.size(), right.size());
+
+    for (int i = 0; i < count; i++)
+    {
+        if (left.at(i) != right.at(i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Finds the nodes in the 'config' member of a configuration file that are reachable from the
+ * source node through references and the bases of derived objects
+ *
+ * The analysis is done on the JSON representation so that the nodes that are not reachable never
+ * have to be read or resolved.
+ */
+class ReachableNodeFinder
+{
+public:
+    /*!
+     * Finds the reachable nodes
+     *
+     * \param   configObject    The 'config' member of the configuration file
+     * \param   sourceNodePath  Absolute node path to the source node
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (a reference could not be analyzed)
+     */
+    bool find(const QJsonObject &configObject, const ConfigNodePath &sourceNodePath)
+    {
+        m_configObject = configObject;
+        m_prunedConfigObject = QJsonObject();
+        m_requiredNodePaths.clear();
+        m_pendingNodePaths.clear();
+        m_visitedNodePaths.clear();
+
+        addRequiredNodePath(sourceNodePath.isRoot() ? QStringList() : sourceNodePath.nodeNames());
+
+        while (!m_pendingNodePaths.empty())
+        {
+            const QStringList nodeNames = m_pendingNodePaths.front();
+            m_pendingNodePaths.pop_front();
+
+            if (!visitNodePath(nodeNames))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /*!
+     * Gets the 'config' member with only the reachable nodes
+     *
+     * \return  Pruned 'config' member
+     */
+    const QJsonObject &prunedConfigObject() const
+    {
+        return m_prunedConfigObject;
+    }
+
+    /*!
+     * Gets the node paths that are needed to get the contents of the source node
+     *
+     * \return  Names of the nodes in the absolute node paths
+     */
+    const std::vector<QStringList> &requiredNodePaths() const
+    {
+        return m_requiredNodePaths;
+    }
+
+private:
+    /*!
+     * Adds a node path that is needed to get the contents of the source node
+     *
+     * \param   nodeNames   Names of the nodes in the absolute node path
+     */
+    void addRequiredNodePath(const QStringList &nodeNames)
+    {
+        const QString key = nodeNames.join(QLatin1Char('/'));
+
+        if (!m_visitedNodePaths.contains(key))
+        {
+            m_visitedNodePaths.insert(key);
+            m_requiredNodePaths.push_back(nodeNames);
+            m_pendingNodePaths.push_back(nodeNames);
+        }
+    }
+
+    /*!
+     * Keeps the members (with all of their decorators) that hold the node at the node path
+     *
+     * \param   nodeNames   Names of the nodes in the absolute node path
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool visitNodePath(const QStringList &nodeNames)
+    {
+        if (nodeNames.isEmpty())
+        {
+            // The whole 'config' member is needed
+            m_prunedConfigObject = m_configObject;
+            return collectObjectReferences(m_configObject, {});
+        }
+
+        QJsonObject object = m_configObject;
+        QStringList parentNodeNames;
+
+        for (int i = 0; i < nodeNames.size(); i++)
+        {
+            const QString &name = nodeNames.at(i);
+            const bool last = (i == (nodeNames.size() - 1));
+            QJsonObject nextObject;
+            bool descend = false;
+
+            for (const QChar decorator : { QChar(), QChar('#'), QChar('$'), QChar('&') })
+            {
+                const QString key = decorator.isNull() ? name : (decorator + name);
+                const auto it = object.constFind(key);
+
+                if (it == object.constEnd())
+                {
+                    continue;
+                }
+
+                if ((!last) && decorator.isNull() && it.value().isObject())
+                {
+                    // Ordinary Object node on the way to the node
+                    nextObject = it.value().toObject();
+                    descend = true;
+                    continue;
+                }
+
+                // The member holds the whole node (or the node is derived from it)
+                keepMember(parentNodeNames, key, it.value());
+
+                if (!collectReferences(key, it.value(), parentNodeNames))
+                {
+                    return false;
+                }
+            }
+
+            if (!descend)
+            {
+                // Rest of the node path (if any) is provided by the includes or external configs
+                break;
+            }
+
+            object = nextObject;
+            parentNodeNames.append(name);
+        }
+
+        return true;
+    }
+
+    /*!
+     * Stores the member in the pruned 'config' member
+     *
+     * \param   parentNodeNames Names of the nodes in the absolute node path of the parent node
+     * \param   key             Member name (with the decorator)
+     * \param   value           Member value
+     */
+    void keepMember(const QStringList &parentNodeNames, const QString &key, const QJsonValue &value)
+    {
+        insertMember(&m_prunedConfigObject, parentNodeNames, 0, key, value);
+    }
+
+    /*!
+     * Stores the member in the JSON Object at the node path
+     *
+     * \param   object          JSON Object
+     * \param   parentNodeNames Names of the nodes in the absolute node path of the parent node
+     * \param   index           Index of the parent node name for the JSON Object
+     * \param   key             Member name (with the decorator)
+     * \param   value           Member value
+     */
+    static void insertMember(QJsonObject *object,
+                             const QStringList &parentNodeNames,
+                             const int index,
+                             const QString &key,
+                             const QJsonValue &value)
+    {
+        if (index == parentNodeNames.size())
+        {
+            object->insert(key, value);
+            return;
+        }
+
+        const QString &name = parentNodeNames.at(index);
+        QJsonObject member = object->value(name).toObject();
+        insertMember(&member, parentNodeNames, index + 1, key, value);
+        object->insert(name, member);
+    }
+
+    /*!
+     * Collects the references in a member
+     *
+     * \param   key             Member name (with the decorator)
+     * \param   value           Member value
+     * \param   parentNodeNames Names of the nodes in the absolute node path of the parent node
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool collectReferences(const QString &key,
+                           const QJsonValue &value,
+                           const QStringList &parentNodeNames)
+    {
+        if (key.startsWith(QLatin1Char('#')) || key.startsWith(QLatin1Char('$')))
+        {
+            // Value nodes cannot contain references
+            return true;
+        }
+
+        if (!key.startsWith(QLatin1Char('&')))
+        {
+            // Ordinary node
+            return value.isObject() ? collectObjectReferences(value.toObject(),
+                                                              parentNodeNames + QStringList(key))
+                                    : true;
+        }
+
+        if (value.isString())
+        {
+            // NodeReference node
+            return addReference(ConfigNodePath(value.toString()), parentNodeNames);
+        }
+
+        if (!value.isObject())
+        {
+            return false;
+        }
+
+        // DerivedObject node
+        const QJsonObject derivedObject = value.toObject();
+        const QJsonValue baseValue = derivedObject.value(QStringLiteral("base"));
+        QJsonArray bases;
+
+        if (baseValue.isString())
+        {
+            bases.append(baseValue);
+        }
+        else if (baseValue.isArray())
+        {
+            bases = baseValue.toArray();
+        }
+        else
+        {
+            return false;
+        }
+
+        for (const auto &base : bases)
+        {
+            if ((!base.isString()) || (!addReference(ConfigNodePath(base.toString()),
+                                                     parentNodeNames)))
+            {
+                return false;
+            }
+        }
+
+        const QJsonValue overrides = derivedObject.value(QStringLiteral("config"));
+
+        return overrides.isObject()
+                ? collectObjectReferences(overrides.toObject(),
+                                          parentNodeNames + QStringList(key.mid(1)))
+                : true;
+    }
+
+    /*!
+     * Collects the references in all members of the JSON Object
+     *
+     * \param   object      JSON Object
+     * \param   nodeNames   Names of the nodes in the absolute node path of the JSON Object
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool collectObjectReferences(const QJsonObject &object, const QStringList &nodeNames)
+    {
+        for (auto it = object.begin(); it != object.end(); it++)
+        {
+            if (!collectReferences(it.key(), it.value(), nodeNames))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /*!
+     * Adds the referenced node to the required nodes
+     *
+     * \param   reference       Node path of the reference
+     * \param   parentNodeNames Names of the nodes in the absolute node path of the parent node
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool addReference(const ConfigNodePath &reference, const QStringList &parentNodeNames)
+    {
+        QStringList nodeNames;
+
+        if (!referencedNodeNames(reference, parentNodeNames, &nodeNames))
+        {
+            return false;
+        }
+
+        addRequiredNodePath(nodeNames);
+        return true;
+    }
+
+private:
+    //! The 'config' member of the configuration file
+    QJsonObject m_configObject;
+
+    //! The 'config' member with only the reachable nodes
+    QJsonObject m_prunedConfigObject;
+
+    //! Node paths that are needed to get the contents of the source node
+    std::vector<QStringList> m_requiredNodePaths;
+
+    //! Node paths that still need to be visited
+    std::deque<QStringList> m_pendingNodePaths;
+
+    //! Node paths that were already added
+    QSet<QString> m_visitedNodePaths;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if an include can contribute to any of the required nodes
+ *
+ * \param   includeObject       Include JSON Object
+ * \param   requiredNodePaths   Names of the nodes in the absolute node paths of the required nodes
+ *
+ * \retval  true    Include can contribute (or its destination node is invalid so the include has
+ *                  to be read to report the error)
+ * \retval  false   Include cannot contribute to any of the required nodes
+ */
+static bool includeCanContribute(const QJsonObject &includeObject,
+                                 const std::vector<QStringList> &requiredNodePaths)
+{
+    auto destinationNodePath = ConfigNodePath::ROOT_PATH;
+
+    if ((!CedarFramework::deserializeOptionalNode(includeObject,
+                                                  QStringLiteral("destination_node"),
+                                                  &destinationNodePath)) ||
+        destinationNodePath.isRelative() ||
+        (!destinationNodePath.isValid()) ||
+        destinationNodePath.isRoot())
+    {
+        return true;
+    }
+
+    QStringList destinationNodeNames;
+
+    if (!referencedNodeNames(destinationNodePath, {}, &destinationNodeNames))
+    {
+        return true;
+    }
+
+    for (const auto &requiredNodePath : requiredNodePaths)
+    {
+        if (nodePathsOverlap(destinationNodeNames, requiredNodePath))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Reads the bases of a derived object from the value of its 'base' member
+ *
+ * \param   baseValue       Value of the 'base' member (undefined if it is missing)
+ * \param   currentNodePath Current node path
+ *
+ * \param[out]  bases   Output for the node paths of the bases
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+static bool readDerivedObjectBases(const QJsonValue &baseValue,
+                                   const ConfigNodePath &currentNodePath,
+                                   QList<ConfigNodePath> *bases)
+{
+    if (baseValue.isUndefined())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "A derived object doesn't have the 'base' member at path:"
+                << currentNodePath.path();
+        return false;
+    }
+
+    bases->clear();
+
+    if (baseValue.isString())
+    {
+        // Single base
+        bases->append(ConfigNodePath(baseValue.toString()));
+    }
+    else if (baseValue.isArray())
+    {
+        for (const auto &item : baseValue.toArray())
+        {
+            if (!item.isString())
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Unsupported JSON type for an item in the 'base' member at path:"
+                        << currentNodePath.path();
+                return false;
+            }
+
+            bases->append(ConfigNodePath(item.toString()));
+        }
+
+        if (bases->isEmpty())
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "The 'base' member is empty at path:" << currentNodePath.path();
+            return false;
+        }
+    }
+    else
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Unsupported JSON type for an item in the 'base' member at path:"
+                << currentNodePath.path();
+        return false;
+    }
+
+    for (const auto &item : *bases)
+    {
+        if (!item.toAbsolute(currentNodePath).isValid())
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("Invalid node path in base item at path:"
+                               "\n    base item's node path: %1"
+                               "\n    node path: %2")
+                       .arg(item.path(), currentNodePath.path());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         const QString &filePath,
         const QDir &workingDir,
@@ -56,6 +1953,12 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         const std::vector<const ConfigObjectNode *> &externalConfigs,
         EnvironmentVariables *environmentVariables) const
 {
+    // Log the read statistics (if enabled)
+    const ConfigReadStatistics::LogScope statisticsScope(filePath);
+
+    // Allocate all of the read nodes from an arena (if enabled)
+    const ConfigNodeArena::Scope arenaScope(m_arenaAllocationEnabled);
+
     // Make sure that file path is not empty
     if (filePath.isEmpty())
     {
@@ -63,27 +1966,32 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         return {};
     }
 
+    // Check if the read was canceled
+    if (ConfigReadOperation::isCurrentCanceled())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Reading of the config file was canceled:" << filePath;
+        return {};
+    }
+
     // Expand references to environment variables in the file path
-    const QString expandedFilePath = environmentVariables->expandText(filePath);
+    EnvironmentVariables::ExpansionError expansionError;
+    const QString expandedFilePath = environmentVariables->expandText(filePath, &expansionError);
 
     if (expandedFilePath.isEmpty())
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Failed to expand file path:" << filePath;
+                << "Failed to expand file path:" << filePath
+                << "Error:" << expansionError.toString();
         return {};
     }
 
     // Prepare absolute path to the file using the working path if needed
-    QString absoluteFilePath;
+    const QString absoluteFilePath = makeAbsoluteFilePath(expandedFilePath, workingDir);
 
-    if (QDir::isAbsolutePath(expandedFilePath))
-    {
-        absoluteFilePath = QDir::cleanPath(expandedFilePath);
-    }
-    else
-    {
-        absoluteFilePath = QDir::cleanPath(workingDir.absoluteFilePath(expandedFilePath));
-    }
+    // Record the file in the include graph (if one is being recorded) even if it does not exist so
+    // that its creation can also be detected
+    const ConfigIncludeGraph::FileScope fileScope(absoluteFilePath);
 
     // Open file
     if (!QFile::exists(absoluteFilePath))
@@ -93,6 +2001,35 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         return {};
     }
 
+    // Check if the file was already read
+    auto *cache = ConfigFileCache::instance();
+    const bool cacheEnabled = cache->isEnabled();
+    ConfigFileCache::FileKey fileKey;
+    fileKey.absoluteFilePath = absoluteFilePath;
+    QJsonObject rootObject;
+
+    if (cacheEnabled)
+    {
+        fileKey = ConfigFileCache::FileKey::fromFile(absoluteFilePath);
+
+        if (cache->findFile(fileKey, &rootObject))
+        {
+            auto config = readFileContents(rootObject,
+                                           fileKey,
+                                           sourceNodePath,
+                                           destinationNodePath,
+                                           externalConfigs,
+                                           environmentVariables);
+
+            if (config)
+            {
+                ConfigReadStatistics::recordTree(*config);
+            }
+
+            return config;
+        }
+    }
+
     QFile file(absoluteFilePath);
 
     if (!file.open(QIODevice::ReadOnly))
@@ -103,30 +2040,35 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
     }
 
     // Read the contents (JSON format)
+    const QByteArray fileContents = ConfigReaderBase::readFileData(&file);
+
+    // Parse the contents straight into nodes (if enabled and the parsed JSON Object is not needed)
+    if (m_streamingParsingEnabled &&
+        (!cacheEnabled) &&
+        (!m_lazyMaterializationEnabled) &&
+        ((!m_sourceNodePruningEnabled) || sourceNodePath.isRoot()))
+    {
+        auto config = readStreamedFileContents(fileContents,
+                                               absoluteFilePath,
+                                               sourceNodePath,
+                                               destinationNodePath,
+                                               externalConfigs,
+                                               environmentVariables);
+
+        if (config)
+        {
+            ConfigReadStatistics::recordTree(*config);
+        }
+
+        return config;
+    }
+
     QJsonParseError jsonParseError {};
-    const QByteArray fileContents = file.readAll();
-    const auto doc = QJsonDocument::fromJson(fileContents, &jsonParseError);
+    const auto doc = parseFileContents(fileContents, &jsonParseError);
 
     if (jsonParseError.error != QJsonParseError::NoError)
     {
-        constexpr int contextMaxLength = 20;
-        const int contextBeforeIndex = std::max(0, jsonParseError.offset - contextMaxLength);
-        const int contextBeforeLength = std::min(jsonParseError.offset, contextMaxLength);
-
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << QString("Failed to parse the file contents:"
-                           "\n    file path: %1"
-                           "\n    offset: %2"
-                           "\n    error: [%3]"
-                           "\n    context before error: [%4]"
-                           "\n    context at error: [%5]")
-                   .arg(absoluteFilePath,
-                        QString::number(jsonParseError.offset),
-                        jsonParseError.errorString(),
-                        QString::fromUtf8(fileContents.mid(contextBeforeIndex,
-                                                           contextBeforeLength)),
-                        QString::fromUtf8(fileContents.mid(jsonParseError.offset,
-                                                           contextMaxLength)));
+        logParseError(absoluteFilePath, fileContents, jsonParseError);
         return {};
     }
 
@@ -137,16 +2079,184 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         return {};
     }
 
+    rootObject = doc.object();
+
+    if (cacheEnabled)
+    {
+        cache->storeFile(fileKey, rootObject);
+    }
+
     // Read the config
-    auto config = read(doc.object(),
-                       QFileInfo(absoluteFilePath).absoluteDir(),
-                       sourceNodePath,
-                       destinationNodePath,
-                       externalConfigs,
-                       environmentVariables);
+    auto config = readFileContents(rootObject,
+                                   fileKey,
+                                   sourceNodePath,
+                                   destinationNodePath,
+                                   externalConfigs,
+                                   environmentVariables);
+
+    if (config)
+    {
+        ConfigReadStatistics::recordTree(*config);
+    }
+
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::read(
+        const QJsonObject &configObject,
+        const QDir &workingDir,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables) const
+{
+    // Log the read statistics (if enabled)
+    const ConfigReadStatistics::LogScope statisticsScope(QStringLiteral("JSON Object"));
+
+    // Allocate all of the read nodes from an arena (if enabled)
+    const ConfigNodeArena::Scope arenaScope(m_arenaAllocationEnabled);
+
+    auto config = readConfigObject(configObject,
+                                   workingDir,
+                                   sourceNodePath,
+                                   destinationNodePath,
+                                   externalConfigs,
+                                   environmentVariables,
+                                   nullptr,
+                                   nullptr);
+
+    if (config)
+    {
+        ConfigReadStatistics::recordTree(*config);
+    }
+
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readFileContents(
+        const QJsonObject &rootObject,
+        const ConfigFileCache::FileKey &fileKey,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables) const
+{
+    auto config = readConfigObject(rootObject,
+                                   QFileInfo(fileKey.absoluteFilePath).absoluteDir(),
+                                   sourceNodePath,
+                                   destinationNodePath,
+                                   externalConfigs,
+                                   environmentVariables,
+                                   (fileKey.size >= 0) ? &fileKey : nullptr,
+                                   nullptr);
+
+    if (!config)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to read config file:" << fileKey.absoluteFilePath;
+        return {};
+    }
+
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readStreamedFileContents(
+        const QByteArray &fileContents,
+        const QString &absoluteFilePath,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables) const
+{
+    // Check the whole file for syntax errors and parse the 'environment_variables' and 'includes'
+    // members. The 'config' member is only skipped since its nodes can be read only after the
+    // includes (they can set the environment variables that are needed for the '$' decorator).
+    JsonStreamParser parser(fileContents, absoluteFilePath);
+    QJsonObject rootObject;
+    int configOffset = 0;
+    bool configIsObject = false;
+
+    {
+        const ConfigReadStatistics::PhaseTimer phaseTimer(
+                ConfigReadStatistics::Phase::JsonParsing);
+
+        if (parser.nextValueType() == QJsonValue::Array)
+        {
+            if (parser.skipValue() && parser.readEnd())
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Config file does not contain a JSON object:" << absoluteFilePath;
+                return {};
+            }
+        }
+        else if (parser.beginObject())
+        {
+            QString memberName;
+
+            while (parser.nextMember(&memberName))
+            {
+                if ((memberName == QStringLiteral("config")) &&
+                    (parser.nextValueType() == QJsonValue::Object))
+                {
+                    rootObject.remove(memberName);
+                    configOffset = parser.offset();
+                    configIsObject = true;
+                    parser.skipValue();
+                }
+                else if ((memberName == QStringLiteral("config")) ||
+                         (memberName == QStringLiteral("environment_variables")) ||
+                         (memberName == QStringLiteral("includes")))
+                {
+                    QJsonValue value;
+
+                    if (parser.readValue(&value))
+                    {
+                        rootObject.insert(memberName, value);
+                    }
+
+                    if (memberName == QStringLiteral("config"))
+                    {
+                        // A 'config' member that is not a JSON Object is handled (or reported) by
+                        // readConfigMember()
+                        configIsObject = false;
+                    }
+                }
+                else
+                {
+                    parser.skipValue();
+                }
+            }
+
+            parser.readEnd();
+        }
+
+        if (parser.hasError())
+        {
+            parser.logError();
+            return {};
+        }
+    }
+
+    // Read the config with the 'config' member read straight from the file contents
+    JsonStreamParser configParser(fileContents, absoluteFilePath, configOffset);
+    auto config = readConfigObject(rootObject,
+                                   QFileInfo(absoluteFilePath).absoluteDir(),
+                                   sourceNodePath,
+                                   destinationNodePath,
+                                   externalConfigs,
+                                   environmentVariables,
+                                   nullptr,
+                                   configIsObject ? &configParser : nullptr);
 
     if (!config)
     {
+        configParser.logError();
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << "Failed to read config file:" << absoluteFilePath;
         return {};
@@ -157,14 +2267,23 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
 
 // -------------------------------------------------------------------------------------------------
 
-std::unique_ptr<ConfigObjectNode> ConfigReader::read(
+std::unique_ptr<ConfigObjectNode> ConfigReader::readConfigObject(
         const QJsonObject &configObject,
         const QDir &workingDir,
         const ConfigNodePath &sourceNodePath,
         const ConfigNodePath &destinationNodePath,
         const std::vector<const ConfigObjectNode *> &externalConfigs,
-        EnvironmentVariables *environmentVariables) const
+        EnvironmentVariables *environmentVariables,
+        const ConfigFileCache::FileKey *fileKey,
+        JsonStreamParser *configParser) const
 {
+    // Check if the read was canceled
+    if (ConfigReadOperation::isCurrentCanceled())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader) << "Reading was canceled";
+        return {};
+    }
+
     // Validate source node path
     if ((!sourceNodePath.isAbsolute()) ||
         (!sourceNodePath.isValid()))
@@ -210,10 +2329,30 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         return {};
     }
 
+    // Find the nodes that are reachable from the source node (if enabled) so that only they are
+    // read (the pruned 'config' member is not stored in the file cache)
+    ReachableNodeFinder reachableNodeFinder;
+    const QJsonValue configValue = configObject.value(QStringLiteral("config"));
+    const bool pruned = m_sourceNodePruningEnabled &&
+                        (!sourceNodePath.isRoot()) &&
+                        configValue.isObject() &&
+                        reachableNodeFinder.find(configValue.toObject(), sourceNodePath);
+
+    QJsonObject prunedConfigObject;
+
+    if (pruned)
+    {
+        prunedConfigObject = configObject;
+        prunedConfigObject.insert(QStringLiteral("config"),
+                                  reachableNodeFinder.prunedConfigObject());
+    }
+
     // Read 'includes' member
     auto completeConfig = readIncludesMember(configObject,
                                              workingDir,
                                              externalConfigs,
+                                             pruned ? &reachableNodeFinder.requiredNodePaths()
+                                                    : nullptr,
                                              environmentVariables);
 
     if (!completeConfig)
@@ -236,10 +2375,12 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
     setCurrentDirectory(workingDir, environmentVariables);
 
     // Read 'config' member
-    auto configMember = readConfigMember(configObject,
+    auto configMember = readConfigMember(pruned ? prunedConfigObject : configObject,
                                          externalConfigs,
                                          *completeConfig,
-                                         *environmentVariables);
+                                         *environmentVariables,
+                                         pruned ? nullptr : fileKey,
+                                         configParser);
 
     if (!configMember)
     {
@@ -257,7 +2398,10 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
     }
 
     // Apply the overloads from 'config' member to the read configuration
-    completeConfig->apply(*configMember);
+    {
+        const ConfigReadStatistics::PhaseTimer phaseTimer(ConfigReadStatistics::Phase::Apply);
+        completeConfig->apply(std::move(*configMember));
+    }
 
     // Transform the configuration node based on source and destination node paths
     auto transformedConfig = transformConfig(std::move(completeConfig),
@@ -312,13 +2456,108 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         return {};
     }
 
-    // Read the configuration file
-    return read(filePath,
-                workingDir,
-                sourceNodePath,
-                destinationNodePath,
-                externalConfigs,
-                environmentVariables);
+    // Read the configuration file
+    return read(filePath,
+                workingDir,
+                sourceNodePath,
+                destinationNodePath,
+                externalConfigs,
+                environmentVariables);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::shared_ptr<ConfigReadOperation> ConfigReader::readAsync(
+        const QString &filePath,
+        const QDir &workingDir,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        const EnvironmentVariables &environmentVariables,
+        ReadCallback callback) const
+{
+    auto operation = std::make_shared<ConfigReadOperation>();
+
+    QThreadPool::globalInstance()->start(new ReadConfigTask(*this,
+                                                            filePath,
+                                                            workingDir,
+                                                            sourceNodePath,
+                                                            destinationNodePath,
+                                                            externalConfigs,
+                                                            environmentVariables,
+                                                            std::move(callback),
+                                                            operation));
+    return operation;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::parallelIncludesEnabled() const
+{
+    return m_parallelIncludesEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setParallelIncludesEnabled(const bool enabled)
+{
+    m_parallelIncludesEnabled = enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::arenaAllocationEnabled() const
+{
+    return m_arenaAllocationEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setArenaAllocationEnabled(const bool enabled)
+{
+    m_arenaAllocationEnabled = enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::lazyMaterializationEnabled() const
+{
+    return m_lazyMaterializationEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setLazyMaterializationEnabled(const bool enabled)
+{
+    m_lazyMaterializationEnabled = enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::sourceNodePruningEnabled() const
+{
+    return m_sourceNodePruningEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setSourceNodePruningEnabled(const bool enabled)
+{
+    m_sourceNodePruningEnabled = enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::streamingParsingEnabled() const
+{
+    return m_streamingParsingEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setStreamingParsingEnabled(const bool enabled)
+{
+    m_streamingParsingEnabled = enabled;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -369,6 +2608,7 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readIncludesMember(
         const QJsonObject &rootObject,
         const QDir &workingDir,
         const std::vector<const ConfigObjectNode *> &externalConfigs,
+        const std::vector<QStringList> *requiredNodePaths,
         EnvironmentVariables *environmentVariables) const
 {
     // Read included configurations
@@ -392,8 +2632,36 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readIncludesMember(
                                    externalConfigs.begin(),
                                    externalConfigs.end());
 
+    // Find the includes that could be skipped since they cannot contribute to any of the required
+    // nodes (if pruned). A later include can reference the nodes of an earlier include, so only the
+    // trailing includes (that are not followed by an include that is read) are considered.
+    std::vector<bool> skippableIncludes(static_cast<size_t>(includes.size()), false);
+
+    if (requiredNodePaths != nullptr)
+    {
+        for (int i = includes.size() - 1; i >= 0; i--)
+        {
+            if (includeCanContribute(includes.at(i), *requiredNodePaths))
+            {
+                break;
+            }
+
+            skippableIncludes[static_cast<size_t>(i)] = true;
+        }
+    }
+
+    // Read and parse the included configuration files concurrently (if enabled)
+    const auto preReadIncludeFiles = preReadIncludes(includes, workingDir, *environmentVariables);
+
     for (int i = 0; i < includes.size(); i++)
     {
+        if (ConfigReadOperation::isCurrentCanceled())
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Reading of the includes was canceled";
+            return {};
+        }
+
         const auto &includeObject = includes.at(i);
 
         // Extract configuration file type
@@ -441,15 +2709,92 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readIncludesMember(
         // Update current directory environment variable
         setCurrentDirectory(workingDir, environmentVariables);
 
-        // Read config file
-        // TODO: limit the includes depth to prevent an endless include loop?
-        auto config = ConfigReaderRegistry::instance()->readConfig(
+        if (ConfigIncludeGraph::isRecording())
+        {
+            recordInclude(includeObject,
                           type,
-                          workingDir,
                           destinationNodePath,
-                          includeObject,
-                          extendedExternalConfigs,
-                          environmentVariables);
+                          workingDir,
+                          *environmentVariables);
+        }
+
+        const PreReadIncludeFile *preReadIncludeFile =
+                (static_cast<size_t>(i) < preReadIncludeFiles.size()) ? &preReadIncludeFiles[i]
+                                                                      : nullptr;
+
+        // Skip the include if it cannot contribute to any of the required nodes and reading it
+        // would not have any other effect (the file is loaded to check that it does not set any
+        // environment variables, a file that cannot be loaded is read the regular way to report
+        // the error)
+        PreReadIncludeFile loadedIncludeFile;
+
+        if (skippableIncludes[static_cast<size_t>(i)])
+        {
+            loadedIncludeFile.absoluteFilePath = includeAbsoluteFilePath(includeObject,
+                                                                         workingDir,
+                                                                         *environmentVariables);
+
+            if ((!loadedIncludeFile.absoluteFilePath.isEmpty()) &&
+                loadIncludeRootObject(loadedIncludeFile.absoluteFilePath,
+                                      preReadIncludeFile,
+                                      &loadedIncludeFile.rootObject))
+            {
+                if (!includeHasSideEffects(loadedIncludeFile.rootObject))
+                {
+                    continue;
+                }
+
+                loadedIncludeFile.valid = true;
+                preReadIncludeFile = &loadedIncludeFile;
+            }
+        }
+
+        // Read config file
+        // TODO: limit the includes depth to prevent an endless include loop?
+        std::unique_ptr<ConfigObjectNode> config;
+
+        {
+            const ConfigReadStatistics::IncludeTimer includeTimer(
+                    type,
+                    ConfigReadStatistics::isRecording()
+                    ? includeFilePath(includeObject, workingDir, *environmentVariables)
+                    : QString());
+
+            if ((preReadIncludeFile != nullptr) &&
+                preReadIncludeFile->valid &&
+                (includeAbsoluteFilePath(includeObject, workingDir, *environmentVariables) ==
+                 preReadIncludeFile->absoluteFilePath))
+            {
+                // The file was already read and parsed (the file path is checked again since the
+                // previous includes could have changed the environment variables used in it)
+                config = readPreReadInclude(preReadIncludeFile->absoluteFilePath,
+                                            preReadIncludeFile->rootObject,
+                                            includeObject,
+                                            destinationNodePath,
+                                            extendedExternalConfigs,
+                                            environmentVariables);
+            }
+            else if ((m_sourceNodePruningEnabled || m_streamingParsingEnabled) &&
+                     (type == QStringLiteral("CppConfigFramework")))
+            {
+                // Read with this instance so that the nested includes are pruned (or parsed
+                // straight into nodes) too
+                config = read(workingDir,
+                              destinationNodePath,
+                              includeObject,
+                              extendedExternalConfigs,
+                              environmentVariables);
+            }
+            else
+            {
+                config = ConfigReaderRegistry::instance()->readConfig(type,
+                                                                      workingDir,
+                                                                      destinationNodePath,
+                                                                      includeObject,
+                                                                      extendedExternalConfigs,
+                                                                      environmentVariables);
+            }
+        }
 
         if (!config)
         {
@@ -459,7 +2804,8 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readIncludesMember(
         }
 
         // Apply the config file contents to the "includes" configuration node
-        includesConfig->apply(*config);
+        const ConfigReadStatistics::PhaseTimer phaseTimer(ConfigReadStatistics::Phase::Apply);
+        includesConfig->apply(std::move(*config));
     }
 
     return includesConfig;
@@ -467,40 +2813,179 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readIncludesMember(
 
 // -------------------------------------------------------------------------------------------------
 
-std::unique_ptr<ConfigObjectNode> ConfigReader::readConfigMember(
-        const QJsonObject &rootObject,
-        const std::vector<const ConfigObjectNode *> &externalConfigs,
-        const ConfigObjectNode &includesConfig,
+std::vector<PreReadIncludeFile> ConfigReader::preReadIncludes(
+        const QVector<QJsonObject> &includes,
+        const QDir &workingDir,
         const EnvironmentVariables &environmentVariables) const
 {
-    // The root object must contain the 'config' member (but it can be an empty object)
-    const auto configValue = rootObject.value(QStringLiteral("config"));
+    if ((!m_parallelIncludesEnabled) || (includes.size() < 2))
+    {
+        return {};
+    }
+
+    // The file paths are expanded with a snapshot of the environment variables as they will be
+    // when processing the first include so that the shared state is not modified
+    EnvironmentVariables environmentVariablesSnapshot = environmentVariables;
+    setCurrentDirectory(workingDir, &environmentVariablesSnapshot);
 
-    if (configValue.isNull())
+    std::vector<PreReadIncludeFile> includeFiles(static_cast<size_t>(includes.size()));
+    QSemaphore finished;
+    int taskCount = 0;
+
+    for (int i = 0; i < includes.size(); i++)
     {
-        // No configuration
-        return std::make_unique<ConfigObjectNode>();
+        auto &includeFile = includeFiles[static_cast<size_t>(i)];
+        includeFile.absoluteFilePath = includeAbsoluteFilePath(includes.at(i),
+                                                               workingDir,
+                                                               environmentVariablesSnapshot);
+
+        if (!includeFile.absoluteFilePath.isEmpty())
+        {
+            // When there is no free thread in the thread pool the file is pre-read on this thread
+            // (it could be a thread pool thread itself, for example in an asynchronous read)
+            auto task = std::make_unique<PreReadIncludeFileTask>(&includeFile, &finished);
+
+            if (QThreadPool::globalInstance()->tryStart(task.get()))
+            {
+                task.release();
+            }
+            else
+            {
+                task->run();
+            }
+
+            taskCount++;
+        }
     }
 
-    if (!configValue.isObject())
+    finished.acquire(taskCount);
+    return includeFiles;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readPreReadInclude(
+        const QString &absoluteFilePath,
+        const QJsonObject &fileObject,
+        const QJsonObject &includeObject,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables) const
+{
+    // Extract source node
+    ConfigNodePath sourceNodePath = ConfigNodePath::ROOT_PATH;
+
+    if (!CedarFramework::deserializeOptionalNode(includeObject,
+                                                 QStringLiteral("source_node"),
+                                                 &sourceNodePath))
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "The 'config' member in the root JSON Object is not a JSON Object!";
+                << "The 'source_node' parameter is invalid";
         return {};
     }
 
-    // Read 'config' object
-    auto config = readObjectNode(configValue.toObject(),
-                                 ConfigNodePath::ROOT_PATH,
-                                 environmentVariables);
+    // Read the config
+    const ConfigIncludeGraph::FileScope fileScope(absoluteFilePath);
+    auto config = read(fileObject,
+                       QFileInfo(absoluteFilePath).absoluteDir(),
+                       sourceNodePath,
+                       destinationNodePath,
+                       externalConfigs,
+                       environmentVariables);
 
     if (!config)
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Failed to read the 'config' member in the root JSON Object!";
+                << "Failed to read config file:" << absoluteFilePath;
         return {};
     }
 
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readConfigMember(
+        const QJsonObject &rootObject,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        const ConfigObjectNode &includesConfig,
+        const EnvironmentVariables &environmentVariables,
+        const ConfigFileCache::FileKey *fileKey,
+        JsonStreamParser *configParser) const
+{
+    std::unique_ptr<ConfigObjectNode> config;
+
+    if (configParser != nullptr)
+    {
+        // Read 'config' object straight from the file contents (the file cache is not used)
+        const ConfigReadStatistics::PhaseTimer phaseTimer(
+                ConfigReadStatistics::Phase::ReadObjectNode);
+        config = readObjectNode(configParser, ConfigNodePath::ROOT_PATH, environmentVariables);
+
+        if (!config)
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Failed to read the 'config' member in the root JSON Object!";
+            return {};
+        }
+    }
+    else
+    {
+        // The root object must contain the 'config' member (but it can be an empty object)
+        const auto configValue = rootObject.value(QStringLiteral("config"));
+
+        if (configValue.isNull())
+        {
+            // No configuration
+            return std::make_unique<ConfigObjectNode>();
+        }
+
+        if (!configValue.isObject())
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "The 'config' member in the root JSON Object is not a JSON Object!";
+            return {};
+        }
+
+        // Read 'config' object (the cached one can be used only if it was read from the same file
+        // with the same values of the referenced environment variables)
+        auto *cache = ConfigFileCache::instance();
+
+        if (fileKey != nullptr)
+        {
+            config = cache->findConfig(*fileKey, environmentVariables);
+        }
+
+        if (!config)
+        {
+            // Record the environment variables that are looked up while reading the config since
+            // the cached config is valid only for as long as their values are not changed
+            QHash<QString, QString> dependencies;
+
+            {
+                const ConfigReadStatistics::PhaseTimer phaseTimer(
+                        ConfigReadStatistics::Phase::ReadObjectNode);
+                const EnvironmentVariables::LookupRecordScope lookupRecordScope(&dependencies);
+                config = readObjectNode(configValue.toObject(),
+                                        ConfigNodePath::ROOT_PATH,
+                                        environmentVariables,
+                                        m_lazyMaterializationEnabled);
+            }
+
+            if (!config)
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Failed to read the 'config' member in the root JSON Object!";
+                return {};
+            }
+
+            if (fileKey != nullptr)
+            {
+                cache->storeConfig(*fileKey, *config, std::move(dependencies));
+            }
+        }
+    }
+
     // Extend the external configs with the includesConfig
     std::vector<const ConfigObjectNode *> extendedExternalConfigs;
     extendedExternalConfigs.reserve(externalConfigs.size() + 1U);
@@ -509,40 +2994,190 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readConfigMember(
                                    externalConfigs.begin(),
                                    externalConfigs.end());
 
-    // Resolve references
-    if (!resolveReferences(extendedExternalConfigs, config.get()))
-    {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Failed to resolve references!";
-        return {};
-    }
+    // Resolve references
+    if (!resolveReferences(extendedExternalConfigs, config.get()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to resolve references!";
+        return {};
+    }
+
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigValueNode> ConfigReader::readValueNode(const QJsonValue &jsonValue,
+                                                             const ConfigNodePath &currentNodePath)
+{
+    Q_UNUSED(currentNodePath)
+
+    return std::make_unique<ConfigValueNode>(jsonValue);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
+        const QJsonObject &jsonObject,
+        const ConfigNodePath &currentNodePath,
+        const EnvironmentVariables &environmentVariables,
+        const bool lazy)
+{
+    auto objectNode = std::make_unique<ConfigObjectNode>();
+
+    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    {
+        QString memberName = it.key();
+
+        // Check for "decorators" in the member name (reference type or Value node)
+        QChar decorator;
+
+        if (hasDecorator(memberName))
+        {
+            decorator = memberName.at(0);
+            memberName = memberName.mid(1);
+        }
+
+        // Validate member name
+        if (!ConfigNodePath::validateNodeName(memberName))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("Invalid member name [%1] in path [%2]")
+                       .arg(memberName, currentNodePath.path());
+            return {};
+        }
+
+        // Create a node based considering the decorator
+        std::unique_ptr<ConfigNode> memberNode;
+        const ConfigNodePath memberNodePath = currentNodePath.append(memberName);
+
+        switch (decorator.toLatin1())
+        {
+            case '#':
+            {
+                // Explicit Value node (even if it is a JSON Object type)
+                memberNode = readValueNode(it.value(), memberNodePath);
+                Q_ASSERT(memberNode);
+                break;
+            }
+
+            case '$':
+            {
+                // Explicit Value node (even if it is a JSON Array or Object type) where references
+                // to environment variables in the value are resolved
+                const QJsonValue resolvedValue = resolveJsonValue(it.value(), environmentVariables);
+
+                if (resolvedValue.isUndefined())
+                {
+                    qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                            << "Failed to resolve a Value node with references to "
+                               "environment variables:"
+                               "\n    member node path:" << memberNodePath.path();
+                    return {};
+                }
+
+                memberNode = readValueNode(resolvedValue, memberNodePath);
+                Q_ASSERT(memberNode);
+                break;
+            }
+
+            case '&':
+            {
+                // One of the reference types
+                if (it.value().isString())
+                {
+                    memberNode = readNodeReferenceNode(it.value().toString(), memberNodePath);
+
+                    if (!memberNode)
+                    {
+                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                                << "Failed to read the a NodeReference node member:"
+                                   "\n    member node path:" << memberNodePath.path();
+                        return {};
+                    }
+                }
+                else if (it.value().isObject())
+                {
+                    memberNode = readDerivedObjectNode(it.value().toObject(),
+                                                       memberNodePath,
+                                                       environmentVariables);
+
+                    if (!memberNode)
+                    {
+                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                                << "Failed to read the a NodeReference node member:"
+                                   "\n    member node path:" << memberNodePath.path();
+                        return {};
+                    }
+                }
+                else
+                {
+                    qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                            << "Unsupported reference type at path:" << memberNodePath.path();
+                    return {};
+                }
+                break;
+            }
 
-    return config;
-}
+            default:
+            {
+                // No decorators, just an ordinary node
+                if (it.value().isObject() && lazy && canReadLazily(it.value().toObject()))
+                {
+                    // Subtree does not need to be resolved so it is read on the first access
+                    auto lazyNode = std::make_unique<ConfigObjectNode>();
+                    lazyNode->setLazyMembers(it.value().toObject(), &ConfigReader::readLazyMembers);
+                    memberNode = std::move(lazyNode);
+                }
+                else if (it.value().isObject())
+                {
+                    memberNode = readObjectNode(it.value().toObject(),
+                                                memberNodePath,
+                                                environmentVariables,
+                                                lazy);
 
-// -------------------------------------------------------------------------------------------------
+                    if (!memberNode)
+                    {
+                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                                << "Failed to read the an ordinary Object node member:"
+                                   "\n    member node path:" << memberNodePath.path();
+                        return {};
+                    }
+                }
+                else
+                {
+                    memberNode = readValueNode(it.value(), memberNodePath);
+                    Q_ASSERT(memberNode);
+                }
+                break;
+            }
+        }
 
-std::unique_ptr<ConfigValueNode> ConfigReader::readValueNode(const QJsonValue &jsonValue,
-                                                             const ConfigNodePath &currentNodePath)
-{
-    Q_UNUSED(currentNodePath)
+        // Add member to the object
+        Q_ASSERT(memberNode);
+        objectNode->setMember(memberName, std::move(memberNode));
+    }
 
-    return std::make_unique<ConfigValueNode>(jsonValue);
+    return objectNode;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
-        const QJsonObject &jsonObject,
+        JsonStreamParser *parser,
         const ConfigNodePath &currentNodePath,
         const EnvironmentVariables &environmentVariables)
 {
+    if (!parser->beginObject())
+    {
+        return {};
+    }
+
     auto objectNode = std::make_unique<ConfigObjectNode>();
+    QString memberName;
 
-    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    while (parser->nextMember(&memberName))
     {
-        QString memberName = it.key();
-
         // Check for "decorators" in the member name (reference type or Value node)
         QChar decorator;
 
@@ -570,7 +3205,14 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
             case '#':
             {
                 // Explicit Value node (even if it is a JSON Object type)
-                memberNode = readValueNode(it.value(), memberNodePath);
+                QJsonValue value;
+
+                if (!parser->readValue(&value))
+                {
+                    return {};
+                }
+
+                memberNode = readValueNode(value, memberNodePath);
                 Q_ASSERT(memberNode);
                 break;
             }
@@ -579,7 +3221,14 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
             {
                 // Explicit Value node (even if it is a JSON Array or Object type) where references
                 // to environment variables in the value are resolved
-                const QJsonValue resolvedValue = resolveJsonValue(it.value(), environmentVariables);
+                QJsonValue value;
+
+                if (!parser->readValue(&value))
+                {
+                    return {};
+                }
+
+                const QJsonValue resolvedValue = resolveJsonValue(value, environmentVariables);
 
                 if (resolvedValue.isUndefined())
                 {
@@ -598,31 +3247,24 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
             case '&':
             {
                 // One of the reference types
-                if (it.value().isString())
+                const auto valueType = parser->nextValueType();
+
+                if (valueType == QJsonValue::String)
                 {
-                    memberNode = readNodeReferenceNode(it.value().toString(), memberNodePath);
+                    QString reference;
 
-                    if (!memberNode)
+                    if (!parser->readString(&reference))
                     {
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << "Failed to read the a NodeReference node member:"
-                                   "\n    member node path:" << memberNodePath.path();
                         return {};
                     }
+
+                    memberNode = readNodeReferenceNode(reference, memberNodePath);
                 }
-                else if (it.value().isObject())
+                else if (valueType == QJsonValue::Object)
                 {
-                    memberNode = readDerivedObjectNode(it.value().toObject(),
+                    memberNode = readDerivedObjectNode(parser,
                                                        memberNodePath,
                                                        environmentVariables);
-
-                    if (!memberNode)
-                    {
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << "Failed to read the a NodeReference node member:"
-                                   "\n    member node path:" << memberNodePath.path();
-                        return {};
-                    }
                 }
                 else
                 {
@@ -630,17 +3272,23 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
                             << "Unsupported reference type at path:" << memberNodePath.path();
                     return {};
                 }
+
+                if (!memberNode)
+                {
+                    qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                            << "Failed to read the a NodeReference node member:"
+                               "\n    member node path:" << memberNodePath.path();
+                    return {};
+                }
                 break;
             }
 
             default:
             {
                 // No decorators, just an ordinary node
-                if (it.value().isObject())
+                if (parser->nextValueType() == QJsonValue::Object)
                 {
-                    memberNode = readObjectNode(it.value().toObject(),
-                                                memberNodePath,
-                                                environmentVariables);
+                    memberNode = readObjectNode(parser, memberNodePath, environmentVariables);
 
                     if (!memberNode)
                     {
@@ -652,7 +3300,14 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
                 }
                 else
                 {
-                    memberNode = readValueNode(it.value(), memberNodePath);
+                    QJsonValue value;
+
+                    if (!parser->readValue(&value))
+                    {
+                        return {};
+                    }
+
+                    memberNode = readValueNode(value, memberNodePath);
                     Q_ASSERT(memberNode);
                 }
                 break;
@@ -664,11 +3319,77 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
         objectNode->setMember(memberName, std::move(memberNode));
     }
 
+    if (parser->hasError())
+    {
+        return {};
+    }
+
+    return objectNode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readLazyMembers(const QJsonObject &jsonObject)
+{
+    auto objectNode = std::make_unique<ConfigObjectNode>();
+
+    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    {
+        // The member names were already validated and only the explicit Value nodes can have a
+        // decorator
+        const QString memberName = it.key();
+
+        if (memberName.startsWith(QLatin1Char('#')))
+        {
+            objectNode->setMember(memberName.mid(1), std::make_unique<ConfigValueNode>(it.value()));
+        }
+        else if (it.value().isObject())
+        {
+            // Members of the nested Object nodes are read on their first access too
+            auto lazyNode = std::make_unique<ConfigObjectNode>();
+            lazyNode->setLazyMembers(it.value().toObject(), &ConfigReader::readLazyMembers);
+            objectNode->setMember(memberName, std::move(lazyNode));
+        }
+        else
+        {
+            objectNode->setMember(memberName, std::make_unique<ConfigValueNode>(it.value()));
+        }
+    }
+
     return objectNode;
 }
 
 // -------------------------------------------------------------------------------------------------
 
+bool ConfigReader::canReadLazily(const QJsonObject &jsonObject)
+{
+    for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
+    {
+        const QString memberName = it.key();
+
+        if (memberName.startsWith(QLatin1Char('#')))
+        {
+            if (!ConfigNodePath::validateNodeName(memberName.mid(1)))
+            {
+                return false;
+            }
+        }
+        else if (hasDecorator(memberName) || (!ConfigNodePath::validateNodeName(memberName)))
+        {
+            // References need to be resolved and invalid member names need to be reported
+            return false;
+        }
+        else if (it.value().isObject() && (!canReadLazily(it.value().toObject())))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 std::unique_ptr<ConfigNodeReference> ConfigReader::readNodeReferenceNode(
         const QString &reference, const ConfigNodePath &currentNodePath)
 {
@@ -693,84 +3414,127 @@ std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
         const EnvironmentVariables &environmentVariables)
 {
     // Extract bases
-    const auto baseValue = jsonObject.value(QStringLiteral("base"));
+    QList<ConfigNodePath> bases;
 
-    if (baseValue.isUndefined())
+    if (!readDerivedObjectBases(jsonObject.value(QStringLiteral("base")), currentNodePath, &bases))
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "A derived object doesn't have the 'base' member at path:"
-                << currentNodePath.path();
         return {};
     }
 
-    QList<ConfigNodePath> bases;
+    // Extract config
+    auto config = std::make_unique<ConfigObjectNode>();
+    const auto configValue = jsonObject.value(QStringLiteral("config"));
 
-    if (baseValue.isString())
-    {
-        // Single base
-        bases.append(ConfigNodePath(baseValue.toString()));
-    }
-    else if (baseValue.isArray())
+    switch (configValue.type())
     {
-        for (const auto &item : baseValue.toArray())
+        case QJsonValue::Object:
         {
-            if (!item.isString())
+            // Read overrides for the object derived from bases
+            config = readObjectNode(configValue.toObject(), currentNodePath, environmentVariables);
+
+            if (!config)
             {
                 qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                        << "Unsupported JSON type for an item in the 'base' member at path:"
-                        << currentNodePath.path();
+                        << "Failed to read the overrides for the object derived from bases at path:"
+                           "\n    node path:" << currentNodePath.path();
                 return {};
             }
+            break;
+        }
 
-            bases.append(ConfigNodePath(item.toString()));
+        case QJsonValue::Null:
+        case QJsonValue::Undefined:
+        {
+            // No overrides for the object derived from bases
+            break;
         }
 
-        if (bases.isEmpty())
+        default:
         {
             qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << "The 'base' member is empty at path:" << currentNodePath.path();
+                    << "Unsupported JSON type for the 'config' member at path:"
+                    << currentNodePath.path();
             return {};
         }
     }
-    else
+
+    // Create derived object node
+    return std::make_unique<ConfigDerivedObjectNode>(bases, std::move(*config));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
+        JsonStreamParser *parser,
+        const ConfigNodePath &currentNodePath,
+        const EnvironmentVariables &environmentVariables)
+{
+    if (!parser->beginObject())
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Unsupported JSON type for an item in the 'base' member at path:"
-                << currentNodePath.path();
         return {};
     }
 
-    for (const auto &item : bases)
+    // Read the members (the overrides are read right away since their order is not known)
+    QJsonValue baseValue(QJsonValue::Undefined);
+    auto configType = QJsonValue::Undefined;
+    std::unique_ptr<ConfigObjectNode> config;
+    QString memberName;
+
+    while (parser->nextMember(&memberName))
     {
-        if (!item.toAbsolute(currentNodePath).isValid())
+        if (memberName == QStringLiteral("base"))
         {
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << QString("Invalid node path in base item at path:"
-                               "\n    base item's node path: %1"
-                               "\n    node path: %2")
-                       .arg(item.path(), currentNodePath.path());
-            return {};
+            parser->readValue(&baseValue);
+        }
+        else if (memberName == QStringLiteral("config"))
+        {
+            configType = parser->nextValueType();
+
+            if (configType == QJsonValue::Object)
+            {
+                // Read overrides for the object derived from bases
+                config = readObjectNode(parser, currentNodePath, environmentVariables);
+
+                if (!config)
+                {
+                    qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                            << "Failed to read the overrides for the object derived from bases "
+                               "at path:"
+                               "\n    node path:" << currentNodePath.path();
+                    return {};
+                }
+            }
+            else
+            {
+                config.reset();
+                parser->skipValue();
+            }
+        }
+        else
+        {
+            parser->skipValue();
         }
     }
 
-    // Extract config
-    auto config = std::make_unique<ConfigObjectNode>();
-    const auto configValue = jsonObject.value(QStringLiteral("config"));
+    if (parser->hasError())
+    {
+        return {};
+    }
 
-    switch (configValue.type())
+    // Extract bases
+    QList<ConfigNodePath> bases;
+
+    if (!readDerivedObjectBases(baseValue, currentNodePath, &bases))
+    {
+        return {};
+    }
+
+    // Extract config
+    switch (configType)
     {
         case QJsonValue::Object:
         {
-            // Read overrides for the object derived from bases
-            config = readObjectNode(configValue.toObject(), currentNodePath, environmentVariables);
-
-            if (!config)
-            {
-                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                        << "Failed to read the overrides for the object derived from bases at path:"
-                           "\n    node path:" << currentNodePath.path();
-                return {};
-            }
+            Q_ASSERT(config);
             break;
         }
 
@@ -778,6 +3542,7 @@ std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
         case QJsonValue::Undefined:
         {
             // No overrides for the object derived from bases
+            config = std::make_unique<ConfigObjectNode>();
             break;
         }
 
@@ -791,7 +3556,7 @@ std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
     }
 
     // Create derived object node
-    return std::make_unique<ConfigDerivedObjectNode>(bases, *config);
+    return std::make_unique<ConfigDerivedObjectNode>(bases, std::move(*config));
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -822,12 +3587,14 @@ QJsonValue ConfigReader::resolveJsonValue(const QJsonValue &jsonValue,
             if (!value.isEmpty())
             {
                 // Value is not an empty string, expand it
-                value = environmentVariables.expandText(value);
+                EnvironmentVariables::ExpansionError expansionError;
+                value = environmentVariables.expandText(value, &expansionError);
 
                 if (value.isNull())
                 {
                     qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                            << "Failed to resolve String value:" << jsonValue.toString();
+                            << "Failed to resolve String value:" << jsonValue.toString()
+                            << "Error:" << expansionError.toString();
                     return QJsonValue(QJsonValue::Undefined);
                 }
             }
@@ -891,12 +3658,14 @@ QJsonValue ConfigReader::resolveJsonObject(const QJsonObject &jsonObject,
 
         if (!key.isEmpty())
         {
-            key = environmentVariables.expandText(key);
+            EnvironmentVariables::ExpansionError expansionError;
+            key = environmentVariables.expandText(key, &expansionError);
 
             if (key.isNull())
             {
                 qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                        << "Failed to resolve Object key:" << it.key();
+                        << "Failed to resolve Object key:" << it.key()
+                        << "Error:" << expansionError.toString();
                 return QJsonValue(QJsonValue::Undefined);
             }
         }
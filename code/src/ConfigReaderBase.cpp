@@ -25,12 +25,19 @@
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReadOperation.hpp>
+#include <CppConfigFramework/ConfigReadStatistics.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 #include <CppConfigFramework/LoggingCategories.hpp>
 
 // Qt includes
+#include <QtCore/QFile>
+#include <QtCore/QStringBuilder>
 
 // System includes
+#include <algorithm>
+#include <deque>
+#include <map>
 
 // Forward declarations
 
@@ -41,247 +48,559 @@
 namespace CppConfigFramework
 {
 
-uint32_t ConfigReaderBase::referenceResolutionMaxCycles() const
+//! Holds an unresolved node (NodeReference or DerivedObject node) in the reference dependency graph
+struct ReferenceGraphNode
 {
-    return m_referenceResolutionMaxCycles;
-}
+    //! Unresolved configuration node
+    ConfigNode *node = nullptr;
+
+    //! Absolute node path of the unresolved configuration node
+    QString nodePath;
+
+    //! Absolute node paths of all nodes referenced by the unresolved configuration node
+    QStringList references;
+
+    //! Indexes of the graph nodes that this graph node depends on
+    std::vector<size_t> dependencies;
+
+    //! Indexes of the graph nodes that depend on this graph node
+    std::vector<size_t> dependents;
+
+    //! Number of unresolved graph nodes that need to be resolved before this graph node
+    int unresolvedDependencyCount = 0;
+
+    //! Holds the "is resolved" flag
+    bool resolved = false;
+};
 
 // -------------------------------------------------------------------------------------------------
 
-void ConfigReaderBase::setReferenceResolutionMaxCycles(const uint32_t referenceResolutionMaxCycles)
+//! Holds the reference dependency graph
+struct ReferenceGraph
 {
-    m_referenceResolutionMaxCycles = referenceResolutionMaxCycles;
+    //! Graph nodes
+    std::vector<ReferenceGraphNode> nodes;
+
+    //! Indexes of the unresolved graph nodes mapped by their node paths
+    std::map<QString, size_t> unresolvedNodes;
+
+    //! Indexes of the unresolved graph nodes that have no unresolved dependencies
+    std::deque<size_t> readyNodes;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Holds the merged bases of the DerivedObject nodes resolved in a single reference resolution
+struct DerivedObjectBaseCache
+{
+    //! Holds the merged bases for a list of base nodes
+    struct Entry
+    {
+        //! Copies of the base nodes that were merged
+        std::vector<std::shared_ptr<const ConfigObjectNode>> baseNodes;
+
+        //! Base nodes merged in the listed order (shared by the derived objects, see
+        //! ConfigObjectNode::setSharedMembers())
+        std::shared_ptr<const ConfigObjectNode> mergedBases;
+    };
+
+    /*!
+     * Merged bases mapped by the content hashes of the base nodes (the lists of base nodes with the
+     * same content hashes still need to be compared to the copies of the merged base nodes)
+     */
+    std::map<std::vector<quint64>, std::vector<Entry>> entries;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Creates a copy of the Object node that can be shared by several nodes
+ *
+ * \param   node    Object node
+ *
+ * \return  Shared copy
+ */
+static std::shared_ptr<const ConfigObjectNode> sharedCopy(const ConfigObjectNode &node)
+{
+    std::shared_ptr<const ConfigObjectNode> copy(
+                static_cast<ConfigObjectNode *>(node.clone().release()));
+
+    // The content hashes are calculated before the copy is shared so that later it is only read
+    copy->contentHash();
+    return copy;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigReaderBase::isFullyResolved(const ConfigNode &node)
+/*!
+ * Gets the base nodes merged in the listed order
+ *
+ * \param   baseNodes   Base nodes
+ *
+ * \param[in,out]   baseCache   Cache of the merged bases
+ *
+ * \return  Merged bases (shared, so they must not be changed)
+ *
+ * \note    The cached merged bases are reused only if the base nodes have the same contents as the
+ *          ones that were merged (the lists of base nodes are first matched by their content hashes
+ *          and then their contents are compared)
+ */
+static std::shared_ptr<const ConfigObjectNode> mergedBaseNodes(
+        const std::vector<const ConfigObjectNode *> &baseNodes, DerivedObjectBaseCache *baseCache)
 {
-    switch (node.type())
+    std::vector<quint64> baseContentHashes;
+    baseContentHashes.reserve(baseNodes.size());
+
+    for (const auto *baseNode : baseNodes)
     {
-        case ConfigNode::Type::Value:
+        baseContentHashes.push_back(baseNode->contentHash());
+    }
+
+    auto &entries = baseCache->entries[baseContentHashes];
+
+    for (const auto &entry : entries)
+    {
+        const bool sameBaseNodes = std::equal(
+                    baseNodes.begin(),
+                    baseNodes.end(),
+                    entry.baseNodes.begin(),
+                    [](const ConfigObjectNode *baseNode,
+                       const std::shared_ptr<const ConfigObjectNode> &copy)
+                    {
+                        return baseNode->hasSameContents(*copy);
+                    });
+
+        if (sameBaseNodes)
         {
-            return true;
+            return entry.mergedBases;
         }
+    }
 
-        case ConfigNode::Type::Object:
-        {
-            const auto &objectNode = node.toObject();
+    DerivedObjectBaseCache::Entry entry;
+    entry.baseNodes.reserve(baseNodes.size());
 
-            for (const auto &name : objectNode.names())
-            {
-                if (!isFullyResolved(*objectNode.member(name)))
-                {
-                    return false;
-                }
-            }
+    for (const auto *baseNode : baseNodes)
+    {
+        entry.baseNodes.push_back(sharedCopy(*baseNode));
+    }
 
-            return true;
-        }
+    if (baseNodes.size() == 1U)
+    {
+        // A single base node is already merged
+        entry.mergedBases = entry.baseNodes.front();
+    }
+    else
+    {
+        // The merged bases share the parts of the base nodes that are not changed by the other
+        // base nodes
+        auto mergedBases = std::make_unique<ConfigObjectNode>();
+        mergedBases->setSharedMembers(entry.baseNodes.front());
 
-        default:
+        for (size_t index = 1U; index < entry.baseNodes.size(); index++)
         {
-            break;
+            mergedBases->apply(*entry.baseNodes[index]);
         }
+
+        mergedBases->contentHash();
+        entry.mergedBases = std::move(mergedBases);
     }
 
-    return false;
+    entries.push_back(std::move(entry));
+    return entries.back().mergedBases;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-QStringList ConfigReaderBase::unresolvedReferences(const ConfigObjectNode &node)
+/*!
+ * Checks if the node path is either the same as the parent node path or if it is one of its
+ * descendants
+ *
+ * \param   nodePath        Absolute node path
+ * \param   parentNodePath  Absolute parent node path
+ *
+ * \retval  true    Node path is the same as or a descendant of the parent node path
+ * \retval  false   Node path is not related to the parent node path
+ */
+static bool isSameOrDescendantNodePath(const QString &nodePath, const QString &parentNodePath)
 {
-    QStringList references;
+    if (parentNodePath == ConfigNodePath::ROOT_PATH_VALUE)
+    {
+        return true;
+    }
 
-    // Iterate over all members and add all nodes of a reference type to the list
-    for (const QString &name : node.names())
+    if (!nodePath.startsWith(parentNodePath))
     {
-        const auto *member = node.member(name);
+        return false;
+    }
 
-        if (member->isNodeReference() || member->isDerivedObject())
+    return ((nodePath.size() == parentNodePath.size()) ||
+            (nodePath.at(parentNodePath.size()) == QChar('/')));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Checks if the graph node depends on an unresolved node at the specified node path
+ *
+ * \param   graphNode   Graph node
+ * \param   nodePath    Absolute node path of the unresolved node
+ *
+ * \retval  true    Graph node depends on the unresolved node
+ * \retval  false   Graph node does not depend on the unresolved node
+ *
+ * A graph node depends on all unresolved nodes on the way to the referenced nodes (they need to be
+ * resolved before the referenced node can be found) and on all unresolved nodes inside of the
+ * referenced nodes (the referenced nodes need to be fully resolved before they can be used).
+ */
+static bool dependsOn(const ReferenceGraphNode &graphNode, const QString &nodePath)
+{
+    for (const QString &reference : graphNode.references)
+    {
+        if (isSameOrDescendantNodePath(reference, nodePath) ||
+            isSameOrDescendantNodePath(nodePath, reference))
         {
-            references.append(member->nodePath().path());
+            return true;
         }
-        else if (member->isObject())
+    }
+
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Adds a dependency between two graph nodes
+ *
+ * \param   dependencyIndex     Index of the graph node that needs to be resolved first
+ * \param   dependentIndex      Index of the graph node that depends on the other graph node
+ *
+ * \param[in,out]   graph   Reference dependency graph
+ */
+static void addDependency(const size_t dependencyIndex,
+                          const size_t dependentIndex,
+                          ReferenceGraph *graph)
+{
+    auto &dependent = graph->nodes[dependentIndex];
+
+    if (std::find(dependent.dependencies.begin(),
+                  dependent.dependencies.end(),
+                  dependencyIndex) != dependent.dependencies.end())
+    {
+        // Dependency already exists
+        return;
+    }
+
+    dependent.dependencies.push_back(dependencyIndex);
+    dependent.unresolvedDependencyCount++;
+    graph->nodes[dependencyIndex].dependents.push_back(dependentIndex);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Adds dependencies on all of the currently unresolved graph nodes to the graph node
+ *
+ * \param   index   Index of the graph node
+ *
+ * \param[in,out]   graph   Reference dependency graph
+ */
+static void addDependencies(const size_t index, ReferenceGraph *graph)
+{
+    for (const QString &reference : graph->nodes[index].references)
+    {
+        // Unresolved nodes on the way to the referenced node (including the referenced node)
+        QString nodePath = reference;
+
+        while (nodePath.size() > 1)
         {
-            references.append(unresolvedReferences(member->toObject()));
+            auto it = graph->unresolvedNodes.find(nodePath);
+
+            if (it != graph->unresolvedNodes.end())
+            {
+                addDependency(it->second, index, graph);
+            }
+
+            nodePath.truncate(std::max(nodePath.lastIndexOf(QChar('/')), 1));
         }
-        else
+
+        // Unresolved nodes inside of the referenced node
+        const QString descendantPrefix =
+                (reference == ConfigNodePath::ROOT_PATH_VALUE) ? reference
+                                                                : (reference % QChar('/'));
+
+        for (auto it = graph->unresolvedNodes.lower_bound(descendantPrefix);
+             (it != graph->unresolvedNodes.end()) && it->first.startsWith(descendantPrefix);
+             ++it)
         {
-            // No unresolved references
+            addDependency(it->second, index, graph);
         }
     }
-
-    return references;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigReaderBase::resolveReferences(
-        const std::vector<const ConfigObjectNode *> &externalConfigs,
-        ConfigObjectNode *config) const
+/*!
+ * Collects all unresolved nodes (NodeReference and DerivedObject nodes) from the node and its
+ * descendants
+ *
+ * \param   node    Configuration node
+ *
+ * \param[in,out]   unresolvedNodes     Collected unresolved nodes
+ */
+static void collectUnresolvedNodes(ConfigNode *node, std::vector<ConfigNode *> *unresolvedNodes)
 {
-    auto result = ReferenceResolutionResult::Unchanged;
-    uint32_t resolutionCycle;
-
-    for (resolutionCycle = 0;
-         (resolutionCycle < m_referenceResolutionMaxCycles) &&
-         (result != ReferenceResolutionResult::Resolved);
-         resolutionCycle++)
+    switch (node->type())
     {
-        // Try to resolve references without external configuration nodes
-        auto newResult = resolveObjectReferences({}, config);
+        case ConfigNode::Type::Value:
+        {
+            break;
+        }
 
-        switch (newResult)
+        case ConfigNode::Type::Object:
         {
-            case ReferenceResolutionResult::Resolved:
-            case ReferenceResolutionResult::PartiallyResolved:
+            // Skip fully resolved Object nodes
+            if (node->toObject().unresolvedReferenceCount() == 0)
             {
-                result = newResult;
                 break;
             }
 
-            case ReferenceResolutionResult::Unchanged:
+            for (auto &member : node->toObject())
             {
-                // Check if external configuration nodes are provided
-                if (externalConfigs.empty())
-                {
-                    result = ReferenceResolutionResult::Unchanged;
-                    break;
-                }
+                collectUnresolvedNodes(&member.node(), unresolvedNodes);
+            }
+            break;
+        }
 
-                // External configuration nodes are provided, try to resolve references with them
-                newResult = resolveObjectReferences(externalConfigs, config);
+        case ConfigNode::Type::NodeReference:
+        case ConfigNode::Type::DerivedObject:
+        {
+            unresolvedNodes->push_back(node);
+            break;
+        }
+    }
+}
 
-                switch (newResult)
-                {
-                    case ReferenceResolutionResult::Resolved:
-                    case ReferenceResolutionResult::PartiallyResolved:
-                    {
-                        result = newResult;
-                        break;
-                    }
+// -------------------------------------------------------------------------------------------------
 
-                    case ReferenceResolutionResult::Unchanged:
-                    {
-                        // Still unchanged
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << QString("No references were resolved in the last cycle even "
-                                           "after using the external configuration nodes:"
-                                           "\n    cycle no.: %1"
-                                           "\n    unresolved references: [%2]")
-                                   .arg(resolutionCycle)
-                                   .arg(unresolvedReferences(*config).join("; "));
-                        return false;
-                    }
+/*!
+ * Adds the unresolved nodes to the reference dependency graph
+ *
+ * \param   unresolvedNodes     Unresolved nodes (NodeReference and DerivedObject nodes)
+ *
+ * \param[in,out]   graph   Reference dependency graph
+ *
+ * \return  Indexes of the added graph nodes
+ */
+static std::vector<size_t> addGraphNodes(const std::vector<ConfigNode *> &unresolvedNodes,
+                                         ReferenceGraph *graph)
+{
+    std::vector<size_t> indexes;
+    indexes.reserve(unresolvedNodes.size());
 
-                    case ReferenceResolutionResult::Error:
-                    {
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << QString("Failed to resolve references when using the external "
-                                           "configuration nodes:"
-                                           "\n    cycle no.: %1"
-                                           "\n    unresolved references: [%2]")
-                                   .arg(resolutionCycle)
-                                   .arg(unresolvedReferences(*config).join("; "));
-                        return false;
-                    }
-                }
-                break;
-            }
+    // First register all of the new graph nodes so that dependencies between them can be found
+    for (auto *node : unresolvedNodes)
+    {
+        ReferenceGraphNode graphNode;
+        graphNode.node = node;
+        graphNode.nodePath = node->nodePath().path();
 
-            case ReferenceResolutionResult::Error:
+        QList<ConfigNodePath> references;
+
+        if (node->isNodeReference())
+        {
+            references.append(node->toNodeReference().reference());
+        }
+        else
+        {
+            references = node->toDerivedObject().bases();
+        }
+
+        const ConfigNodePath parentNodePath = node->parent()->nodePath();
+
+        for (const auto &reference : references)
+        {
+            // Invalid references don't have any dependencies, they will fail during resolution
+            auto absoluteReference = reference.toAbsolute(parentNodePath);
+
+            if (absoluteReference.resolveReferences() && absoluteReference.isValid())
             {
-                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                        << QString("Failed to resolve references:"
-                                   "\n    cycle no.: %1"
-                                   "\n    unresolved references: [%2]")
-                           .arg(resolutionCycle)
-                           .arg(unresolvedReferences(*config).join("; "));
-                return false;
+                graphNode.references.append(absoluteReference.path());
             }
         }
+
+        indexes.push_back(graph->nodes.size());
+        graph->unresolvedNodes.emplace(graphNode.nodePath, graph->nodes.size());
+        graph->nodes.push_back(std::move(graphNode));
     }
 
-    if (result != ReferenceResolutionResult::Resolved)
+    // Then add their dependencies
+    for (const size_t index : indexes)
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << QString("Failed to fully resolve references:"
-                           "\n    cycle no.: %1"
-                           "\n    unresolved references: [%2]")
-                   .arg(resolutionCycle)
-                   .arg(unresolvedReferences(*config).join("; "));
-        return false;
+        addDependencies(index, graph);
     }
 
-    return true;
+    return indexes;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveObjectReferences(
-        const std::vector<const ConfigObjectNode *> &externalConfigs, ConfigObjectNode *node)
+/*!
+ * Finds a cycle in the unresolved part of the reference dependency graph
+ *
+ * \param   graph   Reference dependency graph
+ *
+ * \return  Node paths of the unresolved nodes in the cycle (the first node path is repeated at the
+ *          end) or an empty list if no cycle was found
+ */
+static QStringList findReferenceCycle(const ReferenceGraph &graph)
 {
-    // Iterate over all members and try to resolve their references
-    auto result = ReferenceResolutionResult::Unchanged;
+    // Find the first unresolved graph node
+    auto it = std::find_if(graph.nodes.begin(),
+                           graph.nodes.end(),
+                           [](const ReferenceGraphNode &graphNode) { return !graphNode.resolved; });
 
-    for (const QString &name : node->names())
+    if (it == graph.nodes.end())
     {
-        // Try to resolve the member's references
-        auto *member = node->member(name);
+        return {};
+    }
+
+    // Follow the unresolved dependencies until one of the graph nodes is visited again (each
+    // unresolved graph node in a stalled graph has at least one unresolved dependency)
+    std::vector<size_t> visitedNodes;
+    std::vector<bool> visited(graph.nodes.size(), false);
+    size_t index = static_cast<size_t>(std::distance(graph.nodes.begin(), it));
 
-        switch (member->type())
+    while (!visited[index])
+    {
+        visited[index] = true;
+        visitedNodes.push_back(index);
+
+        const auto &dependencies = graph.nodes[index].dependencies;
+        auto dependency = std::find_if(dependencies.begin(),
+                                       dependencies.end(),
+                                       [&graph](const size_t dependencyIndex)
+                                       {
+                                           return !graph.nodes[dependencyIndex].resolved;
+                                       });
+
+        if (dependency == dependencies.end())
         {
-            case ConfigNode::Type::Value:
-            {
-                // Not a reference type, leave the result as is
-                break;
-            }
+            return {};
+        }
 
-            case ConfigNode::Type::Object:
-            {
-                // Try to resolve the member's (Object node) references
-                auto newResult = resolveObjectReferences(externalConfigs, &member->toObject());
+        index = *dependency;
+    }
 
-                result = updateObjectResolutionResult(result, newResult);
-                break;
-            }
+    // Extract the cycle
+    QStringList cycle;
+    auto cycleStart = std::find(visitedNodes.begin(), visitedNodes.end(), index);
 
-            case ConfigNode::Type::NodeReference:
-            {
-                // Try to resolve the member's (NodeReference node) reference
-                auto newResult = resolveNodeReference(externalConfigs, &member->toNodeReference());
+    for (auto cycleIt = cycleStart; cycleIt != visitedNodes.end(); ++cycleIt)
+    {
+        cycle.append(graph.nodes[*cycleIt].nodePath);
+    }
 
-                result = updateObjectResolutionResult(result, newResult);
-                break;
-            }
+    cycle.append(graph.nodes[index].nodePath);
+    return cycle;
+}
 
-            case ConfigNode::Type::DerivedObject:
-            {
-                // Try to resolve the member's (DerivedObject node) references
-                auto newResult = resolveDerivedObjectReferences(externalConfigs,
-                                                                &member->toDerivedObject());
+// -------------------------------------------------------------------------------------------------
 
-                result = updateObjectResolutionResult(result, newResult);
-                break;
-            }
+uint32_t ConfigReaderBase::referenceResolutionMaxCycles() const
+{
+    return m_referenceResolutionMaxCycles;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReaderBase::setReferenceResolutionMaxCycles(const uint32_t referenceResolutionMaxCycles)
+{
+    qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+            << "The max number of reference resolution cycles is ignored since the references are "
+               "resolved in a single pass over a dependency graph";
+
+    m_referenceResolutionMaxCycles = referenceResolutionMaxCycles;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QByteArray ConfigReaderBase::readFileData(QFile *file)
+{
+    Q_ASSERT(file != nullptr);
+
+    const ConfigReadStatistics::PhaseTimer phaseTimer(ConfigReadStatistics::Phase::FileIo);
+    return file->readAll();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReaderBase::isFullyResolved(const ConfigNode &node)
+{
+    switch (node.type())
+    {
+        case ConfigNode::Type::Value:
+        {
+            return true;
         }
 
-        // Stop on error
-        if (result == ReferenceResolutionResult::Error)
+        case ConfigNode::Type::Object:
         {
-            return ReferenceResolutionResult::Error;
+            return (node.toObject().unresolvedReferenceCount() == 0);
+        }
+
+        default:
+        {
+            break;
         }
     }
 
-    // Check if the object is fully resolved
-    if (isFullyResolved(*node))
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QStringList ConfigReaderBase::unresolvedReferences(const ConfigObjectNode &node)
+{
+    QStringList references;
+
+    // Iterate over all members and add all nodes of a reference type to the list
+    for (const auto &nodeMember : node)
     {
-        return ReferenceResolutionResult::Resolved;
+        const auto *member = &nodeMember.node();
+
+        if (member->isNodeReference() || member->isDerivedObject())
+        {
+            references.append(member->nodePath().path());
+        }
+        else if (member->isObject() && (!isFullyResolved(*member)))
+        {
+            references.append(unresolvedReferences(member->toObject()));
+        }
+        else
+        {
+            // No unresolved references
+        }
     }
 
-    return result;
+    return references;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReaderBase::resolveReferences(
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        ConfigObjectNode *config) const
+{
+    return resolveReferenceGraph(externalConfigs, config);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveObjectReferences(
+        const std::vector<const ConfigObjectNode *> &externalConfigs, ConfigObjectNode *node)
+{
+    return resolveReferenceGraph(externalConfigs, node) ? ReferenceResolutionResult::Resolved
+                                                        : ReferenceResolutionResult::Error;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -333,6 +652,236 @@ ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::updateObjectResolu
 
 // -------------------------------------------------------------------------------------------------
 
+bool ConfigReaderBase::resolveReferenceGraph(
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        ConfigObjectNode *config)
+{
+    // Record the resolution cycles in the read statistics (if they are being recorded)
+    ConfigReadStatistics::ReferenceResolutionRecorder recorder;
+
+    // Build the reference dependency graph from all of the unresolved nodes
+    ReferenceGraph graph;
+    std::vector<ConfigNode *> unresolvedNodes;
+    collectUnresolvedNodes(config, &unresolvedNodes);
+
+    for (const size_t index : addGraphNodes(unresolvedNodes, &graph))
+    {
+        if (graph.nodes[index].unresolvedDependencyCount == 0)
+        {
+            graph.readyNodes.push_back(index);
+        }
+    }
+
+    // Merged bases of the DerivedObject nodes (shared by the nodes with the same base nodes)
+    DerivedObjectBaseCache baseCache;
+
+    // Resolves a graph node and updates the graph
+    auto resolveGraphNode =
+            [&externalConfigs, &graph, &recorder, &baseCache](const size_t index) -> bool
+    {
+        auto *node = graph.nodes[index].node;
+        auto *parentNode = node->parent();
+        const QString memberName = parentNode->name(*node);
+        const QString nodePath = graph.nodes[index].nodePath;
+
+        auto result = node->isNodeReference()
+                      ? resolveNodeReference(externalConfigs, &node->toNodeReference())
+                      : resolveDerivedObjectReferences(externalConfigs,
+                                                       &node->toDerivedObject(),
+                                                       &baseCache);
+
+        switch (result)
+        {
+            case ReferenceResolutionResult::Resolved:
+            case ReferenceResolutionResult::PartiallyResolved:
+            {
+                break;
+            }
+
+            case ReferenceResolutionResult::Unchanged:
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << QString("Failed to resolve the node [%1], the referenced nodes [%2] "
+                                   "were either not found or they are not fully resolved")
+                           .arg(nodePath, graph.nodes[index].references.join("; "));
+                return false;
+            }
+
+            case ReferenceResolutionResult::Error:
+            {
+                return false;
+            }
+        }
+
+        // The resolved node replaced the unresolved node (the old instance is already destroyed)
+        graph.nodes[index].node = nullptr;
+        graph.nodes[index].resolved = true;
+        graph.unresolvedNodes.erase(nodePath);
+        recorder.recordResolvedNode();
+
+        // The resolved node can contain new unresolved nodes (from a partially resolved node in an
+        // external configuration or from the overrides in a DerivedObject node)
+        std::vector<ConfigNode *> newUnresolvedNodes;
+        collectUnresolvedNodes(parentNode->member(memberName), &newUnresolvedNodes);
+        const auto newIndexes = addGraphNodes(newUnresolvedNodes, &graph);
+
+        // Release the dependent graph nodes, but first make them also depend on the new unresolved
+        // nodes if needed (only the dependents of the resolved node can depend on them)
+        const auto dependents = graph.nodes[index].dependents;
+
+        for (const size_t dependentIndex : dependents)
+        {
+            if (graph.nodes[dependentIndex].resolved)
+            {
+                continue;
+            }
+
+            for (const size_t newIndex : newIndexes)
+            {
+                if (dependsOn(graph.nodes[dependentIndex], graph.nodes[newIndex].nodePath))
+                {
+                    addDependency(newIndex, dependentIndex, &graph);
+                }
+            }
+
+            graph.nodes[dependentIndex].unresolvedDependencyCount--;
+
+            if (graph.nodes[dependentIndex].unresolvedDependencyCount == 0)
+            {
+                graph.readyNodes.push_back(dependentIndex);
+            }
+        }
+
+        for (const size_t newIndex : newIndexes)
+        {
+            if (graph.nodes[newIndex].unresolvedDependencyCount == 0)
+            {
+                graph.readyNodes.push_back(newIndex);
+            }
+        }
+
+        return true;
+    };
+
+    // Checks if all nodes referenced by a graph node can be taken from the external configuration
+    // nodes or are already resolved in the configuration node
+    auto isResolvableWithExternalConfigs = [&externalConfigs, &graph](const size_t index) -> bool
+    {
+        const auto *node = graph.nodes[index].node;
+        const auto *parentNode = node->parent();
+
+        QList<ConfigNodePath> references;
+
+        if (node->isNodeReference())
+        {
+            references.append(node->toNodeReference().reference());
+        }
+        else
+        {
+            references = node->toDerivedObject().bases();
+        }
+
+        for (const auto &reference : references)
+        {
+            const auto *internalNode = parentNode->nodeAtPath(reference);
+
+            if (internalNode != nullptr)
+            {
+                if (!isFullyResolved(*internalNode))
+                {
+                    return false;
+                }
+            }
+            else if (findReferencedConfigNode(reference, *parentNode, externalConfigs) == nullptr)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    // Resolve the graph nodes in topological order (a cycle resolves the nodes that became ready in
+    // the previous cycle)
+    size_t cycleReadyNodeCount = 0U;
+
+    while (!graph.unresolvedNodes.empty())
+    {
+        if (cycleReadyNodeCount == 0U)
+        {
+            if (ConfigReadOperation::isCurrentCanceled())
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Reference resolution was canceled";
+                return false;
+            }
+
+            cycleReadyNodeCount = graph.readyNodes.size();
+            recorder.startCycle();
+        }
+
+        if (graph.readyNodes.empty())
+        {
+            // All of the unresolved nodes depend on other unresolved nodes, as a last resort try to
+            // break the cycle by resolving one of the nodes with the external configuration nodes
+            bool resolved = false;
+
+            if (!externalConfigs.empty())
+            {
+                for (size_t index = 0; index < graph.nodes.size(); index++)
+                {
+                    if ((!graph.nodes[index].resolved) && isResolvableWithExternalConfigs(index))
+                    {
+                        if (!resolveGraphNode(index))
+                        {
+                            return false;
+                        }
+
+                        resolved = true;
+                        break;
+                    }
+                }
+            }
+
+            if (!resolved)
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << QString("Failed to resolve references because of a reference cycle:"
+                                   "\n    cycle: [%1]"
+                                   "\n    unresolved references: [%2]")
+                           .arg(findReferenceCycle(graph).join(" -> "),
+                                unresolvedReferences(*config).join("; "));
+                return false;
+            }
+
+            continue;
+        }
+
+        const size_t index = graph.readyNodes.front();
+        graph.readyNodes.pop_front();
+        cycleReadyNodeCount--;
+
+        if (graph.nodes[index].resolved)
+        {
+            // Already resolved while breaking a cycle
+            continue;
+        }
+
+        if (!resolveGraphNode(index))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("Failed to resolve references:"
+                               "\n    unresolved references: [%1]")
+                       .arg(unresolvedReferences(*config).join("; "));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveNodeReference(
         const std::vector<const ConfigObjectNode *> &externalConfigs, ConfigNodeReference *node)
 {
@@ -366,7 +915,9 @@ ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveNodeReferen
 // -------------------------------------------------------------------------------------------------
 
 ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveDerivedObjectReferences(
-        const std::vector<const ConfigObjectNode *> &externalConfigs, ConfigDerivedObjectNode *node)
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        ConfigDerivedObjectNode *node,
+        DerivedObjectBaseCache *baseCache)
 {
     // Derive the config node from the all of the base nodes
     auto *parentNode = node->parent();
@@ -405,27 +956,49 @@ ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveDerivedObje
     }
 
     // All the bases are resolved so they can now be applied to an empty object in the listed order
-    // to create a derived object node
-    ConfigObjectNode derivedObjectNode(parentNode);
+    // to create a derived object node. With a cache the merged bases are shared by all derived
+    // objects with the same bases (copy-on-write, see ConfigObjectNode::setSharedMembers()), so the
+    // overrides below copy only the nodes on their node paths while the rest stays shared.
+    std::unique_ptr<ConfigNode> derivedObjectNode;
 
-    for (const auto *baseNode : baseNodes)
+    if ((baseCache != nullptr) && (!baseNodes.empty()))
+    {
+        auto sharedBases = std::make_unique<ConfigObjectNode>();
+        sharedBases->setSharedMembers(mergedBaseNodes(baseNodes, baseCache));
+        derivedObjectNode = std::move(sharedBases);
+    }
+    else if (baseNodes.size() == 1U)
     {
-        derivedObjectNode.apply(*baseNode);
+        derivedObjectNode = baseNodes.front()->clone();
+    }
+    else
+    {
+        auto mergedBases = std::make_unique<ConfigObjectNode>();
+
+        for (const auto *baseNode : baseNodes)
+        {
+            mergedBases->apply(*baseNode);
+        }
+
+        derivedObjectNode = std::move(mergedBases);
     }
 
-    // Apply overrides to the derived object node
+    auto &derivedObject = derivedObjectNode->toObject();
+    derivedObject.setParent(parentNode);
+
+    // Apply overrides to the derived object node (they are moved instead of copied since the
+    // DerivedObject node gets replaced by the derived object node)
     if (node->config().count() > 0)
     {
-        derivedObjectNode.apply(node->config());
+        derivedObject.apply(std::move(node->config()));
     }
 
-    auto result = (isFullyResolved(derivedObjectNode)
+    auto result = (isFullyResolved(derivedObject)
                    ? ReferenceResolutionResult::Resolved
                    : ReferenceResolutionResult::PartiallyResolved);
 
-
-    // Replace the current node with the referenced node
-    if (!parentNode->setMember(parentNode->name(*node), derivedObjectNode))
+    // Replace the current node with the derived object node
+    if (!parentNode->setMember(parentNode->name(*node), std::move(derivedObjectNode)))
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << QString("Failed to store the resolved DerivedObject node [%1] to the parent "
@@ -446,42 +1019,44 @@ const ConfigNode *ConfigReaderBase::findReferencedConfigNode(
 {
     const auto *referencedNode = parentNode.nodeAtPath(referenceNodePath);
 
-    if (referencedNode == nullptr)
+    if (referencedNode != nullptr)
     {
-        // Unable to find the node reference, try to find it in one of the external configuration
-        // nodes (use last found node)
-        for (const auto *externalConfig : externalConfigs)
-        {
-            if (referenceNodePath.isAbsolute())
-            {
-                const auto *foundNode = externalConfig->nodeAtPath(referenceNodePath);
+        return referencedNode;
+    }
 
-                if (foundNode != nullptr)
-                {
-                    referencedNode = foundNode;
-                }
-            }
-            else
-            {
-                // First try to find the equivalent parent node from the external config and then
-                // try to get the node using the relative path
-                const auto *externalConfigParent =
-                        externalConfig->nodeAtPath(parentNode.nodePath());
+    // Unable to find the node reference, try to find it in one of the external configuration nodes
+    // (the last external configuration node that contains it takes precedence so search them in
+    // reverse order and stop at the first match)
+    const ConfigNodePath parentNodePath = (referenceNodePath.isAbsolute() ? ConfigNodePath()
+                                                                          : parentNode.nodePath());
 
-                if (externalConfigParent != nullptr)
-                {
-                    const auto *foundNode = externalConfigParent->nodeAtPath(referenceNodePath);
+    for (auto it = externalConfigs.crbegin(); it != externalConfigs.crend(); ++it)
+    {
+        const auto *externalConfig = *it;
 
-                    if (foundNode != nullptr)
-                    {
-                        referencedNode = foundNode;
-                    }
-                }
+        if (referenceNodePath.isAbsolute())
+        {
+            referencedNode = externalConfig->nodeAtPath(referenceNodePath);
+        }
+        else
+        {
+            // First try to find the equivalent parent node from the external config and then try to
+            // get the node using the relative path
+            const auto *externalConfigParent = externalConfig->nodeAtPath(parentNodePath);
+
+            if (externalConfigParent != nullptr)
+            {
+                referencedNode = externalConfigParent->nodeAtPath(referenceNodePath);
             }
         }
+
+        if (referencedNode != nullptr)
+        {
+            return referencedNode;
+        }
     }
 
-    return referencedNode;
+    return nullptr;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -495,6 +1070,8 @@ std::unique_ptr<ConfigObjectNode> ConfigReaderBase::transformConfig(
     Q_ASSERT(sourceNodePath.isAbsolute());
     Q_ASSERT(destinationNodePath.isAbsolute());
 
+    const ConfigReadStatistics::PhaseTimer phaseTimer(ConfigReadStatistics::Phase::TransformConfig);
+
     // Check if transformation is needed
     if (sourceNodePath.isRoot() && destinationNodePath.isRoot())
     {
@@ -511,7 +1088,7 @@ std::unique_ptr<ConfigObjectNode> ConfigReaderBase::transformConfig(
     }
     else
     {
-        const auto *node = config->nodeAtPath(sourceNodePath);
+        auto *node = config->nodeAtPath(sourceNodePath);
 
         if (node == nullptr)
         {
@@ -521,7 +1098,19 @@ std::unique_ptr<ConfigObjectNode> ConfigReaderBase::transformConfig(
             return {};
         }
 
-        sourceConfig = node->clone();
+        // Detach the source node from the original configuration node instead of copying it since
+        // the rest of the original configuration node is not needed anymore
+        auto *parentNode = node->parent();
+
+        if (parentNode == nullptr)
+        {
+            sourceConfig = std::move(config);
+        }
+        else
+        {
+            sourceConfig = parentNode->take(parentNode->name(*node));
+            Q_ASSERT(sourceConfig);
+        }
     }
 
     // For "root" destination just return the source node
@@ -22,6 +22,7 @@
 #include <CppConfigFramework/ConfigReaderRegistry.hpp>
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigBinaryReader.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigReader.hpp>
 #include <CppConfigFramework/LoggingCategories.hpp>
@@ -56,7 +57,11 @@ bool ConfigReaderRegistry::registerConfigReader(const QString &type,
         return false;
     }
 
-    m_configReaders[type] = std::move(configReader);
+    // The replaced configuration reader (if any) is destroyed outside of the lock
+    std::shared_ptr<const ConfigReaderBase> replacedConfigReader(std::move(configReader));
+    QWriteLocker locker(&m_lock);
+
+    m_configReaders[type].swap(replacedConfigReader);
     return true;
 }
 
@@ -71,17 +76,15 @@ std::unique_ptr<ConfigObjectNode> ConfigReaderRegistry::readConfig(
         EnvironmentVariables *environmentVariables) const
 {
     // Get the specified type of config reader
-    auto it = m_configReaders.find(type);
+    const auto configReader = findConfigReader(type);
 
-    if (it == m_configReaders.end())
+    if (!configReader)
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << "Unsupported configuration type:" << type;
         return {};
     }
 
-    auto *configReader = it->second.get();
-
     // Read the config
     return configReader->read(workingDir,
                               destinationNodePath,
@@ -95,6 +98,24 @@ std::unique_ptr<ConfigObjectNode> ConfigReaderRegistry::readConfig(
 ConfigReaderRegistry::ConfigReaderRegistry()
 {
     registerConfigReader(QStringLiteral("CppConfigFramework"), std::make_unique<ConfigReader>());
+    registerConfigReader(QStringLiteral("CppConfigFrameworkBinary"),
+                         std::make_unique<ConfigBinaryReader>());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const ConfigReaderBase> ConfigReaderRegistry::findConfigReader(
+        const QString &type) const
+{
+    QReadLocker locker(&m_lock);
+    auto it = m_configReaders.find(type);
+
+    if (it == m_configReaders.end())
+    {
+        return {};
+    }
+
+    return it->second;
 }
 
 } // namespace CppConfigFramework
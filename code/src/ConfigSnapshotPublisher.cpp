@@ -0,0 +1,107 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a publisher of immutable configuration snapshots
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigSnapshotPublisher.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+ConfigSnapshot ConfigSnapshotPublisher::freeze(std::unique_ptr<ConfigObjectNode> config)
+{
+    if (!config)
+    {
+        return {};
+    }
+
+    // Make sure that the node paths in the snapshot do not depend on any node outside of it
+    config->setParent(nullptr);
+
+    // Lazy members are read on the first access so they have to be read before the snapshot is
+    // shared with other threads
+    if (!config->materializeAll())
+    {
+        return {};
+    }
+
+    // Building the node index also caches the content hashes of the whole tree
+    config->cacheNodePaths();
+    config->buildNodeIndex();
+
+    return ConfigSnapshot(std::move(config));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshot ConfigSnapshotPublisher::snapshot() const
+{
+    return std::atomic_load(&m_snapshot);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshot ConfigSnapshotPublisher::publish(std::unique_ptr<ConfigObjectNode> config)
+{
+    const ConfigSnapshot snapshot = freeze(std::move(config));
+
+    if (snapshot)
+    {
+        publish(snapshot);
+    }
+
+    return snapshot;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigSnapshotPublisher::publish(const ConfigSnapshot &snapshot)
+{
+    // The previous snapshot is freed when its last reader drops it
+    std::atomic_store(&m_snapshot, snapshot);
+    m_version.fetch_add(1U);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigSnapshotPublisher::reset()
+{
+    publish(ConfigSnapshot());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 ConfigSnapshotPublisher::version() const
+{
+    return m_version.load();
+}
+
+} // namespace CppConfigFramework
@@ -0,0 +1,149 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a process-wide pool of interned strings
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigStringPool.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QMutexLocker>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+ConfigStringPool *ConfigStringPool::instance()
+{
+    static ConfigStringPool pool;
+
+    return &pool;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigStringPool::isEnabled() const
+{
+    return m_enabled.load();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigStringPool::setEnabled(const bool enabled)
+{
+    QMutexLocker locker(&m_mutex);
+    m_enabled.store(enabled);
+
+    if (!enabled)
+    {
+        m_strings.clear();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigStringPool::count() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_strings.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigStringPool::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_strings.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigStringPool::releaseUnused()
+{
+    QMutexLocker locker(&m_mutex);
+    int removedCount = 0;
+
+    for (auto it = m_strings.begin(); it != m_strings.end(); )
+    {
+        // A string whose storage is not shared is referenced only by the pool
+        if (it->isDetached())
+        {
+            it = m_strings.erase(it);
+            removedCount++;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return removedCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigStringPool::intern(const QString &string)
+{
+    // Empty strings do not allocate any storage so there is nothing to share
+    if ((!m_enabled.load()) || string.isEmpty())
+    {
+        return string;
+    }
+
+    QMutexLocker locker(&m_mutex);
+
+    if (!m_enabled.load())
+    {
+        return string;
+    }
+
+    auto it = m_strings.constFind(string);
+
+    if (it == m_strings.constEnd())
+    {
+        it = m_strings.insert(string);
+    }
+
+    return *it;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigStringPool::isInterned(const QString &string) const
+{
+    if (string.isEmpty())
+    {
+        return false;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    const auto it = m_strings.constFind(string);
+
+    return (it != m_strings.constEnd()) && (it->constData() == string.constData());
+}
+
+} // namespace CppConfigFramework
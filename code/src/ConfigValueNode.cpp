@@ -22,10 +22,17 @@
 #include <CppConfigFramework/ConfigValueNode.hpp>
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigReadStatistics.hpp>
+#include <CppConfigFramework/ConfigStringPool.hpp>
 
 // Qt includes
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 
 // System includes
+#include <cmath>
+#include <cstring>
 
 // Forward declarations
 
@@ -36,17 +43,33 @@
 namespace CppConfigFramework
 {
 
+//! Largest integral value that can be exactly represented by a double
+static constexpr double s_maxExactInteger = 9007199254740992.0;
+
+// -------------------------------------------------------------------------------------------------
+
 ConfigValueNode::ConfigValueNode(const QJsonValue &value, ConfigObjectNode *parent)
-    : ConfigNode(parent),
-      m_value(value)
+    : ConfigNode(parent)
 {
+    m_scalar.integer = 0;
+    setValue(value);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 std::unique_ptr<ConfigNode> ConfigValueNode::clone() const
 {
-    return std::make_unique<ConfigValueNode>(m_value, nullptr);
+    ConfigReadStatistics::recordClonedNode();
+
+    auto node = std::make_unique<ConfigValueNode>();
+
+    node->m_storageType = m_storageType;
+    node->m_scalar = m_scalar;
+    node->m_string = m_string;
+    node->m_jsonValue = m_jsonValue;
+    node->copyContentHashCache(*this);
+
+    return node;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -60,14 +83,322 @@ ConfigNode::Type ConfigValueNode::type() const
 
 QJsonValue ConfigValueNode::value() const
 {
-    return m_value;
+    switch (m_storageType)
+    {
+        case StorageType::Null:
+        {
+            return QJsonValue(QJsonValue::Null);
+        }
+
+        case StorageType::Bool:
+        {
+            return QJsonValue(m_scalar.boolean);
+        }
+
+        case StorageType::Integer:
+        {
+            return QJsonValue(m_scalar.integer);
+        }
+
+        case StorageType::Double:
+        {
+            return QJsonValue(m_scalar.number);
+        }
+
+        case StorageType::String:
+        {
+            return QJsonValue(m_string);
+        }
+
+        case StorageType::Json:
+        {
+            break;
+        }
+    }
+
+    return m_jsonValue;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 void ConfigValueNode::setValue(const QJsonValue &value)
 {
-    m_value = value;
+    invalidateContentHashCache();
+
+    m_string.clear();
+    m_jsonValue = QJsonValue();
+
+    switch (value.type())
+    {
+        case QJsonValue::Null:
+        {
+            m_storageType = StorageType::Null;
+            break;
+        }
+
+        case QJsonValue::Bool:
+        {
+            m_storageType = StorageType::Bool;
+            m_scalar.boolean = value.toBool();
+            break;
+        }
+
+        case QJsonValue::Double:
+        {
+            // Integral values are stored as integers only if storing them as doubles would give the
+            // same value (negative zero is kept as a double to preserve its sign)
+            const double number = value.toDouble();
+
+            if ((std::trunc(number) == number) &&
+                (std::fabs(number) <= s_maxExactInteger) &&
+                !((number == 0.0) && std::signbit(number)))
+            {
+                m_storageType = StorageType::Integer;
+                m_scalar.integer = static_cast<qint64>(number);
+            }
+            else
+            {
+                m_storageType = StorageType::Double;
+                m_scalar.number = number;
+            }
+            break;
+        }
+
+        case QJsonValue::String:
+        {
+            m_storageType = StorageType::String;
+            m_string = ConfigStringPool::instance()->intern(value.toString());
+            break;
+        }
+
+        default:
+        {
+            m_storageType = StorageType::Json;
+            m_jsonValue = value;
+            break;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigValueNode::StorageType ConfigValueNode::storageType() const
+{
+    return m_storageType;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigValueNode::toBool(bool *ok) const
+{
+    const bool isBool = (m_storageType == StorageType::Bool);
+
+    if (ok != nullptr)
+    {
+        *ok = isBool;
+    }
+
+    return isBool ? m_scalar.boolean : false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+qint64 ConfigValueNode::toInt64(bool *ok) const
+{
+    bool converted = false;
+    qint64 integer = 0;
+
+    if (m_storageType == StorageType::Integer)
+    {
+        converted = true;
+        integer = m_scalar.integer;
+    }
+    else if ((m_storageType == StorageType::Double) &&
+             (std::trunc(m_scalar.number) == m_scalar.number) &&
+             (m_scalar.number >= -9223372036854775808.0) &&
+             (m_scalar.number < 9223372036854775808.0))
+    {
+        converted = true;
+        integer = static_cast<qint64>(m_scalar.number);
+    }
+
+    if (ok != nullptr)
+    {
+        *ok = converted;
+    }
+
+    return integer;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+double ConfigValueNode::toDouble(bool *ok) const
+{
+    bool converted = true;
+    double number = 0.0;
+
+    switch (m_storageType)
+    {
+        case StorageType::Integer:
+        {
+            number = static_cast<double>(m_scalar.integer);
+            break;
+        }
+
+        case StorageType::Double:
+        {
+            number = m_scalar.number;
+            break;
+        }
+
+        default:
+        {
+            converted = false;
+            break;
+        }
+    }
+
+    if (ok != nullptr)
+    {
+        *ok = converted;
+    }
+
+    return number;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigValueNode::toString(bool *ok) const
+{
+    const bool isString = (m_storageType == StorageType::String);
+
+    if (ok != nullptr)
+    {
+        *ok = isString;
+    }
+
+    return isString ? m_string : QString();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+QStringView ConfigValueNode::toStringView(bool *ok) const
+{
+    const bool isString = (m_storageType == StorageType::String);
+
+    if (ok != nullptr)
+    {
+        *ok = isString;
+    }
+
+    return isString ? QStringView(m_string) : QStringView();
+}
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigValueNode::hasSameValue(const ConfigValueNode &other) const
+{
+    // Compare the scalar values without creating QJsonValue instances
+    if (m_storageType != other.m_storageType)
+    {
+        return false;
+    }
+
+    switch (m_storageType)
+    {
+        case StorageType::Null:
+        {
+            return true;
+        }
+
+        case StorageType::Bool:
+        {
+            return (m_scalar.boolean == other.m_scalar.boolean);
+        }
+
+        case StorageType::Integer:
+        {
+            return (m_scalar.integer == other.m_scalar.integer);
+        }
+
+        case StorageType::Double:
+        {
+            return (m_scalar.number == other.m_scalar.number);
+        }
+
+        case StorageType::String:
+        {
+            return (m_string == other.m_string);
+        }
+
+        case StorageType::Json:
+        {
+            break;
+        }
+    }
+
+    return (m_jsonValue == other.m_jsonValue);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 ConfigValueNode::calculateContentHash() const
+{
+    quint64 hash = combineContentHash(static_cast<quint64>(type()),
+                                      static_cast<quint64>(m_storageType));
+
+    switch (m_storageType)
+    {
+        case StorageType::Null:
+        {
+            return hash;
+        }
+
+        case StorageType::Bool:
+        {
+            return combineContentHash(hash, m_scalar.boolean ? 1U : 0U);
+        }
+
+        case StorageType::Integer:
+        {
+            return combineContentHash(hash, static_cast<quint64>(m_scalar.integer));
+        }
+
+        case StorageType::Double:
+        {
+            // Positive zero is stored as an Integer so equal doubles also have equal bits
+            quint64 bits = 0U;
+            std::memcpy(&bits, &m_scalar.number, sizeof(bits));
+            return combineContentHash(hash, bits);
+        }
+
+        case StorageType::String:
+        {
+            return combineContentHash(hash, stringContentHash(m_string));
+        }
+
+        case StorageType::Json:
+        {
+            break;
+        }
+    }
+
+    // Arrays and objects are hashed through their compact JSON representation (object members are
+    // always serialized in the same order)
+    QByteArray json;
+
+    if (m_jsonValue.isArray())
+    {
+        json = QJsonDocument(m_jsonValue.toArray()).toJson(QJsonDocument::Compact);
+    }
+    else if (m_jsonValue.isObject())
+    {
+        json = QJsonDocument(m_jsonValue.toObject()).toJson(QJsonDocument::Compact);
+    }
+
+    return combineContentHash(hash, stringContentHash(QString::fromUtf8(json)));
 }
 
 } // namespace CppConfigFramework
@@ -77,8 +408,8 @@ void ConfigValueNode::setValue(const QJsonValue &value)
 bool operator==(const CppConfigFramework::ConfigValueNode &left,
                 const CppConfigFramework::ConfigValueNode &right)
 {
-    return ((left.nodePath() == right.nodePath()) &&
-            (left.value() == right.value()));
+    return (left.hasSameValue(right) &&
+            (left.nodePath() == right.nodePath()));
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -0,0 +1,396 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that watches the configuration files and reloads the configuration
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigWatcher.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/LoggingCategories.hpp>
+
+// Qt includes
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+//! Default debounce interval in milliseconds
+static constexpr int s_defaultDebounceInterval = 500;
+
+//! Mutex protecting the state of the ConfigFileCache shared by the watchers
+static QMutex s_fileCacheMutex;
+
+//! Number of watchers for which the ConfigFileCache is enabled
+static int s_fileCacheAcquireCount = 0;
+
+//! State of the ConfigFileCache before it was enabled for the first watcher
+static bool s_fileCacheWasEnabled = false;
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigWatcher::ConfigWatcher(QObject *parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<std::shared_ptr<const CppConfigFramework::ConfigObjectNode>>();
+
+    m_debounceTimer.setSingleShot(true);
+    m_debounceTimer.setInterval(s_defaultDebounceInterval);
+
+    connect(&m_fileSystemWatcher, &QFileSystemWatcher::fileChanged,
+            this, &ConfigWatcher::onFileChanged);
+    connect(&m_fileSystemWatcher, &QFileSystemWatcher::directoryChanged,
+            this, &ConfigWatcher::onDirectoryChanged);
+    connect(&m_debounceTimer, &QTimer::timeout,
+            this, &ConfigWatcher::onDebounceTimeout);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigWatcher::~ConfigWatcher()
+{
+    stop();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReader *ConfigWatcher::reader()
+{
+    return &m_reader;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigWatcher::debounceInterval() const
+{
+    return m_debounceTimer.interval();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::setDebounceInterval(const int debounceInterval)
+{
+    m_debounceTimer.setInterval(debounceInterval);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigWatcher::start(const QString &filePath,
+                          const QDir &workingDir,
+                          const ConfigNodePath &sourceNodePath,
+                          const ConfigNodePath &destinationNodePath,
+                          const EnvironmentVariables &environmentVariables)
+{
+    stop();
+
+    if (filePath.isEmpty())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWatcher) << "File path is empty!";
+        return false;
+    }
+
+    m_filePath = filePath;
+    m_workingDir = workingDir;
+    m_sourceNodePath = sourceNodePath;
+    m_destinationNodePath = destinationNodePath;
+    m_environmentVariables = environmentVariables;
+    m_config.reset();
+    m_includeGraph.clear();
+
+    // Unchanged files are taken from the cache on reload
+    acquireFileCache();
+
+    const ConfigSnapshot config = readConfig();
+
+    if (!config)
+    {
+        stop();
+        return false;
+    }
+
+    m_config.publish(config);
+    m_active = true;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::stop()
+{
+    m_active = false;
+    m_debounceTimer.stop();
+    m_changedFilePaths.clear();
+    updateWatchedPaths({});
+    releaseFileCache();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigWatcher::isActive() const
+{
+    return m_active;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const ConfigObjectNode> ConfigWatcher::config() const
+{
+    return m_config.snapshot();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigIncludeGraph &ConfigWatcher::includeGraph() const
+{
+    return m_includeGraph;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QStringList ConfigWatcher::watchedPaths() const
+{
+    return m_fileSystemWatcher.files() + m_fileSystemWatcher.directories();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigWatcher::reload()
+{
+    if (!m_active)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWatcher)
+                << "The watcher is not started!";
+        return false;
+    }
+
+    const ConfigSnapshot previousConfig = m_config.snapshot();
+    const ConfigSnapshot config = readConfig();
+
+    if (!config)
+    {
+        emit reloadFailed();
+        return false;
+    }
+
+    if (previousConfig && (*previousConfig == *config))
+    {
+        // Configuration was not changed (the readers can keep on using the previous snapshot)
+        return true;
+    }
+
+    m_config.publish(config);
+    emit configChanged(config);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::onFileChanged(const QString &filePath)
+{
+    m_changedFilePaths.insert(filePath);
+    m_debounceTimer.start();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::onDirectoryChanged(const QString &directoryPath)
+{
+    Q_UNUSED(directoryPath)
+
+    // The affected files are found once the changes have settled
+    m_debounceTimer.start();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::onDebounceTimeout()
+{
+    // Find the changed files (the ones that were created, removed or replaced are detected only
+    // through the change of their directory)
+    QSet<QString> changedFilePaths = m_changedFilePaths;
+    m_changedFilePaths.clear();
+
+    for (auto it = m_fileKeys.begin(); it != m_fileKeys.end(); it++)
+    {
+        if (!(ConfigFileCache::FileKey::fromFile(it.key()) == it.value()))
+        {
+            changedFilePaths.insert(it.key());
+        }
+    }
+
+    if (changedFilePaths.isEmpty())
+    {
+        return;
+    }
+
+    // Make sure that the changed files are read again (the change is not necessarily visible in
+    // the size and modification time of the file) while the unchanged ones are taken from the cache
+    auto *cache = ConfigFileCache::instance();
+
+    for (const QString &filePath : changedFilePaths)
+    {
+        cache->removeFile(filePath);
+    }
+
+    reload();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshot ConfigWatcher::readConfig()
+{
+    // Read the configuration and record its include graph
+    ConfigIncludeGraph includeGraph;
+    EnvironmentVariables environmentVariables = m_environmentVariables;
+    std::unique_ptr<ConfigObjectNode> config;
+
+    {
+        const ConfigIncludeGraph::RecordScope recordScope(&includeGraph);
+
+        config = m_reader.read(m_filePath,
+                               m_workingDir,
+                               m_sourceNodePath,
+                               m_destinationNodePath,
+                               {},
+                               &environmentVariables);
+    }
+
+    if (!config)
+    {
+        // Keep watching the previous files and also the newly read ones so that fixing any of them
+        // triggers another reload
+        QStringList filePaths = m_includeGraph.filePaths();
+
+        for (const QString &filePath : includeGraph.filePaths())
+        {
+            if (!filePaths.contains(filePath))
+            {
+                filePaths.append(filePath);
+            }
+        }
+
+        updateWatchedPaths(filePaths);
+
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWatcher)
+                << "Failed to read the configuration file:" << m_filePath;
+        return {};
+    }
+
+    m_includeGraph = std::move(includeGraph);
+    updateWatchedPaths(m_includeGraph.filePaths());
+    return ConfigSnapshotPublisher::freeze(std::move(config));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::updateWatchedPaths(const QStringList &filePaths)
+{
+    // Remember the current versions of the files
+    QStringList existingFilePaths;
+    QStringList directoryPaths;
+    m_fileKeys.clear();
+
+    for (const QString &filePath : filePaths)
+    {
+        const QFileInfo fileInfo(filePath);
+        m_fileKeys.insert(filePath, ConfigFileCache::FileKey::fromFile(filePath));
+
+        if (fileInfo.exists())
+        {
+            existingFilePaths.append(filePath);
+        }
+
+        const QString directoryPath = fileInfo.absolutePath();
+
+        if ((!directoryPaths.contains(directoryPath)) && QFileInfo::exists(directoryPath))
+        {
+            directoryPaths.append(directoryPath);
+        }
+    }
+
+    // The file system watcher stops watching the files that are removed or replaced so all of the
+    // files are added again
+    const QStringList watchedPaths = this->watchedPaths();
+
+    if (!watchedPaths.isEmpty())
+    {
+        m_fileSystemWatcher.removePaths(watchedPaths);
+    }
+
+    if (!existingFilePaths.isEmpty())
+    {
+        m_fileSystemWatcher.addPaths(existingFilePaths);
+    }
+
+    if (!directoryPaths.isEmpty())
+    {
+        m_fileSystemWatcher.addPaths(directoryPaths);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::acquireFileCache()
+{
+    if (m_fileCacheAcquired)
+    {
+        return;
+    }
+
+    QMutexLocker locker(&s_fileCacheMutex);
+
+    if (s_fileCacheAcquireCount == 0)
+    {
+        s_fileCacheWasEnabled = ConfigFileCache::instance()->isEnabled();
+        ConfigFileCache::instance()->setEnabled(true);
+    }
+
+    s_fileCacheAcquireCount++;
+    m_fileCacheAcquired = true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::releaseFileCache()
+{
+    if (!m_fileCacheAcquired)
+    {
+        return;
+    }
+
+    QMutexLocker locker(&s_fileCacheMutex);
+
+    s_fileCacheAcquireCount--;
+    m_fileCacheAcquired = false;
+
+    if (s_fileCacheAcquireCount == 0)
+    {
+        ConfigFileCache::instance()->setEnabled(s_fileCacheWasEnabled);
+    }
+}
+
+} // namespace CppConfigFramework
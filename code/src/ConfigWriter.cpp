@@ -22,6 +22,7 @@
 #include <CppConfigFramework/ConfigWriter.hpp>
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigBinaryFormat.hpp>
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
@@ -29,11 +30,16 @@
 
 // Qt includes
 #include <QtCore/QFile>
+#include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
+#include <QtCore/QLocale>
 #include <QtCore/QStringBuilder>
 
 // System includes
+#include <cmath>
+#include <cstring>
+#include <vector>
 
 // Forward declarations
 
@@ -55,6 +61,29 @@ QJsonValue toJsonConfig(const ConfigObjectNode &objectNode);
 QJsonValue toJsonConfig(const ConfigNodeReference &nodeReference);
 QJsonValue toJsonConfig(const ConfigDerivedObjectNode &derivedObjectNode);
 
+void appendUInt8(const quint8 value, QByteArray *data);
+void appendUInt32(const quint32 value, QByteArray *data);
+void appendUInt64(const quint64 value, QByteArray *data);
+void appendByteArray(const QByteArray &value, QByteArray *data);
+void appendString(const QString &value, QByteArray *data);
+void appendSources(const ConfigBinaryFormat::Sources &sources, QByteArray *data);
+
+bool toBinaryConfig(const QJsonValue &value, QByteArray *data);
+bool toBinaryConfig(const ConfigObjectNode &objectNode, QByteArray *data);
+
+bool writeToFile(const QByteArray &data, const QString &filePath);
+
+class JsonStreamWriter;
+
+bool isUndefined(const ConfigValueNode &valueNode);
+
+void writeJsonConfig(const ConfigValueNode &valueNode, JsonStreamWriter *writer);
+bool writeJsonConfig(const ConfigObjectNode &objectNode, JsonStreamWriter *writer);
+void writeJsonConfig(const ConfigNodeReference &nodeReference, JsonStreamWriter *writer);
+bool writeJsonConfig(const ConfigDerivedObjectNode &derivedObjectNode, JsonStreamWriter *writer);
+
+void writeJsonValue(const ConfigObjectNode &objectNode, JsonStreamWriter *writer);
+
 // -------------------------------------------------------------------------------------------------
 
 QJsonValue toJsonConfig(const ConfigValueNode &valueNode)
@@ -68,9 +97,10 @@ QJsonValue toJsonConfig(const ConfigObjectNode &objectNode)
 {
     QJsonObject data;
 
-    for (const auto &memberName : objectNode.names())
+    for (const auto &objectMember : objectNode)
     {
-        const auto *member = objectNode.member(memberName);
+        const QString &memberName = objectMember.name();
+        const auto *member = &objectMember.node();
 
         switch (member->type())
         {
@@ -152,6 +182,838 @@ QJsonValue toJsonConfig(const ConfigDerivedObjectNode &derivedObjectNode)
     return data;
 }
 
+// -------------------------------------------------------------------------------------------------
+
+void appendUInt8(const quint8 value, QByteArray *data)
+{
+    data->append(static_cast<char>(value));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void appendUInt32(const quint32 value, QByteArray *data)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        data->append(static_cast<char>((value >> (8 * i)) & 0xFFU));
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void appendUInt64(const quint64 value, QByteArray *data)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        data->append(static_cast<char>((value >> (8 * i)) & 0xFFU));
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void appendByteArray(const QByteArray &value, QByteArray *data)
+{
+    appendUInt32(static_cast<quint32>(value.size()), data);
+    data->append(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void appendString(const QString &value, QByteArray *data)
+{
+    appendByteArray(value.toUtf8(), data);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void appendSources(const ConfigBinaryFormat::Sources &sources, QByteArray *data)
+{
+    appendUInt32(static_cast<quint32>(sources.files.size()), data);
+
+    for (const auto &file : sources.files)
+    {
+        appendString(file.filePath, data);
+        appendUInt64(static_cast<quint64>(file.size), data);
+        appendUInt64(static_cast<quint64>(file.lastModified), data);
+    }
+
+    appendUInt32(static_cast<quint32>(sources.environmentVariables.size()), data);
+
+    for (auto it = sources.environmentVariables.begin();
+         it != sources.environmentVariables.end();
+         ++it)
+    {
+        appendString(it.key(), data);
+        appendUInt8(it.value().isNull() ? 0U : 1U, data);
+        appendString(it.value(), data);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool toBinaryConfig(const QJsonValue &value, QByteArray *data)
+{
+    using ConfigBinaryFormat::ValueTag;
+
+    switch (value.type())
+    {
+        case QJsonValue::Null:
+        {
+            appendUInt8(static_cast<quint8>(ValueTag::Null), data);
+            return true;
+        }
+
+        case QJsonValue::Bool:
+        {
+            appendUInt8(static_cast<quint8>(value.toBool() ? ValueTag::True : ValueTag::False),
+                        data);
+            return true;
+        }
+
+        case QJsonValue::Double:
+        {
+            const double number = value.toDouble();
+            quint64 bits = 0U;
+            std::memcpy(&bits, &number, sizeof(bits));
+
+            appendUInt8(static_cast<quint8>(ValueTag::Double), data);
+            appendUInt64(bits, data);
+            return true;
+        }
+
+        case QJsonValue::String:
+        {
+            appendUInt8(static_cast<quint8>(ValueTag::String), data);
+            appendString(value.toString(), data);
+            return true;
+        }
+
+        case QJsonValue::Array:
+        {
+            const QJsonArray array = value.toArray();
+            appendUInt8(static_cast<quint8>(ValueTag::Array), data);
+            appendUInt32(static_cast<quint32>(array.size()), data);
+
+            for (const auto &item : array)
+            {
+                if (!toBinaryConfig(item, data))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        case QJsonValue::Object:
+        {
+            const QJsonObject object = value.toObject();
+            appendUInt8(static_cast<quint8>(ValueTag::Object), data);
+            appendUInt32(static_cast<quint32>(object.size()), data);
+
+            for (auto it = object.begin(); it != object.end(); it++)
+            {
+                appendString(it.key(), data);
+
+                if (!toBinaryConfig(it.value(), data))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        case QJsonValue::Undefined:
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool toBinaryConfig(const ConfigObjectNode &objectNode, QByteArray *data)
+{
+    using ConfigBinaryFormat::NodeTag;
+
+    appendUInt8(static_cast<quint8>(NodeTag::Object), data);
+    appendUInt32(static_cast<quint32>(objectNode.count()), data);
+
+    for (const auto &objectMember : objectNode)
+    {
+        const auto *member = &objectMember.node();
+        appendString(objectMember.name(), data);
+
+        switch (member->type())
+        {
+            case ConfigNode::Type::Value:
+            {
+                appendUInt8(static_cast<quint8>(NodeTag::Value), data);
+
+                if (!toBinaryConfig(member->toValue().value(), data))
+                {
+                    qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                            << "Failed to write the Value node at path:"
+                            << member->nodePath().path();
+                    return false;
+                }
+                break;
+            }
+
+            case ConfigNode::Type::Object:
+            {
+                if (!toBinaryConfig(member->toObject(), data))
+                {
+                    return false;
+                }
+                break;
+            }
+
+            case ConfigNode::Type::NodeReference:
+            case ConfigNode::Type::DerivedObject:
+            default:
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                        << "Unresolved nodes cannot be written to the binary format, node path:"
+                        << member->nodePath().path();
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool writeToFile(const QByteArray &data, const QString &filePath)
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << "Failed to open file:" << filePath;
+        return false;
+    }
+
+    const qint64 writtenSize = file.write(data);
+    const auto dataSize = static_cast<qint64>(data.size());
+
+    if (writtenSize != dataSize)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << QString("Number of bytes written [%1] to the file [%2] does not match the "
+                           "number of bytes [%3] in the data")
+                   .arg(writtenSize)
+                   .arg(filePath)
+                   .arg(dataSize);
+        return false;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+//! Writes JSON directly to a device (the output is buffered and written in chunks)
+class JsonStreamWriter
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   device  Opened output device
+     * \param   format  Format of the written JSON
+     */
+    JsonStreamWriter(QIODevice *device, const QJsonDocument::JsonFormat format)
+        : m_device(device),
+          m_indented(format == QJsonDocument::Indented)
+    {
+        m_buffer.reserve(BUFFER_SIZE);
+    }
+
+    //! Starts writing a JSON Object
+    void beginObject()
+    {
+        beginValue();
+        m_buffer.append('{');
+        m_hasItems.push_back(false);
+    }
+
+    //! Finishes writing a JSON Object
+    void endObject()
+    {
+        endContainer('}');
+    }
+
+    //! Starts writing a JSON Array
+    void beginArray()
+    {
+        beginValue();
+        m_buffer.append('[');
+        m_hasItems.push_back(false);
+    }
+
+    //! Finishes writing a JSON Array
+    void endArray()
+    {
+        endContainer(']');
+    }
+
+    /*!
+     * Writes the name of the next member of a JSON Object
+     *
+     * \param   name        Member name
+     * \param   decorator   Optional decorator prefix of the member name
+     */
+    void writeName(const QString &name, const char decorator = '\0')
+    {
+        beginItem();
+
+        m_buffer.append('"');
+
+        if (decorator != '\0')
+        {
+            m_buffer.append(decorator);
+        }
+
+        appendEscaped(name);
+        m_buffer.append(m_indented ? "\": " : "\":");
+        m_afterName = true;
+    }
+
+    //! Writes a null value
+    void writeNull()
+    {
+        beginValue();
+        m_buffer.append("null");
+    }
+
+    /*!
+     * Writes a Boolean value
+     *
+     * \param   value   Value
+     */
+    void writeBool(const bool value)
+    {
+        beginValue();
+        m_buffer.append(value ? "true" : "false");
+    }
+
+    /*!
+     * Writes an integer value
+     *
+     * \param   value   Value
+     */
+    void writeInteger(const qint64 value)
+    {
+        beginValue();
+        m_buffer.append(QByteArray::number(value));
+    }
+
+    /*!
+     * Writes a numeric value
+     *
+     * \param   value   Value
+     *
+     * \note    Integral values are written without a fraction and values that are not finite are
+     *          written as null (same as QJsonDocument does)
+     */
+    void writeDouble(const double value)
+    {
+        // Max integer that can be exactly represented by a double
+        constexpr double maxExactInteger = 9007199254740992.0;
+
+        if (!std::isfinite(value))
+        {
+            writeNull();
+        }
+        else if ((std::abs(value) < maxExactInteger) && (std::trunc(value) == value))
+        {
+            writeInteger(static_cast<qint64>(value));
+        }
+        else
+        {
+            beginValue();
+            m_buffer.append(QByteArray::number(value, 'g', QLocale::FloatingPointShortest));
+        }
+    }
+
+    /*!
+     * Writes a string value
+     *
+     * \param   value   Value
+     */
+    void writeString(const QString &value)
+    {
+        beginValue();
+        m_buffer.append('"');
+        appendEscaped(value);
+        m_buffer.append('"');
+    }
+
+    /*!
+     * Writes a JSON value
+     *
+     * \param   value   Value
+     *
+     * \note    An undefined value is written as null
+     */
+    void writeValue(const QJsonValue &value)
+    {
+        switch (value.type())
+        {
+            case QJsonValue::Bool:
+            {
+                writeBool(value.toBool());
+                break;
+            }
+
+            case QJsonValue::Double:
+            {
+                writeDouble(value.toDouble());
+                break;
+            }
+
+            case QJsonValue::String:
+            {
+                writeString(value.toString());
+                break;
+            }
+
+            case QJsonValue::Array:
+            {
+                beginArray();
+
+                for (const auto &item : value.toArray())
+                {
+                    writeValue(item);
+                }
+
+                endArray();
+                break;
+            }
+
+            case QJsonValue::Object:
+            {
+                const QJsonObject object = value.toObject();
+                beginObject();
+
+                for (auto it = object.begin(); it != object.end(); it++)
+                {
+                    writeName(it.key());
+                    writeValue(it.value());
+                }
+
+                endObject();
+                break;
+            }
+
+            case QJsonValue::Null:
+            case QJsonValue::Undefined:
+            default:
+            {
+                writeNull();
+                break;
+            }
+        }
+    }
+
+    /*!
+     * Writes the remaining buffered output to the device
+     *
+     * \retval  true    Success
+     * \retval  false   Failed to write the output
+     */
+    bool finish()
+    {
+        if (m_indented)
+        {
+            m_buffer.append('\n');
+        }
+
+        return flush();
+    }
+
+private:
+    //! Size of the output chunks written to the device
+    static constexpr int BUFFER_SIZE = 16 * 1024;
+
+    //! Writes the separator and the indentation before an item of the current container
+    void beginItem()
+    {
+        if (m_buffer.size() >= BUFFER_SIZE)
+        {
+            flush();
+        }
+
+        if (m_hasItems.empty())
+        {
+            return;
+        }
+
+        if (m_hasItems.back())
+        {
+            m_buffer.append(',');
+        }
+
+        m_hasItems.back() = true;
+        appendNewLine();
+    }
+
+    //! Prepares the output for a value (either a member value or an array item)
+    void beginValue()
+    {
+        if (m_afterName)
+        {
+            m_afterName = false;
+            return;
+        }
+
+        beginItem();
+    }
+
+    /*!
+     * Finishes writing a container
+     *
+     * \param   closingCharacter    Closing character of the container
+     */
+    void endContainer(const char closingCharacter)
+    {
+        const bool hasItems = m_hasItems.back();
+        m_hasItems.pop_back();
+
+        if (hasItems)
+        {
+            appendNewLine();
+        }
+
+        m_buffer.append(closingCharacter);
+    }
+
+    //! Appends a new line and the indentation of the current container (in indented format)
+    void appendNewLine()
+    {
+        if (m_indented)
+        {
+            constexpr int indentationSize = 4;
+
+            m_buffer.append('\n');
+            m_buffer.append(QByteArray(static_cast<int>(m_hasItems.size()) * indentationSize, ' '));
+        }
+    }
+
+    /*!
+     * Appends a string with the characters escaped as needed in a JSON string
+     *
+     * \param   string  String
+     */
+    void appendEscaped(const QString &string)
+    {
+        const QByteArray utf8 = string.toUtf8();
+        const char *data = utf8.constData();
+        const int size = utf8.size();
+        int runStart = 0;
+
+        for (int i = 0; i < size; i++)
+        {
+            const auto character = static_cast<uchar>(data[i]);
+
+            if ((character >= 0x20U) && (character != '"') && (character != '\\'))
+            {
+                continue;
+            }
+
+            m_buffer.append(data + runStart, i - runStart);
+            runStart = i + 1;
+
+            switch (character)
+            {
+                case '"':
+                    m_buffer.append("\\\"");
+                    break;
+
+                case '\\':
+                    m_buffer.append("\\\\");
+                    break;
+
+                case '\b':
+                    m_buffer.append("\\b");
+                    break;
+
+                case '\f':
+                    m_buffer.append("\\f");
+                    break;
+
+                case '\n':
+                    m_buffer.append("\\n");
+                    break;
+
+                case '\r':
+                    m_buffer.append("\\r");
+                    break;
+
+                case '\t':
+                    m_buffer.append("\\t");
+                    break;
+
+                default:
+                {
+                    static const char hexDigits[] = "0123456789abcdef";
+                    m_buffer.append("\\u00");
+                    m_buffer.append(hexDigits[character >> 4U]);
+                    m_buffer.append(hexDigits[character & 0xFU]);
+                    break;
+                }
+            }
+        }
+
+        m_buffer.append(data + runStart, size - runStart);
+    }
+
+    /*!
+     * Writes the buffered output to the device
+     *
+     * \retval  true    Success
+     * \retval  false   Failed to write the output (now or previously)
+     */
+    bool flush()
+    {
+        if (!m_ok)
+        {
+            return false;
+        }
+
+        const qint64 writtenSize = m_device->write(m_buffer);
+
+        if (writtenSize != static_cast<qint64>(m_buffer.size()))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                    << QString("Number of bytes written [%1] to the device does not match the "
+                               "number of bytes [%2] in the data")
+                       .arg(writtenSize)
+                       .arg(m_buffer.size());
+            m_ok = false;
+        }
+
+        m_buffer.clear();
+        return m_ok;
+    }
+
+private:
+    //! Output device
+    QIODevice *m_device;
+
+    //! Flag that indicates if the output is indented
+    bool m_indented;
+
+    //! Buffered output
+    QByteArray m_buffer;
+
+    //! Flags that indicate if the currently open containers already have items
+    std::vector<bool> m_hasItems;
+
+    //! Flag that indicates if a member name was just written
+    bool m_afterName = false;
+
+    //! Flag that indicates if the output was written successfully so far
+    bool m_ok = true;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+bool isUndefined(const ConfigValueNode &valueNode)
+{
+    return (valueNode.storageType() == ConfigValueNode::StorageType::Json) &&
+            valueNode.value().isUndefined();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void writeJsonConfig(const ConfigValueNode &valueNode, JsonStreamWriter *writer)
+{
+    switch (valueNode.storageType())
+    {
+        case ConfigValueNode::StorageType::Null:
+        {
+            writer->writeNull();
+            break;
+        }
+
+        case ConfigValueNode::StorageType::Bool:
+        {
+            writer->writeBool(valueNode.toBool());
+            break;
+        }
+
+        case ConfigValueNode::StorageType::Integer:
+        {
+            writer->writeInteger(valueNode.toInt64());
+            break;
+        }
+
+        case ConfigValueNode::StorageType::Double:
+        {
+            writer->writeDouble(valueNode.toDouble());
+            break;
+        }
+
+        case ConfigValueNode::StorageType::String:
+        {
+            writer->writeString(valueNode.toString());
+            break;
+        }
+
+        case ConfigValueNode::StorageType::Json:
+        {
+            writer->writeValue(valueNode.value());
+            break;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool writeJsonConfig(const ConfigObjectNode &objectNode, JsonStreamWriter *writer)
+{
+    writer->beginObject();
+
+    for (const auto &objectMember : objectNode)
+    {
+        const QString &memberName = objectMember.name();
+        const auto *member = &objectMember.node();
+
+        switch (member->type())
+        {
+            case ConfigNode::Type::Value:
+            {
+                // Undefined values are left out (same as when they are inserted in a JSON Object)
+                if (!isUndefined(member->toValue()))
+                {
+                    writer->writeName(memberName, '#');
+                    writeJsonConfig(member->toValue(), writer);
+                }
+                break;
+            }
+
+            case ConfigNode::Type::Object:
+            {
+                writer->writeName(memberName);
+
+                if (!writeJsonConfig(member->toObject(), writer))
+                {
+                    return false;
+                }
+                break;
+            }
+
+            case ConfigNode::Type::NodeReference:
+            {
+                writer->writeName(memberName, '&');
+                writeJsonConfig(member->toNodeReference(), writer);
+                break;
+            }
+
+            case ConfigNode::Type::DerivedObject:
+            {
+                writer->writeName(memberName, '&');
+
+                if (!writeJsonConfig(member->toDerivedObject(), writer))
+                {
+                    return false;
+                }
+                break;
+            }
+
+            default:
+            {
+                return false;
+            }
+        }
+    }
+
+    writer->endObject();
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void writeJsonConfig(const ConfigNodeReference &nodeReference, JsonStreamWriter *writer)
+{
+    writer->writeString(nodeReference.reference().path());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool writeJsonConfig(const ConfigDerivedObjectNode &derivedObjectNode, JsonStreamWriter *writer)
+{
+    writer->beginObject();
+
+    // Base member
+    const auto &bases = derivedObjectNode.bases();
+
+    if (bases.isEmpty())
+    {
+        // The "base" member is not needed
+    }
+    else if (bases.size() == 1)
+    {
+        // Add the single base as a string
+        writer->writeName(QStringLiteral("base"));
+        writer->writeString(bases.first().path());
+    }
+    else
+    {
+        // Add the array of bases
+        writer->writeName(QStringLiteral("base"));
+        writer->beginArray();
+
+        for (const auto &base : bases)
+        {
+            writer->writeString(base.path());
+        }
+
+        writer->endArray();
+    }
+
+    // Config member
+    writer->writeName(QStringLiteral("config"));
+
+    if (!writeJsonConfig(derivedObjectNode.config(), writer))
+    {
+        return false;
+    }
+
+    writer->endObject();
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void writeJsonValue(const ConfigObjectNode &objectNode, JsonStreamWriter *writer)
+{
+    writer->beginObject();
+
+    for (const auto &objectMember : objectNode)
+    {
+        const auto *member = &objectMember.node();
+
+        if (member->isObject())
+        {
+            writer->writeName(objectMember.name());
+            writeJsonValue(member->toObject(), writer);
+        }
+        else if (!isUndefined(member->toValue()))
+        {
+            writer->writeName(objectMember.name());
+            writeJsonConfig(member->toValue(), writer);
+        }
+    }
+
+    writer->endObject();
+}
+
 } // namespace Internal
 
 // -------------------------------------------------------------------------------------------------
@@ -166,20 +1028,36 @@ QJsonDocument writeToJsonConfig(const ConfigObjectNode &node)
 
 // -------------------------------------------------------------------------------------------------
 
-bool writeToJsonConfigFile(const ConfigObjectNode &node, const QString &filePath)
+bool writeToJsonConfig(const ConfigObjectNode &node,
+                       QIODevice *device,
+                       const QJsonDocument::JsonFormat format)
 {
-    // Convert the configuration node to JSON
-    const auto doc = writeToJsonConfig(node);
+    if ((device == nullptr) || (!device->isWritable()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << "Device is not open for writing!";
+        return false;
+    }
 
-    if (doc.isEmpty())
+    Internal::JsonStreamWriter writer(device, format);
+    writer.beginObject();
+    writer.writeName(QStringLiteral("config"));
+
+    if (!Internal::writeJsonConfig(node, &writer))
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter) << "JSON document is empty!";
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << "Failed to write the configuration node to the JSON format";
         return false;
     }
 
-    const QByteArray jsonData = doc.toJson();
+    writer.endObject();
+    return writer.finish();
+}
 
-    // Write configuration to file
+// -------------------------------------------------------------------------------------------------
+
+bool writeToJsonConfigFile(const ConfigObjectNode &node, const QString &filePath)
+{
     QFile file(filePath);
 
     if (!file.open(QIODevice::WriteOnly))
@@ -189,17 +1067,11 @@ bool writeToJsonConfigFile(const ConfigObjectNode &node, const QString &filePath
         return false;
     }
 
-    const qint64 writtenSize = file.write(jsonData);
-    const auto jsonDataSize = static_cast<qint64>(jsonData.size());
-
-    if (writtenSize != jsonDataSize)
+    // Write configuration to file (without building the whole JSON document first)
+    if (!writeToJsonConfig(node, &file))
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
-                << QString("Number of bytes written [%1] to the file [%2] does not match the "
-                           "number of bytes [%3] in the JSON document")
-                   .arg(writtenSize)
-                   .arg(filePath)
-                   .arg(jsonDataSize);
+                << "Failed to write the configuration to the file:" << filePath;
         return false;
     }
 
@@ -208,13 +1080,55 @@ bool writeToJsonConfigFile(const ConfigObjectNode &node, const QString &filePath
 
 // -------------------------------------------------------------------------------------------------
 
+QByteArray writeToBinaryConfig(const ConfigObjectNode &node,
+                               const ConfigBinaryFormat::Sources &sources)
+{
+    QByteArray data;
+
+    // Header
+    Internal::appendUInt32(ConfigBinaryFormat::MAGIC, &data);
+    Internal::appendUInt32(ConfigBinaryFormat::VERSION, &data);
+    Internal::appendSources(sources, &data);
+
+    // Root node
+    if (!Internal::toBinaryConfig(node, &data))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << "Failed to write the configuration node to the binary format";
+        return {};
+    }
+
+    return data;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool writeToBinaryConfigFile(const ConfigObjectNode &node,
+                             const QString &filePath,
+                             const ConfigBinaryFormat::Sources &sources)
+{
+    // Convert the configuration node to the binary format
+    const QByteArray data = writeToBinaryConfig(node, sources);
+
+    if (data.isEmpty())
+    {
+        return false;
+    }
+
+    // Write configuration to file
+    return Internal::writeToFile(data, filePath);
+}
+
+// -------------------------------------------------------------------------------------------------
+
 QJsonValue convertToJsonValue(const ConfigObjectNode &node)
 {
     QJsonObject data;
 
-    for (const auto &memberName : node.names())
+    for (const auto &nodeMember : node)
     {
-        const auto *member = node.member(memberName);
+        const QString &memberName = nodeMember.name();
+        const auto *member = &nodeMember.node();
 
         switch (member->type())
         {
@@ -242,6 +1156,32 @@ QJsonValue convertToJsonValue(const ConfigObjectNode &node)
     return data;
 }
 
+// -------------------------------------------------------------------------------------------------
+
+bool convertToJsonValue(const ConfigObjectNode &node,
+                        QIODevice *device,
+                        const QJsonDocument::JsonFormat format)
+{
+    if ((device == nullptr) || (!device->isWritable()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << "Device is not open for writing!";
+        return false;
+    }
+
+    // Only Object and Value nodes can be converted (this is checked in advance so that nothing is
+    // written in case of failure)
+    if (node.unresolvedReferenceCount() > 0)
+    {
+        return false;
+    }
+
+    Internal::JsonStreamWriter writer(device, format);
+    Internal::writeJsonValue(node, &writer);
+
+    return writer.finish();
+}
+
 } // namespace ConfigWriter
 
 } // namespace CppConfigFramework
@@ -25,8 +25,10 @@
 #include <CppConfigFramework/ConfigNodePath.hpp>
 
 // Qt includes
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QProcessEnvironment>
-#include <QtCore/QRegularExpression>
+#include <QtCore/QSet>
 
 // Forward declarations
 
@@ -37,17 +39,444 @@
 namespace CppConfigFramework
 {
 
-EnvironmentVariables EnvironmentVariables::loadFromProcess()
+//! Innermost active lookup record scope on this thread (null if no lookups are being recorded)
+static thread_local EnvironmentVariables::LookupRecordScope *t_currentLookupRecordScope = nullptr;
+
+// -------------------------------------------------------------------------------------------------
+
+//! Gives access to the system environment variables which are read lazily from the process
+class ProcessEnvironmentLayer
 {
-    EnvironmentVariables env;
+public:
+    /*!
+     * Reads the system environment variable (only when it is accessed for the first time)
+     *
+     * \param   name    Environment variable name
+     *
+     * \param[out]  value   Optional output for the environment variable value
+     *
+     * \retval  true    Environment variable exists
+     * \retval  false   Environment variable does not exist
+     */
+    bool read(const QString &name, QString *value)
+    {
+        QMutexLocker locker(&m_mutex);
+        auto it = m_variables.constFind(name);
+
+        if (it == m_variables.constEnd())
+        {
+            // After all of the variables were read the layer holds a complete snapshot
+            if (m_complete)
+            {
+                return false;
+            }
+
+            const QByteArray nameData = name.toLocal8Bit();
+            Variable variable;
+            variable.exists = qEnvironmentVariableIsSet(nameData.constData());
+
+            if (variable.exists)
+            {
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+                variable.value = qEnvironmentVariable(nameData.constData());
+#else
+                variable.value = QString::fromLocal8Bit(qgetenv(nameData.constData()));
+#endif
+            }
+
+            it = m_variables.insert(name, variable);
+        }
+
+        if (value != nullptr)
+        {
+            *value = it.value().value;
+        }
+        return it.value().exists;
+    }
+
+    /*!
+     * Gets the names of all of the system environment variables
+     *
+     * \return  List of environment variable names
+     *
+     * \note    All of the system environment variables are read that were not yet accessed
+     */
+    QStringList names()
+    {
+        QMutexLocker locker(&m_mutex);
+
+        if (m_complete)
+        {
+            return existingNames();
+        }
+
+        const QProcessEnvironment systemEnvironment = QProcessEnvironment::systemEnvironment();
+
+        for (const QString &name : systemEnvironment.keys())
+        {
+            if (!m_variables.contains(name))
+            {
+                Variable variable;
+                variable.exists = true;
+                variable.value = systemEnvironment.value(name);
+                m_variables.insert(name, variable);
+            }
+        }
+
+        m_complete = true;
+        return existingNames();
+    }
+
+private:
+    /*!
+     * Gets the names of the already read environment variables that exist
+     *
+     * \return  List of environment variable names
+     */
+    QStringList existingNames() const
+    {
+        QStringList variableNames;
+
+        for (auto it = m_variables.constBegin(); it != m_variables.constEnd(); ++it)
+        {
+            if (it.value().exists)
+            {
+                variableNames.append(it.key());
+            }
+        }
+
+        return variableNames;
+    }
+
+private:
+    //! Holds the (remembered) state of a system environment variable
+    struct Variable
+    {
+        //! Holds the "exists" flag
+        bool exists = false;
+
+        //! Holds the value
+        QString value;
+    };
+
+    //! Protects the remembered environment variables (the layer is shared between threads)
+    QMutex m_mutex;
+
+    //! Environment variables that were already accessed
+    QHash<QString, Variable> m_variables;
+
+    //! Holds the "all of the environment variables were read" flag
+    bool m_complete = false;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Expands the references to environment variables in a single pass over the text
+class EnvironmentVariableExpander
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   environmentVariables    Environment variables
+     */
+    explicit EnvironmentVariableExpander(const EnvironmentVariables &environmentVariables)
+        : m_environmentVariables(environmentVariables)
+    {
+    }
+
+    /*!
+     * Expands the text
+     *
+     * \param   text    Text to expand
+     *
+     * \param[out]  result  Output for the expanded text (it is appended to it)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (see error())
+     */
+    bool expand(const QString &text, QString *result)
+    {
+        const int textSize = text.size();
+        int position = 0;
+
+        while (position < textSize)
+        {
+            const int referenceStart = text.indexOf(QLatin1String("${"), position);
+
+            if (referenceStart < 0)
+            {
+                result->append(text.mid(position));
+                break;
+            }
+
+            result->append(text.mid(position, referenceStart - position));
+
+            QString value;
+            int referenceEnd = 0;
+
+            switch (expandReference(text, referenceStart + 2, &value, &referenceEnd))
+            {
+                case ReferenceResult::Expanded:
+                {
+                    result->append(value);
+                    position = referenceEnd;
+                    break;
+                }
+
+                case ReferenceResult::NotReference:
+                {
+                    // Keep the "${" and try again with the text after it
+                    result->append(QLatin1String("${"));
+                    position = referenceStart + 2;
+                    break;
+                }
+
+                case ReferenceResult::Error:
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /*!
+     * Gets the expansion error
+     *
+     * \return  Expansion error
+     */
+    const EnvironmentVariables::ExpansionError &error() const
+    {
+        return m_error;
+    }
+
+private:
+    //! Results of the expansion of a reference
+    enum class ReferenceResult
+    {
+        Expanded,
+        NotReference,
+        Error
+    };
+
+    /*!
+     * Checks if the character is allowed in environment variable names
+     *
+     * \param   character   Character to check
+     *
+     * \retval  true    Allowed
+     * \retval  false   Not allowed
+     */
+    static bool isNameCharacter(const QChar character)
+    {
+        const ushort code = character.unicode();
+
+        return (((code >= 'a') && (code <= 'z')) ||
+                ((code >= 'A') && (code <= 'Z')) ||
+                ((code >= '0') && (code <= '9')) ||
+                (code == '_'));
+    }
+
+    /*!
+     * Expands the reference
+     *
+     * \param   text        Text with the reference
+     * \param   nameStart   Position of the name in the reference (after "${")
+     *
+     * \param[out]  value           Output for the expanded value
+     * \param[out]  referenceEnd    Output for the position after the reference
+     *
+     * \return  Result of the expansion
+     */
+    ReferenceResult expandReference(const QString &text,
+                                    const int nameStart,
+                                    QString *value,
+                                    int *referenceEnd)
+    {
+        const int textSize = text.size();
+        QString name;
+        int position = nameStart;
+
+        while (position < textSize)
+        {
+            const QChar character = text.at(position);
+
+            if (isNameCharacter(character))
+            {
+                name.append(character);
+                position++;
+            }
+            else if ((character == QLatin1Char('$')) &&
+                     ((position + 1) < textSize) &&
+                     (text.at(position + 1) == QLatin1Char('{')))
+            {
+                // Nested reference in the name
+                QString nestedValue;
+                const auto result = expandReference(text, position + 2, &nestedValue, &position);
+
+                if (result != ReferenceResult::Expanded)
+                {
+                    return result;
+                }
+
+                name.append(nestedValue);
+            }
+            else if ((character == QLatin1Char('}')) && (!name.isEmpty()))
+            {
+                // Values of the nested references must also be valid names
+                for (const QChar nameCharacter : name)
+                {
+                    if (!isNameCharacter(nameCharacter))
+                    {
+                        return ReferenceResult::NotReference;
+                    }
+                }
+
+                *referenceEnd = position + 1;
+                return expandVariable(name, value) ? ReferenceResult::Expanded
+                                                   : ReferenceResult::Error;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        return ReferenceResult::NotReference;
+    }
+
+    /*!
+     * Expands the value of the environment variable
+     *
+     * \param   name    Environment variable name
+     *
+     * \param[out]  value   Output for the expanded value
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool expandVariable(const QString &name, QString *value)
+    {
+        // Use the already expanded value if possible
+        const auto it = m_expandedValues.constFind(name);
+
+        if (it != m_expandedValues.constEnd())
+        {
+            *value = it.value();
+            return true;
+        }
+
+        const bool exists = m_environmentVariables.contains(name);
+        const QString rawValue = exists ? m_environmentVariables.value(name) : QString();
+
+        // An empty value is recorded as an empty (not null) string
+        EnvironmentVariables::LookupRecordScope::record(
+                    name,
+                    (exists && rawValue.isNull()) ? QString(QLatin1String("")) : rawValue);
+
+        if (!exists)
+        {
+            m_error.type = EnvironmentVariables::ExpansionError::Type::UndefinedVariable;
+            m_error.variableName = name;
+            return false;
+        }
+
+        if (m_activeVariables.contains(name))
+        {
+            m_error.type = EnvironmentVariables::ExpansionError::Type::CyclicReference;
+            m_error.variableName = name;
+            return false;
+        }
+
+        // Expand the references in the variable's value
+        m_activeVariables.insert(name);
+        QString expandedValue;
+
+        if (!expand(rawValue, &expandedValue))
+        {
+            return false;
+        }
+
+        m_activeVariables.remove(name);
+        m_expandedValues.insert(name, expandedValue);
+
+        *value = expandedValue;
+        return true;
+    }
 
-    const QProcessEnvironment systemEnvironment = QProcessEnvironment::systemEnvironment();
-    env.m_variables.clear();
+private:
+    //! Environment variables
+    const EnvironmentVariables &m_environmentVariables;
 
-    for (const QString &name : systemEnvironment.keys())
+    //! Already expanded values of the environment variables
+    QHash<QString, QString> m_expandedValues;
+
+    //! Environment variables that are currently being expanded (used for cycle detection)
+    QSet<QString> m_activeVariables;
+
+    //! Expansion error
+    EnvironmentVariables::ExpansionError m_error;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+EnvironmentVariables::LookupRecordScope::LookupRecordScope(QHash<QString, QString> *lookups)
+    : m_lookups(lookups),
+      m_previousScope(t_currentLookupRecordScope)
+{
+    t_currentLookupRecordScope = this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+EnvironmentVariables::LookupRecordScope::~LookupRecordScope()
+{
+    t_currentLookupRecordScope = m_previousScope;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void EnvironmentVariables::LookupRecordScope::record(const QString &name, const QString &value)
+{
+    for (auto *scope = t_currentLookupRecordScope; scope != nullptr; scope = scope->m_previousScope)
     {
-        env.m_variables[name] = systemEnvironment.value(name);
+        scope->m_lookups->insert(name, value);
     }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString EnvironmentVariables::ExpansionError::toString() const
+{
+    switch (type)
+    {
+        case Type::None:
+        {
+            return QStringLiteral("No error");
+        }
+
+        case Type::UndefinedVariable:
+        {
+            return QString("Environment variable [%1] is not defined").arg(variableName);
+        }
+
+        case Type::CyclicReference:
+        {
+            return QString("Environment variable [%1] references itself").arg(variableName);
+        }
+    }
+
+    return {};
+}
+
+// -------------------------------------------------------------------------------------------------
+
+EnvironmentVariables EnvironmentVariables::loadFromProcess()
+{
+    EnvironmentVariables env;
+    env.m_processEnvironment = std::make_shared<ProcessEnvironmentLayer>();
 
     return env;
 }
@@ -56,21 +485,53 @@ EnvironmentVariables EnvironmentVariables::loadFromProcess()
 
 QStringList EnvironmentVariables::names() const
 {
-    return m_variables.keys();
+    QStringList variableNames = m_variables.keys();
+
+    if (m_processEnvironment)
+    {
+        for (const QString &name : m_processEnvironment->names())
+        {
+            if (!m_variables.contains(name))
+            {
+                variableNames.append(name);
+            }
+        }
+    }
+
+    return variableNames;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 bool EnvironmentVariables::contains(const QString &name) const
 {
-    return m_variables.contains(name);
+    if (m_variables.contains(name))
+    {
+        return true;
+    }
+
+    return (m_processEnvironment && m_processEnvironment->read(name, nullptr));
 }
 
 // -------------------------------------------------------------------------------------------------
 
 QString EnvironmentVariables::value(const QString &name) const
 {
-    return m_variables[name];
+    const auto it = m_variables.constFind(name);
+
+    if (it != m_variables.constEnd())
+    {
+        return it.value();
+    }
+
+    QString processValue;
+
+    if (m_processEnvironment)
+    {
+        m_processEnvironment->read(name, &processValue);
+    }
+
+    return processValue;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -84,42 +545,25 @@ void EnvironmentVariables::setValue(const QString &name, const QString &value)
 
 QString EnvironmentVariables::expandText(const QString &text) const
 {
-    // Set the initial value
-    QString expandedText = text;
-
-    // Expand environment text in a loop in case of "nested" environment variables (max 100 cycles)
-    static const QRegularExpression regex(QStringLiteral("\\${([a-zA-Z0-9_]+)}"));
-    constexpr int maxCycles = 100;
-
-    for (int i = 0; i < maxCycles; i++)
-    {
-        // Find and replace all environment variable references with their value
-        auto it = regex.globalMatch(expandedText);
-        bool variableReferenceReplaced = false;
+    return expandText(text, nullptr);
+}
 
-        while (it.hasNext())
-        {
-            auto match = it.next();
+// -------------------------------------------------------------------------------------------------
 
-            const QString reference = match.captured(0);
-            const QString referenceName = match.captured(1);
+QString EnvironmentVariables::expandText(const QString &text, ExpansionError *error) const
+{
+    EnvironmentVariableExpander expander(*this);
+    QString expandedText(QLatin1String(""));
+    expandedText.reserve(text.size());
 
-            if (contains(referenceName))
-            {
-                expandedText.replace(reference, value(referenceName));
-                variableReferenceReplaced = true;
-            }
-        }
+    const bool expanded = expander.expand(text, &expandedText);
 
-        if (!variableReferenceReplaced)
-        {
-            // No variable reference was replaced in the last cycle, nothing left to be done
-            break;
-        }
+    if (error != nullptr)
+    {
+        *error = expander.error();
     }
 
-    // Check if all environment variable references were replaced with their value
-    if (regex.match(expandedText).hasMatch())
+    if (!expanded)
     {
         return QString();
     }
@@ -42,7 +42,10 @@ namespace LoggingCategory
 const QLoggingCategory ConfigLoader("CppConfigFramework.ConfigLoader");
 const QLoggingCategory ConfigNodePath("CppConfigFramework.ConfigNodePath");
 const QLoggingCategory ConfigParameterValidator("CppConfigFramework.ConfigParameterValidator");
+const QLoggingCategory ConfigReadStatistics("CppConfigFramework.ConfigReader.Statistics",
+                                            QtInfoMsg);
 const QLoggingCategory ConfigReader("CppConfigFramework.ConfigReader");
+const QLoggingCategory ConfigWatcher("CppConfigFramework.ConfigWatcher");
 const QLoggingCategory ConfigWriter("CppConfigFramework.ConfigWriter");
 
 } // namespace LoggingCategory
@@ -0,0 +1,437 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigBinaryReader class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigBinaryFormat.hpp>
+#include <CppConfigFramework/ConfigBinaryReader.hpp>
+#include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include <CppConfigFramework/ConfigWriter.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigBinaryReader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testWriteAndRead();
+    void testSourceAndDestinationNode();
+    void testWriteUnresolvedNodes();
+    void testSources();
+    void testInclude();
+    void testReadInvalidFile();
+
+private:
+    static ConfigObjectNode createConfig();
+    bool writeFile(const QString &fileName, const QByteArray &contents) const;
+
+    std::unique_ptr<QTemporaryDir> m_tempDir;
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigBinaryReader::initTestCase()
+{
+}
+
+void TestConfigBinaryReader::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigBinaryReader::init()
+{
+    m_tempDir = std::make_unique<QTemporaryDir>();
+    QVERIFY(m_tempDir->isValid());
+}
+
+void TestConfigBinaryReader::cleanup()
+{
+    m_tempDir.reset();
+}
+
+// Test: write and read a binary config file -------------------------------------------------------
+
+void TestConfigBinaryReader::testWriteAndRead()
+{
+    const auto config = createConfig();
+    const QString filePath = m_tempDir->filePath("config.bin");
+    QVERIFY(ConfigWriter::writeToBinaryConfigFile(config, filePath));
+
+    ConfigBinaryReader configReader;
+    const auto readConfig = configReader.read("config.bin",
+                                              QDir(m_tempDir->path()),
+                                              ConfigNodePath::ROOT_PATH,
+                                              ConfigNodePath::ROOT_PATH);
+    QVERIFY(readConfig);
+    QVERIFY(*readConfig == config);
+
+    // Check a few values explicitly
+    QCOMPARE(readConfig->nodeAtPath("/null")->toValue().value(), QJsonValue(QJsonValue::Null));
+    QCOMPARE(readConfig->nodeAtPath("/bool")->toValue().value(), QJsonValue(true));
+    QCOMPARE(readConfig->nodeAtPath("/level1/double")->toValue().value(), QJsonValue(-1.25));
+    QCOMPARE(readConfig->nodeAtPath("/level1/level2/string")->toValue().value(),
+             QJsonValue(QString::fromUtf8("\xC5\xA1tring")));
+
+    // An empty Object node is also valid
+    QVERIFY(ConfigWriter::writeToBinaryConfigFile(ConfigObjectNode(), filePath));
+
+    const auto emptyConfig = configReader.read(filePath,
+                                               QDir(),
+                                               ConfigNodePath::ROOT_PATH,
+                                               ConfigNodePath::ROOT_PATH);
+    QVERIFY(emptyConfig);
+    QCOMPARE(emptyConfig->count(), 0);
+}
+
+// Test: source and destination node paths ---------------------------------------------------------
+
+void TestConfigBinaryReader::testSourceAndDestinationNode()
+{
+    const auto config = createConfig();
+    const QString filePath = m_tempDir->filePath("config.bin");
+    QVERIFY(ConfigWriter::writeToBinaryConfigFile(config, filePath));
+
+    ConfigBinaryReader configReader;
+    const auto readConfig = configReader.read(filePath,
+                                              QDir(),
+                                              ConfigNodePath("/level1/level2"),
+                                              ConfigNodePath("/destination"));
+    QVERIFY(readConfig);
+    QCOMPARE(readConfig->names(), QStringList({ "destination" }));
+    QCOMPARE(readConfig->nodeAtPath("/destination/string")->toValue().value(),
+             QJsonValue(QString::fromUtf8("\xC5\xA1tring")));
+
+    // Invalid source node
+    QVERIFY(!configReader.read(filePath,
+                               QDir(),
+                               ConfigNodePath("/invalid"),
+                               ConfigNodePath::ROOT_PATH));
+}
+
+// Test: only fully resolved nodes can be written --------------------------------------------------
+
+void TestConfigBinaryReader::testWriteUnresolvedNodes()
+{
+    auto config = createConfig();
+    auto &level1 = config.member("level1")->toObject();
+    QVERIFY(level1.setMember("ref", ConfigNodeReference(ConfigNodePath("/a"))));
+
+    QVERIFY(ConfigWriter::writeToBinaryConfig(config).isEmpty());
+    QVERIFY(!ConfigWriter::writeToBinaryConfigFile(config, m_tempDir->filePath("config.bin")));
+    QVERIFY(!QFile::exists(m_tempDir->filePath("config.bin")));
+}
+
+// Test: sources of a binary config ---------------------------------------------------------------
+
+void TestConfigBinaryReader::testSources()
+{
+    QVERIFY(writeFile("nested.json", "{ \"config\": { \"$b\": \"${TEST_BINARY_VALUE}\" } }"));
+    QVERIFY(writeFile("source.json",
+                      "{ \"includes\": [ { \"file_path\": \"nested.json\" } ], "
+                      "\"config\": { \"a\": 1 } }"));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_BINARY_VALUE", "value");
+    const auto initialEnvironmentVariables = environmentVariables;
+
+    // Record the sources while reading the config
+    std::unique_ptr<ConfigObjectNode> config;
+    ConfigBinaryFormat::Sources sources;
+
+    {
+        const ConfigBinaryFormat::SourceRecordScope sourceRecordScope;
+        config = ConfigReader().read("source.json",
+                                     QDir(m_tempDir->path()),
+                                     ConfigNodePath::ROOT_PATH,
+                                     ConfigNodePath::ROOT_PATH,
+                                     {},
+                                     &environmentVariables);
+        QVERIFY(config);
+        QVERIFY(sourceRecordScope.sources(initialEnvironmentVariables, &sources));
+    }
+
+    // All of the read files are recorded (also the nested include)
+    QCOMPARE(sources.files.size(), static_cast<size_t>(2U));
+    QVERIFY(sources.containsFile(m_tempDir->filePath("source.json")));
+    QVERIFY(sources.containsFile(m_tempDir->filePath("nested.json")));
+    QVERIFY(!sources.containsFile(m_tempDir->filePath("missing.json")));
+    QCOMPARE(sources.environmentVariables.keys(), QStringList({ "TEST_BINARY_VALUE" }));
+    QCOMPARE(sources.environmentVariables.value("TEST_BINARY_VALUE"), QString("value"));
+    QVERIFY(!sources.isStale(environmentVariables));
+
+    // Write the binary config with the sources and read them back
+    const QString filePath = m_tempDir->filePath("config.bin");
+    QVERIFY(ConfigWriter::writeToBinaryConfigFile(*config, filePath, sources));
+
+    ConfigBinaryFormat::Sources storedSources;
+    QVERIFY(ConfigBinaryReader::readSources(filePath, &storedSources));
+    QCOMPARE(storedSources.files.size(), sources.files.size());
+
+    for (size_t i = 0U; i < sources.files.size(); i++)
+    {
+        QCOMPARE(storedSources.files.at(i).filePath, sources.files.at(i).filePath);
+        QCOMPARE(storedSources.files.at(i).size, sources.files.at(i).size);
+        QCOMPARE(storedSources.files.at(i).lastModified, sources.files.at(i).lastModified);
+    }
+
+    QCOMPARE(storedSources.environmentVariables, sources.environmentVariables);
+
+    ConfigBinaryReader configReader;
+    const auto readBinaryConfig = [&]()
+    {
+        return configReader.read(filePath,
+                                 QDir(),
+                                 ConfigNodePath::ROOT_PATH,
+                                 ConfigNodePath::ROOT_PATH,
+                                 &environmentVariables);
+    };
+
+    auto readConfig = readBinaryConfig();
+    QVERIFY(readConfig);
+    QCOMPARE(readConfig->nodeAtPath("/a")->toValue().value(), QJsonValue(1));
+    QCOMPARE(readConfig->nodeAtPath("/b")->toValue().value(), QJsonValue("value"));
+
+    // An environment variable that was not looked up does not make the binary config stale
+    environmentVariables.setValue("TEST_BINARY_UNUSED", "value");
+    QVERIFY(readBinaryConfig());
+
+    // A changed environment variable makes the binary config stale
+    environmentVariables.setValue("TEST_BINARY_VALUE", "changed");
+    QVERIFY(!readBinaryConfig());
+
+    environmentVariables.setValue("TEST_BINARY_VALUE", "value");
+    QVERIFY(readBinaryConfig());
+
+    // A changed nested include makes the binary config stale
+    QVERIFY(writeFile("nested.json", "{ \"config\": { \"$b\": \"${TEST_BINARY_VALUE}_2\" } }"));
+    QVERIFY(!readBinaryConfig());
+
+    // A missing source file makes the binary config stale
+    QVERIFY(QFile::remove(m_tempDir->filePath("nested.json")));
+    QVERIFY(!readBinaryConfig());
+
+    // The sources cannot be taken if a source file does not exist anymore
+    QVERIFY(writeFile("nested.json", "{ \"config\": { \"$b\": \"${TEST_BINARY_VALUE}\" } }"));
+
+    {
+        const ConfigBinaryFormat::SourceRecordScope sourceRecordScope;
+        QVERIFY(ConfigReader().read("source.json",
+                                    QDir(m_tempDir->path()),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables));
+        QVERIFY(QFile::remove(m_tempDir->filePath("nested.json")));
+        QVERIFY(!sourceRecordScope.sources(initialEnvironmentVariables, &sources));
+    }
+}
+
+// Test: binary config file in the includes --------------------------------------------------------
+
+void TestConfigBinaryReader::testInclude()
+{
+    QVERIFY(writeFile("source.json", "{ \"config\": { \"a\": 1 } }"));
+
+    ConfigBinaryFormat::Sources sources;
+    sources.files.push_back(ConfigBinaryFormat::SourceFile());
+    sources.files.back().filePath = m_tempDir->filePath("source.json");
+    sources.files.back().size = QFileInfo(sources.files.back().filePath).size();
+    sources.files.back().lastModified =
+            QFileInfo(sources.files.back().filePath).lastModified().toMSecsSinceEpoch();
+    QVERIFY(ConfigWriter::writeToBinaryConfigFile(createConfig(),
+                                                  m_tempDir->filePath("config.bin"),
+                                                  sources));
+
+    const auto createRootObject = [](const QJsonArray &sourceFiles)
+    {
+        const QJsonObject include {
+            { "type", "CppConfigFrameworkBinary" },
+            { "file_path", "${BINARY_CONFIG_NAME}.bin" },
+            { "source_node", "/level1" },
+            { "destination_node", "/included" },
+            { "source_files", sourceFiles }
+        };
+        return QJsonObject {
+            { "includes", QJsonArray { include } },
+            { "config", QJsonObject { { "&value", "/included/double" } } }
+        };
+    };
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("BINARY_CONFIG_NAME", "config");
+    environmentVariables.setValue("BINARY_SOURCE_NAME", "source");
+
+    ConfigReader configReader;
+    const auto read = [&](const QJsonArray &sourceFiles)
+    {
+        return configReader.read(createRootObject(sourceFiles),
+                                 QDir(m_tempDir->path()),
+                                 ConfigNodePath::ROOT_PATH,
+                                 ConfigNodePath::ROOT_PATH,
+                                 {},
+                                 &environmentVariables);
+    };
+
+    auto config = read(QJsonArray { "${BINARY_SOURCE_NAME}.json" });
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value(), QJsonValue(-1.25));
+    QCOMPARE(config->nodeAtPath("/included/level2/string")->toValue().value(),
+             QJsonValue(QString::fromUtf8("\xC5\xA1tring")));
+
+    // The source files are optional
+    QVERIFY(read(QJsonArray()));
+
+    // A source file that is not one of the sources of the binary config is rejected
+    QVERIFY(writeFile("other.json", "{ \"config\": { \"a\": 1 } }"));
+    QVERIFY(!read(QJsonArray { "other.json" }));
+
+    // A source file that cannot be expanded is rejected
+    QVERIFY(!read(QJsonArray { "${BINARY_UNDEFINED_NAME}.json" }));
+
+    // A stale binary config file is rejected (even if the source files are not set)
+    QVERIFY(writeFile("source.json", "{ \"config\": { \"a\": 12 } }"));
+    QVERIFY(!read(QJsonArray { "source.json" }));
+    QVERIFY(!read(QJsonArray()));
+}
+
+// Test: invalid binary config files ---------------------------------------------------------------
+
+void TestConfigBinaryReader::testReadInvalidFile()
+{
+    const QByteArray validData = ConfigWriter::writeToBinaryConfig(createConfig());
+    QVERIFY(!validData.isEmpty());
+
+    ConfigBinaryReader configReader;
+    const QDir workingDir(m_tempDir->path());
+    const auto root = ConfigNodePath::ROOT_PATH;
+
+    // Missing file
+    QVERIFY(!configReader.read("missing.bin", workingDir, root, root));
+
+    // Empty file
+    QVERIFY(writeFile("empty.bin", QByteArray()));
+    QVERIFY(!configReader.read("empty.bin", workingDir, root, root));
+
+    // JSON file
+    QVERIFY(writeFile("config.json", "{ \"config\": {} }"));
+    QVERIFY(!configReader.read("config.json", workingDir, root, root));
+
+    // Unsupported version
+    QByteArray data = validData;
+    data[4] = static_cast<char>(ConfigBinaryFormat::VERSION + 1U);
+    QVERIFY(writeFile("version.bin", data));
+    QVERIFY(!configReader.read("version.bin", workingDir, root, root));
+
+    ConfigBinaryFormat::Sources sources;
+    QVERIFY(!ConfigBinaryReader::readSources(m_tempDir->filePath("version.bin"), &sources));
+
+    // Truncated file
+    QVERIFY(writeFile("truncated.bin", validData.left(validData.size() - 1)));
+    QVERIFY(!configReader.read("truncated.bin", workingDir, root, root));
+
+    // Trailing data
+    QVERIFY(writeFile("trailing.bin", validData + QByteArray(1, '\0')));
+    QVERIFY(!configReader.read("trailing.bin", workingDir, root, root));
+
+    // Invalid parameters for the registry
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    QVERIFY(!configReader.read(workingDir, root, QJsonObject(), {}, &environmentVariables));
+    QVERIFY(!configReader.read(workingDir,
+                               root,
+                               QJsonObject { { "file_path", "config.bin" },
+                                             { "source_files", "source.json" } },
+                               {},
+                               &environmentVariables));
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+ConfigObjectNode TestConfigBinaryReader::createConfig()
+{
+    ConfigObjectNode level2 {
+        { "string", ConfigValueNode(QString::fromUtf8("\xC5\xA1tring")) },
+        { "array", ConfigValueNode(QJsonArray { 1, "two", QJsonObject { { "three", 3 } } }) },
+        { "object", ConfigValueNode(QJsonObject { { "a", QJsonArray() }, { "b", false } }) }
+    };
+
+    ConfigObjectNode level1 {
+        { "double", ConfigValueNode(-1.25) },
+        { "integer", ConfigValueNode(123456789) }
+    };
+    level1.setMember("level2", std::move(level2));
+
+    ConfigObjectNode config {
+        { "null", ConfigValueNode(QJsonValue::Null) },
+        { "bool", ConfigValueNode(true) }
+    };
+    config.setMember("level1", std::move(level1));
+
+    return config;
+}
+
+bool TestConfigBinaryReader::writeFile(const QString &fileName, const QByteArray &contents) const
+{
+    QFile file(m_tempDir->filePath(fileName));
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    return (file.write(contents) == contents.size());
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigBinaryReader)
+#include "testConfigBinaryReader.moc"
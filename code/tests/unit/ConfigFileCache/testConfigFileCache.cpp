@@ -0,0 +1,463 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigFileCache class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigFileCache.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigFileCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testDisabledByDefault();
+    void testDiamondIncludes();
+    void testModifiedFile();
+    void testRemoveFile();
+    void testEnvironmentVariableDependencies();
+    void testNestedEnvironmentVariableName();
+    void testEviction();
+
+private:
+    bool writeFile(const QString &fileName, const QJsonObject &rootObject) const;
+    std::unique_ptr<ConfigObjectNode> readFile(const QString &fileName,
+                                               EnvironmentVariables *environmentVariables) const;
+
+    std::unique_ptr<QTemporaryDir> m_tempDir;
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigFileCache::initTestCase()
+{
+}
+
+void TestConfigFileCache::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigFileCache::init()
+{
+    m_tempDir = std::make_unique<QTemporaryDir>();
+    QVERIFY(m_tempDir->isValid());
+
+    ConfigFileCache::instance()->setEnabled(true);
+    ConfigFileCache::instance()->setMaxFileCount(64);
+    ConfigFileCache::instance()->resetStatistics();
+}
+
+void TestConfigFileCache::cleanup()
+{
+    ConfigFileCache::instance()->setEnabled(false);
+    m_tempDir.reset();
+}
+
+// Test: cache is disabled by default --------------------------------------------------------------
+
+void TestConfigFileCache::testDisabledByDefault()
+{
+    // Disabling the cache clears it
+    ConfigFileCache::instance()->setEnabled(false);
+    QVERIFY(!ConfigFileCache::instance()->isEnabled());
+
+    QVERIFY(writeFile("config.json", QJsonObject { { "config", QJsonObject { { "a", 1 } } } }));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    QVERIFY(readFile("config.json", &environmentVariables));
+    QVERIFY(readFile("config.json", &environmentVariables));
+
+    const auto statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(ConfigFileCache::instance()->fileCount(), 0);
+    QCOMPARE(statistics.fileHits, 0);
+    QCOMPARE(statistics.fileMisses, 0);
+    QCOMPARE(statistics.configHits, 0);
+    QCOMPARE(statistics.configMisses, 0);
+}
+
+// Test: file included through several parents is parsed only once ---------------------------------
+
+void TestConfigFileCache::testDiamondIncludes()
+{
+    const QJsonArray includeCommon {
+        QJsonObject { { "file_path", "common.json" }, { "destination_node", "/common" } }
+    };
+
+    QVERIFY(writeFile("common.json", QJsonObject { { "config", QJsonObject { { "value", 1 } } } }));
+    QVERIFY(writeFile("left.json", QJsonObject {
+                          { "includes", includeCommon },
+                          { "config", QJsonObject { { "&left", "/common/value" } } }
+                      }));
+    QVERIFY(writeFile("right.json", QJsonObject {
+                          { "includes", includeCommon },
+                          { "config", QJsonObject { { "&right", "/common/value" } } }
+                      }));
+    QVERIFY(writeFile("root.json", QJsonObject {
+                          {
+                              "includes", QJsonArray {
+                                  QJsonObject { { "file_path", "left.json" } },
+                                  QJsonObject { { "file_path", "right.json" } }
+                              }
+                          },
+                          { "config", QJsonObject { { "value", 2 } } }
+                      }));
+
+    // Read with the cache
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto config = readFile("root.json", &environmentVariables);
+    QVERIFY(config);
+
+    auto statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(ConfigFileCache::instance()->fileCount(), 4);
+    QCOMPARE(statistics.fileMisses, 4);
+    QCOMPARE(statistics.fileHits, 1);
+    QCOMPARE(statistics.configMisses, 4);
+    QCOMPARE(statistics.configHits, 1);
+
+    // Read without the cache and compare the results
+    ConfigFileCache::instance()->setEnabled(false);
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto uncachedConfig = readFile("root.json", &environmentVariables);
+    QVERIFY(uncachedConfig);
+    QVERIFY(*config == *uncachedConfig);
+
+    // Check the values
+    QCOMPARE(config->nodeAtPath("/common/value")->toValue().value(), QJsonValue(1));
+    QCOMPARE(config->nodeAtPath("/left")->toValue().value(), QJsonValue(1));
+    QCOMPARE(config->nodeAtPath("/right")->toValue().value(), QJsonValue(1));
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value(), QJsonValue(2));
+
+    // Read again with the cache (everything must be found in the cache)
+    ConfigFileCache::instance()->setEnabled(true);
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    QVERIFY(readFile("root.json", &environmentVariables));
+
+    ConfigFileCache::instance()->resetStatistics();
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    config = readFile("root.json", &environmentVariables);
+    QVERIFY(config);
+    QVERIFY(*config == *uncachedConfig);
+
+    statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(statistics.fileMisses, 0);
+    QCOMPARE(statistics.fileHits, 5);
+    QCOMPARE(statistics.configMisses, 0);
+    QCOMPARE(statistics.configHits, 5);
+
+    // Read with includes read in parallel and the cache
+    ConfigFileCache::instance()->clear();
+    ConfigReader parallelConfigReader;
+    parallelConfigReader.setParallelIncludesEnabled(true);
+
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    config = parallelConfigReader.read("root.json",
+                                       QDir(m_tempDir->path()),
+                                       ConfigNodePath::ROOT_PATH,
+                                       ConfigNodePath::ROOT_PATH,
+                                       {},
+                                       &environmentVariables);
+    QVERIFY(config);
+    QVERIFY(*config == *uncachedConfig);
+    QCOMPARE(ConfigFileCache::instance()->fileCount(), 4);
+}
+
+// Test: modified file is read again ---------------------------------------------------------------
+
+void TestConfigFileCache::testModifiedFile()
+{
+    QVERIFY(writeFile("config.json", QJsonObject { { "config", QJsonObject { { "a", 1 } } } }));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto config = readFile("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/a")->toValue().value(), QJsonValue(1));
+
+    // Modify the file (the size of the file is changed so that the change is detected even if the
+    // modification time stays the same)
+    QVERIFY(writeFile("config.json", QJsonObject { { "config", QJsonObject { { "a", 100 } } } }));
+
+    config = readFile("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/a")->toValue().value(), QJsonValue(100));
+
+    const auto statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(ConfigFileCache::instance()->fileCount(), 1);
+    QCOMPARE(statistics.fileMisses, 2);
+    QCOMPARE(statistics.fileHits, 0);
+}
+
+// Test: removed file is read again even if it was not modified ------------------------------------
+
+void TestConfigFileCache::testRemoveFile()
+{
+    QVERIFY(writeFile("config.json", QJsonObject { { "config", QJsonObject { { "a", 1 } } } }));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    QVERIFY(readFile("config.json", &environmentVariables));
+    QVERIFY(readFile("config.json", &environmentVariables));
+
+    auto statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(statistics.fileMisses, 1);
+    QCOMPARE(statistics.fileHits, 1);
+
+    // Remove the file from the cache (removing an unknown file has no effect)
+    const QString absoluteFilePath =
+            QFileInfo(m_tempDir->filePath("config.json")).absoluteFilePath();
+    ConfigFileCache::instance()->removeFile(m_tempDir->filePath("unknown.json"));
+    QCOMPARE(ConfigFileCache::instance()->fileCount(), 1);
+
+    ConfigFileCache::instance()->removeFile(absoluteFilePath);
+    QCOMPARE(ConfigFileCache::instance()->fileCount(), 0);
+
+    QVERIFY(readFile("config.json", &environmentVariables));
+
+    statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(ConfigFileCache::instance()->fileCount(), 1);
+    QCOMPARE(statistics.fileMisses, 2);
+    QCOMPARE(statistics.fileHits, 1);
+    QCOMPARE(statistics.configMisses, 2);
+}
+
+// Test: cached 'config' member depends on the referenced environment variables --------------------
+
+void TestConfigFileCache::testEnvironmentVariableDependencies()
+{
+    QVERIFY(writeFile("config.json", QJsonObject {
+                          {
+                              "config", QJsonObject {
+                                  { "$value", "${TEST_VALUE}" },
+                                  { "other", "${TEST_OTHER}" }
+                              }
+                          }
+                      }));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_VALUE", "${TEST_NESTED}");
+    environmentVariables.setValue("TEST_NESTED", "a");
+
+    auto config = readFile("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value(), QJsonValue("a"));
+
+    // An unrelated environment variable does not affect the cached config
+    environmentVariables.setValue("TEST_UNRELATED", "x");
+    config = readFile("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value(), QJsonValue("a"));
+
+    auto statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(statistics.configMisses, 1);
+    QCOMPARE(statistics.configHits, 1);
+
+    // A nested environment variable affects the cached config
+    environmentVariables.setValue("TEST_NESTED", "b");
+    config = readFile("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value(), QJsonValue("b"));
+
+    statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(statistics.configMisses, 2);
+    QCOMPARE(statistics.configHits, 1);
+
+    // The config for the previous value is still cached
+    environmentVariables.setValue("TEST_NESTED", "a");
+    config = readFile("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value(), QJsonValue("a"));
+
+    statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(statistics.configMisses, 2);
+    QCOMPARE(statistics.configHits, 2);
+    QCOMPARE(statistics.fileMisses, 1);
+    QCOMPARE(statistics.fileHits, 3);
+}
+
+// Test: environment variables referenced with nested names are dependencies of the config -------
+
+void TestConfigFileCache::testNestedEnvironmentVariableName()
+{
+    QVERIFY(writeFile("config.json", QJsonObject {
+                          {
+                              "config", QJsonObject {
+                                  { "$value", "${TEST_NAME_${TEST_SUFFIX}}" }
+                              }
+                          }
+                      }));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_SUFFIX", "x");
+    environmentVariables.setValue("TEST_NAME_x", "a");
+    environmentVariables.setValue("TEST_NAME_y", "b");
+
+    auto config = readFile("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value(), QJsonValue("a"));
+
+    // The environment variable with the nested name affects the cached config
+    environmentVariables.setValue("TEST_NAME_x", "c");
+    config = readFile("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value(), QJsonValue("c"));
+
+    auto statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(statistics.configMisses, 2);
+    QCOMPARE(statistics.configHits, 0);
+
+    // The environment variable used in the nested name affects the cached config
+    environmentVariables.setValue("TEST_SUFFIX", "y");
+    config = readFile("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value(), QJsonValue("b"));
+
+    // An environment variable that was not looked up does not affect the cached config, but the
+    // ones that it depends on are still recorded as looked up
+    environmentVariables.setValue("TEST_NAME_x", "d");
+    QHash<QString, QString> lookups;
+
+    {
+        const EnvironmentVariables::LookupRecordScope lookupRecordScope(&lookups);
+        config = readFile("config.json", &environmentVariables);
+    }
+
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value(), QJsonValue("b"));
+    QCOMPARE(lookups.value("TEST_SUFFIX"), QString("y"));
+    QCOMPARE(lookups.value("TEST_NAME_y"), QString("b"));
+    QVERIFY(!lookups.contains("TEST_NAME_x"));
+
+    statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(statistics.configMisses, 3);
+    QCOMPARE(statistics.configHits, 1);
+}
+
+// Test: least recently used files are evicted -----------------------------------------------------
+
+void TestConfigFileCache::testEviction()
+{
+    ConfigFileCache::instance()->setMaxFileCount(2);
+    QCOMPARE(ConfigFileCache::instance()->maxFileCount(), 2);
+
+    for (int i = 0; i < 3; i++)
+    {
+        QVERIFY(writeFile(QString("config%1.json").arg(i),
+                          QJsonObject { { "config", QJsonObject { { "a", i } } } }));
+    }
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    QVERIFY(readFile("config0.json", &environmentVariables));
+    QVERIFY(readFile("config1.json", &environmentVariables));
+    QVERIFY(readFile("config0.json", &environmentVariables));
+    QVERIFY(readFile("config2.json", &environmentVariables));
+
+    auto statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(ConfigFileCache::instance()->fileCount(), 2);
+    QCOMPARE(statistics.evictions, 1);
+
+    // "config1.json" was the least recently used one
+    ConfigFileCache::instance()->resetStatistics();
+    QVERIFY(readFile("config0.json", &environmentVariables));
+    QVERIFY(readFile("config2.json", &environmentVariables));
+
+    statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(statistics.fileHits, 2);
+    QCOMPARE(statistics.fileMisses, 0);
+
+    QVERIFY(readFile("config1.json", &environmentVariables));
+
+    statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(statistics.fileMisses, 1);
+    QCOMPARE(statistics.evictions, 1);
+
+    // Invalid limit is ignored
+    ConfigFileCache::instance()->setMaxFileCount(0);
+    QCOMPARE(ConfigFileCache::instance()->maxFileCount(), 2);
+
+    // Lowering the limit evicts the files
+    ConfigFileCache::instance()->setMaxFileCount(1);
+    QCOMPARE(ConfigFileCache::instance()->fileCount(), 1);
+
+    ConfigFileCache::instance()->clear();
+    QCOMPARE(ConfigFileCache::instance()->fileCount(), 0);
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+bool TestConfigFileCache::writeFile(const QString &fileName, const QJsonObject &rootObject) const
+{
+    QFile file(m_tempDir->filePath(fileName));
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    const QByteArray contents = QJsonDocument(rootObject).toJson(QJsonDocument::Compact);
+    return (file.write(contents) == contents.size());
+}
+
+std::unique_ptr<ConfigObjectNode> TestConfigFileCache::readFile(
+        const QString &fileName,
+        EnvironmentVariables *environmentVariables) const
+{
+    ConfigReader configReader;
+
+    return configReader.read(fileName,
+                             QDir(m_tempDir->path()),
+                             ConfigNodePath::ROOT_PATH,
+                             ConfigNodePath::ROOT_PATH,
+                             {},
+                             environmentVariables);
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigFileCache)
+#include "testConfigFileCache.moc"
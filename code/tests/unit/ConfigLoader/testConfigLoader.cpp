@@ -20,11 +20,16 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigLoader.hpp>
+#include <CppConfigFramework/ConfigNodeReference.hpp>
 #include <CppConfigFramework/ConfigReader.hpp>
 
 // Qt includes
 #include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
 #include <QtCore/QLine>
+#include <QtCore/QMutex>
+#include <QtCore/QThread>
 #include <QtTest/QTest>
 
 // System includes
@@ -176,6 +181,71 @@ private:
     }
 };
 
+class TestRecordingConfigContainerItem : public TestConfigContainerItem
+{
+public:
+    TestRecordingConfigContainerItem(const QString &name = QString())
+        : TestConfigContainerItem(name)
+    {
+    }
+
+    static QMutex errorsMutex;
+    static QStringList errors;
+    static QList<QThread *> errorThreads;
+
+private:
+    void handleError(const QString &error) override
+    {
+        QMutexLocker locker(&errorsMutex);
+        errors.append(error);
+        errorThreads.append(QThread::currentThread());
+    }
+};
+
+QMutex TestRecordingConfigContainerItem::errorsMutex;
+QStringList TestRecordingConfigContainerItem::errors;
+QList<QThread *> TestRecordingConfigContainerItem::errorThreads;
+
+template<typename T>
+class TestParallelConfigContainer : public ConfigLoader
+{
+public:
+    using Item = typename ConfigContainerHelper<T>::ItemType;
+
+    T container;
+    bool required = true;
+    bool loaded = false;
+    QStringList errors;
+
+private:
+    static Item createItem(const QString &name)
+    {
+        return Item(name);
+    }
+
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        if (required)
+        {
+            return loadRequiredConfigContainerInParallel(&container,
+                                                         "container",
+                                                         config,
+                                                         createItem);
+        }
+
+        return loadOptionalConfigContainerInParallel(&container,
+                                                     "container",
+                                                     config,
+                                                     createItem,
+                                                     &loaded);
+    }
+
+    void handleError(const QString &error) override
+    {
+        errors.append(error);
+    }
+};
+
 class TestRequiredConfigContainerInvalidParameter : public ConfigLoader
 {
 public:
@@ -201,6 +271,122 @@ private:
     }
 };
 
+enum class TestEnum
+{
+    Value0,
+    Value1,
+    Value2
+};
+
+class TestQEnumHolder
+{
+    Q_GADGET
+
+public:
+    enum class Value
+    {
+        Value0 = 0,
+        Value2 = 2
+    };
+    Q_ENUM(Value)
+};
+
+class TestScalarConfigParameters : public ConfigLoader
+{
+public:
+    bool boolParam = false;
+    qint8 int8Param = 0;
+    quint16 uint16Param = 0;
+    qint64 int64Param = 0;
+    float floatParam = 0.0F;
+    double doubleParam = 0.0;
+    QString stringParam;
+    TestEnum enumParam = TestEnum::Value0;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        return loadRequiredConfigParameter(&boolParam, "bool", config) &&
+               loadRequiredConfigParameter(&int8Param, "int8", config) &&
+               loadRequiredConfigParameter(&uint16Param, "uint16", config) &&
+               loadRequiredConfigParameter(&int64Param, "int64", config) &&
+               loadRequiredConfigParameter(&floatParam, "float", config) &&
+               loadRequiredConfigParameter(&doubleParam, "double", config) &&
+               loadRequiredConfigParameter(&stringParam, "string", config) &&
+               loadRequiredConfigParameter(&enumParam, "enum", config);
+    }
+};
+
+class TestStructuredConfigParameters : public ConfigLoader
+{
+public:
+    QMap<QString, QHash<QString, int>> mapParam;
+    std::map<QString, QString> stdMapParam;
+    QJsonObject jsonParam;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        return loadRequiredConfigParameter(&mapParam, "map", config) &&
+               loadRequiredConfigParameter(&stdMapParam, "std_map", config) &&
+               loadRequiredConfigParameter(&jsonParam, "json", config);
+    }
+};
+
+class TestConfigParameterSchema : public ConfigLoader
+{
+public:
+    QString host;
+    int port = 0;
+    QString mode = "default";
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        static constexpr auto schema = makeConfigParameterSchema(
+                requiredConfigParameter(&TestConfigParameterSchema::host, "host"),
+                requiredConfigParameter(&TestConfigParameterSchema::port,
+                                        "port",
+                                        ConfigParameterRangeValidator<int>(1, 65535)),
+                optionalConfigParameter(&TestConfigParameterSchema::mode, "mode"));
+
+        return loadConfigParameterSchema(schema, config);
+    }
+};
+
+class TestConfigParameterSchemaWithListValidator : public ConfigLoader
+{
+public:
+    QString mode;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        static const auto schema = makeConfigParameterSchema(
+                requiredConfigParameter(&TestConfigParameterSchemaWithListValidator::mode,
+                                        "mode",
+                                        ConfigParameterListValidator<QString>({ "a", "b" })));
+
+        return loadConfigParameterSchema(schema, config);
+    }
+};
+
+class TestConfigParameterSchemaInvalidName : public ConfigLoader
+{
+public:
+    int param = 0;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        // Not a constant expression, otherwise the invalid name would not compile
+        static const auto schema = makeConfigParameterSchema(
+                optionalConfigParameter(&TestConfigParameterSchemaInvalidName::param, "0param"));
+
+        return loadConfigParameterSchema(schema, config);
+    }
+};
+
 // Test class declaration --------------------------------------------------------------------------
 
 class TestConfigLoader : public QObject
@@ -230,8 +416,14 @@ private slots:
     void testLoadOptionalConfig_data();
 
     void testLoadConfigParameter();
+    void testLoadScalarConfigParameters();
+    void testLoadScalarConfigParameters_data();
+    void testLoadConfigValueDirectly();
+    void testLoadStructuredConfigParameters();
+    void testLoadConfigParameterSchema();
 
     void testLoadConfigContainer();
+    void testLoadConfigContainerInParallel();
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -526,6 +718,165 @@ void TestConfigLoader::testLoadConfigParameter()
     }
 }
 
+// Test: loading of scalar config parameters ------------------------------------------------------
+
+void TestConfigLoader::testLoadScalarConfigParameters()
+{
+    QFETCH(QString, name);
+    QFETCH(QJsonValue, value);
+    QFETCH(bool, expectedResult);
+
+    ConfigObjectNode config;
+    config.setMember("bool", ConfigValueNode(true));
+    config.setMember("int8", ConfigValueNode(-128));
+    config.setMember("uint16", ConfigValueNode(65535));
+    config.setMember("int64", ConfigValueNode(static_cast<qint64>(1) << 40));
+    config.setMember("float", ConfigValueNode(1.5));
+    config.setMember("double", ConfigValueNode(2));
+    config.setMember("string", ConfigValueNode("abc"));
+    config.setMember("enum", ConfigValueNode(2));
+
+    if (!name.isEmpty())
+    {
+        config.member(name)->toValue().setValue(value);
+    }
+
+    TestScalarConfigParameters configStructure;
+    QCOMPARE(configStructure.loadConfig(config), expectedResult);
+
+    if (expectedResult)
+    {
+        QCOMPARE(configStructure.boolParam, true);
+        QCOMPARE(configStructure.int8Param, static_cast<qint8>(-128));
+        QCOMPARE(configStructure.uint16Param, static_cast<quint16>(65535));
+        QCOMPARE(configStructure.int64Param, static_cast<qint64>(1) << 40);
+        QCOMPARE(configStructure.floatParam, 1.5F);
+        QCOMPARE(configStructure.doubleParam, 2.0);
+        QCOMPARE(configStructure.stringParam, QString("abc"));
+        QCOMPARE(configStructure.enumParam, TestEnum::Value2);
+    }
+}
+
+void TestConfigLoader::testLoadScalarConfigParameters_data()
+{
+    QTest::addColumn<QString>("name");
+    QTest::addColumn<QJsonValue>("value");
+    QTest::addColumn<bool>("expectedResult");
+
+    QTest::newRow("Valid") << QString() << QJsonValue() << true;
+
+    QTest::newRow("Invalid bool") << "bool" << QJsonValue(1) << false;
+    QTest::newRow("Invalid int8: too small") << "int8" << QJsonValue(-129) << false;
+    QTest::newRow("Invalid int8: too big") << "int8" << QJsonValue(128) << false;
+    QTest::newRow("Invalid int8: not integral") << "int8" << QJsonValue(1.5) << false;
+    QTest::newRow("Invalid uint16: negative") << "uint16" << QJsonValue(-1) << false;
+    QTest::newRow("Invalid uint16: too big") << "uint16" << QJsonValue(65536) << false;
+    QTest::newRow("Invalid int64") << "int64" << QJsonValue("1") << false;
+    QTest::newRow("Invalid float") << "float" << QJsonValue(true) << false;
+    QTest::newRow("Invalid double") << "double" << QJsonValue(QJsonValue::Null) << false;
+    QTest::newRow("Invalid string") << "string" << QJsonValue(1) << false;
+    QTest::newRow("Invalid enum") << "enum" << QJsonValue(0.5) << false;
+}
+
+// Test: direct loading of config values -----------------------------------------------------------
+
+void TestConfigLoader::testLoadConfigValueDirectly()
+{
+    // Floating-point values out of the range of the data type are not loaded directly
+    float floatValue = 0.0F;
+    QVERIFY(ConfigValueHelper<float>::load(ConfigValueNode(1.5), &floatValue));
+    QCOMPARE(floatValue, 1.5F);
+    QVERIFY(!ConfigValueHelper<float>::load(ConfigValueNode(1e300), &floatValue));
+    QVERIFY(!ConfigValueHelper<float>::load(ConfigValueNode(-1e300), &floatValue));
+    QCOMPARE(floatValue, 1.5F);
+
+    double doubleValue = 0.0;
+    QVERIFY(ConfigValueHelper<double>::load(ConfigValueNode(1e300), &doubleValue));
+    QCOMPARE(doubleValue, 1e300);
+
+    // Q_ENUM values are loaded directly only if they match one of the enumerators
+    auto qEnumValue = TestQEnumHolder::Value::Value0;
+    QVERIFY(ConfigValueHelper<TestQEnumHolder::Value>::load(ConfigValueNode(2), &qEnumValue));
+    QCOMPARE(qEnumValue, TestQEnumHolder::Value::Value2);
+    QVERIFY(!ConfigValueHelper<TestQEnumHolder::Value>::load(ConfigValueNode(1), &qEnumValue));
+    QCOMPARE(qEnumValue, TestQEnumHolder::Value::Value2);
+
+    // Values of the other enums are not validated
+    auto enumValue = TestEnum::Value0;
+    QVERIFY(ConfigValueHelper<TestEnum>::load(ConfigValueNode(5), &enumValue));
+    QCOMPARE(static_cast<int>(enumValue), 5);
+}
+
+// Test: loading of structured config parameters --------------------------------------------------
+
+void TestConfigLoader::testLoadStructuredConfigParameters()
+{
+    ConfigObjectNode config;
+    config.setMember("map", ConfigObjectNode());
+    config.setMember("std_map", ConfigObjectNode());
+    config.setMember("json", ConfigObjectNode());
+
+    auto &mapNode = config.member("map")->toObject();
+    mapNode.setMember("a", ConfigObjectNode());
+    mapNode.member("a")->toObject().setMember("x", ConfigValueNode(1));
+    mapNode.member("a")->toObject().setMember("y", ConfigValueNode(2));
+    mapNode.setMember("b", ConfigObjectNode());
+
+    auto &stdMapNode = config.member("std_map")->toObject();
+    stdMapNode.setMember("a", ConfigValueNode("abc"));
+    stdMapNode.setMember("b", ConfigValueNode("xyz"));
+
+    auto &jsonNode = config.member("json")->toObject();
+    jsonNode.setMember("a", ConfigValueNode(QJsonArray { 1, 2 }));
+    jsonNode.setMember("b", ConfigObjectNode());
+    jsonNode.member("b")->toObject().setMember("c", ConfigValueNode(true));
+
+    // Load valid config
+    {
+        TestStructuredConfigParameters configStructure;
+        QVERIFY(configStructure.loadConfig(config));
+
+        const QMap<QString, QHash<QString, int>> expectedMap {
+            { "a", QHash<QString, int> { { "x", 1 }, { "y", 2 } } },
+            { "b", QHash<QString, int>() }
+        };
+        QCOMPARE(configStructure.mapParam, expectedMap);
+
+        const std::map<QString, QString> expectedStdMap { { "a", "abc" }, { "b", "xyz" } };
+        QVERIFY(configStructure.stdMapParam == expectedStdMap);
+
+        const QJsonObject expectedJson {
+            { "a", QJsonArray { 1, 2 } },
+            { "b", QJsonObject { { "c", true } } }
+        };
+        QCOMPARE(configStructure.jsonParam, expectedJson);
+    }
+
+    // Invalid item value leaves the parameter unchanged
+    {
+        auto invalidConfig = config.clone();
+        auto &invalidMapNode = invalidConfig->toObject().member("map")->toObject();
+        invalidMapNode.member("a")->toObject().setMember("y", ConfigValueNode("2"));
+
+        TestStructuredConfigParameters configStructure;
+        configStructure.mapParam.insert("c", QHash<QString, int>());
+        QVERIFY(!configStructure.loadConfig(invalidConfig->toObject()));
+        QCOMPARE(configStructure.mapParam.size(), 1);
+        QVERIFY(configStructure.mapParam.contains("c"));
+    }
+
+    // Unresolved reference
+    {
+        auto invalidConfig = config.clone();
+        auto &invalidMapNode = invalidConfig->toObject().member("std_map")->toObject();
+        invalidMapNode.setMember("c", ConfigNodeReference(ConfigNodePath("/std_map/a")));
+
+        TestStructuredConfigParameters configStructure;
+        QVERIFY(!configStructure.loadConfig(invalidConfig->toObject()));
+        QVERIFY(configStructure.stdMapParam.empty());
+    }
+}
+
 // Test: loading of required and optional config containers ----------------------------------------
 
 void TestConfigLoader::testLoadConfigContainer()
@@ -779,6 +1130,237 @@ void TestConfigLoader::testLoadConfigContainer()
     }
 }
 
+// Test: loading of config containers in parallel -------------------------------------------------
+
+void TestConfigLoader::testLoadConfigContainerInParallel()
+{
+    const int itemCount = 500;
+    ConfigObjectNode config;
+    config.setMember("container", ConfigObjectNode());
+    auto &containerNode = config.member("container")->toObject();
+
+    for (int i = 0; i < itemCount; i++)
+    {
+        ConfigObjectNode itemNode;
+        itemNode.setMember("param", ConfigValueNode((i % 101) - 50));
+        containerNode.setMember(QString("item%1").arg(i, 3, 10, QChar('0')), std::move(itemNode));
+    }
+
+    // Load all items
+    {
+        TestParallelConfigContainer<QVector<TestConfigContainerItem>> configStructure;
+        QVERIFY(configStructure.loadConfig(config));
+        QVERIFY(configStructure.errors.isEmpty());
+        QCOMPARE(configStructure.container.size(), itemCount);
+
+        for (int i = 0; i < itemCount; i++)
+        {
+            const auto &item = configStructure.container.at(i);
+            QCOMPARE(item.name, QString("item%1").arg(i, 3, 10, QChar('0')));
+            QCOMPARE(item.param, (i % 101) - 50);
+        }
+
+        TestParallelConfigContainer<std::map<QString, TestConfigContainerItem>> mapStructure;
+        mapStructure.required = false;
+        QVERIFY(mapStructure.loadConfig(config));
+        QVERIFY(mapStructure.loaded);
+        QCOMPARE(static_cast<int>(mapStructure.container.size()), itemCount);
+    }
+
+    // Invalid items: only the items before the first invalid one are loaded
+    {
+        auto invalidConfig = config.clone();
+        auto &invalidContainerNode = invalidConfig->toObject().member("container")->toObject();
+        invalidContainerNode.setMember("item450", ConfigValueNode(1));
+        invalidContainerNode.member("item123")->toObject().setMember("param", ConfigValueNode(99));
+        invalidContainerNode.setMember("item100", ConfigValueNode(1));
+
+        for (int run = 0; run < 10; run++)
+        {
+            TestParallelConfigContainer<QList<TestConfigContainerItem>> configStructure;
+            QVERIFY(!configStructure.loadConfig(invalidConfig->toObject()));
+            QCOMPARE(configStructure.container.size(), 100);
+            QCOMPARE(configStructure.container.last().name, QString("item099"));
+
+            // Only the error of the first invalid item and the error of the structure are reported
+            QCOMPARE(configStructure.errors.size(), 2);
+            QVERIFY(configStructure.errors.first().contains("/container/item100"));
+        }
+    }
+
+    // Failed items: only the errors of the first failed item are reported on the calling thread
+    {
+        auto invalidConfig = config.clone();
+        auto &invalidContainerNode = invalidConfig->toObject().member("container")->toObject();
+
+        for (const int index : { 123, 124, 300, 301, 499 })
+        {
+            invalidContainerNode.member(QString("item%1").arg(index))->toObject()
+                    .setMember("param", ConfigValueNode(99));
+        }
+
+        for (int run = 0; run < 10; run++)
+        {
+            TestRecordingConfigContainerItem::errors.clear();
+            TestRecordingConfigContainerItem::errorThreads.clear();
+
+            TestParallelConfigContainer<QList<TestRecordingConfigContainerItem>> configStructure;
+            QVERIFY(!configStructure.loadConfig(invalidConfig->toObject()));
+            QCOMPARE(configStructure.container.size(), 123);
+            QCOMPARE(configStructure.container.last().name, QString("item122"));
+
+            QVERIFY(!TestRecordingConfigContainerItem::errors.isEmpty());
+
+            for (const auto &error : TestRecordingConfigContainerItem::errors)
+            {
+                QVERIFY(error.contains("/container/item123"));
+            }
+
+            for (auto *thread : TestRecordingConfigContainerItem::errorThreads)
+            {
+                QCOMPARE(thread, QThread::currentThread());
+            }
+        }
+    }
+
+    // Lazy items are read on the calling thread before the items are loaded
+    {
+        ConfigObjectNode lazyConfig;
+        lazyConfig.setMember("container", ConfigObjectNode());
+        auto &lazyContainerNode = lazyConfig.member("container")->toObject();
+
+        for (int i = 0; i < itemCount; i++)
+        {
+            ConfigObjectNode itemNode;
+            itemNode.setLazyMembers(QJsonObject { { "param", (i % 101) - 50 } },
+                                    [](const QJsonObject &jsonObject)
+            {
+                auto node = std::make_unique<ConfigObjectNode>();
+                node->setMember("param", ConfigValueNode(jsonObject.value("param")));
+                return node;
+            });
+            lazyContainerNode.setMember(QString("item%1").arg(i, 3, 10, QChar('0')),
+                                        std::move(itemNode));
+        }
+
+        TestParallelConfigContainer<QVector<TestConfigContainerItem>> configStructure;
+        QVERIFY(configStructure.loadConfig(lazyConfig));
+        QVERIFY(configStructure.errors.isEmpty());
+        QCOMPARE(configStructure.container.size(), itemCount);
+        QCOMPARE(configStructure.container.last().param, ((itemCount - 1) % 101) - 50);
+
+        for (const auto &member : lazyContainerNode)
+        {
+            QVERIFY(member.node().toObject().isMaterialized());
+        }
+    }
+
+    // Missing container
+    {
+        ConfigObjectNode emptyConfig;
+
+        TestParallelConfigContainer<QVector<TestConfigContainerItem>> required;
+        QVERIFY(!required.loadConfig(emptyConfig));
+
+        TestParallelConfigContainer<QVector<TestConfigContainerItem>> optional;
+        optional.required = false;
+        optional.loaded = true;
+        QVERIFY(optional.loadConfig(emptyConfig));
+        QVERIFY(!optional.loaded);
+        QVERIFY(optional.container.isEmpty());
+    }
+}
+
+// Test: loadConfigParameterSchema() method -------------------------------------------------------
+
+void TestConfigLoader::testLoadConfigParameterSchema()
+{
+    static_assert(isValidConfigParameterName("param_1"), "Name must be valid");
+    static_assert(!isValidConfigParameterName("1param"), "Name must not be valid");
+    static_assert(!isValidConfigParameterName("param-1"), "Name must not be valid");
+    static_assert(!isValidConfigParameterName(""), "Name must not be valid");
+
+    // Load all parameters (the members that do not match any field are ignored wherever they are
+    // ordered between the fields)
+    {
+        const ConfigObjectNode config {
+            { "Host", ConfigValueNode(1) },
+            { "a", ConfigValueNode(1) },
+            { "host", ConfigValueNode("localhost") },
+            { "n", ConfigValueNode(1) },
+            { "mode", ConfigValueNode("fast") },
+            { "port", ConfigValueNode(8080) },
+            { "unused", ConfigValueNode(true) }
+        };
+
+        TestConfigParameterSchema configStructure;
+        QVERIFY(configStructure.loadConfig(config));
+        QCOMPARE(configStructure.host, QString("localhost"));
+        QCOMPARE(configStructure.port, 8080);
+        QCOMPARE(configStructure.mode, QString("fast"));
+    }
+
+    // Optional parameter keeps its value
+    {
+        const ConfigObjectNode config {
+            { "host", ConfigValueNode("localhost") },
+            { "port", ConfigValueNode(8080) }
+        };
+
+        TestConfigParameterSchema configStructure;
+        QVERIFY(configStructure.loadConfig(config));
+        QCOMPARE(configStructure.mode, QString("default"));
+    }
+
+    // Missing required parameter
+    {
+        const ConfigObjectNode config {
+            { "host", ConfigValueNode("localhost") }
+        };
+
+        TestConfigParameterSchema configStructure;
+        QVERIFY(!configStructure.loadConfig(config));
+    }
+
+    // Invalid parameter values
+    {
+        const ConfigObjectNode config {
+            { "host", ConfigValueNode("localhost") },
+            { "port", ConfigValueNode(0) }
+        };
+
+        TestConfigParameterSchema configStructure;
+        QVERIFY(!configStructure.loadConfig(config));
+    }
+
+    {
+        const ConfigObjectNode config {
+            { "host", ConfigValueNode(QJsonArray { 1 }) },
+            { "port", ConfigValueNode(8080) }
+        };
+
+        TestConfigParameterSchema configStructure;
+        QVERIFY(!configStructure.loadConfig(config));
+    }
+
+    // Validator that is not a literal type
+    {
+        TestConfigParameterSchemaWithListValidator configStructure;
+        QVERIFY(configStructure.loadConfig(ConfigObjectNode { { "mode", ConfigValueNode("b") } }));
+        QCOMPARE(configStructure.mode, QString("b"));
+        QVERIFY(!configStructure.loadConfig(ConfigObjectNode {
+                                                { "mode", ConfigValueNode("c") }
+                                            }));
+    }
+
+    // Invalid parameter name
+    {
+        TestConfigParameterSchemaInvalidName configStructure;
+        QVERIFY(!configStructure.loadConfig(ConfigObjectNode { { "param", ConfigValueNode(1) } }));
+        QCOMPARE(configStructure.param, 0);
+    }
+}
+
 // Main function -----------------------------------------------------------------------------------
 
 QTEST_MAIN(TestConfigLoader)
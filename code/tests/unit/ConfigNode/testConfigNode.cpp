@@ -26,6 +26,8 @@
 
 // Qt includes
 #include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
 #include <QtCore/QLine>
 #include <QtCore/QLineF>
 #include <QtCore/QRect>
@@ -33,6 +35,7 @@
 #include <QtTest/QTest>
 
 // System includes
+#include <cmath>
 
 // Forward declarations
 
@@ -55,6 +58,7 @@ using ConfigNodePtr = std::shared_ptr<ConfigNode>;
 
 Q_DECLARE_METATYPE(ConfigNode::Type);
 Q_DECLARE_METATYPE(ConfigNodePtr);
+Q_DECLARE_METATYPE(ConfigValueNode::StorageType);
 
 class TestConfigNode : public QObject
 {
@@ -78,6 +82,9 @@ private slots:
     void testConstructorNodeReference();
     void testConstructorDerivedObject();
 
+    void testValueStorage();
+    void testValueStorage_data();
+
     void testMoveValue();
     void testMoveObject();
     void testMoveNodeReference();
@@ -89,9 +96,17 @@ private slots:
     void testCloneDerivedObject();
 
     void testNodePath();
+    void testNodePathAfterRelocation();
 
     void testObjectNode();
+    void testObjectNodeIteration();
+    void testObjectNodeLookup();
+    void testObjectNodeUnresolvedReferenceCount();
+    void testObjectNodeTake();
+    void testObjectNodeLazyMembers();
+    void testObjectNodeSharedMembers();
     void testApplyObject();
+    void testApplyObjectMove();
 
     void testDerivedObjectNode();
 
@@ -99,6 +114,12 @@ private slots:
     void testEqualityOperatorsObject();
     void testEqualityOperatorsNodeReference();
     void testEqualityOperatorsDerivedObject();
+
+    void testContentHash();
+    void testContentHashInvalidation();
+
+    void testMemoryUsage();
+    void testTreeStatistics();
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -260,6 +281,71 @@ void TestConfigNode::testConstructorDerivedObject()
     QCOMPARE(node2.config().count(), 3);
 }
 
+// Test: Value node storage ------------------------------------------------------------------------
+
+void TestConfigNode::testValueStorage()
+{
+    QFETCH(QJsonValue, value);
+    QFETCH(ConfigValueNode::StorageType, expectedStorageType);
+
+    ConfigValueNode node(value);
+    QCOMPARE(node.storageType(), expectedStorageType);
+    QCOMPARE(node.value(), value);
+    QCOMPARE(node.value().type(), value.type());
+
+    bool ok = false;
+    QCOMPARE(node.toBool(&ok), value.toBool());
+    QCOMPARE(ok, value.isBool());
+
+    QCOMPARE(node.toDouble(&ok), value.toDouble());
+    QCOMPARE(ok, value.isDouble());
+
+    QCOMPARE(node.toString(&ok), value.toString());
+    QCOMPARE(ok, value.isString());
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+    QCOMPARE(node.toStringView(&ok).toString(), value.toString());
+    QCOMPARE(ok, value.isString());
+#endif
+
+    const qint64 integer = node.toInt64(&ok);
+    QCOMPARE(ok, (value.isDouble() && (std::trunc(value.toDouble()) == value.toDouble())));
+    QCOMPARE(integer, ok ? static_cast<qint64>(value.toDouble()) : 0);
+
+    // Clone and change the value
+    auto clonedNode = node.clone();
+    QCOMPARE(clonedNode->toValue().storageType(), expectedStorageType);
+    QVERIFY(clonedNode->toValue() == node);
+
+    clonedNode->toValue().setValue(QJsonValue("other"));
+    QCOMPARE(clonedNode->toValue().storageType(), ConfigValueNode::StorageType::String);
+    QVERIFY(clonedNode->toValue() != node);
+}
+
+void TestConfigNode::testValueStorage_data()
+{
+    QTest::addColumn<QJsonValue>("value");
+    QTest::addColumn<ConfigValueNode::StorageType>("expectedStorageType");
+
+    QTest::newRow("Null") << QJsonValue() << ConfigValueNode::StorageType::Null;
+    QTest::newRow("Bool: false") << QJsonValue(false) << ConfigValueNode::StorageType::Bool;
+    QTest::newRow("Bool: true") << QJsonValue(true) << ConfigValueNode::StorageType::Bool;
+    QTest::newRow("Integer: 0") << QJsonValue(0) << ConfigValueNode::StorageType::Integer;
+    QTest::newRow("Integer: -123") << QJsonValue(-123) << ConfigValueNode::StorageType::Integer;
+    QTest::newRow("Integer: 2^53")
+            << QJsonValue(9007199254740992.0) << ConfigValueNode::StorageType::Integer;
+    QTest::newRow("Double: 1.5") << QJsonValue(1.5) << ConfigValueNode::StorageType::Double;
+    QTest::newRow("Double: -0.0") << QJsonValue(-0.0) << ConfigValueNode::StorageType::Double;
+    QTest::newRow("Double: 2^60")
+            << QJsonValue(1152921504606846976.0) << ConfigValueNode::StorageType::Double;
+    QTest::newRow("String: empty") << QJsonValue("") << ConfigValueNode::StorageType::String;
+    QTest::newRow("String") << QJsonValue("abc") << ConfigValueNode::StorageType::String;
+    QTest::newRow("Array")
+            << QJsonValue(QJsonArray { 1, "a" }) << ConfigValueNode::StorageType::Json;
+    QTest::newRow("Object")
+            << QJsonValue(QJsonObject { { "a", 1 } }) << ConfigValueNode::StorageType::Json;
+}
+
 // Test: Move constructor and move assignment operator ---------------------------------------------
 
 void TestConfigNode::testMoveValue()
@@ -494,6 +580,30 @@ void TestConfigNode::testCloneObject()
     QCOMPARE(clonedNode->toObject().member("item2")->type(), ConfigNode::Type::Value);
     QCOMPARE(clonedNode->toObject().member("item2")->parent(), clonedNode.get());
     QCOMPARE(clonedNode->toObject().member("item2")->toValue().value(), QJsonValue("asd"));
+
+    // Clone nested nodes with unresolved nodes
+    ConfigObjectNode nestedNode;
+    nestedNode.setMember("c", ConfigValueNode(3));
+    nestedNode.setMember("a", ConfigNodeReference(ConfigNodePath("/c")));
+    nestedNode.setMember("b", ConfigObjectNode());
+    nestedNode.member("b")->toObject().setMember("ref", ConfigNodeReference(ConfigNodePath("..")));
+    QCOMPARE(nestedNode.unresolvedReferenceCount(), 2);
+
+    clonedNode = nestedNode.clone();
+    QVERIFY(clonedNode->toObject() == nestedNode);
+    QCOMPARE(clonedNode->toObject().names(), QStringList({ "a", "b", "c" }));
+    QCOMPARE(clonedNode->toObject().unresolvedReferenceCount(), 2);
+
+    const auto *clonedReference = clonedNode->nodeAtPath("/b/ref");
+    QVERIFY(clonedReference != nullptr);
+    QCOMPARE(clonedReference->parent(), clonedNode->toObject().member("b"));
+    QCOMPARE(clonedReference->nodePath(), ConfigNodePath("/b/ref"));
+    QCOMPARE(clonedNode->toObject().name(*clonedReference->parent()), QString("b"));
+
+    // Changes in the cloned node must be tracked independently of the original node
+    clonedNode->toObject().member("b")->toObject().remove("ref");
+    QCOMPARE(clonedNode->toObject().unresolvedReferenceCount(), 1);
+    QCOMPARE(nestedNode.unresolvedReferenceCount(), 2);
 }
 
 void TestConfigNode::testCloneNodeReference()
@@ -652,6 +762,41 @@ void TestConfigNode::testNodePath()
     }
 }
 
+// Test: nodePath() method after the nodes are relocated ------------------------------------------
+
+void TestConfigNode::testNodePathAfterRelocation()
+{
+    auto rootNode = std::make_unique<ConfigObjectNode>();
+    QVERIFY(rootNode->setMember("level1", ConfigObjectNode()));
+
+    auto *level1 = &rootNode->member("level1")->toObject();
+    QVERIFY(level1->setMember("item", ConfigValueNode(1)));
+
+    const auto *item = level1->member("item");
+    QCOMPARE(item->nodePath(), ConfigNodePath("/level1/item"));
+    QCOMPARE(level1->name(*item), QString("item"));
+
+    // Move the Object node to a member with a different name
+    QVERIFY(rootNode->setMember("moved",
+                                std::make_unique<ConfigObjectNode>(std::move(*level1))));
+    const auto *moved = &rootNode->member("moved")->toObject();
+    QCOMPARE(moved->member("item"), item);
+    QCOMPARE(moved->nodePath(), ConfigNodePath("/moved"));
+    QCOMPARE(item->nodePath(), ConfigNodePath("/moved/item"));
+    QCOMPARE(rootNode->member("level1")->nodePath(), ConfigNodePath("/level1"));
+    QCOMPARE(rootNode->member("level1")->toObject().count(), 0);
+
+    // Store the whole tree in a new root node
+    ConfigObjectNode newRootNode;
+    QVERIFY(newRootNode.setMember("root", std::move(rootNode)));
+    QCOMPARE(moved->nodePath(), ConfigNodePath("/root/moved"));
+    QCOMPARE(item->nodePath(), ConfigNodePath("/root/moved/item"));
+
+    // Node that only points to a parent without being its member
+    ConfigValueNode orphanNode(123, &newRootNode);
+    QCOMPARE(newRootNode.name(orphanNode), QString());
+}
+
 // Test: Object node -------------------------------------------------------------------------------
 
 void TestConfigNode::testObjectNode()
@@ -709,6 +854,313 @@ void TestConfigNode::testObjectNode()
     QCOMPARE(object.count(), 0);
 }
 
+// Test: iteration over the members of an Object node ---------------------------------------------
+
+void TestConfigNode::testObjectNodeIteration()
+{
+    ConfigObjectNode object;
+    const auto &objectConst = static_cast<const ConfigObjectNode&>(object);
+    QVERIFY(object.begin() == object.end());
+    QVERIFY(objectConst.cbegin() == objectConst.cend());
+
+    QVERIFY(object.setMember("item3", ConfigObjectNode()));
+    QVERIFY(object.setMember("item1", ConfigValueNode(1)));
+    QVERIFY(object.setMember("item2", ConfigValueNode(2)));
+
+    // Members are iterated in the order of their names
+    QStringList names;
+
+    for (const auto &member : objectConst)
+    {
+        QCOMPARE(&member.node(), objectConst.member(member.name()));
+        QCOMPARE(member.node().parent(), &object);
+        names.append(member.name());
+    }
+
+    QCOMPARE(names, QStringList({"item1", "item2", "item3"}));
+    QCOMPARE(std::distance(objectConst.begin(), objectConst.end()),
+             static_cast<std::ptrdiff_t>(object.count()));
+
+    // Members can be modified through the non-const iterator
+    for (auto &member : object)
+    {
+        if (member.node().isValue())
+        {
+            member.node().toValue().setValue(member.node().toValue().value().toInt() * 10);
+        }
+    }
+
+    QCOMPARE(object.member("item1")->toValue().value(), QJsonValue(10));
+    QCOMPARE(object.member("item2")->toValue().value(), QJsonValue(20));
+
+    // Iterator access
+    auto it = objectConst.begin();
+    QCOMPARE(it->name(), QString("item1"));
+    QCOMPARE((it++)->name(), QString("item1"));
+    QCOMPARE(it->name(), QString("item2"));
+    QCOMPARE((++it)->name(), QString("item3"));
+    QVERIFY(it->node().isObject());
+    QVERIFY(++it == objectConst.end());
+}
+
+// Test: member lookup in an Object node ----------------------------------------------------------
+
+void TestConfigNode::testObjectNodeLookup()
+{
+    ConfigObjectNode object;
+    const auto &objectConst = static_cast<const ConfigObjectNode&>(object);
+
+    // Members inserted out of order are kept sorted by name
+    QVERIFY(object.setMember("c", ConfigValueNode(3)));
+    QVERIFY(object.setMember("a", ConfigValueNode(1)));
+    QVERIFY(object.setMember("d", ConfigValueNode(4)));
+    QVERIFY(object.setMember("b", ConfigValueNode(2)));
+    QCOMPARE(object.names(), QStringList({"a", "b", "c", "d"}));
+
+    // Lookup with QLatin1String
+    QVERIFY(object.contains(QLatin1String("a")));
+    QVERIFY(!object.contains(QLatin1String("e")));
+    QCOMPARE(object.member(QLatin1String("b")), object.member("b"));
+    QCOMPARE(objectConst.member(QLatin1String("d")), objectConst.member("d"));
+    QVERIFY(object.member(QLatin1String("e")) == nullptr);
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+    // Lookup with QStringView
+    const QString name("c");
+    QVERIFY(object.contains(QStringView(name)));
+    QCOMPARE(object.member(QStringView(name)), object.member("c"));
+    QCOMPARE(objectConst.member(QStringView(name)), objectConst.member("c"));
+    QCOMPARE(object.name(*object.member(QStringView(name))), name);
+#endif
+
+    // Replacing a member keeps the order
+    QVERIFY(object.setMember("b", ConfigObjectNode()));
+    QVERIFY(object.member(QLatin1String("b"))->isObject());
+    QCOMPARE(object.names(), QStringList({"a", "b", "c", "d"}));
+    QCOMPARE(object.name(*object.member("b")), QString("b"));
+
+    // Removing members keeps the order
+    QVERIFY(object.remove("a"));
+    QVERIFY(object.remove("c"));
+    QVERIFY(!object.remove("e"));
+    QCOMPARE(object.names(), QStringList({"b", "d"}));
+    QVERIFY(!object.contains(QLatin1String("a")));
+    QCOMPARE(object.member(QLatin1String("d"))->toValue().value(), QJsonValue(4));
+}
+
+// Test: number of unresolved nodes in an Object node ---------------------------------------------
+
+void TestConfigNode::testObjectNodeUnresolvedReferenceCount()
+{
+    ConfigObjectNode root;
+    QCOMPARE(root.unresolvedReferenceCount(), 0);
+
+    // Adding unresolved nodes updates all of the ancestors
+    QVERIFY(root.setMember("level1", ConfigObjectNode()));
+    auto &level1 = root.member("level1")->toObject();
+    QVERIFY(level1.setMember("level2", ConfigObjectNode()));
+    auto &level2 = level1.member("level2")->toObject();
+
+    QVERIFY(level2.setMember("ref", ConfigNodeReference(ConfigNodePath("/value"))));
+    QVERIFY(level2.setMember("derived", ConfigDerivedObjectNode({ ConfigNodePath("/base") })));
+    QVERIFY(level1.setMember("value", ConfigValueNode(1)));
+    QCOMPARE(level2.unresolvedReferenceCount(), 2);
+    QCOMPARE(level1.unresolvedReferenceCount(), 2);
+    QCOMPARE(root.unresolvedReferenceCount(), 2);
+
+    // Cloning keeps the number of unresolved nodes
+    auto clonedRoot = root.clone();
+    QCOMPARE(clonedRoot->toObject().unresolvedReferenceCount(), 2);
+
+    // Replacing an unresolved node with a resolved node
+    QVERIFY(level2.setMember("ref", ConfigValueNode(2)));
+    QCOMPARE(level2.unresolvedReferenceCount(), 1);
+    QCOMPARE(root.unresolvedReferenceCount(), 1);
+
+    // Replacing an Object node that contains unresolved nodes
+    QVERIFY(root.setMember("other", ConfigObjectNode()));
+    QVERIFY(root.member("other")->toObject().setMember("ref", ConfigNodeReference()));
+    QCOMPARE(root.unresolvedReferenceCount(), 2);
+
+    QVERIFY(root.setMember("other", ConfigValueNode(3)));
+    QCOMPARE(root.unresolvedReferenceCount(), 1);
+
+    // Applying an Object node with unresolved nodes
+    ConfigObjectNode other;
+    QVERIFY(other.setMember("level1", ConfigObjectNode()));
+    QVERIFY(other.member("level1")->toObject().setMember("ref", ConfigNodeReference()));
+    root.apply(other);
+    QCOMPARE(level1.unresolvedReferenceCount(), 2);
+    QCOMPARE(root.unresolvedReferenceCount(), 2);
+
+    // A node that only points to a parent does not affect it
+    ConfigObjectNode temporary(&level1);
+    QVERIFY(temporary.setMember("ref", ConfigNodeReference()));
+    QCOMPARE(temporary.unresolvedReferenceCount(), 1);
+    QCOMPARE(level1.unresolvedReferenceCount(), 2);
+
+    // Moving members out of a stored node
+    ConfigObjectNode moved(std::move(level2));
+    QCOMPARE(moved.unresolvedReferenceCount(), 1);
+    QCOMPARE(level2.unresolvedReferenceCount(), 0);
+    QCOMPARE(level1.unresolvedReferenceCount(), 1);
+    QCOMPARE(root.unresolvedReferenceCount(), 1);
+
+    // Removing the unresolved nodes
+    QVERIFY(level1.remove("ref"));
+    QCOMPARE(level1.unresolvedReferenceCount(), 0);
+    QCOMPARE(root.unresolvedReferenceCount(), 0);
+
+    moved.removeAll();
+    QCOMPARE(moved.unresolvedReferenceCount(), 0);
+}
+
+// Test: ConfigObjectNode::take() method -----------------------------------------------------------
+
+void TestConfigNode::testObjectNodeTake()
+{
+    ConfigObjectNode root;
+    QVERIFY(root.setMember("value", ConfigValueNode(1)));
+    QVERIFY(root.setMember("level1", ConfigObjectNode()));
+
+    auto &level1 = root.member("level1")->toObject();
+    QVERIFY(level1.setMember("value", ConfigValueNode(2)));
+    QVERIFY(level1.setMember("ref", ConfigNodeReference(ConfigNodePath("/value"))));
+    QVERIFY(root.setMember("ref", ConfigNodeReference(ConfigNodePath("/value"))));
+    QCOMPARE(root.unresolvedReferenceCount(), 2);
+
+    const ConfigNode *level1Value = level1.member("value");
+    QCOMPARE(level1Value->nodePath(), ConfigNodePath("/level1/value"));
+
+    // Take a non-existing member
+    QVERIFY(!root.take("invalid"));
+    QCOMPARE(root.count(), 3);
+
+    // Take an Object member
+    auto takenNode = root.take("level1");
+    QVERIFY(takenNode);
+    QCOMPARE(takenNode.get(), &level1);
+    QCOMPARE(takenNode->parent(), nullptr);
+    QCOMPARE(takenNode->nodePath(), ConfigNodePath::ROOT_PATH);
+    QCOMPARE(takenNode->toObject().unresolvedReferenceCount(), 1);
+
+    QCOMPARE(takenNode->toObject().member("value"), level1Value);
+    QCOMPARE(level1Value->parent(), takenNode.get());
+    QCOMPARE(level1Value->nodePath(), ConfigNodePath("/value"));
+
+    QCOMPARE(root.names(), QStringList({ "ref", "value" }));
+    QCOMPARE(root.unresolvedReferenceCount(), 1);
+
+    // Take a NodeReference member
+    takenNode = root.take("ref");
+    QVERIFY(takenNode);
+    QVERIFY(takenNode->isNodeReference());
+    QCOMPARE(takenNode->parent(), nullptr);
+    QCOMPARE(root.names(), QStringList({ "value" }));
+    QCOMPARE(root.unresolvedReferenceCount(), 0);
+
+    // The taken node can be stored again
+    QVERIFY(root.setMember("ref2", std::move(takenNode)));
+    QCOMPARE(root.member("ref2")->nodePath(), ConfigNodePath("/ref2"));
+    QCOMPARE(root.unresolvedReferenceCount(), 1);
+}
+
+// Test: lazy members of ConfigObjectNode ----------------------------------------------------------
+
+void TestConfigNode::testObjectNodeLazyMembers()
+{
+    ConfigObjectNode root;
+    root.setMember("lazy", ConfigObjectNode());
+    auto &lazy = root.member("lazy")->toObject();
+
+    lazy.setLazyMembers(QJsonObject { {"a", 1} },
+                        [](const QJsonObject &jsonObject)
+    {
+        auto node = std::make_unique<ConfigObjectNode>();
+        node->setMember("a", ConfigValueNode(jsonObject.value("a")));
+        return node;
+    });
+    QVERIFY(!lazy.isMaterialized());
+
+    // Members are read on the first access and they are owned by the node
+    QVERIFY(lazy.materialize());
+    QVERIFY(lazy.isMaterialized());
+    QCOMPARE(lazy.count(), 1);
+    QCOMPARE(lazy.member("a")->parent(), &lazy);
+    QCOMPARE(lazy.member("a")->nodePath(), ConfigNodePath("/lazy/a"));
+
+    // Failure to read the members is reported and the lazy members are kept
+    lazy.setLazyMembers(QJsonObject { {"a", 1} },
+                        [](const QJsonObject &) { return std::unique_ptr<ConfigObjectNode>(); });
+
+    QVERIFY(!lazy.materialize());
+    QVERIFY(!lazy.isMaterialized());
+    QVERIFY(!root.materializeAll());
+    QCOMPARE(lazy.count(), 0);
+}
+
+// Test: ConfigObjectNode::setSharedMembers() method -----------------------------------------------
+
+void TestConfigNode::testObjectNodeSharedMembers()
+{
+    auto sharedNode = std::make_shared<ConfigObjectNode>();
+    sharedNode->setMember("a", ConfigValueNode(1));
+    sharedNode->setMember("b", ConfigObjectNode());
+    sharedNode->nodeAtPath("b")->toObject().setMember("c", ConfigValueNode(2));
+    sharedNode->nodeAtPath("b")->toObject().setMember("d", ConfigObjectNode());
+    sharedNode->nodeAtPath("b/d")->toObject().setMember("e", ConfigValueNode(3));
+    sharedNode->setMember("f", ConfigObjectNode());
+    sharedNode->nodeAtPath("f")->toObject().setMember("g", ConfigValueNode(4));
+    sharedNode->contentHash();
+
+    ConfigObjectNode root;
+    root.setMember("shared1", ConfigObjectNode());
+    root.setMember("shared2", ConfigObjectNode());
+    auto &shared1 = root.member("shared1")->toObject();
+    auto &shared2 = root.member("shared2")->toObject();
+    shared1.setSharedMembers(sharedNode);
+    shared2.setSharedMembers(sharedNode);
+
+    // Members are not copied until they are accessed
+    QVERIFY(!shared1.isMaterialized());
+    QCOMPARE(shared1.contentHash(), sharedNode->contentHash());
+    QVERIFY(shared1.hasSameContents(shared2));
+    QVERIFY(!shared1.isMaterialized());
+    QVERIFY(!shared2.isMaterialized());
+
+    const auto usage = root.memoryUsage();
+    QCOMPARE(usage.sharedSubtreeCount, 2);
+    QVERIFY(usage.sharedSubtreeBytes > 0);
+    QCOMPARE(usage.valueNodes.count, 0);
+
+    // A change copies only the nodes on the node path to the changed node
+    shared1.nodeAtPath("b/c")->toValue().setValue(20);
+    QVERIFY(shared1.isMaterialized());
+    QVERIFY(shared1.member("b")->toObject().isMaterialized());
+    QVERIFY(!shared1.nodeAtPath("b")->toObject().member("d")->toObject().isMaterialized());
+    QVERIFY(!shared1.member("f")->toObject().isMaterialized());
+    QCOMPARE(shared1.nodeAtPath("b/c")->nodePath(), ConfigNodePath("/shared1/b/c"));
+    QCOMPARE(shared1.nodeAtPath("b/c")->parent(), &shared1.member("b")->toObject());
+
+    // Other nodes and the shared node are not affected
+    QCOMPARE(shared2.nodeAtPath("b/c")->toValue().value(), QJsonValue(2));
+    QCOMPARE(sharedNode->nodeAtPath("b/c")->toValue().value(), QJsonValue(2));
+    QVERIFY(!shared1.hasSameContents(shared2));
+    QCOMPARE(shared2.nodeAtPath("b/d/e")->toValue().value(), QJsonValue(3));
+    QVERIFY(shared2.hasSameContents(*sharedNode));
+
+    // Cloned node still shares the members
+    auto clonedNode = shared1.member("f")->clone();
+    QVERIFY(!clonedNode->toObject().isMaterialized());
+    QCOMPARE(clonedNode->nodeAtPath("g")->toValue().value(), QJsonValue(4));
+
+    // Members can be removed and added
+    QVERIFY(shared2.remove("f"));
+    QVERIFY(shared2.setMember("h", ConfigValueNode(5)));
+    QCOMPARE(shared2.names(), QStringList({ "a", "b", "h" }));
+    QCOMPARE(sharedNode->names(), QStringList({ "a", "b", "f" }));
+}
+
 // Test: ConfigObjectNode::apply() method ----------------------------------------------------------
 
 void TestConfigNode::testApplyObject()
@@ -778,6 +1230,68 @@ void TestConfigNode::testApplyObject()
     QCOMPARE(node.nodeAtPath("level1/level2/value")->toValue().value(), QJsonValue(789));
 }
 
+// Test: ConfigObjectNode::apply() method with an rvalue -------------------------------------------
+
+void TestConfigNode::testApplyObjectMove()
+{
+    // Create a 2 level node structure
+    ConfigObjectNode parentNode;
+    parentNode.setMember("node", ConfigObjectNode());
+    auto &node = parentNode.member("node")->toObject();
+
+    node.setMember("value", ConfigValueNode(111));
+    node.setMember("valueToObject", ConfigValueNode(1));
+    node.setMember("level1", ConfigObjectNode());
+    node.member("level1")->toObject().setMember("value", ConfigValueNode(123));
+
+    // Create a compatible node structure for the update (with unresolved nodes)
+    ConfigObjectNode updateParentNode;
+    updateParentNode.setMember("update", ConfigObjectNode());
+    auto &update = updateParentNode.member("update")->toObject();
+
+    update.setMember("value", ConfigValueNode(222));
+    update.setMember("valueToObject", ConfigObjectNode());
+    update.member("valueToObject")->toObject().setMember("ref", ConfigNodeReference());
+    update.setMember("level1", ConfigObjectNode());
+    update.member("level1")->toObject().setMember("value", ConfigValueNode(456));
+    update.member("level1")->toObject().setMember("ref", ConfigNodeReference());
+    update.setMember("new", ConfigObjectNode());
+    QCOMPARE(updateParentNode.unresolvedReferenceCount(), 2);
+
+    // The result must be the same as when the update is copied
+    ConfigObjectNode expectedParentNode;
+    expectedParentNode.setMember("node", node);
+    auto &expectedNode = expectedParentNode.member("node")->toObject();
+    expectedNode.apply(update);
+
+    const ConfigNode *valueToObject = update.member("valueToObject");
+    const ConfigNode *level1Reference = update.nodeAtPath("level1/ref");
+    const ConfigNode *newNode = update.member("new");
+
+    // Apply the update
+    node.apply(std::move(update));
+    QVERIFY(node == expectedNode);
+
+    // Check that the nodes were moved and not copied
+    QCOMPARE(node.member("valueToObject"), valueToObject);
+    QCOMPARE(node.nodeAtPath("level1/ref"), level1Reference);
+    QCOMPARE(node.member("new"), newNode);
+
+    QCOMPARE(valueToObject->parent(), &node);
+    QCOMPARE(valueToObject->nodePath(), ConfigNodePath("/node/valueToObject"));
+    QCOMPARE(level1Reference->parent(), node.member("level1"));
+    QCOMPARE(level1Reference->nodePath(), ConfigNodePath("/node/level1/ref"));
+
+    // Check the number of unresolved nodes
+    QCOMPARE(node.unresolvedReferenceCount(), 2);
+    QCOMPARE(parentNode.unresolvedReferenceCount(), 2);
+
+    // Check that the update is empty
+    QCOMPARE(update.count(), 0);
+    QCOMPARE(update.unresolvedReferenceCount(), 0);
+    QCOMPARE(updateParentNode.unresolvedReferenceCount(), 0);
+}
+
 // Test: DerivedObject node ------------------------------------------------------------------------
 
 void TestConfigNode::testDerivedObjectNode()
@@ -809,6 +1323,24 @@ void TestConfigNode::testDerivedObjectNode()
     QVERIFY(derivedObject.config().contains("b"));
     QVERIFY(derivedObject.config().member("b")->isValue());
     QCOMPARE(derivedObject.config().member("b")->toValue().value(), QJsonValue("str"));
+
+    // Move overloads
+    ConfigObjectNode parentNode;
+    ConfigObjectNode movedConfig(&parentNode);
+    movedConfig.setMember("c", ConfigValueNode(3));
+
+    derivedObject.setConfig(std::move(movedConfig));
+    QCOMPARE(derivedObject.config().count(), 1);
+    QCOMPARE(derivedObject.config().parent(), nullptr);
+    QCOMPARE(derivedObject.config().member("c")->parent(), &derivedObject.config());
+    QCOMPARE(derivedObject.config().member("c")->toValue().value(), QJsonValue(3));
+
+    ConfigDerivedObjectNode movedDerivedObject(bases,
+                                               ConfigObjectNode { { "d", ConfigValueNode(4) } });
+    QCOMPARE(movedDerivedObject.bases(), bases);
+    QCOMPARE(movedDerivedObject.config().count(), 1);
+    QCOMPARE(movedDerivedObject.config().member("d")->parent(), &movedDerivedObject.config());
+    QCOMPARE(movedDerivedObject.config().member("d")->toValue().value(), QJsonValue(4));
 }
 
 // Test: Equality operators for Value node ---------------------------------------------------------
@@ -1094,6 +1626,262 @@ void TestConfigNode::testEqualityOperatorsDerivedObject()
     QVERIFY(!(root1.member("test")->toDerivedObject() == root3.member("other")->toDerivedObject()));
 }
 
+// Test: contentHash() method ----------------------------------------------------------------------
+
+void TestConfigNode::testContentHash()
+{
+    // Value nodes
+    QCOMPARE(ConfigValueNode().contentHash(), ConfigValueNode().contentHash());
+    QCOMPARE(ConfigValueNode(1).contentHash(), ConfigValueNode(1).contentHash());
+    QCOMPARE(ConfigValueNode(1).contentHash(), ConfigValueNode(1.0).contentHash());
+    QCOMPARE(ConfigValueNode(1.5).contentHash(), ConfigValueNode(1.5).contentHash());
+    QCOMPARE(ConfigValueNode("str").contentHash(), ConfigValueNode("str").contentHash());
+    QCOMPARE(ConfigValueNode(QJsonArray { 1, "a" }).contentHash(),
+             ConfigValueNode(QJsonArray { 1, "a" }).contentHash());
+
+    QVERIFY(ConfigValueNode().contentHash() != ConfigValueNode(false).contentHash());
+    QVERIFY(ConfigValueNode(false).contentHash() != ConfigValueNode(true).contentHash());
+    QVERIFY(ConfigValueNode(1).contentHash() != ConfigValueNode(2).contentHash());
+    QVERIFY(ConfigValueNode(1).contentHash() != ConfigValueNode(true).contentHash());
+    QVERIFY(ConfigValueNode(1).contentHash() != ConfigValueNode("1").contentHash());
+    QVERIFY(ConfigValueNode(1.5).contentHash() != ConfigValueNode(2.5).contentHash());
+    QVERIFY(ConfigValueNode("str").contentHash() != ConfigValueNode("abc").contentHash());
+    QVERIFY(ConfigValueNode(QJsonArray { 1, "a" }).contentHash() !=
+            ConfigValueNode(QJsonArray { 1, "b" }).contentHash());
+
+    // Object nodes (the order in which the members are set doesn't matter)
+    ConfigObjectNode object1;
+    object1.setMember("a", ConfigValueNode(1));
+    object1.setMember("b", ConfigValueNode("str"));
+
+    ConfigObjectNode object2;
+    object2.setMember("b", ConfigValueNode("str"));
+    object2.setMember("a", ConfigValueNode(1));
+
+    ConfigObjectNode object3;
+    object3.setMember("a", ConfigValueNode(1));
+    object3.setMember("c", ConfigValueNode("str"));
+
+    QCOMPARE(object1.contentHash(), object2.contentHash());
+    QVERIFY(object1.contentHash() != object3.contentHash());
+    QVERIFY(object1.contentHash() != ConfigObjectNode().contentHash());
+    QCOMPARE(object1.clone()->contentHash(), object1.contentHash());
+
+    // NodeReference nodes
+    QCOMPARE(ConfigNodeReference(ConfigNodePath("/a")).contentHash(),
+             ConfigNodeReference(ConfigNodePath("/a")).contentHash());
+    QVERIFY(ConfigNodeReference(ConfigNodePath("/a")).contentHash() !=
+            ConfigNodeReference(ConfigNodePath("/b")).contentHash());
+    QVERIFY(ConfigNodeReference(ConfigNodePath("/a")).contentHash() !=
+            ConfigValueNode("/a").contentHash());
+
+    // DerivedObject nodes
+    ConfigDerivedObjectNode derived1({ConfigNodePath("/base")}, object1);
+    ConfigDerivedObjectNode derived2({ConfigNodePath("/base")}, object2);
+    ConfigDerivedObjectNode derived3({ConfigNodePath("/xyz")}, object1);
+    ConfigDerivedObjectNode derived4({ConfigNodePath("/base")}, object3);
+
+    QCOMPARE(derived1.contentHash(), derived2.contentHash());
+    QVERIFY(derived1.contentHash() != derived3.contentHash());
+    QVERIFY(derived1.contentHash() != derived4.contentHash());
+    QVERIFY(derived1.contentHash() != object1.contentHash());
+    QCOMPARE(derived1.clone()->contentHash(), derived1.contentHash());
+
+    // Location of the node is not a part of its contents
+    ConfigObjectNode root;
+    root.setMember("object1", object1);
+    root.setMember("nested", ConfigObjectNode());
+    root.member("nested")->toObject().setMember("object2", object2);
+
+    QCOMPARE(root.member("object1")->contentHash(), object1.contentHash());
+    QCOMPARE(root.nodeAtPath("/nested/object2")->contentHash(), object1.contentHash());
+}
+
+// Test: contentHash() method after the contents are changed ---------------------------------------
+
+void TestConfigNode::testContentHashInvalidation()
+{
+    ConfigObjectNode nested;
+    nested.setMember("x", ConfigValueNode(1));
+    nested.setMember("ref", ConfigNodeReference(ConfigNodePath("/a")));
+
+    ConfigObjectNode overloads;
+    overloads.setMember("y", ConfigValueNode(2));
+
+    ConfigObjectNode root;
+    root.setMember("nested", nested);
+    root.setMember("derived", ConfigDerivedObjectNode({ConfigNodePath("/base")}, overloads));
+
+    const quint64 hash = root.contentHash();
+    const quint64 nestedHash = root.member("nested")->contentHash();
+
+    // Value node
+    root.nodeAtPath("/nested/x")->toValue().setValue(2);
+    QVERIFY(root.contentHash() != hash);
+    QVERIFY(root.member("nested")->contentHash() != nestedHash);
+
+    root.nodeAtPath("/nested/x")->toValue().setValue(1);
+    QCOMPARE(root.contentHash(), hash);
+    QCOMPARE(root.member("nested")->contentHash(), nestedHash);
+
+    // NodeReference node
+    root.nodeAtPath("/nested/ref")->toNodeReference().setReference(ConfigNodePath("/b"));
+    QVERIFY(root.contentHash() != hash);
+
+    root.nodeAtPath("/nested/ref")->toNodeReference().setReference(ConfigNodePath("/a"));
+    QCOMPARE(root.contentHash(), hash);
+
+    // Object node
+    root.member("nested")->toObject().setMember("z", ConfigValueNode(3));
+    QVERIFY(root.contentHash() != hash);
+
+    QVERIFY(root.member("nested")->toObject().remove("z"));
+    QCOMPARE(root.contentHash(), hash);
+
+    auto taken = root.member("nested")->toObject().take("x");
+    QVERIFY(root.contentHash() != hash);
+    QCOMPARE(taken->contentHash(), ConfigValueNode(1).contentHash());
+
+    root.member("nested")->toObject().setMember("x", std::move(taken));
+    QCOMPARE(root.contentHash(), hash);
+
+    ConfigObjectNode applied;
+    applied.setMember("x", ConfigValueNode(5));
+    root.member("nested")->toObject().apply(applied);
+    QVERIFY(root.contentHash() != hash);
+
+    root.nodeAtPath("/nested/x")->toValue().setValue(1);
+    QCOMPARE(root.contentHash(), hash);
+
+    // DerivedObject node
+    auto &derived = root.member("derived")->toDerivedObject();
+    derived.setBases({ConfigNodePath("/xyz")});
+    QVERIFY(root.contentHash() != hash);
+
+    derived.setBases({ConfigNodePath("/base")});
+    QCOMPARE(root.contentHash(), hash);
+
+    derived.config().setMember("y", ConfigValueNode(20));
+    QVERIFY(root.contentHash() != hash);
+
+    derived.config().member("y")->toValue().setValue(2);
+    QCOMPARE(root.contentHash(), hash);
+
+    derived.setConfig(ConfigObjectNode());
+    QVERIFY(root.contentHash() != hash);
+
+    derived.setConfig(overloads);
+    QCOMPARE(root.contentHash(), hash);
+
+    // Moved DerivedObject node
+    ConfigDerivedObjectNode movedDerived(std::move(derived));
+    const quint64 movedHash = movedDerived.contentHash();
+
+    movedDerived.config().setMember("y", ConfigValueNode(20));
+    QVERIFY(movedDerived.contentHash() != movedHash);
+}
+
+// Test: memory usage ------------------------------------------------------------------------------
+
+void TestConfigNode::testMemoryUsage()
+{
+    ConfigObjectNode overloads;
+    overloads.setMember("y", ConfigValueNode(2));
+
+    ConfigObjectNode root;
+    root.setMember("integer", ConfigValueNode(1));
+    root.setMember("string", ConfigValueNode(QString("some") + QString(" text")));
+    root.setMember("array", ConfigValueNode(QJsonArray {1, "two", 3}));
+    root.setMember("ref", ConfigNodeReference(ConfigNodePath("/integer")));
+    root.setMember("derived", ConfigDerivedObjectNode({ConfigNodePath("/base")}, overloads));
+
+    const auto usage = root.memoryUsage();
+
+    QCOMPARE(usage.valueNodes.count, 4);
+    QCOMPARE(usage.valueNodes.bytes, 4 * static_cast<qint64>(sizeof(ConfigValueNode)));
+    QCOMPARE(usage.objectNodes.count, 1);
+    QCOMPARE(usage.objectNodes.bytes, static_cast<qint64>(sizeof(ConfigObjectNode)));
+    QCOMPARE(usage.nodeReferenceNodes.count, 1);
+    QCOMPARE(usage.derivedObjectNodes.count, 1);
+    QVERIFY(usage.memberContainerBytes > 0);
+    QVERIFY(usage.memberNameBytes > 0);
+    QVERIFY(usage.valuePayloadBytes > 0);
+    QVERIFY(usage.referenceBytes > 0);
+    QCOMPARE(usage.sharedBytes(), 0);
+    QCOMPARE(usage.totalBytes(), usage.ownedBytes());
+
+    // Adding a member increases the memory usage
+    root.setMember("other", ConfigValueNode(QString("other") + QString(" text")));
+    QVERIFY(root.memoryUsage().totalBytes() > usage.totalBytes());
+
+    // Lazy members are reported as shared and they are not materialized
+    ConfigObjectNode lazy;
+    lazy.setLazyMembers(QJsonObject { {"a", 1}, {"b", "text"} },
+                        [](const QJsonObject &) { return std::make_unique<ConfigObjectNode>(); });
+
+    const auto lazyUsage = lazy.memoryUsage();
+    QCOMPARE(lazyUsage.lazySubtreeCount, 1);
+    QVERIFY(lazyUsage.lazySubtreeBytes > 0);
+    QCOMPARE(lazyUsage.sharedBytes(), lazyUsage.lazySubtreeBytes);
+    QCOMPARE(lazyUsage.valueNodes.count, 0);
+    QVERIFY(!lazy.isMaterialized());
+
+    // JSON
+    const QJsonObject json = usage.toJson();
+    QCOMPARE(json.value("total_bytes").toDouble(), static_cast<double>(usage.totalBytes()));
+    QCOMPARE(json.value("value_nodes").toObject().value("count").toInt(), 4);
+    QVERIFY(!usage.toString().isEmpty());
+}
+
+// Test: tree statistics ---------------------------------------------------------------------------
+
+void TestConfigNode::testTreeStatistics()
+{
+    ConfigObjectNode overloads;
+    overloads.setMember("y", ConfigValueNode(2));
+
+    ConfigObjectNode wide;
+    wide.setMember("a", ConfigValueNode(1));
+    wide.setMember("b", ConfigValueNode(2));
+    wide.setMember("c", ConfigValueNode(3));
+
+    ConfigObjectNode nested;
+    nested.setMember("wide", wide);
+    nested.setMember("ref", ConfigNodeReference(ConfigNodePath("/nested/wide/a")));
+
+    ConfigObjectNode root;
+    root.setMember("nested", nested);
+    root.setMember("derived",
+                   ConfigDerivedObjectNode({ConfigNodePath("/base1"), ConfigNodePath("/base2")},
+                                           overloads));
+
+    const auto statistics = root.treeStatistics();
+
+    QCOMPARE(statistics.valueNodeCount, 4);
+    QCOMPARE(statistics.objectNodeCount, 3);
+    QCOMPARE(statistics.nodeReferenceCount, 1);
+    QCOMPARE(statistics.derivedObjectCount, 1);
+    QCOMPARE(statistics.nodeCount(), 9);
+    QCOMPARE(statistics.lazyObjectCount, 0);
+    QCOMPARE(statistics.referenceCount, 3);
+    QCOMPARE(statistics.maxDepth, 3);
+    QCOMPARE(statistics.widestObjectMemberCount, 3);
+    QCOMPARE(statistics.widestObjectNodePath, QString("/nested/wide"));
+
+    // Statistics of a single node
+    const auto valueStatistics = ConfigValueNode(1).treeStatistics();
+    QCOMPARE(valueStatistics.nodeCount(), 1);
+    QCOMPARE(valueStatistics.maxDepth, 0);
+    QVERIFY(valueStatistics.widestObjectNodePath.isEmpty());
+
+    // JSON
+    const QJsonObject json = statistics.toJson();
+    QCOMPARE(json.value("node_count").toInt(), 9);
+    QCOMPARE(json.value("max_depth").toInt(), 3);
+    QCOMPARE(json.value("widest_object_node_path").toString(), QString("/nested/wide"));
+    QVERIFY(!statistics.toString().isEmpty());
+}
+
 // Main function -----------------------------------------------------------------------------------
 
 QTEST_MAIN(TestConfigNode)
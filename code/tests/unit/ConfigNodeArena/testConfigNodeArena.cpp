@@ -0,0 +1,261 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigNodeArena class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtTest/QTest>
+
+// System includes
+#include <thread>
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigNodeArena : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testScope();
+    void testSuspendScope();
+    void testNodeLifetime();
+    void testReader();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigNodeArena::initTestCase()
+{
+}
+
+void TestConfigNodeArena::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigNodeArena::init()
+{
+    QCOMPARE(ConfigNodeArena::arenaCount(), 0);
+}
+
+void TestConfigNodeArena::cleanup()
+{
+}
+
+// Test: arena scope -------------------------------------------------------------------------------
+
+void TestConfigNodeArena::testScope()
+{
+    QVERIFY(!ConfigNodeArena::isActive());
+
+    {
+        const ConfigNodeArena::Scope disabledScope(false);
+        QVERIFY(!ConfigNodeArena::isActive());
+        QCOMPARE(ConfigNodeArena::arenaCount(), 0);
+    }
+
+    {
+        const ConfigNodeArena::Scope scope;
+        QVERIFY(ConfigNodeArena::isActive());
+        QCOMPARE(ConfigNodeArena::arenaCount(), 1);
+
+        {
+            // Nested scope uses the arena of the outer scope
+            const ConfigNodeArena::Scope nestedScope;
+            QVERIFY(ConfigNodeArena::isActive());
+            QCOMPARE(ConfigNodeArena::arenaCount(), 1);
+        }
+
+        QVERIFY(ConfigNodeArena::isActive());
+    }
+
+    // Unused arena is released together with its scope
+    QVERIFY(!ConfigNodeArena::isActive());
+    QCOMPARE(ConfigNodeArena::arenaCount(), 0);
+}
+
+// Test: suspended arena scope ---------------------------------------------------------------------
+
+void TestConfigNodeArena::testSuspendScope()
+{
+    std::unique_ptr<ConfigObjectNode> heapNode;
+
+    {
+        const ConfigNodeArena::Scope scope;
+
+        {
+            const ConfigNodeArena::SuspendScope suspendScope;
+            QVERIFY(!ConfigNodeArena::isActive());
+
+            heapNode = std::make_unique<ConfigObjectNode>();
+            heapNode->setMember("a", ConfigValueNode(1));
+        }
+
+        QVERIFY(ConfigNodeArena::isActive());
+    }
+
+    // Nodes created while the arena was suspended do not keep the arena alive
+    QCOMPARE(ConfigNodeArena::arenaCount(), 0);
+    QCOMPARE(heapNode->member("a")->toValue().value(), QJsonValue(1));
+}
+
+// Test: lifetime of the nodes allocated from an arena ---------------------------------------------
+
+void TestConfigNodeArena::testNodeLifetime()
+{
+    std::unique_ptr<ConfigObjectNode> node;
+
+    {
+        const ConfigNodeArena::Scope scope;
+
+        node = std::make_unique<ConfigObjectNode>();
+        node->setMember("a", ConfigValueNode(1));
+        node->setMember("b", ConfigObjectNode());
+        node->member("b")->toObject().setMember("c", ConfigValueNode("abc"));
+    }
+
+    // Arena is kept alive by its nodes
+    QCOMPARE(ConfigNodeArena::arenaCount(), 1);
+
+    // Nodes allocated from the heap do not affect the arena
+    auto heapNode = std::make_unique<ConfigValueNode>(2);
+    QVERIFY(!ConfigNodeArena::isActive());
+    heapNode.reset();
+    QCOMPARE(ConfigNodeArena::arenaCount(), 1);
+
+    // Nodes that are not allocated with new (for example on the stack) do not affect the arena
+    {
+        const ConfigNodeArena::Scope scope;
+        QCOMPARE(ConfigNodeArena::arenaCount(), 2);
+
+        ConfigObjectNode stackNode;
+        stackNode.setMember("a", ConfigValueNode(1));
+    }
+
+    QCOMPARE(ConfigNodeArena::arenaCount(), 1);
+
+    // Nodes can be freed on another thread
+    {
+        std::unique_ptr<ConfigValueNode> otherThreadNode;
+
+        {
+            const ConfigNodeArena::Scope scope;
+            otherThreadNode = std::make_unique<ConfigValueNode>(3);
+        }
+
+        QCOMPARE(ConfigNodeArena::arenaCount(), 2);
+
+        std::thread thread([&otherThreadNode]()
+        {
+            otherThreadNode.reset();
+        });
+        thread.join();
+        QCOMPARE(ConfigNodeArena::arenaCount(), 1);
+    }
+
+    // Nodes are still owned by the tree and can be moved to and between other trees
+    auto takenNode = node->take("b");
+    QVERIFY(takenNode);
+
+    ConfigObjectNode otherNode;
+    QVERIFY(otherNode.setMember("b", std::move(takenNode)));
+    QCOMPARE(otherNode.member("b")->toObject().member("c")->toValue().value(), QJsonValue("abc"));
+
+    node.reset();
+    QCOMPARE(ConfigNodeArena::arenaCount(), 1);
+
+    otherNode.removeAll();
+    QCOMPARE(ConfigNodeArena::arenaCount(), 0);
+}
+
+// Test: reading a configuration with arena allocation ---------------------------------------------
+
+void TestConfigNodeArena::testReader()
+{
+    const QJsonObject configObject {
+        { "config", QJsonObject {
+              { "a", 1 },
+              { "b", QJsonObject { { "c", "abc" }, { "d", QJsonArray { 1, 2, 3 } } } },
+              { "&e", QJsonObject {
+                    { "base", QJsonArray { "/b" } },
+                    { "config", QJsonObject { { "c", "xyz" } } }
+                } },
+              { "&f", "/b/c" }
+          } }
+    };
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+    QVERIFY(!configReader.arenaAllocationEnabled());
+
+    auto expectedConfig = configReader.read(configObject,
+                                            QDir::current(),
+                                            ConfigNodePath::ROOT_PATH,
+                                            ConfigNodePath::ROOT_PATH,
+                                            {},
+                                            &environmentVariables);
+    QVERIFY(expectedConfig);
+    QCOMPARE(ConfigNodeArena::arenaCount(), 0);
+
+    configReader.setArenaAllocationEnabled(true);
+    QVERIFY(configReader.arenaAllocationEnabled());
+
+    auto config = configReader.read(configObject,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+    QVERIFY(!ConfigNodeArena::isActive());
+    QCOMPARE(ConfigNodeArena::arenaCount(), 1);
+    QVERIFY(*config == *expectedConfig);
+
+    config.reset();
+    QCOMPARE(ConfigNodeArena::arenaCount(), 0);
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigNodeArena)
+#include "testConfigNodeArena.moc"
@@ -0,0 +1,283 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigNodeDiff class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigNodeDiff.hpp>
+#include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigNodeDiff : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testEqualNodes();
+    void testDifferences();
+    void testChangedType();
+    void testValues();
+    void testDerivedObject();
+    void testSubtree();
+
+private:
+    static std::unique_ptr<ConfigObjectNode> createConfig();
+    static QStringList toStringList(const std::vector<ConfigNodePath> &nodePaths);
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigNodeDiff::initTestCase()
+{
+}
+
+void TestConfigNodeDiff::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigNodeDiff::init()
+{
+}
+
+void TestConfigNodeDiff::cleanup()
+{
+}
+
+// Test: equal nodes have no differences -----------------------------------------------------------
+
+void TestConfigNodeDiff::testEqualNodes()
+{
+    const auto previous = createConfig();
+    const auto current = createConfig();
+
+    auto diff = ConfigNodeDiff::compare(*previous, *current);
+    QVERIFY(diff.isEmpty());
+    QVERIFY(diff.addedNodePaths().empty());
+    QVERIFY(diff.removedNodePaths().empty());
+    QVERIFY(diff.changedNodePaths().empty());
+    QVERIFY(!diff.isChanged(ConfigNodePath::ROOT_PATH));
+    QVERIFY(!diff.isChanged(ConfigNodePath("/obj/x")));
+
+    // Node compared with itself
+    diff = ConfigNodeDiff::compare(*previous, *previous);
+    QVERIFY(diff.isEmpty());
+
+    // Default constructed difference
+    QVERIFY(ConfigNodeDiff().isEmpty());
+}
+
+// Test: added, removed and changed nodes ----------------------------------------------------------
+
+void TestConfigNodeDiff::testDifferences()
+{
+    const auto previous = createConfig();
+    auto current = createConfig();
+
+    current->setMember("b", ConfigValueNode("changed"));
+    current->member("obj")->toObject().remove("y");
+    current->member("obj")->toObject().setMember("z", ConfigValueNode(3));
+    current->setMember("ref", ConfigNodeReference(ConfigNodePath("/b")));
+    current->remove("gone");
+
+    ConfigObjectNode newNode;
+    newNode.setMember("v", ConfigValueNode(1));
+    current->setMember("new", newNode);
+
+    const auto diff = ConfigNodeDiff::compare(*previous, *current);
+    QVERIFY(!diff.isEmpty());
+    QCOMPARE(toStringList(diff.addedNodePaths()), QStringList({ "/new", "/obj/z" }));
+    QCOMPARE(toStringList(diff.removedNodePaths()), QStringList({ "/gone", "/obj/y" }));
+    QCOMPARE(toStringList(diff.changedNodePaths()), QStringList({ "/b", "/ref" }));
+
+    // Affected nodes
+    QVERIFY(diff.isChanged(ConfigNodePath::ROOT_PATH));
+    QVERIFY(!diff.isChanged(ConfigNodePath("/a")));
+    QVERIFY(diff.isChanged(ConfigNodePath("/b")));
+    QVERIFY(diff.isChanged(ConfigNodePath("/obj")));
+    QVERIFY(!diff.isChanged(ConfigNodePath("/obj/x")));
+    QVERIFY(diff.isChanged(ConfigNodePath("/obj/y")));
+    QVERIFY(diff.isChanged(ConfigNodePath("/gone/deep/v")));
+    QVERIFY(diff.isChanged(ConfigNodePath("/new")));
+    QVERIFY(!diff.isChanged(ConfigNodePath("/unknown")));
+    QVERIFY(!diff.isChanged(ConfigNodePath("/ob")));
+
+    // Reversed comparison
+    const auto reversedDiff = ConfigNodeDiff::compare(*current, *previous);
+    QCOMPARE(toStringList(reversedDiff.addedNodePaths()), QStringList({ "/gone", "/obj/y" }));
+    QCOMPARE(toStringList(reversedDiff.removedNodePaths()), QStringList({ "/new", "/obj/z" }));
+    QCOMPARE(toStringList(reversedDiff.changedNodePaths()), QStringList({ "/b", "/ref" }));
+}
+
+// Test: node that changed its type is reported as changed -----------------------------------------
+
+void TestConfigNodeDiff::testChangedType()
+{
+    const auto previous = createConfig();
+    auto current = createConfig();
+
+    ConfigObjectNode objectNode;
+    objectNode.setMember("x", ConfigValueNode(1));
+    current->setMember("a", objectNode);
+    current->setMember("obj", ConfigValueNode(1));
+
+    const auto diff = ConfigNodeDiff::compare(*previous, *current);
+    QVERIFY(diff.addedNodePaths().empty());
+    QVERIFY(diff.removedNodePaths().empty());
+    QCOMPARE(toStringList(diff.changedNodePaths()), QStringList({ "/a", "/obj" }));
+    QVERIFY(diff.isChanged(ConfigNodePath("/a/x")));
+    QVERIFY(diff.isChanged(ConfigNodePath("/obj/x")));
+    QVERIFY(!diff.isChanged(ConfigNodePath("/b")));
+}
+
+// Test: values of different types are compared ----------------------------------------------------
+
+void TestConfigNodeDiff::testValues()
+{
+    ConfigObjectNode previous;
+    previous.setMember("null", ConfigValueNode());
+    previous.setMember("bool", ConfigValueNode(true));
+    previous.setMember("integer", ConfigValueNode(1));
+    previous.setMember("double", ConfigValueNode(1.5));
+    previous.setMember("string", ConfigValueNode("str"));
+    previous.setMember("array", ConfigValueNode(QJsonArray { 1, 2 }));
+
+    auto current = previous.clone();
+    QVERIFY(ConfigNodeDiff::compare(previous, *current).isEmpty());
+
+    auto &currentObject = current->toObject();
+    currentObject.setMember("null", ConfigValueNode(false));
+    currentObject.setMember("bool", ConfigValueNode(false));
+    currentObject.setMember("integer", ConfigValueNode(1.0));
+    currentObject.setMember("double", ConfigValueNode(2.5));
+    currentObject.setMember("string", ConfigValueNode("str"));
+    currentObject.setMember("array", ConfigValueNode(QJsonArray { 1, 3 }));
+
+    const auto diff = ConfigNodeDiff::compare(previous, *current);
+    QCOMPARE(toStringList(diff.changedNodePaths()),
+             QStringList({ "/array", "/bool", "/double", "/null" }));
+}
+
+// Test: DerivedObject nodes are compared by their bases and overloads -----------------------------
+
+void TestConfigNodeDiff::testDerivedObject()
+{
+    ConfigObjectNode overloads;
+    overloads.setMember("m", ConfigValueNode(1));
+
+    ConfigObjectNode previous;
+    previous.setMember("d1", ConfigDerivedObjectNode({ ConfigNodePath("/base1") }, overloads));
+    previous.setMember("d2", ConfigDerivedObjectNode({ ConfigNodePath("/base1") }, overloads));
+
+    auto current = previous.clone();
+    QVERIFY(ConfigNodeDiff::compare(previous, *current).isEmpty());
+
+    auto &currentObject = current->toObject();
+    currentObject.setMember("d1", ConfigDerivedObjectNode({ ConfigNodePath("/base2") }, overloads));
+
+    overloads.setMember("m", ConfigValueNode(2));
+    currentObject.setMember("d2", ConfigDerivedObjectNode({ ConfigNodePath("/base1") }, overloads));
+
+    const auto diff = ConfigNodeDiff::compare(previous, *current);
+    QVERIFY(diff.addedNodePaths().empty());
+    QVERIFY(diff.removedNodePaths().empty());
+    QCOMPARE(toStringList(diff.changedNodePaths()), QStringList({ "/d1", "/d2/m" }));
+    QVERIFY(diff.isChanged(ConfigNodePath("/d2")));
+}
+
+// Test: node paths of the compared subtrees start at the subtree ----------------------------------
+
+void TestConfigNodeDiff::testSubtree()
+{
+    const auto previous = createConfig();
+    auto current = createConfig();
+    current->member("obj")->toObject().setMember("x", ConfigValueNode(100));
+    current->setMember("a", ConfigValueNode(100));
+
+    const auto diff = ConfigNodeDiff::compare(*previous->member("obj"), *current->member("obj"));
+    QCOMPARE(toStringList(diff.changedNodePaths()), QStringList({ "/obj/x" }));
+    QVERIFY(diff.isChanged(ConfigNodePath("/obj")));
+    QVERIFY(!diff.isChanged(ConfigNodePath("/a")));
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> TestConfigNodeDiff::createConfig()
+{
+    auto config = std::make_unique<ConfigObjectNode>();
+    config->setMember("a", ConfigValueNode(1));
+    config->setMember("b", ConfigValueNode("str"));
+    config->setMember("ref", ConfigNodeReference(ConfigNodePath("/a")));
+
+    ConfigObjectNode obj;
+    obj.setMember("x", ConfigValueNode(1));
+    obj.setMember("y", ConfigValueNode(2));
+    config->setMember("obj", obj);
+
+    ConfigObjectNode deep;
+    deep.setMember("v", ConfigValueNode(1));
+    ConfigObjectNode gone;
+    gone.setMember("deep", deep);
+    config->setMember("gone", gone);
+
+    return config;
+}
+
+QStringList TestConfigNodeDiff::toStringList(const std::vector<ConfigNodePath> &nodePaths)
+{
+    QStringList result;
+
+    for (const auto &nodePath : nodePaths)
+    {
+        result.append(nodePath.path());
+    }
+
+    return result;
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigNodeDiff)
+#include "testConfigNodeDiff.moc"
@@ -0,0 +1,266 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigNodeIndex class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeIndex.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigSnapshotPublisher.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QJsonObject>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigNodeIndex : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testIndex();
+    void testNodeAtPath();
+    void testInvalidation();
+    void testFreeze();
+    void testExternalConfigs();
+
+private:
+    std::unique_ptr<ConfigObjectNode> createConfig() const;
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigNodeIndex::initTestCase()
+{
+}
+
+void TestConfigNodeIndex::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigNodeIndex::init()
+{
+}
+
+void TestConfigNodeIndex::cleanup()
+{
+}
+
+// Test: index -------------------------------------------------------------------------------------
+
+void TestConfigNodeIndex::testIndex()
+{
+    const auto config = createConfig();
+    const ConfigNodeIndex index(*config);
+
+    QCOMPARE(index.count(), 6);
+    QCOMPARE(index.node(ConfigNodePath::ROOT_PATH), config.get());
+    QCOMPARE(index.node(ConfigNodePath("/a")), config->member("a"));
+    QCOMPARE(index.node(ConfigNodePath("/b")), config->member("b"));
+    QCOMPARE(index.node(ConfigNodePath("/b/c")), config->nodeAtPath("/b/c"));
+    QCOMPARE(index.node(ConfigNodePath("/b/d")), config->nodeAtPath("/b/d"));
+    QCOMPARE(index.node(ConfigNodePath("/b/d/e")), config->nodeAtPath("/b/d/e"));
+
+    // Missing, relative and unresolved node paths
+    QCOMPARE(index.node(ConfigNodePath("/x")), nullptr);
+    QCOMPARE(index.node(ConfigNodePath("/a/x")), nullptr);
+    QCOMPARE(index.node(ConfigNodePath("b/c")), nullptr);
+    QCOMPARE(index.node(ConfigNodePath("/b/../a")), nullptr);
+    QCOMPARE(index.node(ConfigNodePath()), nullptr);
+}
+
+// Test: nodeAtPath() ------------------------------------------------------------------------------
+
+void TestConfigNodeIndex::testNodeAtPath()
+{
+    auto config = createConfig();
+    QVERIFY(!config->hasNodeIndex());
+    QVERIFY(!config->member("b")->toObject().buildNodeIndex());
+
+    // Results without the index
+    const QStringList nodePaths {
+        "/", "/a", "/b", "/b/c", "/b/d/e", "/x", "/b/x", "/b/../a", "/b/d/..", "/a/.."
+    };
+    const QStringList relativeNodePaths { "c", "d/e", "x", "../a", "d/../c", ".." };
+
+    const auto *memberB = config->nodeAtPath("/b");
+    QVERIFY(memberB != nullptr);
+
+    QList<const ConfigNode *> expectedNodes;
+
+    for (const QString &nodePath : nodePaths)
+    {
+        expectedNodes.append(config->nodeAtPath(nodePath));
+    }
+
+    for (const QString &nodePath : relativeNodePaths)
+    {
+        expectedNodes.append(memberB->nodeAtPath(nodePath));
+    }
+
+    // Results with the index must be the same
+    QVERIFY(config->buildNodeIndex());
+    QVERIFY(config->hasNodeIndex());
+
+    QList<const ConfigNode *> actualNodes;
+
+    for (const QString &nodePath : nodePaths)
+    {
+        actualNodes.append(config->nodeAtPath(nodePath));
+    }
+
+    for (const QString &nodePath : relativeNodePaths)
+    {
+        actualNodes.append(memberB->nodeAtPath(nodePath));
+    }
+
+    QCOMPARE(actualNodes, expectedNodes);
+    QCOMPARE(config->nodeAtPath("/b/d/e"), config->member("b")->toObject().nodeAtPath("d/e"));
+}
+
+// Test: invalidation ------------------------------------------------------------------------------
+
+void TestConfigNodeIndex::testInvalidation()
+{
+    auto config = createConfig();
+
+    // Changing a deep node drops the index
+    QVERIFY(config->buildNodeIndex());
+    config->nodeAtPath("/b/d/e")->toValue().setValue(5);
+    QVERIFY(!config->hasNodeIndex());
+
+    // Adding a member drops the index
+    QVERIFY(config->buildNodeIndex());
+    QVERIFY(config->nodeAtPath("/b/d")->toObject().setMember("f", ConfigValueNode(6)));
+    QVERIFY(!config->hasNodeIndex());
+    QVERIFY(config->nodeAtPath("/b/d/f") != nullptr);
+    QCOMPARE(config->nodeAtPath("/b/d/f")->toValue().value(), QJsonValue(6));
+
+    // Removing a member drops the index
+    QVERIFY(config->buildNodeIndex());
+    QVERIFY(config->nodeAtPath("/b")->toObject().remove("c"));
+    QVERIFY(!config->hasNodeIndex());
+    QCOMPARE(config->nodeAtPath("/b/c"), nullptr);
+
+    // Moving the tree drops the index (the moved-to node has no index)
+    QVERIFY(config->buildNodeIndex());
+    ConfigObjectNode movedConfig(std::move(*config));
+    QVERIFY(!config->hasNodeIndex());
+    QVERIFY(!movedConfig.hasNodeIndex());
+    QCOMPARE(config->nodeAtPath("/b"), nullptr);
+    QCOMPARE(movedConfig.nodeAtPath("/b"), movedConfig.member("b"));
+
+    // A cloned tree has no index
+    QVERIFY(movedConfig.buildNodeIndex());
+    const auto clonedConfig = movedConfig.clone();
+    QVERIFY(!clonedConfig->toObject().hasNodeIndex());
+    QCOMPARE(clonedConfig->nodeAtPath("/b/d/f"), clonedConfig->toObject().member("b")
+                                                 ->nodeAtPath("d/f"));
+}
+
+// Test: freeze ------------------------------------------------------------------------------------
+
+void TestConfigNodeIndex::testFreeze()
+{
+    const auto snapshot = ConfigSnapshotPublisher::freeze(createConfig());
+    QVERIFY(snapshot);
+    QVERIFY(snapshot->hasNodeIndex());
+    QCOMPARE(snapshot->nodeAtPath("/b/d/e")->toValue().value(), QJsonValue(4));
+    QCOMPARE(snapshot->nodeAtPath("b/c")->toValue().value(), QJsonValue(3));
+}
+
+// Test: external configs --------------------------------------------------------------------------
+
+void TestConfigNodeIndex::testExternalConfigs()
+{
+    // The node from the last external configuration that contains it is used
+    auto externalConfig1 = createConfig();
+    auto externalConfig2 = createConfig();
+    externalConfig2->nodeAtPath("/b/c")->toValue().setValue(30);
+
+    const auto snapshot1 = ConfigSnapshotPublisher::freeze(std::move(externalConfig1));
+    const auto snapshot2 = ConfigSnapshotPublisher::freeze(std::move(externalConfig2));
+
+    const QJsonObject configObject {
+        { "config", QJsonObject {
+              { "b", QJsonObject { { "&x", "c" } } },
+              { "&y", "/b/d/e" },
+              { "&z", "/a" }
+          } }
+    };
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+
+    const auto config = configReader.read(configObject,
+                                          QDir::current(),
+                                          ConfigNodePath::ROOT_PATH,
+                                          ConfigNodePath::ROOT_PATH,
+                                          { snapshot1.get(), snapshot2.get() },
+                                          &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/b/x")->toValue().value(), QJsonValue(30));
+    QCOMPARE(config->nodeAtPath("/y")->toValue().value(), QJsonValue(4));
+    QCOMPARE(config->nodeAtPath("/z")->toValue().value(), QJsonValue(1));
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> TestConfigNodeIndex::createConfig() const
+{
+    auto config = std::make_unique<ConfigObjectNode>();
+    config->setMember("a", ConfigValueNode(1));
+
+    ConfigObjectNode memberD;
+    memberD.setMember("e", ConfigValueNode(4));
+
+    ConfigObjectNode memberB;
+    memberB.setMember("c", ConfigValueNode(3));
+    memberB.setMember("d", std::move(memberD));
+
+    config->setMember("b", std::move(memberB));
+    return config;
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigNodeIndex)
+#include "testConfigNodeIndex.moc"
@@ -83,6 +83,11 @@ private slots:
 
     void testAppendNodePath();
     void testAppendNodePath_data();
+
+    void testPropertiesAfterModification();
+
+    void testValidateNodeName();
+    void testValidateNodeName_data();
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -390,6 +395,22 @@ void TestConfigNodePath::testNodeNames()
     nodePath.setPath("d/e/f");
     nodeNames = QStringList { "d", "e", "f" };
     QCOMPARE(nodePath.nodeNames(), nodeNames);
+
+    nodePath.append("g");
+    nodeNames = QStringList { "d", "e", "f", "g" };
+    QCOMPARE(nodePath.nodeNames(), nodeNames);
+
+    nodePath.append(ConfigNodePath("../h"));
+    nodeNames = QStringList { "d", "e", "f", "g", "..", "h" };
+    QCOMPARE(nodePath.nodeNames(), nodeNames);
+
+    QVERIFY(nodePath.resolveReferences());
+    nodeNames = QStringList { "d", "e", "f", "h" };
+    QCOMPARE(nodePath.nodeNames(), nodeNames);
+
+    nodePath = ConfigNodePath::ROOT_PATH.append("a");
+    nodeNames = QStringList { "a" };
+    QCOMPARE(nodePath.nodeNames(), nodeNames);
 }
 
 // Test: toAbsolute() method -----------------------------------------------------------------------
@@ -511,6 +532,80 @@ void TestConfigNodePath::testAppendNodePath_data()
     QTest::newRow("Empty path") << "" << "aaa/bbb" << "";
 }
 
+// Test: properties of a node path after it is modified ------------------------------------------
+
+void TestConfigNodePath::testPropertiesAfterModification()
+{
+    // Appending parent node references can make an absolute path invalid
+    ConfigNodePath nodePath("/aaa");
+    nodePath.append(ConfigNodePath(".."));
+    QCOMPARE(nodePath.path(), QString("/aaa/.."));
+    QVERIFY(nodePath.isValid());
+    QVERIFY(nodePath.hasUnresolvedReferences());
+
+    nodePath.append(ConfigNodePath("../bbb"));
+    QCOMPARE(nodePath.path(), QString("/aaa/../../bbb"));
+    QVERIFY(!nodePath.isValid());
+    QVERIFY(nodePath.hasUnresolvedReferences());
+
+    // Resolving the references updates the properties
+    nodePath = ConfigNodePath("/aaa/bbb/../..");
+    QVERIFY(nodePath.resolveReferences());
+    QVERIFY(nodePath.isRoot());
+    QVERIFY(nodePath.isAbsolute());
+    QVERIFY(nodePath.isValid());
+    QVERIFY(!nodePath.hasUnresolvedReferences());
+    QCOMPARE(nodePath, ConfigNodePath::ROOT_PATH);
+
+    nodePath = ConfigNodePath("aaa/../0bbb");
+    QVERIFY(!nodePath.isValid());
+    QVERIFY(nodePath.resolveReferences());
+    QCOMPARE(nodePath.path(), QString("0bbb"));
+    QVERIFY(nodePath.isRelative());
+    QVERIFY(!nodePath.isValid());
+    QVERIFY(!nodePath.hasUnresolvedReferences());
+
+    // Setting the path updates the properties
+    nodePath.setPath("/aaa");
+    QVERIFY(nodePath.isAbsolute());
+    QVERIFY(nodePath.isValid());
+
+    nodePath.setPath(QString());
+    QVERIFY(!nodePath.isAbsolute());
+    QVERIFY(!nodePath.isRelative());
+    QVERIFY(!nodePath.isValid());
+}
+
+// Test: validateNodeName() method -----------------------------------------------------------------
+
+void TestConfigNodePath::testValidateNodeName()
+{
+    QFETCH(QString, nodeName);
+    QFETCH(bool, expectedResult);
+
+    QCOMPARE(ConfigNodePath::validateNodeName(nodeName), expectedResult);
+}
+
+void TestConfigNodePath::testValidateNodeName_data()
+{
+    QTest::addColumn<QString>("nodeName");
+    QTest::addColumn<bool>("expectedResult");
+
+    QTest::newRow("Single lowercase letter") << "a" << true;
+    QTest::newRow("Single uppercase letter") << "Z" << true;
+    QTest::newRow("Letters, digits and underscores") << "aZ_09_zA" << true;
+
+    QTest::newRow("Empty") << "" << false;
+    QTest::newRow("Starts with a digit") << "0a" << false;
+    QTest::newRow("Starts with an underscore") << "_a" << false;
+    QTest::newRow("Parent reference") << ".." << false;
+    QTest::newRow("Contains a separator") << "a/b" << false;
+    QTest::newRow("Contains a space") << "a b" << false;
+    QTest::newRow("Contains a dash") << "a-b" << false;
+    QTest::newRow("Contains a non-ASCII letter") << QString("a") + QChar(0x00E4) << false;
+    QTest::newRow("Starts with a non-ASCII letter") << QString(QChar(0x00C4)) + "a" << false;
+}
+
 // Main function -----------------------------------------------------------------------------------
 
 QTEST_MAIN(TestConfigNodePath)
@@ -20,11 +20,23 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReadOperation.hpp>
+#include <CppConfigFramework/ConfigReadStatistics.hpp>
 #include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigReaderRegistry.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 
 // Qt includes
 #include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QRunnable>
+#include <QtCore/QSemaphore>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QThreadPool>
 #include <QtTest/QTest>
 
 // System includes
@@ -54,17 +66,130 @@ private slots:
     void testReadValidConfig();
     void testReadConfigWithNodeReference();
     void testReadConfigWithDerivedObject();
+    void testReadConfigWithLongReferenceChains();
+    void testReadConfigWithSharedDerivedObjectBases();
     void testReadConfigWithIncludes();
     void testReadConfigWithIncludesAndEnv();
+    void testReadConfigWithNestedIncludeReferences();
     void testReadConfigWithOnlyIncludes();
     void testReadConfigWithExternalConfigReferences();
+    void testReadConfigWithParallelIncludes();
+    void testReadConfigWithParallelIncludes_data();
+    void testReadConfigWithLazyMaterialization();
+    void testReadConfigWithLazyMaterialization_data();
+    void testLazyMaterializationOnAccess();
+    void testReadConfigWithSourceNodePruning();
+    void testReadConfigWithSourceNodePruning_data();
+    void testSourceNodePruningSkipsIncludes();
+    void testSourceNodePruningSkipsIncludes_data();
+    void testReadConfigWithStreamingParsing();
+    void testReadConfigWithStreamingParsing_data();
+    void testStreamingParsingMatchesJsonDocument();
+    void testStreamingParsingMatchesJsonDocument_data();
     void testReadInvalidPathParameters();
     void testReadInvalidPathParameters_data();
     void testReadInvalidExternalConfigsParameter();
     void testReadInvalidConfigFile();
     void testReadInvalidConfigFile_data();
+    void testReadEmptyAndMissingFile();
+    void testReadEmptyAndMissingFile_data();
     void testCurrentDirectoryEnvironmentVariable();
     void testReadConfigNullEnvironmentVariables();
+    void testReadConfigOnMultipleThreads();
+    void testReadConfigAsync();
+    void testReadConfigAsync_data();
+    void testReadConfigAsyncCanceled();
+    void testReadCanceledOperation();
+    void testReadStatistics();
+    void testReadStatistics_data();
+    void testReadStatisticsCounters();
+};
+
+// Read config task --------------------------------------------------------------------------------
+
+//! Reads the same config file multiple times with its own environment variables
+class ReadConfigTask : public QRunnable
+{
+public:
+    ReadConfigTask(const ConfigReader *configReader,
+                   const QString &filePath,
+                   const int readCount,
+                   std::vector<std::unique_ptr<ConfigObjectNode>> *configs)
+        : m_configReader(configReader),
+          m_filePath(filePath),
+          m_readCount(readCount),
+          m_configs(configs)
+    {
+    }
+
+    void run() override
+    {
+        for (int i = 0; i < m_readCount; i++)
+        {
+            auto environmentVariables = EnvironmentVariables::loadFromProcess();
+            environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+
+            m_configs->push_back(m_configReader->read(m_filePath,
+                                                      QDir::current(),
+                                                      ConfigNodePath::ROOT_PATH,
+                                                      ConfigNodePath::ROOT_PATH,
+                                                      {},
+                                                      &environmentVariables));
+        }
+    }
+
+private:
+    const ConfigReader *m_configReader;
+    QString m_filePath;
+    int m_readCount;
+    std::vector<std::unique_ptr<ConfigObjectNode>> *m_configs;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Replaces the configuration reader in the registry multiple times
+class RegisterConfigReaderTask : public QRunnable
+{
+public:
+    explicit RegisterConfigReaderTask(const int registerCount)
+        : m_registerCount(registerCount)
+    {
+    }
+
+    void run() override
+    {
+        for (int i = 0; i < m_registerCount; i++)
+        {
+            ConfigReaderRegistry::instance()->registerConfigReader(
+                        QStringLiteral("CppConfigFramework"), std::make_unique<ConfigReader>());
+        }
+    }
+
+private:
+    int m_registerCount;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Occupies a thread of the thread pool until it is released
+class BlockingTask : public QRunnable
+{
+public:
+    BlockingTask(QSemaphore *started, QSemaphore *released)
+        : m_started(started),
+          m_released(released)
+    {
+    }
+
+    void run() override
+    {
+        m_started->release();
+        m_released->acquire();
+    }
+
+private:
+    QSemaphore *m_started;
+    QSemaphore *m_released;
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -326,6 +451,199 @@ void TestConfigReader::testReadConfigWithDerivedObject()
     }
 }
 
+// Test: read a config with chains of references longer than the old resolution cycle limit --------
+
+void TestConfigReader::testReadConfigWithLongReferenceChains()
+{
+    // Each node depends on the node with the next index so the nodes are ordered in the opposite
+    // order of their dependencies
+    const int chainLength = 250;
+    QJsonObject configObject { { "value", 1 } };
+
+    for (int i = 0; i < chainLength; i++)
+    {
+        const QString nextDerivedNodePath = (i == (chainLength - 1))
+                                            ? QString("/base")
+                                            : QString("/derived_%1").arg(i + 1, 3, 10, QChar('0'));
+        configObject.insert(QString("&derived_%1").arg(i, 3, 10, QChar('0')),
+                            QJsonObject { { "base", nextDerivedNodePath } });
+
+        const QString nextReferenceNodePath = (i == (chainLength - 1))
+                                              ? QString("/value")
+                                              : QString("/ref_%1").arg(i + 1, 3, 10, QChar('0'));
+        configObject.insert(QString("&ref_%1").arg(i, 3, 10, QChar('0')), nextReferenceNodePath);
+    }
+
+    configObject.insert("base", QJsonObject { { "item", 2 } });
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+
+    // The deprecated limit of the resolution cycles is ignored
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("resolution cycles is ignored"));
+    configReader.setReferenceResolutionMaxCycles(1U);
+    QCOMPARE(configReader.referenceResolutionMaxCycles(), 1U);
+
+    auto config = configReader.read(QJsonObject { { "config", configObject } },
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->count(), (2 * chainLength) + 2);
+
+    for (int i = 0; i < chainLength; i++)
+    {
+        const auto *derived = config->member(QString("derived_%1").arg(i, 3, 10, QChar('0')));
+        QVERIFY(derived != nullptr);
+        QVERIFY(derived->isObject());
+        QCOMPARE(derived->toObject().count(), 1);
+        QCOMPARE(derived->toObject().member("item")->toValue().value(), QJsonValue(2));
+
+        const auto *reference = config->member(QString("ref_%1").arg(i, 3, 10, QChar('0')));
+        QVERIFY(reference != nullptr);
+        QVERIFY(reference->isValue());
+        QCOMPARE(reference->toValue().value(), QJsonValue(1));
+    }
+}
+
+// Test: read a config with DerivedObject nodes that share their bases ----------------------------
+
+void TestConfigReader::testReadConfigWithSharedDerivedObjectBases()
+{
+    // Half of the endpoints list the bases in the opposite order, which gives other merged bases
+    const int endpointCount = 100;
+    QJsonObject endpointsObject;
+
+    for (int i = 0; i < endpointCount; i++)
+    {
+        const QJsonArray bases = ((i % 2) == 0)
+                                 ? QJsonArray { "/templates/endpoint", "/templates/secure" }
+                                 : QJsonArray { "/templates/secure", "/templates/endpoint" };
+        endpointsObject.insert(QString("&endpoint_%1").arg(i, 3, 10, QChar('0')),
+                               QJsonObject {
+                                   { "base", bases },
+                                   { "config", QJsonObject { { "port", 1000 + i } } }
+                               });
+    }
+
+    const QJsonObject configObject {
+        { "templates", QJsonObject {
+              { "endpoint", QJsonObject {
+                    { "host", "localhost" },
+                    { "port", 80 },
+                    { "protocol", "http" },
+                    { "options", QJsonObject { { "timeout", 10 } } }
+                } },
+              { "secure", QJsonObject {
+                    { "protocol", "https" },
+                    { "options", QJsonObject { { "verify", true } } }
+                } }
+          } },
+        { "endpoints", endpointsObject }
+    };
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+
+    auto config = configReader.read(QJsonObject { { "config", configObject } },
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+
+    // The parts of the merged bases that are not overridden are shared by the endpoints
+    const auto usage = config->memoryUsage();
+    QVERIFY(usage.sharedSubtreeCount >= endpointCount);
+    QVERIFY(usage.sharedSubtreeBytes > 0);
+
+    {
+        const auto *endpoint = config->nodeAtPath("/endpoints/endpoint_000");
+        QVERIFY(endpoint != nullptr);
+        QVERIFY(endpoint->toObject().isMaterialized());
+        QVERIFY(!endpoint->toObject().member("options")->toObject().isMaterialized());
+    }
+
+    const auto *endpoints = config->member("endpoints");
+    QVERIFY(endpoints != nullptr);
+    QVERIFY(endpoints->isObject());
+    QCOMPARE(endpoints->toObject().count(), endpointCount);
+
+    for (int i = 0; i < endpointCount; i++)
+    {
+        const auto *endpoint =
+                endpoints->toObject().member(QString("endpoint_%1").arg(i, 3, 10, QChar('0')));
+        QVERIFY(endpoint != nullptr);
+        QVERIFY(endpoint->isObject());
+        QCOMPARE(endpoint->toObject().count(), 4);
+        QCOMPARE(endpoint->nodeAtPath("host")->toValue().value(), QJsonValue("localhost"));
+        QCOMPARE(endpoint->nodeAtPath("port")->toValue().value(), QJsonValue(1000 + i));
+        QCOMPARE(endpoint->nodeAtPath("protocol")->toValue().value(),
+                 QJsonValue(((i % 2) == 0) ? "https" : "http"));
+        QCOMPARE(endpoint->nodeAtPath("options/timeout")->toValue().value(), QJsonValue(10));
+        QCOMPARE(endpoint->nodeAtPath("options/verify")->toValue().value(), QJsonValue(true));
+        QCOMPARE(endpoint->nodePath().path(),
+                 QString("/endpoints/endpoint_%1").arg(i, 3, 10, QChar('0')));
+    }
+
+    // The bases with the same contents at another node path and a single base
+    const QJsonObject otherEndpointsObject {
+        { "&copy", QJsonObject {
+              { "base", QJsonArray { "/templates/endpoint_copy", "/templates/secure" } },
+              { "config", QJsonObject { { "port", 443 } } }
+          } },
+        { "&other", QJsonObject {
+              { "base", QJsonArray { "/templates/endpoint_other", "/templates/secure" } }
+          } },
+        { "&single", QJsonObject {
+              { "base", QJsonArray { "/templates/endpoint" } }
+          } }
+    };
+    auto otherConfigObject = configObject;
+    auto templatesObject = otherConfigObject.value("templates").toObject();
+    templatesObject.insert("endpoint_copy", templatesObject.value("endpoint"));
+    templatesObject.insert("endpoint_other", QJsonObject { { "host", "remote" } });
+    otherConfigObject.insert("templates", templatesObject);
+    otherConfigObject.insert("other_endpoints", otherEndpointsObject);
+
+    const auto otherConfig = configReader.read(QJsonObject { { "config", otherConfigObject } },
+                                               QDir::current(),
+                                               ConfigNodePath::ROOT_PATH,
+                                               ConfigNodePath::ROOT_PATH,
+                                               {},
+                                               &environmentVariables);
+    QVERIFY(otherConfig);
+
+    const auto *copy = otherConfig->nodeAtPath("/other_endpoints/copy");
+    QVERIFY(copy != nullptr);
+    QCOMPARE(copy->toObject().names(), QStringList({ "host", "options", "port", "protocol" }));
+    QCOMPARE(copy->nodeAtPath("port")->toValue().value(), QJsonValue(443));
+    QCOMPARE(copy->nodeAtPath("protocol")->toValue().value(), QJsonValue("https"));
+    QCOMPARE(copy->nodeAtPath("options/timeout")->toValue().value(), QJsonValue(10));
+
+    const auto *other = otherConfig->nodeAtPath("/other_endpoints/other");
+    QVERIFY(other != nullptr);
+    QCOMPARE(other->toObject().names(), QStringList({ "host", "options", "protocol" }));
+    QCOMPARE(other->nodeAtPath("host")->toValue().value(), QJsonValue("remote"));
+    QCOMPARE(other->nodeAtPath("options/verify")->toValue().value(), QJsonValue(true));
+
+    const auto *single = otherConfig->nodeAtPath("/other_endpoints/single");
+    QVERIFY(single != nullptr);
+    QVERIFY(single->toObject().hasSameContents(
+                *otherConfig->nodeAtPath("/templates/endpoint")));
+    QCOMPARE(single->nodePath().path(), QString("/other_endpoints/single"));
+
+    // A change is not visible in the other endpoints nor in the bases
+    config->nodeAtPath("/endpoints/endpoint_000/options/timeout")->toValue().setValue(20);
+    QCOMPARE(config->nodeAtPath("/endpoints/endpoint_002/options/timeout")->toValue().value(),
+             QJsonValue(10));
+    QCOMPARE(config->nodeAtPath("/templates/endpoint/options/timeout")->toValue().value(),
+             QJsonValue(10));
+}
+
 // Test: read a config file with includes ----------------------------------------------------------
 
 void TestConfigReader::testReadConfigWithIncludes()
@@ -490,6 +808,43 @@ void TestConfigReader::testReadConfigWithIncludesAndEnv()
     }
 }
 
+// Test: read a config file with references to included nodes next to resolved Object nodes --------
+
+void TestConfigReader::testReadConfigWithNestedIncludeReferences()
+{
+    // Read config file
+    const QString configFilePath(
+                QStringLiteral(":/TestData/ConfigWithNestedIncludeReferences.json"));
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+
+    auto config = configReader.read(configFilePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+    QVERIFY(config->isObject());
+    QCOMPARE(config->count(), 2);
+
+    // Check "/nested/resolved/value"
+    {
+        const auto *value = config->nodeAtPath("/nested/resolved/value");
+        QVERIFY(value != nullptr);
+        QVERIFY(value->isValue());
+        QCOMPARE(value->toValue().value(), QJsonValue(2));
+    }
+
+    // Check "/nested/reference"
+    {
+        const auto *reference = config->nodeAtPath("/nested/reference");
+        QVERIFY(reference != nullptr);
+        QVERIFY(reference->isValue());
+        QCOMPARE(reference->toValue().value(), QJsonValue(1));
+    }
+}
+
 // Test: read a config file with only includes (empty config) --------------------------------------
 
 void TestConfigReader::testReadConfigWithOnlyIncludes()
@@ -577,6 +932,479 @@ void TestConfigReader::testReadConfigWithExternalConfigReferences()
     }
 }
 
+// Test: read a config file with includes read in parallel ----------------------------------------
+
+void TestConfigReader::testReadConfigWithParallelIncludes()
+{
+    QFETCH(QString, filePath);
+
+    // Read config file with includes read one after another
+    auto sequentialEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    sequentialEnvironmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader sequentialConfigReader;
+    QVERIFY(!sequentialConfigReader.parallelIncludesEnabled());
+
+    auto sequentialConfig = sequentialConfigReader.read(filePath,
+                                                        QDir::current(),
+                                                        ConfigNodePath::ROOT_PATH,
+                                                        ConfigNodePath::ROOT_PATH,
+                                                        {},
+                                                        &sequentialEnvironmentVariables);
+    QVERIFY(sequentialConfig);
+
+    // Read config file with includes read in parallel
+    auto parallelEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    parallelEnvironmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader parallelConfigReader;
+    parallelConfigReader.setParallelIncludesEnabled(true);
+    QVERIFY(parallelConfigReader.parallelIncludesEnabled());
+
+    auto parallelConfig = parallelConfigReader.read(filePath,
+                                                    QDir::current(),
+                                                    ConfigNodePath::ROOT_PATH,
+                                                    ConfigNodePath::ROOT_PATH,
+                                                    {},
+                                                    &parallelEnvironmentVariables);
+    QVERIFY(parallelConfig);
+
+    // Both configs and environment variables must be the same
+    QVERIFY(*parallelConfig == *sequentialConfig);
+    auto parallelNames = parallelEnvironmentVariables.names();
+    auto sequentialNames = sequentialEnvironmentVariables.names();
+    parallelNames.sort();
+    sequentialNames.sort();
+    QCOMPARE(parallelNames, sequentialNames);
+
+    for (const auto &name : sequentialEnvironmentVariables.names())
+    {
+        QCOMPARE(parallelEnvironmentVariables.value(name),
+                 sequentialEnvironmentVariables.value(name));
+    }
+}
+
+void TestConfigReader::testReadConfigWithParallelIncludes_data()
+{
+    QTest::addColumn<QString>("filePath");
+
+    QTest::newRow("ConfigWithIncludes") << ":/TestData/ConfigWithIncludes.json";
+    QTest::newRow("ConfigWithIncludesAndEnv") << ":/TestData/ConfigWithIncludesAndEnv.json";
+    QTest::newRow("ConfigWithNestedIncludeReferences")
+            << ":/TestData/ConfigWithNestedIncludeReferences.json";
+    QTest::newRow("ConfigWithOnlyIncludes") << ":/TestData/ConfigWithOnlyIncludes.json";
+    QTest::newRow("ConfigWithExternalConfigReferences")
+            << ":/TestData/ConfigWithExternalConfigReferences.json";
+    QTest::newRow("CurrentDirectoryEnvironmentVariable")
+            << ":/TestData/CurrentDirectoryEnvironmentVariable.json";
+}
+
+// Test: read a config file with lazily materialized Object nodes ----------------------------------
+
+void TestConfigReader::testReadConfigWithLazyMaterialization()
+{
+    QFETCH(QString, filePath);
+
+    // Read config file with all nodes created right away
+    auto eagerEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    eagerEnvironmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader eagerConfigReader;
+    QVERIFY(!eagerConfigReader.lazyMaterializationEnabled());
+
+    auto eagerConfig = eagerConfigReader.read(filePath,
+                                              QDir::current(),
+                                              ConfigNodePath::ROOT_PATH,
+                                              ConfigNodePath::ROOT_PATH,
+                                              {},
+                                              &eagerEnvironmentVariables);
+    QVERIFY(eagerConfig);
+
+    // Read config file with lazily materialized Object nodes
+    auto lazyEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    lazyEnvironmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader lazyConfigReader;
+    lazyConfigReader.setLazyMaterializationEnabled(true);
+    QVERIFY(lazyConfigReader.lazyMaterializationEnabled());
+
+    auto lazyConfig = lazyConfigReader.read(filePath,
+                                            QDir::current(),
+                                            ConfigNodePath::ROOT_PATH,
+                                            ConfigNodePath::ROOT_PATH,
+                                            {},
+                                            &lazyEnvironmentVariables);
+    QVERIFY(lazyConfig);
+
+    // Both configs must be the same
+    QVERIFY(*lazyConfig == *eagerConfig);
+    QCOMPARE(lazyConfig->contentHash(), eagerConfig->contentHash());
+}
+
+void TestConfigReader::testReadConfigWithLazyMaterialization_data()
+{
+    QTest::addColumn<QString>("filePath");
+
+    QTest::newRow("ValidConfig") << ":/TestData/ValidConfig.json";
+    QTest::newRow("ConfigWithNodeReferences") << ":/TestData/ConfigWithNodeReferences.json";
+    QTest::newRow("ConfigWithDerivedObjects") << ":/TestData/ConfigWithDerivedObjects.json";
+    QTest::newRow("ConfigWithIncludes") << ":/TestData/ConfigWithIncludes.json";
+    QTest::newRow("ConfigWithIncludesAndEnv") << ":/TestData/ConfigWithIncludesAndEnv.json";
+    QTest::newRow("ConfigWithNestedIncludeReferences")
+            << ":/TestData/ConfigWithNestedIncludeReferences.json";
+}
+
+// Test: lazily materialized Object nodes are read on their first access ---------------------------
+
+void TestConfigReader::testLazyMaterializationOnAccess()
+{
+    const QJsonObject configObject {
+        { "plain", QJsonObject {
+              { "enabled", true },
+              { "#list", QJsonArray { 1, 2 } },
+              { "nested", QJsonObject { { "timeout_ms", 100 } } }
+          } },
+        { "with_reference", QJsonObject {
+              { "plain", QJsonObject { { "host", "localhost" } } },
+              { "&copy", "/plain/nested" }
+          } },
+        { "value", 1 }
+    };
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+    configReader.setLazyMaterializationEnabled(true);
+
+    auto config = configReader.read(QJsonObject { { "config", configObject } },
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+    QVERIFY(config->isMaterialized());
+
+    // The referenced node had to be read to resolve the reference, but not its siblings
+    auto &plain = config->member("plain")->toObject();
+    QVERIFY(plain.isMaterialized());
+    QCOMPARE(config->nodeAtPath("/with_reference/copy/timeout_ms")->toValue().value(),
+             QJsonValue(100));
+
+    auto &withReference = config->member("with_reference")->toObject();
+    QVERIFY(withReference.isMaterialized());
+    QVERIFY(!withReference.member("plain")->toObject().isMaterialized());
+
+    // Cloning does not read the members
+    auto clone = withReference.member("plain")->clone();
+    QVERIFY(!clone->toObject().isMaterialized());
+    QVERIFY(!withReference.member("plain")->toObject().isMaterialized());
+
+    // Accessing the members reads them
+    QCOMPARE(withReference.nodeAtPath("plain/host")->toValue().value(), QJsonValue("localhost"));
+    QVERIFY(withReference.member("plain")->toObject().isMaterialized());
+    QCOMPARE(clone->toObject().count(), 1);
+    QVERIFY(clone->toObject().isMaterialized());
+
+    QCOMPARE(plain.member("list")->toValue().value(), QJsonValue(QJsonArray { 1, 2 }));
+    QVERIFY(!plain.member("nested")->toObject().isMaterialized());
+    QCOMPARE(plain.nodeAtPath("nested/timeout_ms")->nodePath().path(),
+             QString("/plain/nested/timeout_ms"));
+    QVERIFY(plain.member("nested")->toObject().isMaterialized());
+
+    // Materializing everything gives the same config as reading it without lazy members
+    config->materializeAll();
+
+    ConfigReader eagerConfigReader;
+    auto eagerConfig = eagerConfigReader.read(QJsonObject { { "config", configObject } },
+                                              QDir::current(),
+                                              ConfigNodePath::ROOT_PATH,
+                                              ConfigNodePath::ROOT_PATH,
+                                              {},
+                                              &environmentVariables);
+    QVERIFY(eagerConfig);
+    QVERIFY(*config == *eagerConfig);
+}
+
+// Test: read only the nodes reachable from the source node ---------------------------------------
+
+void TestConfigReader::testReadConfigWithSourceNodePruning()
+{
+    QFETCH(QString, filePath);
+    QFETCH(QString, sourceNodePath);
+
+    // Read whole config file
+    auto fullEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    fullEnvironmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader fullConfigReader;
+    QVERIFY(!fullConfigReader.sourceNodePruningEnabled());
+
+    auto fullConfig = fullConfigReader.read(filePath,
+                                            QDir::current(),
+                                            ConfigNodePath(sourceNodePath),
+                                            ConfigNodePath::ROOT_PATH,
+                                            {},
+                                            &fullEnvironmentVariables);
+    QVERIFY(fullConfig);
+
+    // Read only the nodes reachable from the source node
+    auto prunedEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    prunedEnvironmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader prunedConfigReader;
+    prunedConfigReader.setSourceNodePruningEnabled(true);
+    QVERIFY(prunedConfigReader.sourceNodePruningEnabled());
+
+    auto prunedConfig = prunedConfigReader.read(filePath,
+                                                QDir::current(),
+                                                ConfigNodePath(sourceNodePath),
+                                                ConfigNodePath::ROOT_PATH,
+                                                {},
+                                                &prunedEnvironmentVariables);
+    QVERIFY(prunedConfig);
+
+    // Both configs must be the same
+    QVERIFY(*prunedConfig == *fullConfig);
+}
+
+void TestConfigReader::testReadConfigWithSourceNodePruning_data()
+{
+    QTest::addColumn<QString>("filePath");
+    QTest::addColumn<QString>("sourceNodePath");
+
+    QTest::newRow("ValidConfig") << ":/TestData/ValidConfig.json" << "/";
+    QTest::newRow("NodeReferences")
+            << ":/TestData/ConfigWithNodeReferences.json" << "/root_node2";
+    QTest::newRow("RelativeNodeReference")
+            << ":/TestData/ConfigWithNodeReferences.json" << "/root_node2/ref_value2";
+    QTest::newRow("DerivedObject")
+            << ":/TestData/ConfigWithDerivedObjects.json" << "/derived_object3";
+    QTest::newRow("DerivedObjectMember")
+            << ":/TestData/ConfigWithDerivedObjects.json" << "/derived_object2/sub_node";
+    QTest::newRow("Includes")
+            << ":/TestData/ConfigWithIncludes.json" << "/included_value3";
+    QTest::newRow("NestedIncludeReferences")
+            << ":/TestData/ConfigWithNestedIncludeReferences.json" << "/nested";
+}
+
+// Test: includes that cannot contribute to the source node are not read ---------------------------
+
+void TestConfigReader::testSourceNodePruningSkipsIncludes()
+{
+    QFETCH(QJsonArray, includes);
+    QFETCH(int, readIncludeCount);
+
+    const QJsonObject rootObject {
+        { "includes", includes },
+        { "config", QJsonObject {
+              { "selected", QJsonObject { { "&value", "/included_config1/value" } } },
+              { "unrelated", QJsonObject { { "&value", "/non_existing_node" } } }
+          } }
+    };
+
+    // The whole configuration cannot be read
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader configReader;
+
+    auto config = configReader.read(rootObject,
+                                    QDir(":/TestData"),
+                                    ConfigNodePath("/selected"),
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(!config);
+
+    // Only the nodes reachable from the source node are read
+    configReader.setSourceNodePruningEnabled(true);
+    ConfigReadStatistics statistics;
+
+    {
+        const ConfigReadStatistics::RecordScope statisticsScope(&statistics);
+        config = configReader.read(rootObject,
+                                   QDir(":/TestData"),
+                                   ConfigNodePath("/selected"),
+                                   ConfigNodePath::ROOT_PATH,
+                                   {},
+                                   &environmentVariables);
+    }
+
+    QVERIFY(config);
+    QCOMPARE(config->names(), QStringList({ "value" }));
+    QCOMPARE(config->member("value")->toValue().value(), QJsonValue(1));
+    QCOMPARE(static_cast<int>(statistics.includes().size()), readIncludeCount);
+}
+
+void TestConfigReader::testSourceNodePruningSkipsIncludes_data()
+{
+    QTest::addColumn<QJsonArray>("includes");
+    QTest::addColumn<int>("readIncludeCount");
+
+    const QJsonObject include1 { { "file_path", "Include1.json" } };
+    const QJsonObject unrelatedInclude {
+        { "file_path", "Include3.json" },
+        { "destination_node", "/unrelated/included" }
+    };
+    const QJsonObject unrelatedIncludeWithEnvironmentVariables {
+        { "file_path", "includes/Include1.json" },
+        { "destination_node", "/unrelated/included" }
+    };
+
+    // The last include is skipped
+    QTest::newRow("Trailing") << QJsonArray { include1, unrelatedInclude } << 1;
+
+    // The first include is read since the later include could reference its nodes
+    QTest::newRow("Leading") << QJsonArray { unrelatedInclude, include1 } << 2;
+
+    // The last include is read since it sets environment variables
+    QTest::newRow("EnvironmentVariables")
+            << QJsonArray { include1, unrelatedIncludeWithEnvironmentVariables } << 2;
+}
+
+// Test: read a config file with streaming parsing -------------------------------------------------
+
+void TestConfigReader::testReadConfigWithStreamingParsing()
+{
+    QFETCH(QString, filePath);
+
+    // Read config file parsed to a JSON document first
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader configReader;
+    QVERIFY(!configReader.streamingParsingEnabled());
+
+    auto config = configReader.read(filePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+
+    // Read config file parsed straight into nodes
+    auto streamedEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    streamedEnvironmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader streamedConfigReader;
+    streamedConfigReader.setStreamingParsingEnabled(true);
+    QVERIFY(streamedConfigReader.streamingParsingEnabled());
+
+    auto streamedConfig = streamedConfigReader.read(filePath,
+                                                    QDir::current(),
+                                                    ConfigNodePath::ROOT_PATH,
+                                                    ConfigNodePath::ROOT_PATH,
+                                                    {},
+                                                    &streamedEnvironmentVariables);
+    QVERIFY(streamedConfig);
+
+    // Both configs must be the same
+    QVERIFY(*streamedConfig == *config);
+    QCOMPARE(streamedConfig->contentHash(), config->contentHash());
+}
+
+void TestConfigReader::testReadConfigWithStreamingParsing_data()
+{
+    QTest::addColumn<QString>("filePath");
+
+    QTest::newRow("ValidConfig") << ":/TestData/ValidConfig.json";
+    QTest::newRow("ConfigWithNodeReferences") << ":/TestData/ConfigWithNodeReferences.json";
+    QTest::newRow("ConfigWithDerivedObjects") << ":/TestData/ConfigWithDerivedObjects.json";
+    QTest::newRow("ConfigWithIncludes") << ":/TestData/ConfigWithIncludes.json";
+    QTest::newRow("ConfigWithIncludesAndEnv") << ":/TestData/ConfigWithIncludesAndEnv.json";
+    QTest::newRow("ConfigWithNestedIncludeReferences")
+            << ":/TestData/ConfigWithNestedIncludeReferences.json";
+    QTest::newRow("ConfigWithOnlyIncludes") << ":/TestData/ConfigWithOnlyIncludes.json";
+    QTest::newRow("CurrentDirectoryEnvironmentVariable")
+            << ":/TestData/CurrentDirectoryEnvironmentVariable.json";
+}
+
+// Test: streaming parsing accepts and rejects the same file contents as a JSON document -----------
+
+void TestConfigReader::testStreamingParsingMatchesJsonDocument()
+{
+    QFETCH(QByteArray, fileContents);
+    QFETCH(bool, valid);
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    QFile file(tempDir.filePath("Config.json"));
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write(fileContents), static_cast<qint64>(fileContents.size()));
+    file.close();
+
+    const auto read = [&tempDir](const bool streamingParsingEnabled)
+    {
+        auto environmentVariables = EnvironmentVariables::loadFromProcess();
+        ConfigReader configReader;
+        configReader.setStreamingParsingEnabled(streamingParsingEnabled);
+
+        return configReader.read("Config.json",
+                                 QDir(tempDir.path()),
+                                 ConfigNodePath::ROOT_PATH,
+                                 ConfigNodePath::ROOT_PATH,
+                                 {},
+                                 &environmentVariables);
+    };
+
+    const auto config = read(false);
+    const auto streamedConfig = read(true);
+    QCOMPARE(static_cast<bool>(config), valid);
+    QCOMPARE(static_cast<bool>(streamedConfig), valid);
+
+    if (valid)
+    {
+        QVERIFY(*streamedConfig == *config);
+        QCOMPARE(streamedConfig->contentHash(), config->contentHash());
+    }
+}
+
+void TestConfigReader::testStreamingParsingMatchesJsonDocument_data()
+{
+    QTest::addColumn<QByteArray>("fileContents");
+    QTest::addColumn<bool>("valid");
+
+    QTest::newRow("Byte order mark")
+            << QByteArray("\xEF\xBB\xBF{ \"config\": { \"value\": 1 } }") << true;
+    QTest::newRow("Whitespace")
+            << QByteArray("\t{\r\n  \"config\" :\n{ \"a\" : [ 1 , 2 ] , \"b\":{}} \n}\n ") << true;
+    QTest::newRow("Escape sequences")
+            << QByteArray(R"({ "config": { "a": "\"\\\/\b\f\n\r\t\u00E9\ud83d\ude00" } })")
+            << true;
+    QTest::newRow("UTF-8 text")
+            << QByteArray("{ \"config\": { \"a\": \"\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\" } }")
+            << true;
+    QTest::newRow("Numbers")
+            << QByteArray(R"({ "config": { "a": 0, "b": -1.5, "c": 2e3, "d": 1E-2, "e": 1234 } })")
+            << true;
+    QTest::newRow("Literals")
+            << QByteArray(R"({ "config": { "a": true, "b": false, "c": null, "d": [null] } })")
+            << true;
+    QTest::newRow("Decorators")
+            << QByteArray(R"({ "config": { "#a": { "b": [1, { "c": 2 }] }, "d": { "e": 1 },)"
+                          R"( "&f": "/d", "&g": { "base": ["/d"], "config": { "h": 2 } } } })")
+            << true;
+    QTest::newRow("Config member first")
+            << QByteArray(R"({ "config": { "$a": "${StreamingParsingValue}" },)"
+                          R"( "environment_variables": { "StreamingParsingValue": "value" },)"
+                          R"( "includes": [] })")
+            << true;
+    QTest::newRow("Unknown root members")
+            << QByteArray(R"({ "comment": { "a": [1, { "b": null }] }, "config": { "a": 1 } })")
+            << true;
+    QTest::newRow("Null config member") << QByteArray(R"({ "config": null })") << true;
+
+    QTest::newRow("Empty file") << QByteArray() << false;
+    QTest::newRow("Array") << QByteArray("[]") << false;
+    QTest::newRow("Trailing comma") << QByteArray(R"({ "config": { "a": 1, } })") << false;
+    QTest::newRow("Garbage at end") << QByteArray(R"({ "config": {} } x)") << false;
+    QTest::newRow("Unterminated object") << QByteArray(R"({ "config": { "a": 1 })") << false;
+    QTest::newRow("Invalid UTF-8")
+            << QByteArray("{ \"config\": { \"a\": \"\xFF\" } }") << false;
+    QTest::newRow("Missing config member") << QByteArray(R"({ "includes": [] })") << false;
+    QTest::newRow("Config member not an object") << QByteArray(R"({ "config": 1 })") << false;
+    QTest::newRow("Invalid member name") << QByteArray(R"({ "config": { "a/b": 1 } })") << false;
+    QTest::newRow("Invalid reference type") << QByteArray(R"({ "config": { "&a": 1 } })") << false;
+    QTest::newRow("Derived object without base")
+            << QByteArray(R"({ "config": { "&a": { "config": {} } } })") << false;
+    QTest::newRow("Undefined environment variable")
+            << QByteArray(R"({ "config": { "$a": "${StreamingParsingUndefinedValue}" } })")
+            << false;
+}
+
 // Test: read a config file with invalid file, source, and destination parameters ------------------
 
 void TestConfigReader::testReadInvalidPathParameters()
@@ -649,6 +1477,31 @@ void TestConfigReader::testReadInvalidConfigFile()
                                     {},
                                     &environmentVariables);
     QVERIFY(!config);
+
+    // Read config file with parallel reading of includes
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    configReader.setParallelIncludesEnabled(true);
+
+    config = configReader.read(filePath,
+                               QDir::current(),
+                               ConfigNodePath::ROOT_PATH,
+                               ConfigNodePath::ROOT_PATH,
+                               {},
+                               &environmentVariables);
+    QVERIFY(!config);
+
+    // Read config file with streaming parsing
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    configReader.setParallelIncludesEnabled(false);
+    configReader.setStreamingParsingEnabled(true);
+
+    config = configReader.read(filePath,
+                               QDir::current(),
+                               ConfigNodePath::ROOT_PATH,
+                               ConfigNodePath::ROOT_PATH,
+                               {},
+                               &environmentVariables);
+    QVERIFY(!config);
 }
 
 void TestConfigReader::testReadInvalidConfigFile_data()
@@ -696,6 +1549,8 @@ void TestConfigReader::testReadInvalidConfigFile_data()
     QTest::newRow("ConfigInvalidReferenceType") << ":/TestData/ConfigInvalidReferenceType.json";
     QTest::newRow("ConfigInvalidSubObjectNode") << ":/TestData/ConfigInvalidSubObjectNode.json";
     QTest::newRow("ConfigUnresolvedReference") << ":/TestData/ConfigUnresolvedReference.json";
+    QTest::newRow("ConfigReferenceCycle") << ":/TestData/ConfigReferenceCycle.json";
+    QTest::newRow("ConfigSelfReference") << ":/TestData/ConfigSelfReference.json";
     QTest::newRow("ConfigUnresolvableExternalConfigReferences")
             << ":/TestData/ConfigUnresolvableExternalConfigReferences.json";
     QTest::newRow("ConfigUnresolvedFilePath") << ":/TestData/ConfigUnresolvedFilePath.json";
@@ -705,6 +1560,73 @@ void TestConfigReader::testReadInvalidConfigFile_data()
     QTest::newRow("ConfigInvalidEnvVar4") << ":/TestData/ConfigInvalidEnvVar4.json";
 }
 
+// Test: read an empty and a missing config file from the file system ------------------------------
+
+void TestConfigReader::testReadEmptyAndMissingFile()
+{
+    QFETCH(bool, parallelIncludesEnabled);
+    QFETCH(bool, streamingParsingEnabled);
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const auto writeFile = [&tempDir](const QString &fileName, const QByteArray &contents)
+    {
+        QFile file(tempDir.filePath(fileName));
+        return (file.open(QIODevice::WriteOnly) && (file.write(contents) == contents.size()));
+    };
+    const auto includeFile = [](const QString &fileName)
+    {
+        return QJsonDocument(QJsonObject {
+                                 { "includes", QJsonArray { QJsonObject {
+                                       { "file_path", fileName }
+                                   } } },
+                                 { "config", QJsonObject() }
+                             }).toJson();
+    };
+
+    QVERIFY(writeFile("Valid.json", "{ \"config\": { \"value\": 1 } }"));
+    QVERIFY(writeFile("Empty.json", QByteArray()));
+    QVERIFY(writeFile("IncludesEmpty.json", includeFile("Empty.json")));
+    QVERIFY(writeFile("IncludesMissing.json", includeFile("Missing.json")));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+    configReader.setParallelIncludesEnabled(parallelIncludesEnabled);
+    configReader.setStreamingParsingEnabled(streamingParsingEnabled);
+
+    const auto read = [&](const QString &fileName)
+    {
+        return configReader.read(fileName,
+                                 QDir(tempDir.path()),
+                                 ConfigNodePath::ROOT_PATH,
+                                 ConfigNodePath::ROOT_PATH,
+                                 {},
+                                 &environmentVariables);
+    };
+
+    // A file from the file system is read
+    const auto config = read("Valid.json");
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value(), QJsonValue(1));
+
+    // Empty and missing files are rejected, also when they are included
+    QVERIFY(!read("Empty.json"));
+    QVERIFY(!read("Missing.json"));
+    QVERIFY(!read("IncludesEmpty.json"));
+    QVERIFY(!read("IncludesMissing.json"));
+}
+
+void TestConfigReader::testReadEmptyAndMissingFile_data()
+{
+    QTest::addColumn<bool>("parallelIncludesEnabled");
+    QTest::addColumn<bool>("streamingParsingEnabled");
+
+    QTest::newRow("Sequential includes") << false << false;
+    QTest::newRow("Parallel includes") << true << false;
+    QTest::newRow("Streaming parsing") << false << true;
+}
+
 // Test: using the current directory environment variable ------------------------------------------
 
 void TestConfigReader::testCurrentDirectoryEnvironmentVariable()
@@ -759,6 +1681,420 @@ void TestConfigReader::testReadConfigNullEnvironmentVariables()
     QVERIFY(!config);
 }
 
+// Test: read independent configs on multiple threads with the same reader -------------------------
+
+void TestConfigReader::testReadConfigOnMultipleThreads()
+{
+    const QString configFilePath(QStringLiteral(":/TestData/ConfigWithIncludesAndEnv.json"));
+    const ConfigReader configReader;
+
+    // Read the expected config
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+
+    const auto expectedConfig = configReader.read(configFilePath,
+                                                  QDir::current(),
+                                                  ConfigNodePath::ROOT_PATH,
+                                                  ConfigNodePath::ROOT_PATH,
+                                                  {},
+                                                  &environmentVariables);
+    QVERIFY(expectedConfig);
+
+    // Read the config on multiple threads while the reader for the includes gets replaced
+    constexpr int threadCount = 4;
+    constexpr int readCount = 20;
+    std::vector<std::unique_ptr<ConfigObjectNode>> configs[threadCount];
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(threadCount + 1);
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        threadPool.start(new ReadConfigTask(&configReader, configFilePath, readCount, &configs[i]));
+    }
+
+    threadPool.start(new RegisterConfigReaderTask(readCount));
+    QVERIFY(threadPool.waitForDone(60000));
+
+    for (const auto &threadConfigs : configs)
+    {
+        QCOMPARE(static_cast<int>(threadConfigs.size()), readCount);
+
+        for (const auto &config : threadConfigs)
+        {
+            QVERIFY(config);
+            QVERIFY(*config == *expectedConfig);
+        }
+    }
+}
+
+// Test: read a config file asynchronously --------------------------------------------------------
+
+void TestConfigReader::testReadConfigAsync()
+{
+    QFETCH(bool, parallelIncludesEnabled);
+
+    const QString configFilePath(QStringLiteral(":/TestData/ConfigWithIncludesAndEnv.json"));
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+
+    ConfigReader configReader;
+    configReader.setParallelIncludesEnabled(parallelIncludesEnabled);
+
+    // Read the expected config
+    auto expectedEnvironmentVariables = environmentVariables;
+    const auto expectedConfig = configReader.read(configFilePath,
+                                                  QDir::current(),
+                                                  ConfigNodePath::ROOT_PATH,
+                                                  ConfigNodePath::ROOT_PATH,
+                                                  {},
+                                                  &expectedEnvironmentVariables);
+    QVERIFY(expectedConfig);
+
+    // Read the config asynchronously
+    std::unique_ptr<ConfigObjectNode> config;
+    EnvironmentVariables readEnvironmentVariables;
+    int callbackCount = 0;
+
+    const auto operation = configReader.readAsync(
+                configFilePath,
+                QDir::current(),
+                ConfigNodePath::ROOT_PATH,
+                ConfigNodePath::ROOT_PATH,
+                {},
+                environmentVariables,
+                [&config, &readEnvironmentVariables, &callbackCount](
+                std::unique_ptr<ConfigObjectNode> readConfig,
+                const EnvironmentVariables &updatedEnvironmentVariables)
+    {
+        config = std::move(readConfig);
+        readEnvironmentVariables = updatedEnvironmentVariables;
+        callbackCount++;
+    });
+    QVERIFY(operation);
+    QVERIFY(operation->waitForFinished(60000));
+    QVERIFY(operation->isFinished());
+    QVERIFY(!operation->isCanceled());
+
+    QCOMPARE(callbackCount, 1);
+    QVERIFY(config);
+    QVERIFY(*config == *expectedConfig);
+    QCOMPARE(readEnvironmentVariables.value("IncludeDir"), QString(":/TestData/includes"));
+    QCOMPARE(readEnvironmentVariables.value("IncludeDir"),
+             expectedEnvironmentVariables.value("IncludeDir"));
+
+    // Failed read also calls the callback
+    callbackCount = 0;
+    const auto failedOperation = configReader.readAsync(
+                QStringLiteral(":/TestData/NonExistingFile.json"),
+                QDir::current(),
+                ConfigNodePath::ROOT_PATH,
+                ConfigNodePath::ROOT_PATH,
+                {},
+                environmentVariables,
+                [&config, &callbackCount](std::unique_ptr<ConfigObjectNode> readConfig,
+                                          const EnvironmentVariables &)
+    {
+        config = std::move(readConfig);
+        callbackCount++;
+    });
+    QVERIFY(failedOperation->waitForFinished(60000));
+    QCOMPARE(callbackCount, 1);
+    QVERIFY(!config);
+}
+
+void TestConfigReader::testReadConfigAsync_data()
+{
+    QTest::addColumn<bool>("parallelIncludesEnabled");
+
+    QTest::newRow("Sequential includes") << false;
+    QTest::newRow("Parallel includes") << true;
+}
+
+// Test: cancel an asynchronous read ---------------------------------------------------------------
+
+void TestConfigReader::testReadConfigAsyncCanceled()
+{
+    // Occupy all threads of the global thread pool so that the read cannot start before it is
+    // canceled
+    auto *threadPool = QThreadPool::globalInstance();
+    const int threadCount = threadPool->maxThreadCount();
+    QSemaphore started;
+    QSemaphore released;
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        threadPool->start(new BlockingTask(&started, &released));
+    }
+
+    QVERIFY(started.tryAcquire(threadCount, 60000));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader configReader;
+    int callbackCount = 0;
+
+    const auto operation = configReader.readAsync(
+                QStringLiteral(":/TestData/ConfigWithIncludesAndEnv.json"),
+                QDir::current(),
+                ConfigNodePath::ROOT_PATH,
+                ConfigNodePath::ROOT_PATH,
+                {},
+                environmentVariables,
+                [&callbackCount](std::unique_ptr<ConfigObjectNode>, const EnvironmentVariables &)
+    {
+        callbackCount++;
+    });
+
+    QVERIFY(!operation->waitForFinished(10));
+    QVERIFY(!operation->isFinished());
+    operation->cancel();
+    QVERIFY(operation->isCanceled());
+
+    // The canceled read finishes without calling the callback
+    released.release(threadCount);
+    QVERIFY(operation->waitForFinished(60000));
+    QCOMPARE(callbackCount, 0);
+}
+
+// Test: read with a canceled operation ------------------------------------------------------------
+
+void TestConfigReader::testReadCanceledOperation()
+{
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader configReader;
+    configReader.setParallelIncludesEnabled(true);
+
+    ConfigReadOperation operation;
+    QVERIFY(ConfigReadOperation::current() == nullptr);
+    QVERIFY(!ConfigReadOperation::isCurrentCanceled());
+
+    {
+        const ConfigReadOperation::Scope scope(&operation);
+        QVERIFY(ConfigReadOperation::current() == &operation);
+        QVERIFY(!ConfigReadOperation::isCurrentCanceled());
+
+        auto config = configReader.read(QStringLiteral(":/TestData/ConfigWithIncludes.json"),
+                                        QDir::current(),
+                                        ConfigNodePath::ROOT_PATH,
+                                        ConfigNodePath::ROOT_PATH,
+                                        {},
+                                        &environmentVariables);
+        QVERIFY(config);
+
+        operation.cancel();
+        QVERIFY(ConfigReadOperation::isCurrentCanceled());
+
+        config = configReader.read(QStringLiteral(":/TestData/ConfigWithIncludes.json"),
+                                   QDir::current(),
+                                   ConfigNodePath::ROOT_PATH,
+                                   ConfigNodePath::ROOT_PATH,
+                                   {},
+                                   &environmentVariables);
+        QVERIFY(!config);
+    }
+
+    QVERIFY(ConfigReadOperation::current() == nullptr);
+}
+
+// Test: record the statistics of a config read ----------------------------------------------------
+
+void TestConfigReader::testReadStatistics()
+{
+    QFETCH(bool, parallelIncludesEnabled);
+
+    const QString configFilePath(QStringLiteral(":/TestData/ConfigWithIncludes.json"));
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+    configReader.setParallelIncludesEnabled(parallelIncludesEnabled);
+
+    ConfigReadStatistics statistics;
+    QVERIFY(!ConfigReadStatistics::isRecording());
+
+    {
+        const ConfigReadStatistics::RecordScope scope(&statistics);
+        QVERIFY(ConfigReadStatistics::isRecording());
+        QVERIFY(ConfigReadStatistics::current() == &statistics);
+
+        auto config = configReader.read(configFilePath,
+                                        QDir::current(),
+                                        ConfigNodePath::ROOT_PATH,
+                                        ConfigNodePath::ROOT_PATH,
+                                        {},
+                                        &environmentVariables);
+        QVERIFY(config);
+    }
+
+    QVERIFY(!ConfigReadStatistics::isRecording());
+
+    // The main file, the three includes and the include nested in 'Include2.json' are read (the
+    // files pre-read on the thread pool are recorded as well)
+    QCOMPARE(statistics.phase(ConfigReadStatistics::Phase::FileIo).count, 5);
+    QCOMPARE(statistics.phase(ConfigReadStatistics::Phase::JsonParsing).count, 5);
+    QCOMPARE(statistics.phase(ConfigReadStatistics::Phase::ReadObjectNode).count, 5);
+    QCOMPARE(statistics.phase(ConfigReadStatistics::Phase::ResolveReferences).count, 5);
+    QCOMPARE(statistics.phase(ConfigReadStatistics::Phase::TransformConfig).count, 5);
+
+    // Each file applies its 'config' member and each of the four includes is applied
+    QCOMPARE(statistics.phase(ConfigReadStatistics::Phase::Apply).count, 9);
+
+    // Includes are recorded when they are finished
+    const auto includes = statistics.includes();
+    QCOMPARE(static_cast<int>(includes.size()), 4);
+
+    const QStringList expectedFileNames = { "Include1.json",
+                                            "Include1.json",
+                                            "Include2.json",
+                                            "Include3.json" };
+
+    for (size_t i = 0; i < includes.size(); i++)
+    {
+        QCOMPARE(includes[i].type, QString("CppConfigFramework"));
+        QCOMPARE(QFileInfo(includes[i].filePath).fileName(),
+                 expectedFileNames.at(static_cast<int>(i)));
+        QVERIFY(QFileInfo(includes[i].filePath).isAbsolute());
+        QVERIFY(includes[i].elapsedNanoseconds >= 0);
+    }
+
+    // Only 'Include2.json' has a reference and it is resolved in a single cycle
+    const auto resolutions = statistics.referenceResolutions();
+    QCOMPARE(static_cast<int>(resolutions.size()), 5);
+
+    int resolvedNodeCount = 0;
+
+    for (const auto &resolution : resolutions)
+    {
+        for (const int count : resolution.resolvedNodeCounts)
+        {
+            resolvedNodeCount += count;
+        }
+
+        QVERIFY(resolution.resolvedNodeCounts.size() <= 1U);
+    }
+
+    QCOMPARE(resolvedNodeCount, 1);
+
+    QVERIFY(statistics.createdNodeCount() > 0);
+    QVERIFY(statistics.toString().contains("ResolveReferences"));
+    QVERIFY(statistics.toString().contains(includes.front().filePath));
+
+    // Reads outside of the scope are not recorded
+    const auto createdNodeCount = statistics.createdNodeCount();
+    QVERIFY(configReader.read(configFilePath,
+                              QDir::current(),
+                              ConfigNodePath::ROOT_PATH,
+                              ConfigNodePath::ROOT_PATH,
+                              {},
+                              &environmentVariables));
+    QCOMPARE(statistics.createdNodeCount(), createdNodeCount);
+    QCOMPARE(statistics.phase(ConfigReadStatistics::Phase::FileIo).count, 5);
+
+    // Clear the statistics
+    statistics.clear();
+    QCOMPARE(statistics.phase(ConfigReadStatistics::Phase::FileIo).count, 0);
+    QVERIFY(statistics.includes().empty());
+    QVERIFY(statistics.referenceResolutions().empty());
+    QCOMPARE(statistics.createdNodeCount(), Q_INT64_C(0));
+}
+
+void TestConfigReader::testReadStatistics_data()
+{
+    QTest::addColumn<bool>("parallelIncludesEnabled");
+
+    QTest::newRow("sequential") << false;
+    QTest::newRow("parallel") << true;
+}
+
+// Test: reference resolution cycles and node counters ---------------------------------------------
+
+void TestConfigReader::testReadStatisticsCounters()
+{
+    // All of the references point to nodes without references so they are resolved in one cycle
+    const QString configFilePath(QStringLiteral(":/TestData/ConfigWithNodeReferences.json"));
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+
+    ConfigReadStatistics statistics;
+
+    {
+        const ConfigReadStatistics::RecordScope scope(&statistics);
+        QVERIFY(configReader.read(configFilePath,
+                                  QDir::current(),
+                                  ConfigNodePath::ROOT_PATH,
+                                  ConfigNodePath::ROOT_PATH,
+                                  {},
+                                  &environmentVariables));
+    }
+
+    const auto resolutions = statistics.referenceResolutions();
+    QCOMPARE(static_cast<int>(resolutions.size()), 1);
+    QCOMPARE(resolutions.front().resolvedNodeCounts, std::vector<int>({ 3 }));
+
+    // Reference chain is resolved in one cycle per link
+    const QJsonObject configObject
+    {
+        {
+            "config", QJsonObject
+            {
+                { "value", 1 },
+                { "&ref1", "/value" },
+                { "&ref2", "/ref1" },
+                { "&ref3", "/ref2" }
+            }
+        }
+    };
+
+    statistics.clear();
+
+    {
+        const ConfigReadStatistics::RecordScope scope(&statistics);
+        QVERIFY(configReader.read(configObject,
+                                  QDir::current(),
+                                  ConfigNodePath::ROOT_PATH,
+                                  ConfigNodePath::ROOT_PATH,
+                                  {},
+                                  &environmentVariables));
+    }
+
+    QCOMPARE(static_cast<int>(statistics.referenceResolutions().size()), 1);
+    QCOMPARE(statistics.referenceResolutions().front().resolvedNodeCounts,
+             std::vector<int>({ 1, 1, 1 }));
+
+    // Created and cloned nodes
+    ConfigObjectNode node;
+    node.setMember("a", ConfigValueNode(1));
+    node.setMember("b", ConfigValueNode(2));
+
+    statistics.clear();
+
+    {
+        const ConfigReadStatistics::RecordScope scope(&statistics);
+        const auto clonedNode = node.clone();
+        QVERIFY(clonedNode);
+    }
+
+    QCOMPARE(statistics.clonedNodeCount(), Q_INT64_C(3));
+    QCOMPARE(statistics.createdNodeCount(), Q_INT64_C(3));
+
+    // Nested scope records in its own statistics
+    ConfigReadStatistics nestedStatistics;
+
+    {
+        const ConfigReadStatistics::RecordScope scope(&statistics);
+
+        {
+            const ConfigReadStatistics::RecordScope nestedScope(&nestedStatistics);
+            node.clone();
+        }
+
+        QVERIFY(ConfigReadStatistics::current() == &statistics);
+    }
+
+    QCOMPARE(statistics.clonedNodeCount(), Q_INT64_C(3));
+    QCOMPARE(nestedStatistics.clonedNodeCount(), Q_INT64_C(3));
+}
+
 // Main function -----------------------------------------------------------------------------------
 
 QTEST_MAIN(TestConfigReader)
@@ -0,0 +1,244 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigSnapshotPublisher class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigSnapshotPublisher.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QRunnable>
+#include <QtCore/QThreadPool>
+#include <QtTest/QTest>
+
+// System includes
+#include <atomic>
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigSnapshotPublisher : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testFreeze();
+    void testPublish();
+    void testConcurrentReaders();
+
+private:
+    static std::unique_ptr<ConfigObjectNode> createConfig(const int value);
+};
+
+// Reader task -------------------------------------------------------------------------------------
+
+//! Reads the current snapshot of the publisher in a loop and checks its consistency
+class ReaderTask : public QRunnable
+{
+public:
+    ReaderTask(const ConfigSnapshotPublisher *publisher,
+               const std::atomic<bool> *stop,
+               std::atomic<int> *errorCount)
+        : m_publisher(publisher),
+          m_stop(stop),
+          m_errorCount(errorCount)
+    {
+    }
+
+    void run() override
+    {
+        qint64 previousValue = -1;
+
+        while (!m_stop->load())
+        {
+            const ConfigSnapshot config = m_publisher->snapshot();
+
+            if (!config)
+            {
+                continue;
+            }
+
+            // Both members always have the same value and newer snapshots have greater values
+            const qint64 value = config->nodeAtPath("/a")->toValue().toInt64();
+            const ConfigNode *nestedNode = config->nodeAtPath("/nested/b");
+
+            if ((nestedNode->toValue().toInt64() != value) ||
+                (nestedNode->nodePath().path() != QStringLiteral("/nested/b")) ||
+                (value < previousValue))
+            {
+                m_errorCount->fetch_add(1);
+            }
+
+            previousValue = value;
+        }
+    }
+
+private:
+    const ConfigSnapshotPublisher *m_publisher;
+    const std::atomic<bool> *m_stop;
+    std::atomic<int> *m_errorCount;
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigSnapshotPublisher::initTestCase()
+{
+}
+
+void TestConfigSnapshotPublisher::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigSnapshotPublisher::init()
+{
+}
+
+void TestConfigSnapshotPublisher::cleanup()
+{
+}
+
+// Test: freeze() method ---------------------------------------------------------------------------
+
+void TestConfigSnapshotPublisher::testFreeze()
+{
+    QVERIFY(!ConfigSnapshotPublisher::freeze({}));
+
+    // Frozen node becomes a root node with the same contents
+    ConfigObjectNode parent;
+    auto config = createConfig(1);
+    config->setParent(&parent);
+
+    const quint64 contentHash = config->contentHash();
+    const ConfigObjectNode *node = config.get();
+
+    const auto snapshot = ConfigSnapshotPublisher::freeze(std::move(config));
+    QVERIFY(snapshot);
+    QCOMPARE(snapshot.get(), node);
+    QVERIFY(snapshot->isRoot());
+    QCOMPARE(snapshot->contentHash(), contentHash);
+    QCOMPARE(snapshot->nodeAtPath("/nested/b")->nodePath().path(), QStringLiteral("/nested/b"));
+    QCOMPARE(snapshot->nodeAtPath("/derived")->toDerivedObject().config().member("c")->nodePath(),
+             ConfigNodePath("/c"));
+}
+
+// Test: publish() and snapshot() methods ----------------------------------------------------------
+
+void TestConfigSnapshotPublisher::testPublish()
+{
+    ConfigSnapshotPublisher publisher;
+    QVERIFY(!publisher.snapshot());
+    QCOMPARE(publisher.version(), Q_UINT64_C(0));
+
+    // Publish a configuration node
+    const auto snapshot1 = publisher.publish(createConfig(1));
+    QVERIFY(snapshot1);
+    QVERIFY(publisher.snapshot() == snapshot1);
+    QCOMPARE(publisher.version(), Q_UINT64_C(1));
+
+    // Publish a frozen snapshot (the previous one is still valid for its readers)
+    const auto snapshot2 = ConfigSnapshotPublisher::freeze(createConfig(2));
+    publisher.publish(snapshot2);
+    QVERIFY(publisher.snapshot() == snapshot2);
+    QCOMPARE(publisher.version(), Q_UINT64_C(2));
+    QCOMPARE(snapshot1->nodeAtPath("/a")->toValue().toInt64(), Q_INT64_C(1));
+    QCOMPARE(snapshot1.use_count(), 1L);
+
+    // Null configuration node is not published
+    QVERIFY(!publisher.publish(std::unique_ptr<ConfigObjectNode>()));
+    QVERIFY(publisher.snapshot() == snapshot2);
+    QCOMPARE(publisher.version(), Q_UINT64_C(2));
+
+    // Reset
+    publisher.reset();
+    QVERIFY(!publisher.snapshot());
+    QCOMPARE(publisher.version(), Q_UINT64_C(3));
+    QCOMPARE(snapshot2.use_count(), 1L);
+}
+
+// Test: readers on other threads while new snapshots are published --------------------------------
+
+void TestConfigSnapshotPublisher::testConcurrentReaders()
+{
+    ConfigSnapshotPublisher publisher;
+    publisher.publish(createConfig(0));
+
+    std::atomic<bool> stop(false);
+    std::atomic<int> errorCount(0);
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(4);
+
+    for (int i = 0; i < threadPool.maxThreadCount(); i++)
+    {
+        threadPool.start(new ReaderTask(&publisher, &stop, &errorCount));
+    }
+
+    for (int i = 1; i <= 200; i++)
+    {
+        publisher.publish(createConfig(i));
+    }
+
+    stop.store(true);
+    QVERIFY(threadPool.waitForDone(10000));
+
+    QCOMPARE(errorCount.load(), 0);
+    QCOMPARE(publisher.snapshot()->nodeAtPath("/a")->toValue().toInt64(), Q_INT64_C(200));
+    QCOMPARE(publisher.version(), Q_UINT64_C(201));
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> TestConfigSnapshotPublisher::createConfig(const int value)
+{
+    auto config = std::make_unique<ConfigObjectNode>();
+    config->setMember("a", ConfigValueNode(value));
+
+    ConfigObjectNode nested;
+    nested.setMember("b", ConfigValueNode(value));
+    config->setMember("nested", nested);
+
+    ConfigObjectNode overloads;
+    overloads.setMember("c", ConfigValueNode(value));
+    config->setMember("derived", ConfigDerivedObjectNode({ ConfigNodePath("/nested") }, overloads));
+
+    return config;
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigSnapshotPublisher)
+#include "testConfigSnapshotPublisher.moc"
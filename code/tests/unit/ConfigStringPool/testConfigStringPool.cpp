@@ -0,0 +1,268 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigStringPool class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigStringPool.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QJsonObject>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigStringPool : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testDisabledByDefault();
+    void testIntern();
+    void testSetMember();
+    void testSetValue();
+    void testReader();
+    void testReleaseUnused();
+    void testMemoryUsage();
+
+private:
+    static bool sharesStorage(const QString &left, const QString &right);
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigStringPool::initTestCase()
+{
+}
+
+void TestConfigStringPool::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigStringPool::init()
+{
+    ConfigStringPool::instance()->setEnabled(true);
+}
+
+void TestConfigStringPool::cleanup()
+{
+    ConfigStringPool::instance()->setEnabled(false);
+}
+
+// Test: pool is disabled by default ---------------------------------------------------------------
+
+void TestConfigStringPool::testDisabledByDefault()
+{
+    // Disabling the pool clears it
+    ConfigStringPool::instance()->setEnabled(false);
+    QVERIFY(!ConfigStringPool::instance()->isEnabled());
+
+    const QString first = QString("na") + QString("me");
+    const QString second = QString("nam") + QString("e");
+
+    QVERIFY(!sharesStorage(ConfigStringPool::instance()->intern(first),
+                           ConfigStringPool::instance()->intern(second)));
+    QCOMPARE(ConfigStringPool::instance()->count(), 0);
+}
+
+// Test: equal strings share the storage -----------------------------------------------------------
+
+void TestConfigStringPool::testIntern()
+{
+    const QString first = QString("na") + QString("me");
+    const QString second = QString("nam") + QString("e");
+    QVERIFY(!sharesStorage(first, second));
+
+    const QString internedFirst = ConfigStringPool::instance()->intern(first);
+    const QString internedSecond = ConfigStringPool::instance()->intern(second);
+
+    QCOMPARE(internedFirst, QString("name"));
+    QCOMPARE(internedSecond, QString("name"));
+    QVERIFY(sharesStorage(internedFirst, internedSecond));
+    QCOMPARE(ConfigStringPool::instance()->count(), 1);
+
+    // Empty strings are not stored
+    QVERIFY(ConfigStringPool::instance()->intern(QString()).isNull());
+    QVERIFY(ConfigStringPool::instance()->intern(QString("")).isEmpty());
+    QCOMPARE(ConfigStringPool::instance()->count(), 1);
+
+    ConfigStringPool::instance()->clear();
+    QCOMPARE(ConfigStringPool::instance()->count(), 0);
+}
+
+// Test: member names are interned -----------------------------------------------------------------
+
+void TestConfigStringPool::testSetMember()
+{
+    ConfigObjectNode first;
+    ConfigObjectNode second;
+
+    QVERIFY(first.setMember(QString("time") + QString("out"), ConfigValueNode(1)));
+    QVERIFY(second.setMember(QString("tim") + QString("eout"), ConfigValueNode(2)));
+
+    QVERIFY(sharesStorage(first.begin()->name(), second.begin()->name()));
+    QCOMPARE(first.name(*first.member("timeout")), QString("timeout"));
+
+    // Replacing a member keeps its name
+    const QString name = first.begin()->name();
+    QVERIFY(first.setMember(QString("time") + QString("out"), ConfigValueNode(3)));
+    QVERIFY(sharesStorage(first.begin()->name(), name));
+    QCOMPARE(first.member("timeout")->toValue().value(), QJsonValue(3));
+
+    // Cloned and merged members share the names too
+    auto clone = first.clone();
+    QVERIFY(sharesStorage(clone->toObject().begin()->name(), name));
+
+    ConfigObjectNode merged;
+    merged.apply(second);
+    QVERIFY(sharesStorage(merged.begin()->name(), name));
+}
+
+// Test: string values are interned ----------------------------------------------------------------
+
+void TestConfigStringPool::testSetValue()
+{
+    ConfigValueNode first(QString("local") + QString("host"));
+    ConfigValueNode second;
+    second.setValue(QString("localh") + QString("ost"));
+
+    QVERIFY(sharesStorage(first.toString(), second.toString()));
+    QVERIFY(first.hasSameValue(second));
+
+    // Other values are not interned
+    ConfigValueNode number(1);
+    QCOMPARE(number.value(), QJsonValue(1));
+    QCOMPARE(ConfigStringPool::instance()->count(), 1);
+}
+
+// Test: reader shares the member names ------------------------------------------------------------
+
+void TestConfigStringPool::testReader()
+{
+    const QJsonObject configObject {
+        {
+            "config", QJsonObject {
+                { "first", QJsonObject { { "#enabled", true }, { "host", "localhost" } } },
+                { "second", QJsonObject { { "enabled", false }, { "#host", "localhost" } } }
+            }
+        }
+    };
+
+    ConfigReader configReader;
+    EnvironmentVariables environmentVariables;
+    auto config = configReader.read(configObject,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+
+    const auto &first = config->member("first")->toObject();
+    const auto &second = config->member("second")->toObject();
+
+    QCOMPARE(first.names(), QStringList({ "enabled", "host" }));
+    QCOMPARE(second.names(), QStringList({ "enabled", "host" }));
+
+    auto firstIt = first.begin();
+    auto secondIt = second.begin();
+
+    for (; firstIt != first.end(); ++firstIt, ++secondIt)
+    {
+        QVERIFY(sharesStorage(firstIt->name(), secondIt->name()));
+    }
+
+    QVERIFY(sharesStorage(first.member("host")->toValue().toString(),
+                          second.member("host")->toValue().toString()));
+}
+
+// Test: unused strings are released ---------------------------------------------------------------
+
+void TestConfigStringPool::testReleaseUnused()
+{
+    auto node = std::make_unique<ConfigObjectNode>();
+    QVERIFY(node->setMember(QString("used"), ConfigValueNode(1)));
+    QVERIFY(node->setMember(QString("unused"), ConfigValueNode(2)));
+    QVERIFY(node->remove("unused"));
+    QCOMPARE(ConfigStringPool::instance()->count(), 2);
+
+    QCOMPARE(ConfigStringPool::instance()->releaseUnused(), 1);
+    QCOMPARE(ConfigStringPool::instance()->count(), 1);
+
+    node.reset();
+    QCOMPARE(ConfigStringPool::instance()->releaseUnused(), 1);
+    QCOMPARE(ConfigStringPool::instance()->count(), 0);
+}
+
+// Test: interned strings are reported as shared storage ------------------------------------------
+
+void TestConfigStringPool::testMemoryUsage()
+{
+    const QString notInterned = QString("na") + QString("me");
+    const QString interned = ConfigStringPool::instance()->intern(QString("nam") + QString("e"));
+
+    QVERIFY(ConfigStringPool::instance()->isInterned(interned));
+    QVERIFY(!ConfigStringPool::instance()->isInterned(notInterned));
+    QVERIFY(!ConfigStringPool::instance()->isInterned(QString()));
+
+    ConfigObjectNode node;
+    QVERIFY(node.setMember(QString("val") + QString("ue"),
+                           ConfigValueNode(QString("some") + QString(" text"))));
+
+    const auto usage = node.memoryUsage();
+    QCOMPARE(usage.memberNameBytes, 0);
+    QVERIFY(usage.sharedMemberNameBytes > 0);
+    QCOMPARE(usage.valuePayloadBytes, 0);
+    QVERIFY(usage.sharedValuePayloadBytes > 0);
+    QCOMPARE(usage.sharedBytes(), usage.sharedMemberNameBytes + usage.sharedValuePayloadBytes);
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+bool TestConfigStringPool::sharesStorage(const QString &left, const QString &right)
+{
+    return (left.constData() == right.constData());
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigStringPool)
+#include "testConfigStringPool.moc"
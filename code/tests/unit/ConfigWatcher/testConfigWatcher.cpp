@@ -0,0 +1,509 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigWatcher and ConfigIncludeGraph classes
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigFileCache.hpp>
+#include <CppConfigFramework/ConfigIncludeGraph.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include <CppConfigFramework/ConfigWatcher.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigWatcher : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testIncludeGraph();
+    void testStart();
+    void testReloadChangedInclude();
+    void testDebounce();
+    void testReloadFailed();
+    void testUnchangedConfig();
+    void testFileCacheState();
+
+private:
+    bool writeFile(const QString &fileName, const QJsonObject &rootObject) const;
+    bool writeFileContents(const QString &fileName, const QByteArray &contents) const;
+    bool writeIncludeTree() const;
+    QString filePath(const QString &fileName) const;
+    QJsonValue value(const ConfigObjectNode &config, const QString &nodePath) const;
+
+    std::unique_ptr<QTemporaryDir> m_tempDir;
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigWatcher::initTestCase()
+{
+}
+
+void TestConfigWatcher::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigWatcher::init()
+{
+    m_tempDir = std::make_unique<QTemporaryDir>();
+    QVERIFY(m_tempDir->isValid());
+    QVERIFY(writeIncludeTree());
+}
+
+void TestConfigWatcher::cleanup()
+{
+    ConfigFileCache::instance()->setEnabled(false);
+    m_tempDir.reset();
+}
+
+// Test: include graph is recorded while reading the configuration ---------------------------------
+
+void TestConfigWatcher::testIncludeGraph()
+{
+    for (const bool parallelIncludes : { false, true })
+    {
+        ConfigIncludeGraph includeGraph;
+        QVERIFY(includeGraph.isEmpty());
+        QVERIFY(!ConfigIncludeGraph::isRecording());
+
+        ConfigReader configReader;
+        configReader.setParallelIncludesEnabled(parallelIncludes);
+        auto environmentVariables = EnvironmentVariables::loadFromProcess();
+        std::unique_ptr<ConfigObjectNode> config;
+
+        {
+            const ConfigIncludeGraph::RecordScope recordScope(&includeGraph);
+            QVERIFY(ConfigIncludeGraph::isRecording());
+
+            config = configReader.read("root.json",
+                                       QDir(m_tempDir->path()),
+                                       ConfigNodePath::ROOT_PATH,
+                                       ConfigNodePath::ROOT_PATH,
+                                       {},
+                                       &environmentVariables);
+        }
+
+        QVERIFY(!ConfigIncludeGraph::isRecording());
+        QVERIFY(config);
+        QCOMPARE(value(*config, "/left/common/value"), QJsonValue(1));
+        QCOMPARE(value(*config, "/right/value"), QJsonValue(3));
+
+        // Files
+        QCOMPARE(includeGraph.filePaths(), QStringList({ filePath("root.json"),
+                                                         filePath("left.json"),
+                                                         filePath("common.json"),
+                                                         filePath("right.json") }));
+
+        // Includes
+        const auto &includes = includeGraph.includes();
+        QCOMPARE(includes.size(), static_cast<size_t>(3));
+
+        QCOMPARE(includes.at(0).parentFilePath, filePath("root.json"));
+        QCOMPARE(includes.at(0).filePath, filePath("left.json"));
+        QCOMPARE(includes.at(0).type, QString("CppConfigFramework"));
+        QCOMPARE(includes.at(0).sourceNodePath.path(), QString("/"));
+        QCOMPARE(includes.at(0).destinationNodePath.path(), QString("/left"));
+
+        QCOMPARE(includes.at(1).parentFilePath, filePath("left.json"));
+        QCOMPARE(includes.at(1).filePath, filePath("common.json"));
+        QCOMPARE(includes.at(1).destinationNodePath.path(), QString("/common"));
+
+        QCOMPARE(includes.at(2).parentFilePath, filePath("root.json"));
+        QCOMPARE(includes.at(2).filePath, filePath("right.json"));
+        QCOMPARE(includes.at(2).sourceNodePath.path(), QString("/data"));
+        QCOMPARE(includes.at(2).destinationNodePath.path(), QString("/right"));
+
+        // Dependencies
+        QCOMPARE(includeGraph.dependentFilePaths(filePath("common.json")),
+                 QStringList({ filePath("common.json"),
+                               filePath("left.json"),
+                               filePath("root.json") }));
+        QCOMPARE(includeGraph.dependentFilePaths(filePath("root.json")),
+                 QStringList({ filePath("root.json") }));
+        QVERIFY(includeGraph.dependentFilePaths(filePath("unknown.json")).isEmpty());
+
+        includeGraph.clear();
+        QVERIFY(includeGraph.isEmpty());
+    }
+}
+
+// Test: starting the watcher reads the configuration and watches all of its files -----------------
+
+void TestConfigWatcher::testStart()
+{
+    ConfigWatcher watcher;
+    QVERIFY(!watcher.isActive());
+    QVERIFY(!watcher.config());
+    QVERIFY(!watcher.reload());
+
+    // Invalid file
+    QVERIFY(!watcher.start("missing.json",
+                           QDir(m_tempDir->path()),
+                           ConfigNodePath::ROOT_PATH,
+                           ConfigNodePath::ROOT_PATH,
+                           EnvironmentVariables::loadFromProcess()));
+    QVERIFY(!watcher.isActive());
+    QVERIFY(watcher.watchedPaths().isEmpty());
+
+    // Valid file
+    QVERIFY(watcher.start("root.json",
+                          QDir(m_tempDir->path()),
+                          ConfigNodePath::ROOT_PATH,
+                          ConfigNodePath::ROOT_PATH,
+                          EnvironmentVariables::loadFromProcess()));
+    QVERIFY(watcher.isActive());
+    QVERIFY(ConfigFileCache::instance()->isEnabled());
+
+    QVERIFY(watcher.config());
+    QCOMPARE(value(*watcher.config(), "/left/common/value"), QJsonValue(1));
+    QCOMPARE(watcher.includeGraph().filePaths().size(), 4);
+
+    const QStringList watchedPaths = watcher.watchedPaths();
+    QCOMPARE(watchedPaths.size(), 5);
+
+    for (const QString &path : watcher.includeGraph().filePaths())
+    {
+        QVERIFY(watchedPaths.contains(path));
+    }
+
+    QVERIFY(watchedPaths.contains(QFileInfo(filePath("root.json")).absolutePath()));
+
+    // Stop
+    watcher.stop();
+    QVERIFY(!watcher.isActive());
+    QVERIFY(watcher.watchedPaths().isEmpty());
+    QVERIFY(watcher.config());
+    QVERIFY(!ConfigFileCache::instance()->isEnabled());
+}
+
+// Test: only the changed include is read again on reload ------------------------------------------
+
+void TestConfigWatcher::testReloadChangedInclude()
+{
+    ConfigWatcher watcher;
+    watcher.setDebounceInterval(50);
+    QCOMPARE(watcher.debounceInterval(), 50);
+
+    QSignalSpy configChangedSpy(&watcher, &ConfigWatcher::configChanged);
+    QSignalSpy reloadFailedSpy(&watcher, &ConfigWatcher::reloadFailed);
+
+    QVERIFY(watcher.start("root.json",
+                          QDir(m_tempDir->path()),
+                          ConfigNodePath::ROOT_PATH,
+                          ConfigNodePath::ROOT_PATH,
+                          EnvironmentVariables::loadFromProcess()));
+    QCOMPARE(configChangedSpy.count(), 0);
+
+    // Change the included file
+    ConfigFileCache::instance()->resetStatistics();
+    QVERIFY(writeFile("common.json",
+                      QJsonObject { { "config", QJsonObject { { "value", 100 } } } }));
+
+    QTRY_COMPARE(configChangedSpy.count(), 1);
+    QCOMPARE(reloadFailedSpy.count(), 0);
+    QCOMPARE(value(*watcher.config(), "/left/common/value"), QJsonValue(100));
+    QCOMPARE(value(*watcher.config(), "/left/value"), QJsonValue(100));
+    QCOMPARE(value(*watcher.config(), "/right/value"), QJsonValue(3));
+
+    // Only the changed file was read and parsed again
+    const auto statistics = ConfigFileCache::instance()->statistics();
+    QCOMPARE(statistics.fileMisses, 1);
+    QCOMPARE(statistics.fileHits, 3);
+
+    // Add a new include to the root file
+    QVERIFY(writeFile("extra.json",
+                      QJsonObject { { "config", QJsonObject { { "value", 4 } } } }));
+    QVERIFY(writeFile("root.json", QJsonObject {
+                          {
+                              "includes", QJsonArray {
+                                  QJsonObject {
+                                      { "file_path", "left.json" },
+                                      { "destination_node", "/left" }
+                                  },
+                                  QJsonObject {
+                                      { "file_path", "extra.json" },
+                                      { "destination_node", "/extra" }
+                                  }
+                              }
+                          },
+                          { "config", QJsonObject {} }
+                      }));
+
+    QTRY_COMPARE(configChangedSpy.count(), 2);
+    QCOMPARE(value(*watcher.config(), "/extra/value"), QJsonValue(4));
+    QVERIFY(!watcher.config()->contains("right"));
+    QVERIFY(watcher.includeGraph().filePaths().contains(filePath("extra.json")));
+    QVERIFY(!watcher.includeGraph().filePaths().contains(filePath("right.json")));
+    QVERIFY(watcher.watchedPaths().contains(filePath("extra.json")));
+    QVERIFY(!watcher.watchedPaths().contains(filePath("right.json")));
+
+    // The removed include is not watched anymore
+    QVERIFY(writeFile("right.json",
+                      QJsonObject { { "config", QJsonObject { { "value", 300 } } } }));
+    QTest::qWait(200);
+    QCOMPARE(configChangedSpy.count(), 2);
+}
+
+// Test: a burst of changes results in a single reload ---------------------------------------------
+
+void TestConfigWatcher::testDebounce()
+{
+    ConfigWatcher watcher;
+    watcher.setDebounceInterval(300);
+
+    QSignalSpy configChangedSpy(&watcher, &ConfigWatcher::configChanged);
+
+    QVERIFY(watcher.start("root.json",
+                          QDir(m_tempDir->path()),
+                          ConfigNodePath::ROOT_PATH,
+                          ConfigNodePath::ROOT_PATH,
+                          EnvironmentVariables::loadFromProcess()));
+
+    for (int i = 10; i < 15; i++)
+    {
+        QVERIFY(writeFile("common.json",
+                          QJsonObject { { "config", QJsonObject { { "value", i } } } }));
+        QVERIFY(writeFile("right.json", QJsonObject {
+                              {
+                                  "config", QJsonObject {
+                                      { "data", QJsonObject { { "value", i } } }
+                                  }
+                              }
+                          }));
+        QTest::qWait(20);
+    }
+
+    QTRY_COMPARE(configChangedSpy.count(), 1);
+    QCOMPARE(value(*watcher.config(), "/left/common/value"), QJsonValue(14));
+    QCOMPARE(value(*watcher.config(), "/right/value"), QJsonValue(14));
+
+    QTest::qWait(500);
+    QCOMPARE(configChangedSpy.count(), 1);
+}
+
+// Test: failed reload keeps the previous configuration --------------------------------------------
+
+void TestConfigWatcher::testReloadFailed()
+{
+    ConfigWatcher watcher;
+    watcher.setDebounceInterval(50);
+
+    QSignalSpy configChangedSpy(&watcher, &ConfigWatcher::configChanged);
+    QSignalSpy reloadFailedSpy(&watcher, &ConfigWatcher::reloadFailed);
+
+    QVERIFY(watcher.start("root.json",
+                          QDir(m_tempDir->path()),
+                          ConfigNodePath::ROOT_PATH,
+                          ConfigNodePath::ROOT_PATH,
+                          EnvironmentVariables::loadFromProcess()));
+    const auto previousConfig = watcher.config();
+
+    // Invalid contents
+    QVERIFY(writeFileContents("common.json", "{ \"config\": "));
+
+    QTRY_COMPARE(reloadFailedSpy.count(), 1);
+    QCOMPARE(configChangedSpy.count(), 0);
+    QCOMPARE(watcher.config(), previousConfig);
+    QVERIFY(watcher.isActive());
+
+    // Fixed contents
+    QVERIFY(writeFile("common.json",
+                      QJsonObject { { "config", QJsonObject { { "value", 5 } } } }));
+
+    QTRY_COMPARE(configChangedSpy.count(), 1);
+    QCOMPARE(reloadFailedSpy.count(), 1);
+    QCOMPARE(value(*watcher.config(), "/left/common/value"), QJsonValue(5));
+}
+
+// Test: configChanged() is not emitted if the configuration did not change ------------------------
+
+void TestConfigWatcher::testUnchangedConfig()
+{
+    ConfigWatcher watcher;
+    watcher.setDebounceInterval(50);
+
+    QSignalSpy configChangedSpy(&watcher, &ConfigWatcher::configChanged);
+
+    QVERIFY(watcher.start("root.json",
+                          QDir(m_tempDir->path()),
+                          ConfigNodePath::ROOT_PATH,
+                          ConfigNodePath::ROOT_PATH,
+                          EnvironmentVariables::loadFromProcess()));
+
+    QVERIFY(watcher.reload());
+    QCOMPARE(configChangedSpy.count(), 0);
+
+    // Rewriting a file with a different formatting but the same values
+    QVERIFY(writeFileContents("common.json", "{\n    \"config\": { \"value\": 1 }\n}\n"));
+    QTest::qWait(300);
+    QCOMPARE(configChangedSpy.count(), 0);
+    QCOMPARE(value(*watcher.config(), "/left/common/value"), QJsonValue(1));
+}
+
+// Test: file cache is enabled only while the watchers are active ----------------------------------
+
+void TestConfigWatcher::testFileCacheState()
+{
+    const auto start = [this](ConfigWatcher *watcher)
+    {
+        return watcher->start("root.json",
+                              QDir(m_tempDir->path()),
+                              ConfigNodePath::ROOT_PATH,
+                              ConfigNodePath::ROOT_PATH,
+                              EnvironmentVariables::loadFromProcess());
+    };
+
+    // The cache stays enabled until the last watcher is stopped
+    QVERIFY(!ConfigFileCache::instance()->isEnabled());
+
+    {
+        ConfigWatcher watcher1;
+        ConfigWatcher watcher2;
+
+        QVERIFY(start(&watcher1));
+        QVERIFY(start(&watcher2));
+        QVERIFY(start(&watcher1));
+        QVERIFY(ConfigFileCache::instance()->isEnabled());
+
+        watcher1.stop();
+        QVERIFY(ConfigFileCache::instance()->isEnabled());
+    }
+
+    QVERIFY(!ConfigFileCache::instance()->isEnabled());
+
+    // A cache that was already enabled stays enabled
+    ConfigFileCache::instance()->setEnabled(true);
+
+    {
+        ConfigWatcher watcher;
+        QVERIFY(start(&watcher));
+        watcher.stop();
+    }
+
+    QVERIFY(ConfigFileCache::instance()->isEnabled());
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+bool TestConfigWatcher::writeFile(const QString &fileName, const QJsonObject &rootObject) const
+{
+    return writeFileContents(fileName, QJsonDocument(rootObject).toJson(QJsonDocument::Compact));
+}
+
+bool TestConfigWatcher::writeFileContents(const QString &fileName,
+                                          const QByteArray &contents) const
+{
+    QFile file(m_tempDir->filePath(fileName));
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    return (file.write(contents) == contents.size());
+}
+
+bool TestConfigWatcher::writeIncludeTree() const
+{
+    return writeFile("common.json",
+                     QJsonObject { { "config", QJsonObject { { "value", 1 } } } }) &&
+           writeFile("left.json", QJsonObject {
+                         {
+                             "includes", QJsonArray {
+                                 QJsonObject {
+                                     { "file_path", "common.json" },
+                                     { "destination_node", "/common" }
+                                 }
+                             }
+                         },
+                         { "config", QJsonObject { { "&value", "/common/value" } } }
+                     }) &&
+           writeFile("right.json", QJsonObject {
+                         { "config", QJsonObject { { "data", QJsonObject { { "value", 3 } } } } }
+                     }) &&
+           writeFile("root.json", QJsonObject {
+                         {
+                             "includes", QJsonArray {
+                                 QJsonObject {
+                                     { "file_path", "left.json" },
+                                     { "destination_node", "/left" }
+                                 },
+                                 QJsonObject {
+                                     { "file_path", "right.json" },
+                                     { "source_node", "/data" },
+                                     { "destination_node", "/right" }
+                                 }
+                             }
+                         },
+                         { "config", QJsonObject {} }
+                     });
+}
+
+QString TestConfigWatcher::filePath(const QString &fileName) const
+{
+    return QFileInfo(m_tempDir->filePath(fileName)).absoluteFilePath();
+}
+
+QJsonValue TestConfigWatcher::value(const ConfigObjectNode &config, const QString &nodePath) const
+{
+    const auto *node = config.nodeAtPath(nodePath);
+
+    if ((node == nullptr) || (!node->isValue()))
+    {
+        return {};
+    }
+
+    return node->toValue().value();
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigWatcher)
+#include "testConfigWatcher.moc"
@@ -26,6 +26,7 @@
 #include <CppConfigFramework/ConfigWriter.hpp>
 
 // Qt includes
+#include <QtCore/QBuffer>
 #include <QtCore/QDebug>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
@@ -61,7 +62,11 @@ private slots:
     // Test functions
     void testWriteToJsonConfig();
     void testWriteToJsonConfigFile();
+    void testWriteToJsonConfigDevice();
+    void testWriteToJsonConfigDevice_data();
+    void testWriteToJsonConfigDeviceValues();
     void testConvertToJsonValue();
+    void testConvertToJsonValueDevice();
 
 private:
     static ConfigObjectNode createConfig();
@@ -127,6 +132,78 @@ void TestConfigWriter::testWriteToJsonConfigFile()
     QCOMPARE(doc, createJson());
 }
 
+// Test: writeToJsonConfig() to a device -----------------------------------------------------------
+
+void TestConfigWriter::testWriteToJsonConfigDevice()
+{
+    QFETCH(QJsonDocument::JsonFormat, format);
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QVERIFY(ConfigWriter::writeToJsonConfig(createConfig(), &buffer, format));
+
+    QJsonParseError parseError {};
+    const auto doc = QJsonDocument::fromJson(buffer.data(), &parseError);
+    QCOMPARE(parseError.error, QJsonParseError::NoError);
+    QCOMPARE(doc, createJson());
+
+    if (format == QJsonDocument::Compact)
+    {
+        QVERIFY(!buffer.data().contains('\n'));
+        QVERIFY(buffer.data().startsWith("{\"config\":{\"#a\":1,"));
+    }
+    else
+    {
+        QVERIFY(buffer.data().startsWith("{\n    \"config\": {\n        \"#a\": 1,\n"));
+        QVERIFY(buffer.data().endsWith("}\n"));
+    }
+
+    // Device that is not open for writing
+    QBuffer closedBuffer;
+    QVERIFY(!ConfigWriter::writeToJsonConfig(createConfig(), &closedBuffer, format));
+    QVERIFY(!ConfigWriter::writeToJsonConfig(createConfig(), nullptr, format));
+}
+
+void TestConfigWriter::testWriteToJsonConfigDevice_data()
+{
+    QTest::addColumn<QJsonDocument::JsonFormat>("format");
+
+    QTest::newRow("Indented") << QJsonDocument::Indented;
+    QTest::newRow("Compact") << QJsonDocument::Compact;
+}
+
+// Test: writeToJsonConfig() to a device writes the same values as the JSON document ---------------
+
+void TestConfigWriter::testWriteToJsonConfigDeviceValues()
+{
+    const ConfigObjectNode config
+    {
+        { "null", ConfigValueNode(QJsonValue()) },
+        { "bool", ConfigValueNode(false) },
+        { "integer", ConfigValueNode(-1234567890123LL) },
+        { "double", ConfigValueNode(-0.1) },
+        { "large_double", ConfigValueNode(1.5e300) },
+        { "string", ConfigValueNode(QString::fromUtf8("q\"b\\s/n\nt\tc\x01 \xc3\xa9")) },
+        { "array", ConfigValueNode(QJsonArray { 1, 2.5, "str", QJsonArray(), QJsonObject() }) },
+        {
+            "object", ConfigValueNode(QJsonObject { { "a", 1 }, { "b\"", QJsonArray { true } } })
+        },
+        { "empty", ConfigObjectNode() }
+    };
+
+    for (const auto format : { QJsonDocument::Indented, QJsonDocument::Compact })
+    {
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QVERIFY(ConfigWriter::writeToJsonConfig(config, &buffer, format));
+
+        QJsonParseError parseError {};
+        const auto doc = QJsonDocument::fromJson(buffer.data(), &parseError);
+        QCOMPARE(parseError.error, QJsonParseError::NoError);
+        QCOMPARE(doc, ConfigWriter::writeToJsonConfig(config));
+    }
+}
+
 // Test: convertToJsonValue() -------------------------------------------------------------------
 
 void TestConfigWriter::testConvertToJsonValue()
@@ -208,6 +285,52 @@ void TestConfigWriter::testConvertToJsonValue()
     QCOMPARE(ConfigWriter::convertToJsonValue(node3), QJsonValue(QJsonValue::Undefined));
 }
 
+// Test: convertToJsonValue() to a device ----------------------------------------------------------
+
+void TestConfigWriter::testConvertToJsonValueDevice()
+{
+    // Positive tests
+    const ConfigObjectNode node1
+    {
+        { "a", ConfigValueNode(1) },
+        {
+            "b", ConfigObjectNode
+            {
+                { "c", ConfigValueNode(QJsonArray { 1, 2, 3 }) },
+                { "d", ConfigValueNode("str") }
+            }
+        }
+    };
+
+    for (const auto format : { QJsonDocument::Indented, QJsonDocument::Compact })
+    {
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QVERIFY(ConfigWriter::convertToJsonValue(node1, &buffer, format));
+
+        const auto doc = QJsonDocument::fromJson(buffer.data());
+        QVERIFY(doc.isObject());
+        QCOMPARE(QJsonValue(doc.object()), ConfigWriter::convertToJsonValue(node1));
+    }
+
+    // Negative tests (nothing is written)
+    const ConfigObjectNode node2
+    {
+        {
+            "a", ConfigObjectNode
+            {
+                { "ref", ConfigNodeReference(ConfigNodePath("/b")) }
+            }
+        },
+        { "b", ConfigValueNode(1) }
+    };
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QVERIFY(!ConfigWriter::convertToJsonValue(node2, &buffer));
+    QVERIFY(buffer.data().isEmpty());
+}
+
 // -------------------------------------------------------------------------------------------------
 
 ConfigObjectNode TestConfigWriter::createConfig()
@@ -52,11 +52,14 @@ private slots:
     // Test functions
     void testLoadFromProcess();
 
+    void testLayers();
     void testValue();
     void testValue_data();
 
     void testExpandText();
     void testExpandText_data();
+    void testExpandTextError();
+    void testExpandTextError_data();
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -116,6 +119,39 @@ void TestEnvironmentVariables::testLoadFromProcess()
     QVERIFY(!environmentVariables.contains("TEST_VAR2"));
 }
 
+// Test: local and system environment variable layers ----------------------------------------------
+
+void TestEnvironmentVariables::testLayers()
+{
+    qputenv("TEST_VAR3", "system");
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+
+    // Copies share the system environment variables, but not the local ones
+    auto copy = environmentVariables;
+    copy.setValue("TEST_VAR3", "local");
+    copy.setValue("TEST_VAR4", "local");
+
+    QCOMPARE(environmentVariables.value("TEST_VAR3"), QString("system"));
+    QVERIFY(!environmentVariables.contains("TEST_VAR4"));
+    QCOMPARE(copy.value("TEST_VAR3"), QString("local"));
+    QCOMPARE(copy.value("TEST_VAR4"), QString("local"));
+    QVERIFY(copy.names().contains("TEST_VAR4"));
+    QCOMPARE(copy.names().count("TEST_VAR3"), 1);
+
+    // Already read system environment variable is remembered (also for new copies)
+    qputenv("TEST_VAR3", "changed");
+    QCOMPARE(environmentVariables.value("TEST_VAR3"), QString("system"));
+
+    const auto snapshot = environmentVariables;
+    QCOMPARE(snapshot.value("TEST_VAR3"), QString("system"));
+
+    // Environment without the system environment variables
+    EnvironmentVariables localEnvironmentVariables;
+    QVERIFY(!localEnvironmentVariables.contains("TEST_VAR3"));
+    QVERIFY(localEnvironmentVariables.value("TEST_VAR3").isEmpty());
+    QVERIFY(localEnvironmentVariables.names().isEmpty());
+}
+
 // Test: value methods -----------------------------------------------------------------------------
 
 void TestEnvironmentVariables::testValue()
@@ -157,7 +193,11 @@ void TestEnvironmentVariables::testExpandText()
     environmentVariables.setValue("TEST_LOOP1", "${TEST_LOOP2}");
     environmentVariables.setValue("TEST_LOOP2", "${TEST_LOOP1}");
 
+    environmentVariables.setValue("NUMBER", "1");
+    environmentVariables.setValue("EMPTY", "");
+
     QCOMPARE(environmentVariables.expandText(text), expected);
+    QCOMPARE(environmentVariables.expandText(text).isNull(), expected.isNull());
 }
 
 void TestEnvironmentVariables::testExpandText_data()
@@ -170,6 +210,55 @@ void TestEnvironmentVariables::testExpandText_data()
     QTest::newRow("var double ref") << "test3 ${TEST2}" << "test3 value";
     QTest::newRow("loop") << "${TEST_LOOP1}" << QString();
     QTest::newRow("non-existent var") << "${TEST_VAR_DOES_NOT_EXIST}" << QString();
+    QTest::newRow("multiple refs") << "${TEST1}/${TEST2}-${TEST1}" << "value/value-value";
+    QTest::newRow("nested name") << "${TEST${NUMBER}}" << "value";
+    QTest::newRow("not a ref") << "$TEST1 ${} ${TEST-1} ${TEST1" << "$TEST1 ${} ${TEST-1} ${TEST1";
+    QTest::newRow("dollar before ref") << "$${TEST1}}" << "$value}";
+    QTest::newRow("empty value") << "a${EMPTY}b" << "ab";
+}
+
+// Test: expandText() method with error information ------------------------------------------------
+
+void TestEnvironmentVariables::testExpandTextError()
+{
+    QFETCH(QString, text);
+    QFETCH(int, expectedErrorType);
+    QFETCH(QString, expectedVariableName);
+
+    EnvironmentVariables environmentVariables;
+    environmentVariables.setValue("TEST1", "value");
+    environmentVariables.setValue("TEST2", "${TEST1} ${TEST_UNDEFINED}");
+    environmentVariables.setValue("TEST_LOOP1", "${TEST_LOOP2}");
+    environmentVariables.setValue("TEST_LOOP2", "a${TEST_LOOP3}");
+    environmentVariables.setValue("TEST_LOOP3", "${TEST1}${TEST_LOOP1}");
+
+    EnvironmentVariables::ExpansionError error;
+    error.type = EnvironmentVariables::ExpansionError::Type::CyclicReference;
+
+    const QString expandedText = environmentVariables.expandText(text, &error);
+    QCOMPARE(static_cast<int>(error.type), expectedErrorType);
+    QCOMPARE(error.variableName, expectedVariableName);
+    QCOMPARE(expandedText.isNull(),
+             (error.type != EnvironmentVariables::ExpansionError::Type::None));
+    QVERIFY(!error.toString().isEmpty());
+}
+
+void TestEnvironmentVariables::testExpandTextError_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<int>("expectedErrorType");
+    QTest::addColumn<QString>("expectedVariableName");
+
+    const int none = static_cast<int>(EnvironmentVariables::ExpansionError::Type::None);
+    const int undefined =
+            static_cast<int>(EnvironmentVariables::ExpansionError::Type::UndefinedVariable);
+    const int cyclic =
+            static_cast<int>(EnvironmentVariables::ExpansionError::Type::CyclicReference);
+
+    QTest::newRow("no error") << "${TEST1}" << none << QString();
+    QTest::newRow("undefined") << "${TEST1} ${TEST_UNDEFINED}" << undefined << "TEST_UNDEFINED";
+    QTest::newRow("undefined nested") << "a ${TEST2}" << undefined << "TEST_UNDEFINED";
+    QTest::newRow("cyclic") << "${TEST_LOOP2}" << cyclic << "TEST_LOOP2";
 }
 
 // Main function -----------------------------------------------------------------------------------